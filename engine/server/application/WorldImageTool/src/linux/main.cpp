@@ -0,0 +1,10 @@
+#include "FirstWorldImageTool.h"
+
+#include "WorldImageTool.h"
+
+// ======================================================================
+
+int main(int argc, char ** argv)
+{
+	return WorldImageTool::run(argc, argv);
+}
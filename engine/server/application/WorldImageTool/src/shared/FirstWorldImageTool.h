@@ -0,0 +1,15 @@
+// FirstWorldImageTool.h
+// Copyright 2000-01, Sony Online Entertainment Inc., all rights reserved. 
+
+#ifndef	_INCLUDED_FirstWorldImageTool_H
+#define	_INCLUDED_FirstWorldImageTool_H
+
+//-----------------------------------------------------------------------
+
+#include "sharedFoundationTypes/FoundationTypes.h"
+#include <string>
+#include <vector>
+
+//-----------------------------------------------------------------------
+
+#endif	// _INCLUDED_FirstWorldImageTool_H
@@ -0,0 +1,207 @@
+// ======================================================================
+//
+// WorldImageTool.cpp
+//
+// Copyright 2000-01, Sony Online Entertainment Inc., all rights reserved. 
+//
+// ======================================================================
+
+#include "FirstWorldImageTool.h"
+#include "WorldImageTool.h"
+
+#include "serverDatabase/WorldImageFormat.h"
+
+#include <cstdio>
+#include <cstring>
+
+// ======================================================================
+
+namespace WorldImageToolNamespace
+{
+	WorldImageFormat::Header const * getHeader(const std::vector<unsigned char> &image);
+	WorldImageFormat::Entry const *  getEntries(const std::vector<unsigned char> &image);
+	bool                             checkHeader(const std::vector<unsigned char> &image);
+}
+
+using namespace WorldImageToolNamespace;
+using namespace WorldImageFormat;
+
+// ======================================================================
+
+Header const * WorldImageToolNamespace::getHeader(const std::vector<unsigned char> &image)
+{
+	return reinterpret_cast<Header const *>(&image[0]);
+}
+
+// ----------------------------------------------------------------------
+
+Entry const * WorldImageToolNamespace::getEntries(const std::vector<unsigned char> &image)
+{
+	return reinterpret_cast<Entry const *>(&image[0] + getHeader(image)->m_indexOffset);
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * The same checks WorldImage makes before it maps an image.
+ */
+bool WorldImageToolNamespace::checkHeader(const std::vector<unsigned char> &image)
+{
+	Header const * const header = getHeader(image);
+	if (header->m_magic != cs_magic)
+	{
+		printf("not a world image\n");
+		return false;
+	}
+	if (header->m_version != cs_version)
+	{
+		printf("unsupported version %lu, expected %lu\n", header->m_version, cs_version);
+		return false;
+	}
+	if (header->m_indexOffset < sizeof(Header) || header->m_indexOffset > image.size() || (image.size() - header->m_indexOffset) / sizeof(Entry) < header->m_entryCount)
+	{
+		printf("corrupt index (offset %lu, %lu entries, %u bytes)\n", header->m_indexOffset, header->m_entryCount, static_cast<unsigned int>(image.size()));
+		return false;
+	}
+	return true;
+}
+
+// ======================================================================
+
+int WorldImageTool::run(int argc, char ** argv)
+{
+	if (argc != 3)
+	{
+		usage();
+		return 2;
+	}
+
+	std::string const command(argv[1]);
+	std::vector<unsigned char> image;
+	if (!load(argv[2], image))
+		return 1;
+
+	if (command == "info")
+		return info(image);
+	if (command == "list")
+		return list(image);
+	if (command == "verify")
+		return verify(image);
+
+	usage();
+	return 2;
+}
+
+// ----------------------------------------------------------------------
+
+void WorldImageTool::usage()
+{
+	printf("usage: WorldImageTool info|list|verify <image>\n");
+}
+
+// ----------------------------------------------------------------------
+
+bool WorldImageTool::load(const std::string &fileName, std::vector<unsigned char> &image)
+{
+	FILE * const f = fopen(fileName.c_str(), "rb");
+	if (!f)
+	{
+		printf("could not open %s\n", fileName.c_str());
+		return false;
+	}
+
+	static_cast<void>(fseek(f, 0, SEEK_END));
+	long const fileSize = ftell(f);
+	static_cast<void>(fseek(f, 0, SEEK_SET));
+
+	image.resize(static_cast<size_t>(fileSize > 0 ? fileSize : 0));
+	bool const ok = fileSize >= static_cast<long>(sizeof(Header)) && fread(&image[0], 1, image.size(), f) == image.size();
+	fclose(f);
+
+	if (!ok)
+		printf("%s is truncated\n", fileName.c_str());
+	return ok && checkHeader(image);
+}
+
+// ----------------------------------------------------------------------
+
+int WorldImageTool::info(const std::vector<unsigned char> &image)
+{
+	Header const * const header = getHeader(image);
+	printf("version       %lu\n", header->m_version);
+	printf("clock stamp   %ld\n", header->m_clockStamp);
+	printf("chunks        %lu\n", header->m_entryCount);
+	printf("message bytes %lu\n", header->m_indexOffset - static_cast<uint32>(sizeof(Header)));
+	printf("file bytes    %u\n", static_cast<unsigned int>(image.size()));
+	return 0;
+}
+
+// ----------------------------------------------------------------------
+
+int WorldImageTool::list(const std::vector<unsigned char> &image)
+{
+	Header const * const header = getHeader(image);
+	Entry const * const entries = getEntries(image);
+
+	printf("%-10s %8s %8s %10s %10s %8s\n", "scene crc", "x", "z", "offset", "bytes", "messages");
+	for (uint32 i = 0; i < header->m_entryCount; ++i)
+		printf("0x%08lx %8ld %8ld %10lu %10lu %8lu\n", entries[i].m_sceneCrc, entries[i].m_nodeX, entries[i].m_nodeZ, entries[i].m_offset, entries[i].m_length, entries[i].m_messageCount);
+	return 0;
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Check the index is sorted without duplicates, every entry lies inside
+ * the message data, and each entry's messages exactly fill it.
+ */
+int WorldImageTool::verify(const std::vector<unsigned char> &image)
+{
+	Header const * const header = getHeader(image);
+	Entry const * const entries = getEntries(image);
+
+	int errors = 0;
+	uint32 messages = 0;
+	for (uint32 i = 0; i < header->m_entryCount; ++i)
+	{
+		Entry const &entry = entries[i];
+		if (i > 0 && !(entries[i - 1] < entry))
+		{
+			printf("entry %lu (0x%08lx %ld %ld) is out of order\n", i, entry.m_sceneCrc, entry.m_nodeX, entry.m_nodeZ);
+			++errors;
+		}
+
+		if (entry.m_offset < sizeof(Header) || entry.m_offset > header->m_indexOffset || entry.m_length > header->m_indexOffset - entry.m_offset)
+		{
+			printf("entry %lu (0x%08lx %ld %ld) lies outside the message data\n", i, entry.m_sceneCrc, entry.m_nodeX, entry.m_nodeZ);
+			++errors;
+			continue;
+		}
+
+		unsigned char const * data = &image[0] + entry.m_offset;
+		unsigned char const * const dataEnd = data + entry.m_length;
+		uint32 count = 0;
+		while (count < entry.m_messageCount && static_cast<size_t>(dataEnd - data) >= sizeof(uint32))
+		{
+			uint32 size;
+			memcpy(&size, data, sizeof(size));
+			data += sizeof(size);
+			if (static_cast<uint32>(dataEnd - data) < size)
+				break;
+			data += size;
+			++count;
+		}
+
+		if (count != entry.m_messageCount || data != dataEnd)
+		{
+			printf("entry %lu (0x%08lx %ld %ld) holds %lu of %lu messages, %d bytes left over\n", i, entry.m_sceneCrc, entry.m_nodeX, entry.m_nodeZ, count, entry.m_messageCount, static_cast<int>(dataEnd - data));
+			++errors;
+		}
+		messages += count;
+	}
+
+	printf("%lu chunks, %lu messages, %d errors\n", header->m_entryCount, messages, errors);
+	return errors == 0 ? 0 : 1;
+}
+
+// ======================================================================
@@ -0,0 +1,41 @@
+// ======================================================================
+//
+// WorldImageTool.h
+//
+// Copyright 2000-01, Sony Online Entertainment Inc., all rights reserved. 
+//
+// ======================================================================
+
+#ifndef INCLUDED_WorldImageTool_H
+#define INCLUDED_WorldImageTool_H
+
+// ======================================================================
+
+/**
+ * Offline inspection of world images written by the database server
+ * (see WorldImage), so an image can be checked before a cluster is
+ * pointed at it with worldImageFile:
+ *
+ *   WorldImageTool info   <image>   header, database clock stamp, sizes
+ *   WorldImageTool list   <image>   one line per chunk
+ *   WorldImageTool verify <image>   full index and message framing check
+ *
+ * The clock stamp printed by info must match the database's clock for
+ * the image to be served.
+ */
+class WorldImageTool
+{
+  public:
+	static int run(int argc, char ** argv);
+
+  private:
+	static bool load   (const std::string &fileName, std::vector<unsigned char> &image);
+	static int  info   (const std::vector<unsigned char> &image);
+	static int  list   (const std::vector<unsigned char> &image);
+	static int  verify (const std::vector<unsigned char> &image);
+	static void usage  ();
+};
+
+// ======================================================================
+
+#endif
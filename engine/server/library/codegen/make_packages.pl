@@ -491,6 +491,11 @@ sub editDecoder
 	    &makeDecodeSwitcher("client");
 	    &makeDecodeSwitcher("parentClient");
 
+	    &makeLatestValueSwitcher("server");
+	    &makeLatestValueSwitcher("shared");
+	    &makeLatestValueSwitcher("client");
+	    &makeLatestValueSwitcher("parentClient");
+
 	    while (!/!!!END GENERATED DECODER/)
 	    {
 		#eat old generated code
@@ -660,6 +665,84 @@ sub makeDecodeSwitcher
 
 # ----------------------------------------------------------------------
 
+# Returns "true" or "false" for each index of the package, parent classes first.
+# A field is a latest value field if it is decoded by simple assignment
+# (no load function), so a later delta for it replaces an earlier one.
+
+sub latestValueFlags
+{
+    my ($classname,$package)=@_;
+    my (@flags,$member,$loadFunction);
+
+    @flags=&latestValueFlags($parent{$classname},$package) if ($parent{$classname} ne "");
+    foreach $member (@{ $packageMembers{"$classname.$package"} })
+    {
+	$loadFunction=${ $member }[4];
+	push(@flags, ($loadFunction eq "") ? "true" : "false");
+    }
+    return @flags;
+}
+
+# ----------------------------------------------------------------------
+
+sub makeLatestValueSwitcher
+{
+    my($package)=@_;
+    my($classname,$templatetag,@flags,@classes);
+
+    print OUTFILE "bool SwgSnapshot::isLatestValue\u${package}Data(Tag typeId, uint16 index)\n";
+    print OUTFILE "{\n";
+    print OUTFILE "\tswitch(typeId)\n";
+    print OUTFILE "\t{\n";
+
+    if ($package eq "parentClient")
+    {
+	@classes=("PlayerObject");
+    }
+    else
+    {
+	@classes=sort (keys (%parent));
+    }
+
+    foreach $classname (@classes)
+    {
+	if ($classname eq "ServerObject")
+	{
+	    $templatetag="ServerObjectTemplate::ServerObjectTemplate_tag";
+	}
+	elsif(!($classname =~ /Object$/))
+	{
+	    $templatetag="Server${classname}ObjectTemplate::Server${classname}ObjectTemplate_tag";
+	}
+	else
+	{
+	    $templatetag="Server${classname}Template::Server${classname}Template_tag";
+	}
+
+	@flags=&latestValueFlags($classname,$package);
+
+	print OUTFILE "\t\tcase ${templatetag}:\n";
+	print OUTFILE "\t\t{\n";
+	if (scalar(@flags) > 0)
+	{
+	    print OUTFILE "\t\t\tstatic bool const latestValue[] = {".join(", ",@flags)."};\n";
+	    print OUTFILE "\t\t\treturn index < sizeof(latestValue) / sizeof(latestValue[0]) && latestValue[index];\n";
+	}
+	else
+	{
+	    print OUTFILE "\t\t\treturn false;\n";
+	}
+	print OUTFILE "\t\t}\n";
+    }
+
+    print OUTFILE "\t}\n";
+    print OUTFILE "\treturn false;\n";
+    print OUTFILE "}\n";
+    print OUTFILE "\n";
+}
+
+# ----------------------------------------------------------------------
+
 sub makeRegisterTags
 {
     my($classname,$parent,$templatetag,$buffer);
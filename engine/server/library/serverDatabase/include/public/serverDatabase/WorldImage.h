@@ -0,0 +1 @@
+#include "../../src/shared/WorldImage.h"
@@ -0,0 +1 @@
+#include "../../src/shared/WorldImageFormat.h"
@@ -30,6 +30,10 @@ class ChunkLocator : public ObjectLocator
 	virtual bool locateObjects(DB::Session *session, const std::string &schema, int &objectsLocated);
 	virtual void sendPostBaselinesCustomData(GameServerConnection &conn) const;
 
+	int getNodeX() const;
+	int getNodeZ() const;
+	const std::string &getSceneId() const;
+
   private:
 	int m_nodeX;
 	int m_nodeZ;
@@ -44,6 +48,27 @@ class ChunkLocator : public ObjectLocator
 	ChunkLocator(const ChunkLocator&); //disable
 };
 
+// ----------------------------------------------------------------------
+
+inline int ChunkLocator::getNodeX() const
+{
+	return m_nodeX;
+}
+
+// ----------------------------------------------------------------------
+
+inline int ChunkLocator::getNodeZ() const
+{
+	return m_nodeZ;
+}
+
+// ----------------------------------------------------------------------
+
+inline const std::string &ChunkLocator::getSceneId() const
+{
+	return *m_sceneId;
+}
+
 // ======================================================================
 
 #endif
@@ -90,6 +90,7 @@ void ConfigServerDatabase::install(void)
 	KEY_BOOL    (enableObjvarPacking, true);
 	KEY_INT     (prefetchNumRows,0);
 	KEY_INT     (prefetchMemory,0);
+	KEY_INT     (statementCacheSize,100); // parsed statements kept per session, 0 to disable
 	KEY_INT     (defaultFetchBatchSize,1000);
 	KEY_INT     (queryReportingRate,60);
 	KEY_INT     (enableDatabaseErrorLogging, 0);
@@ -99,7 +100,12 @@ void ConfigServerDatabase::install(void)
 	KEY_FLOAT   (defaultQueueUpdateTimeLimit, 0.25f);
 	KEY_BOOL    (enableDataCleanup, false);
 	KEY_INT     (defaultLazyDeleteBulkBindSize, 100);
-	KEY_INT     (defaultLazyDeleteSleepTime, 1000);
+	KEY_INT     (defaultLazyDeleteSleepTime, 1000);  // pause after a purge that ran longer than lazyDeleteTargetBatchTime
+	KEY_INT     (lazyDeleteThreads, 2);               // worker threads (and database sessions) purging objects
+	KEY_INT     (lazyDeleteMaxQueuedObjects, 100000); // objects kept in memory, the rest go to lazyDeleteSpillFile
+	KEY_STRING  (lazyDeleteSpillFile, "lazyDeleteQueue.dat"); // empty to keep every pending delete in memory
+	KEY_INT     (lazyDeleteTargetBatchTime, 500);     // ms, purge batches are sized to take about this long
+	KEY_INT     (lazyDeleteMaxBatchSize, 1000);
 	KEY_INT     (writeDelay, 0);
 	KEY_BOOL    (delayUnloadIfObjectStillHasData, true);
 	KEY_FLOAT   (experienceConsolidationTime, 0.0f);
@@ -116,6 +122,9 @@ void ConfigServerDatabase::install(void)
 	KEY_INT     (auctionAttributeLoadBatchSize, 100);
 	KEY_INT     (auctionBidLoadBatchSize, 100);
 	KEY_INT     (oldestUnackedLoadAlertThresholdSeconds, 10*60); // seconds
+	KEY_STRING  (worldImageFile, "");        // serve chunk loads from this world image instead of the database
+	KEY_STRING  (worldImageExportFile, "");  // record chunk loads into this world image as they are sent
+	KEY_BOOL    (enableDeltaCoalescing, true); // keep only the latest value of each field between saves, decode it at save time
 }
 
 //-------------------------------------------------------------------
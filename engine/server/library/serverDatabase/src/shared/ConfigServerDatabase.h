@@ -80,6 +80,7 @@ public:
 		bool            enableObjvarPacking;
 		int             prefetchNumRows;
 		int             prefetchMemory;
+		int             statementCacheSize;
 		int             defaultFetchBatchSize;
 		int             queryReportingRate;
 		int             enableDatabaseErrorLogging;
@@ -106,6 +107,14 @@ public:
 		int             auctionAttributeLoadBatchSize;
 		int             auctionBidLoadBatchSize;
 		int             oldestUnackedLoadAlertThresholdSeconds;
+		const char*     worldImageFile;
+		const char*     worldImageExportFile;
+		bool            enableDeltaCoalescing;
+		int             lazyDeleteThreads;
+		int             lazyDeleteMaxQueuedObjects;
+		const char*     lazyDeleteSpillFile;
+		int             lazyDeleteTargetBatchTime;
+		int             lazyDeleteMaxBatchSize;
 	};
 
 private:
@@ -173,6 +182,7 @@ public:
 	static const bool    getEnableObjvarPacking      (void);
 	static const int     getPrefetchNumRows          (void);
 	static const int     getPrefetchMemory           (void);
+	static const int     getStatementCacheSize       (void);
 	static const int     getDefaultFetchBatchSize    (void);
 	static const int     getQueryReportingRate       (void);
 	static const int     getEnableDatabaseErrorLogging (void);
@@ -183,6 +193,11 @@ public:
 	static const bool    getEnableDataCleanup(void);
 	static const int     getDefaultLazyDeleteBulkBindSize (void);
 	static const int     getDefaultLazyDeleteSleepTime (void);
+	static const int     getLazyDeleteThreads        (void);
+	static const int     getLazyDeleteMaxQueuedObjects (void);
+	static const char *  getLazyDeleteSpillFile      (void);
+	static const int     getLazyDeleteTargetBatchTime (void);
+	static const int     getLazyDeleteMaxBatchSize   (void);
 	static const int     getWriteDelay               (void);
 	static const bool    getDelayUnloadIfObjectStillHasData(void);
 	static const float   getExperienceConsolidationTime (void);
@@ -199,6 +214,9 @@ public:
 	static const int     getAuctionAttributeLoadBatchSize(void);
 	static const int     getAuctionBidLoadBatchSize(void);
 	static const int     getOldestUnackedLoadAlertThresholdSeconds(void);
+	static const char *  getWorldImageFile           (void);
+	static const char *  getWorldImageExportFile     (void);
+	static const bool    getEnableDeltaCoalescing    (void);
 };
 
 //-----------------------------------------------------------------------
@@ -593,6 +611,13 @@ inline const int ConfigServerDatabase::getPrefetchMemory(void)
 
 // ----------------------------------------------------------------------
 
+inline const int ConfigServerDatabase::getStatementCacheSize(void)
+{
+	return data->statementCacheSize;
+}
+
+// ----------------------------------------------------------------------
+
 inline const int ConfigServerDatabase::getDefaultFetchBatchSize(void)
 {
 	return data->defaultFetchBatchSize;
@@ -657,6 +682,41 @@ inline const int ConfigServerDatabase::getDefaultLazyDeleteSleepTime(void)
 
 // ----------------------------------------------------------------------
 
+inline const int ConfigServerDatabase::getLazyDeleteThreads(void)
+{
+	return data->lazyDeleteThreads;
+}
+
+// ----------------------------------------------------------------------
+
+inline const int ConfigServerDatabase::getLazyDeleteMaxQueuedObjects(void)
+{
+	return data->lazyDeleteMaxQueuedObjects;
+}
+
+// ----------------------------------------------------------------------
+
+inline const char * ConfigServerDatabase::getLazyDeleteSpillFile(void)
+{
+	return data->lazyDeleteSpillFile;
+}
+
+// ----------------------------------------------------------------------
+
+inline const int ConfigServerDatabase::getLazyDeleteTargetBatchTime(void)
+{
+	return data->lazyDeleteTargetBatchTime;
+}
+
+// ----------------------------------------------------------------------
+
+inline const int ConfigServerDatabase::getLazyDeleteMaxBatchSize(void)
+{
+	return data->lazyDeleteMaxBatchSize;
+}
+
+// ----------------------------------------------------------------------
+
 inline const int ConfigServerDatabase::getWriteDelay(void)
 {
 	return data->writeDelay;
@@ -767,6 +827,27 @@ inline const int ConfigServerDatabase::getOldestUnackedLoadAlertThresholdSeconds
 	return data->oldestUnackedLoadAlertThresholdSeconds;
 }
 
+// ----------------------------------------------------------------------
+
+inline const char * ConfigServerDatabase::getWorldImageFile(void)
+{
+	return data->worldImageFile;
+}
+
+// ----------------------------------------------------------------------
+
+inline const char * ConfigServerDatabase::getWorldImageExportFile(void)
+{
+	return data->worldImageExportFile;
+}
+
+// ----------------------------------------------------------------------
+
+inline const bool ConfigServerDatabase::getEnableDeltaCoalescing(void)
+{
+	return data->enableDeltaCoalescing;
+}
+
 // ======================================================================
 
 #endif
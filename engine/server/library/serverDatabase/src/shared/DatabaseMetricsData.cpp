@@ -32,11 +32,19 @@ m_timeSinceLastSaveStarted(0),
 m_lastSaveTime(0),
 m_lastSaveTotalObjectCount(0),
 m_lastSaveNewObjectCount(0),
+m_lastSaveDeltaCount(0),
+m_lastSaveCoalescedDeltaCount(0),
 m_lazyDeleteQueueSize(0),
 m_lazyDeleteTotalCount(0),
 m_lazyDeletesPerMinute(0),
+m_lazyDeletesCompleted(0),
+m_lazyDeletesCompletedPerMinute(0),
+m_lazyDeleteSpilledCount(0),
+m_lazyDeleteBatchSize(0),
 m_queryRate(0),
 m_fetchRate(0),
+m_roundTripRate(0),
+m_statementCacheHitRate(0),
 m_snapshotCreationCount(0),
 m_snapshotDeletionCount(0),
 m_snapshotPendingCount(0),
@@ -45,7 +53,11 @@ m_snapshotRowDeletionCount(0),
 m_snapshotRowPendingCount(0),
 m_taskQueueTotalNumRequests(0),
 m_taskQueueTotalNumResults(0),
-m_cmLoadTime(0)
+m_cmLoadTime(0),
+m_loaderGroupsSent(0),
+m_loaderQueueWaitTime(0),
+m_loaderLoadTime(0),
+m_loaderSendTime(0)
 {
 	MetricsPair p;
 
@@ -57,11 +69,20 @@ m_cmLoadTime(0)
 	ADD_METRICS_DATA(lastSaveTime, 0, true);
 	ADD_METRICS_DATA(lastSaveTotalObjectCount, 0, true);
 	ADD_METRICS_DATA(lastSaveNewObjectCount, 0, true);
+	ADD_METRICS_DATA(lastSaveDeltaCount, 0, true);
+	ADD_METRICS_DATA(lastSaveCoalescedDeltaCount, 0, true);
 	ADD_METRICS_DATA(lazyDeleteQueueSize, 0, true);
 	ADD_METRICS_DATA(lazyDeleteTotalCount, 0, true);
 	ADD_METRICS_DATA(lazyDeletesPerMinute, 0, true);
+	ADD_METRICS_DATA(lazyDeletesCompleted, 0, true);
+	ADD_METRICS_DATA(lazyDeletesCompletedPerMinute, 0, true);
+	ADD_METRICS_DATA(lazyDeleteSpilledCount, 0, true);
+	ADD_METRICS_DATA(lazyDeleteBatchSize, 0, false);
 	ADD_METRICS_DATA(queryRate, 0, true);
 	ADD_METRICS_DATA(fetchRate, 0, true);
+	ADD_METRICS_DATA(roundTripRate, 0, true);
+	ADD_METRICS_DATA(statementCacheHitRate, 0, true);
+	m_data[m_statementCacheHitRate].m_description = "percent";
 
 	// snapshot data
 	ADD_METRICS_DATA(snapshotCreationCount, 0, true);
@@ -79,6 +100,15 @@ m_cmLoadTime(0)
 	// commodities data
 	ADD_METRICS_DATA(cmLoadTime, 0, true);
 	m_data[m_cmLoadTime].m_description = "minutes";
+
+	// loader pipeline stages
+	ADD_METRICS_DATA(loaderGroupsSent, 0, true);
+	ADD_METRICS_DATA(loaderQueueWaitTime, 0, true);
+	ADD_METRICS_DATA(loaderLoadTime, 0, true);
+	ADD_METRICS_DATA(loaderSendTime, 0, true);
+	m_data[m_loaderQueueWaitTime].m_description = "average ms per group";
+	m_data[m_loaderLoadTime].m_description = "average ms per group";
+	m_data[m_loaderSendTime].m_description = "average ms per group";
 }
 
 //-----------------------------------------------------------------------
@@ -123,11 +153,19 @@ void DatabaseMetricsData::updateData()
 	m_data[m_lastSaveTime].m_value = Persister::getInstance().getLastSaveTime() / 1000;
 	m_data[m_lastSaveTotalObjectCount].m_value = Persister::getInstance().getLastSaveTotalObjectCount();
 	m_data[m_lastSaveNewObjectCount].m_value = Persister::getInstance().getLastSaveNewObjectCount();
+	m_data[m_lastSaveDeltaCount].m_value = Persister::getInstance().getLastSaveDeltaCount();
+	m_data[m_lastSaveCoalescedDeltaCount].m_value = Persister::getInstance().getLastSaveCoalescedDeltaCount();
 	m_data[m_lazyDeleteQueueSize].m_value = static_cast<int>(LazyDeleter::getInstance().getQueueSize());
 	m_data[m_lazyDeleteTotalCount].m_value = LazyDeleter::getInstance().getTotalObjectCount();
 	m_data[m_lazyDeletesPerMinute].m_value = static_cast<int>(Clock::getSecondsSinceStart() > 60 ? LazyDeleter::getInstance().getTotalObjectCount() / (Clock::getSecondsSinceStart() / 60) : 0); //lint !e573 !e737 // signed/unsigned int precision
+	m_data[m_lazyDeletesCompleted].m_value = LazyDeleter::getInstance().getCompletedObjectCount();
+	m_data[m_lazyDeletesCompletedPerMinute].m_value = LazyDeleter::getInstance().getCompletedObjectsPerMinute();
+	m_data[m_lazyDeleteSpilledCount].m_value = LazyDeleter::getInstance().getSpilledObjectCount();
+	m_data[m_lazyDeleteBatchSize].m_value = LazyDeleter::getInstance().getBatchSize();
 	m_data[m_queryRate].m_value = static_cast<int>(DatabaseProcess::getInstance().getQueryExecRate());
 	m_data[m_fetchRate].m_value = static_cast<int>(DatabaseProcess::getInstance().getQueryFetchRate());
+	m_data[m_roundTripRate].m_value = static_cast<int>(DatabaseProcess::getInstance().getRoundTripRate());
+	m_data[m_statementCacheHitRate].m_value = DatabaseProcess::getInstance().getStatementCacheHitPercent();
 
 	m_data[m_lastSaveTime].m_description = std::string("Completed at ")+Persister::getInstance().getLastSaveCompletionTime();
 
@@ -145,6 +183,7 @@ void DatabaseMetricsData::updateData()
 	}
 	m_data[m_queryRate].m_description = rateDescription;
 	m_data[m_fetchRate].m_description = rateDescription;
+	m_data[m_roundTripRate].m_description = rateDescription;
 	m_data[m_loadQueueTasks].m_description = ConfigServerDatabase::getDSN();
 
 	m_data[m_snapshotCreationCount].m_value = Snapshot::getCreationCount();
@@ -161,6 +200,23 @@ void DatabaseMetricsData::updateData()
 	m_data[m_taskQueueTotalNumResults].m_value = DB::TaskQueue::getTotalNumResults();
 
 	m_data[m_cmLoadTime].m_value = CMLoader::getInstance().getLoadTime();
+
+	Loader::LoadStageStatistics const & loadStages = Loader::getInstance().getLastLoadStageStatistics();
+	m_data[m_loaderGroupsSent].m_value = loadStages.groupCount;
+	if (loadStages.groupCount > 0)
+	{
+		unsigned long const groupCount = static_cast<unsigned long>(loadStages.groupCount);
+		m_data[m_loaderQueueWaitTime].m_value = static_cast<int>(loadStages.queueWaitTimeMs / groupCount);
+		m_data[m_loaderLoadTime].m_value = static_cast<int>(loadStages.loadTimeMs / groupCount);
+		m_data[m_loaderSendTime].m_value = static_cast<int>(loadStages.sendTimeMs / groupCount);
+	}
+	else
+	{
+		m_data[m_loaderQueueWaitTime].m_value = 0;
+		m_data[m_loaderLoadTime].m_value = 0;
+		m_data[m_loaderSendTime].m_value = 0;
+	}
+	m_data[m_loaderGroupsSent].m_description = "per 5 seconds";
 }
 
 //-----------------------------------------------------------------------
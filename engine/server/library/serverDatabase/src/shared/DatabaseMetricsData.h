@@ -28,11 +28,19 @@ private:
 	unsigned long m_lastSaveTime;
 	unsigned long m_lastSaveTotalObjectCount;
 	unsigned long m_lastSaveNewObjectCount;
+	unsigned long m_lastSaveDeltaCount;
+	unsigned long m_lastSaveCoalescedDeltaCount;
 	unsigned long m_lazyDeleteQueueSize;
 	unsigned long m_lazyDeleteTotalCount;
 	unsigned long m_lazyDeletesPerMinute;
+	unsigned long m_lazyDeletesCompleted;
+	unsigned long m_lazyDeletesCompletedPerMinute;
+	unsigned long m_lazyDeleteSpilledCount;
+	unsigned long m_lazyDeleteBatchSize;
 	unsigned long m_queryRate;
 	unsigned long m_fetchRate;
+	unsigned long m_roundTripRate;
+	unsigned long m_statementCacheHitRate;
 
 	unsigned long m_snapshotCreationCount;
 	unsigned long m_snapshotDeletionCount;
@@ -47,6 +55,11 @@ private:
 
 	unsigned long m_cmLoadTime;
 
+	unsigned long m_loaderGroupsSent;
+	unsigned long m_loaderQueueWaitTime;
+	unsigned long m_loaderLoadTime;
+	unsigned long m_loaderSendTime;
+
 private:
 
 	// Disabled.
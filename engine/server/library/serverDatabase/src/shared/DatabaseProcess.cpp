@@ -85,7 +85,10 @@ chatServerConnection(0),
 commoditiesConnection(0),
 m_metricsData(0),
 m_queryExecCount(0),
-m_queryFetchCount(0)
+m_queryFetchCount(0),
+m_statementCacheHitCount(0),
+m_statementCacheMissCount(0),
+m_roundTripCount(0)
 {
 	ExitChain::add(DatabaseProcess::remove,"DatabaseProcess::remove");
 
@@ -104,6 +107,9 @@ m_queryFetchCount(0)
 	
 	taskService = new TaskManagerConnection("127.0.0.1", ConfigServerDatabase::getTaskManagerPort());
 
+	if (ConfigServerDatabase::getStatementCacheSize() > 0)
+		DB::Server::enableStatementCache(ConfigServerDatabase::getStatementCacheSize());
+
 	dbServer = DB::Server::create(ConfigServerDatabase::getDSN(),
 								  ConfigServerDatabase::getDatabaseUID(),
 								  ConfigServerDatabase::getDatabasePWD(),
@@ -653,10 +659,27 @@ float DatabaseProcess::getQueryFetchRate() const
 
 // ----------------------------------------------------------------------
 
+float DatabaseProcess::getRoundTripRate() const
+{
+    float rateMultiplier = static_cast<float>(ConfigServerDatabase::getQueryReportingRate()) / 60.0f;
+    return static_cast<float>(m_roundTripCount) * rateMultiplier;
+}
+
+// ----------------------------------------------------------------------
+
+int DatabaseProcess::getStatementCacheHitPercent() const
+{
+    int const lookups = m_statementCacheHitCount + m_statementCacheMissCount;
+    return (lookups > 0) ? (m_statementCacheHitCount * 100) / lookups : 0;
+}
+
+// ----------------------------------------------------------------------
+
 void DatabaseProcess::takeQueryCountSnapshot()
 {
     if (dbServer) {
         dbServer->getAndResetQueryCount(m_queryExecCount, m_queryFetchCount);
+        dbServer->getAndResetStatementCacheCount(m_statementCacheHitCount, m_statementCacheMissCount, m_roundTripCount);
     }
 }
 
@@ -59,6 +59,8 @@ class DatabaseProcess : public MessageDispatch::Receiver
 	const std::string getSchema() const;
 	float getQueryExecRate() const;
 	float getQueryFetchRate() const;
+	float getRoundTripRate() const;
+	int   getStatementCacheHitPercent() const;
 
 // communication:
 	void connectToGameServer(const char *addres, uint16 port, uint32 processId);
@@ -93,6 +95,9 @@ class DatabaseProcess : public MessageDispatch::Receiver
 
 	int m_queryExecCount;
 	int m_queryFetchCount;
+	int m_statementCacheHitCount;
+	int m_statementCacheMissCount;
+	int m_roundTripCount;
 
 //creation	
   protected:
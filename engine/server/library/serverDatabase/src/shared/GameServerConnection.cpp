@@ -12,13 +12,16 @@
 #include "serverNetworkMessages/ChunkCompleteMessage.h"
 #include "serverNetworkMessages/GameGameServerMessages.h"
 #include "serverUtility/ConfigServerUtility.h"
+#include "sharedNetworkMessages/GameNetworkMessage.h"
 #include "sharedNetwork/NetworkSetupData.h"
 
 //-----------------------------------------------------------------------
 
 GameServerConnection::GameServerConnection(const std::string & a, const unsigned short p) :
 		ServerConnection(a, p, NetworkSetupData()),
-		m_chunkCompleteQueue(new ChunkCompleteQueueType)
+		m_chunkCompleteQueue(new ChunkCompleteQueueType),
+		m_captureTarget(nullptr),
+		m_captureCount(0)
 {
 }
 
@@ -26,7 +29,9 @@ GameServerConnection::GameServerConnection(const std::string & a, const unsigned
 
 GameServerConnection::GameServerConnection(UdpConnectionMT * u, TcpClient * t) :
 		ServerConnection(u, t),
-		m_chunkCompleteQueue(new ChunkCompleteQueueType)
+		m_chunkCompleteQueue(new ChunkCompleteQueueType),
+		m_captureTarget(nullptr),
+		m_captureCount(0)
 {
 }
 
@@ -76,6 +81,62 @@ void GameServerConnection::onReceive(const Archive::ByteStream & message)
 
 //-----------------------------------------------------------------------
 
+void GameServerConnection::send(const GameNetworkMessage & message, const bool reliable)
+{
+	if (m_captureTarget)
+	{
+		static Archive::ByteStream packed;
+		packed.clear();
+		message.pack(packed);
+
+		Archive::put(*m_captureTarget, packed.getSize());
+		m_captureTarget->put(packed.getBuffer(), packed.getSize());
+		++m_captureCount;
+
+		Connection::send(packed, reliable);
+	}
+	else
+		ServerConnection::send(message, reliable);
+}
+
+//-----------------------------------------------------------------------
+
+/**
+ * Send a message that was packed earlier, e.g. one replayed from a
+ * WorldImage.  Always sent reliably.
+ */
+void GameServerConnection::sendPacked(const Archive::ByteStream & message)
+{
+	Connection::send(message, true);
+}
+
+//-----------------------------------------------------------------------
+
+/**
+ * Start appending a length-prefixed copy of every message sent on this
+ * connection to target, until endCapture() is called.
+ */
+void GameServerConnection::beginCapture(Archive::ByteStream & target)
+{
+	DEBUG_FATAL(m_captureTarget,("GameServerConnection::beginCapture called while already capturing.\n"));
+	m_captureTarget = &target;
+	m_captureCount = 0;
+}
+
+//-----------------------------------------------------------------------
+
+/**
+ * Stop capturing.
+ * @return the number of messages captured
+ */
+int GameServerConnection::endCapture()
+{
+	m_captureTarget = nullptr;
+	return m_captureCount;
+}
+
+//-----------------------------------------------------------------------
+
 void GameServerConnection::queueCompletedChunk (int nodeX, int nodeZ)
 {
 	m_chunkCompleteQueue->push_back(std::make_pair(nodeX, nodeZ));
@@ -22,13 +22,23 @@ public:
 	void                          onConnectionOpened      ();
 	void                          onReceive               (const Archive::ByteStream & message);
 
+	virtual void                  send                    (const GameNetworkMessage & message, const bool reliable);
+	void                          sendPacked              (const Archive::ByteStream & message);
+
 	void queueCompletedChunk (int nodeX, int nodeZ);
 	void sendChunkCompleteMessage();
 	void clearChunkCompleteQueue();
 
+	void beginCapture(Archive::ByteStream & target);
+	int  endCapture();
+
 private:
 	typedef std::vector<std::pair<int, int> > ChunkCompleteQueueType;
 	ChunkCompleteQueueType * const m_chunkCompleteQueue;
+
+	// while capturing, every message sent is also appended here (see WorldImage)
+	Archive::ByteStream * m_captureTarget;
+	int                   m_captureCount;
 	
 private:
 	GameServerConnection(const GameServerConnection&);
@@ -15,6 +15,7 @@
 #include "sharedDatabaseInterface/DbException.h"
 #include "sharedDatabaseInterface/DbServer.h"
 #include "sharedDatabaseInterface/DbSession.h"
+#include "sharedFoundation/Clock.h"
 #include "sharedFoundation/ExitChain.h"
 #include "sharedFoundation/Os.h"
 #include "sharedSynchronization/Mutex.h"
@@ -22,11 +23,61 @@
 #include "sharedThread/Thread.h"
 #include "sharedLog/Log.h"
 #include "serverDatabase/ConfigServerDatabase.h"
+#include <algorithm>
 #include <deque>
+#include <string>
 #include <vector>
 
 // ======================================================================
 
+namespace LazyDeleterNamespace
+{
+	// LazyDeleteQuery binds its ids into an array of this size
+	int const cs_maxQueryItems = 1000;
+
+	// read back from the spill file in chunks of this many ids
+	int const cs_spillReadChunk = 1000;
+
+	// the spill file starts with { cs_spillFileMagic, read offset }, both
+	// stored as NetworkIdType, followed by the spilled ids
+	NetworkId::NetworkIdType const cs_spillFileMagic = 0x4c445350; // "PSDL"
+	long const cs_spillHeaderSize = static_cast<long>(2 * sizeof(NetworkId::NetworkIdType));
+	long const cs_spillRecordSize = static_cast<long>(sizeof(NetworkId::NetworkIdType));
+
+	// once this much of the file has been read back, and it is more than
+	// what is still unread, the unread part is copied to a new file
+	long const cs_spillCompactSize = 16 * 1024 * 1024;
+
+	int getMaxBatchSize()
+	{
+		return std::max(1, std::min(ConfigServerDatabase::getLazyDeleteMaxBatchSize(), cs_maxQueryItems));
+	}
+
+	int getMaxQueuedObjects()
+	{
+		return std::max(ConfigServerDatabase::getLazyDeleteMaxQueuedObjects(), cs_spillReadChunk);
+	}
+
+	/**
+	 * Grow the batch while purges finish in under half the target time,
+	 * halve it when they take longer than the target.
+	 */
+	int adjustBatchSize(int batchSize, unsigned long elapsedMs)
+	{
+		unsigned long const targetMs = static_cast<unsigned long>(ConfigServerDatabase::getLazyDeleteTargetBatchTime());
+		if (elapsedMs > targetMs)
+			batchSize = batchSize / 2;
+		else if (elapsedMs < targetMs / 2)
+			batchSize = batchSize + std::max(1, batchSize / 4);
+
+		return std::max(1, std::min(batchSize, getMaxBatchSize()));
+	}
+}
+
+using namespace LazyDeleterNamespace;
+
+// ======================================================================
+
 LazyDeleter * LazyDeleter::ms_instance=nullptr;
 
 // ======================================================================
@@ -51,18 +102,30 @@ void LazyDeleter::update(float updateTime)
 	if (!m_incomingObjects->empty())
 	{
 		m_objectListLock->enter();
+
+		size_t room = m_incomingObjects->size();
+		if (isSpillEnabled())
+		{
+			size_t const maxQueued = static_cast<size_t>(getMaxQueuedObjects());
+			room = std::min(room, maxQueued > m_objectsToDelete->size() ? maxQueued - m_objectsToDelete->size() : 0);
+		}
 		
-		for (std::vector<NetworkId>::iterator i=m_incomingObjects->begin(); i!=m_incomingObjects->end(); ++i)
-			m_objectsToDelete->push_back(*i);
-		m_incomingObjects->clear();
+		std::vector<NetworkId>::iterator const firstSpilled = m_incomingObjects->begin() + static_cast<std::vector<NetworkId>::difference_type>(room);
+		m_objectsToDelete->insert(m_objectsToDelete->end(), m_incomingObjects->begin(), firstSpilled);
 
 		m_objectListLock->leave();
+
+		if (firstSpilled != m_incomingObjects->end())
+			spillObjects(firstSpilled, m_incomingObjects->end());
+		m_incomingObjects->clear();
 	}
 
 	if (Persister::getInstance().isSaveInProgress() || Loader::getInstance().isBacklogged() || (Loader::getInstance().getNumPreloads() != 0))
 		m_paused=true;
 	else
 		m_paused=false;
+
+	reportProgress();
 }
 
 // ----------------------------------------------------------------------
@@ -86,19 +149,41 @@ void LazyDeleter::remove()
 // ----------------------------------------------------------------------
 
 LazyDeleter::LazyDeleter() :
-		m_workerThread(nullptr), // Avoid starting the worker thread until the other member variables are initialized
+		m_workerThreads(new std::vector<Thread *>), // Avoid starting the worker threads until the other member variables are initialized
+		m_sessions(new std::vector<DB::Session *>),
 		m_incomingObjects(new std::vector<NetworkId>),
 		m_objectsToDelete(new std::deque<NetworkId>),
 		m_objectListLock(new Mutex),
 		m_shutdown(false),
 		m_paused(false),
-		m_batchSize(10),
-		m_session(DatabaseProcess::getInstance().getDBServer()->getSession()),
-		m_totalObjectCount(0)
+		m_batchSize(std::min(ConfigServerDatabase::getDefaultLazyDeleteBulkBindSize(), getMaxBatchSize())),
+		m_totalObjectCount(0),
+		m_completedObjectCount(0),
+		m_refilledObjects(new std::deque<NetworkId>),
+		m_spillLock(new Mutex),
+		m_spillFile(nullptr),
+		m_spillEnabled(false),
+		m_refilledOutstandingCount(0),
+		m_spillReadOffset(0),
+		m_spillWriteOffset(0),
+		m_spilledObjectCount(0),
+		m_lastProgressTime(Clock::getSecondsSinceStart()),
+		m_lastProgressCompletedCount(0),
+		m_completedObjectsPerMinute(0)
 {
-	m_workerThread = new MemberFunctionThreadZero<LazyDeleter>("LazyDeleter", *this, &LazyDeleter::workerThreadLoop);
-	ThreadHandle tempThreadHandle(m_workerThread); // for some obscure reason, the thread doesn't run unless you create a handle, but we don't need the handle for anything
-	UNREF(tempThreadHandle);
+	openSpillFile();
+
+	int const threadCount = std::max(1, ConfigServerDatabase::getLazyDeleteThreads());
+	for (int i = 0; i < threadCount; ++i)
+		m_sessions->push_back(DatabaseProcess::getInstance().getDBServer()->getSession());
+
+	for (int i = 0; i < threadCount; ++i)
+	{
+		Thread * const workerThread = new MemberFunctionThreadOne<LazyDeleter, int>("LazyDeleter", *this, &LazyDeleter::workerThreadLoop, i);
+		ThreadHandle tempThreadHandle(workerThread); // for some obscure reason, the thread doesn't run unless you create a handle, but we don't need the handle for anything
+		UNREF(tempThreadHandle);
+		m_workerThreads->push_back(workerThread);
+	}
 }
 
 // ----------------------------------------------------------------------
@@ -106,125 +191,540 @@ LazyDeleter::LazyDeleter() :
 LazyDeleter::~LazyDeleter()
 {
 	m_shutdown = true;
-	m_workerThread->wait();
-	DatabaseProcess::getInstance().getDBServer()->releaseSession(m_session);
+	for (std::vector<Thread *>::iterator i = m_workerThreads->begin(); i != m_workerThreads->end(); ++i)
+		(*i)->wait();
+	for (std::vector<DB::Session *>::iterator j = m_sessions->begin(); j != m_sessions->end(); ++j)
+		DatabaseProcess::getInstance().getDBServer()->releaseSession(*j);
+
+	// whatever the workers did not get to is left in the spill file for the next run,
+	// ids read back but not purged first, then queued ids, then anything not yet read back
+	if (isSpillEnabled())
+	{
+		m_incomingObjects->insert(m_incomingObjects->begin(), m_objectsToDelete->begin(), m_objectsToDelete->end());
+		m_incomingObjects->insert(m_incomingObjects->begin(), m_refilledObjects->begin(), m_refilledObjects->end());
+		m_objectsToDelete->clear();
+		m_refilledObjects->clear();
+		m_refilledOutstandingCount = 0;
+		m_spillLock->enter();
+		bool const rewritten = rewriteSpillFile(*m_incomingObjects);
+		m_spillLock->leave();
+		if (!rewritten && !m_incomingObjects->empty())
+			spillObjects(m_incomingObjects->begin(), m_incomingObjects->end());
+		m_incomingObjects->clear();
+
+		if (m_spilledObjectCount != 0)
+			LOG("LazyDeleter", ("Shutting down with %d objects left in %s", m_spilledObjectCount, ConfigServerDatabase::getLazyDeleteSpillFile()));
+		closeSpillFile();
+	}
 	
+	delete m_workerThreads;
+	delete m_sessions;
 	delete m_incomingObjects;
 	delete m_objectsToDelete;
 	delete m_objectListLock;
+	delete m_refilledObjects;
+	delete m_spillLock;
 	 
-	m_workerThread = nullptr;
+	m_workerThreads = nullptr;
+	m_sessions = nullptr;
 	m_incomingObjects = nullptr;
 	m_objectsToDelete = nullptr;
 	m_objectListLock = nullptr;
-	m_session = nullptr;
+	m_refilledObjects = nullptr;
+	m_spillLock = nullptr;
 }
 
 // ----------------------------------------------------------------------
 
-void LazyDeleter::workerThreadLoop()
+void LazyDeleter::workerThreadLoop(int workerIndex)
 {
+	DB::Session * const session = (*m_sessions)[static_cast<size_t>(workerIndex)];
+	NOT_NULL(session);
+
+	int batchSize = m_batchSize;
 	bool done = false;
-	int size = 0;
-	bool succeeded;
 	
 	while (!done)
 	{
+		bool slowBatch = false;
+
 		if ((!m_paused) || m_shutdown)
 		{
-			m_objectListLock->enter();
-
-			size = m_objectsToDelete->size();
-			
-			if (size!=0)
+			std::vector<NetworkId> batch;
+			int refilledCount = 0;
+			if (takeBatch(batch, batchSize, refilledCount))
 			{
-				LazyDeleteQuery qry;
-				std::vector<NetworkId> batch;
-			
-				for (int c=0; !m_objectsToDelete->empty() && c < m_batchSize; ++c)
+				unsigned long const startTime = Clock::timeMs();
+				if (purgeBatch(*session, batch))
 				{
-					NetworkId &object = m_objectsToDelete->front();
-					batch.push_back(object);
-					m_objectsToDelete->pop_front();
-				}
+					unsigned long const elapsedTime = Clock::timeMs() - startTime;
+					slowBatch = elapsedTime > static_cast<unsigned long>(ConfigServerDatabase::getLazyDeleteTargetBatchTime());
+					batchSize = adjustBatchSize(batchSize, elapsedTime);
 
-				m_objectListLock->leave();
+					m_objectListLock->enter();
+					m_completedObjectCount += static_cast<int>(batch.size());
+					m_batchSize = batchSize;
+					m_objectListLock->leave();
 
-				succeeded = true;
-				if (!qry.setupData(m_session))
-					succeeded = false;
-				else
-				{
-					for (std::vector<NetworkId>::iterator i=batch.begin(); i!=batch.end(); ++i)
-					{
-						if (!qry.addData(*i))
-						{
-							succeeded = false;
-							break;
-						}
-						if (qry.getNumItems() == ConfigServerDatabase::getDefaultLazyDeleteBulkBindSize())
-						{	
-							if (! (m_session->exec(&qry)))
-							{
-								succeeded = false;
-								break;
-							}
-							qry.clearData();
-							qry.done();
-							m_session->commitTransaction();
-						}
-					}
+					if (refilledCount != 0)
+						releaseRefilledObjects(refilledCount);
 				}
-
-				if (succeeded && (qry.getNumItems() != 0))
-					succeeded = m_session->exec(&qry);
-				qry.done();
-				qry.freeData();
-				if (succeeded)
-					m_session->commitTransaction();
 				else
 				{
-					m_session->rollbackTransaction();
-					m_session->disconnect();
-					while (! (m_session->connect()))
+					session->disconnect();
+					while (! (session->connect()))
 					{
-						m_session->disconnect();
+						session->disconnect();
 						Os::sleep(DB::Server::getDisconnectSleepTime());
 					};
 					LOG("DatabaseError", ("Database connection reestablished"));
-					m_objectListLock->enter();
-					m_objectsToDelete->insert(m_objectsToDelete->begin(),batch.begin(),batch.end()); // retry this batch
-					m_objectListLock->leave();
+					requeueBatch(batch, refilledCount); // retry this batch
+					batchSize = std::max(1, batchSize / 2);
 				}
 			}
-			else
-			{
-				m_objectListLock->leave();
-				if (m_shutdown)
-					done = true;
-			}
+			else if (m_shutdown)
+				done = true;
 		}
 		if (!m_shutdown)
 		{
-			if ( size > (ConfigServerDatabase::getDefaultLazyDeleteBulkBindSize()))
-				Os::sleep(ConfigServerDatabase::getDefaultLazyDeleteSleepTime()); // just multi-batch bulk delete so wait a bit to start again
+			if (slowBatch)
+				Os::sleep(ConfigServerDatabase::getDefaultLazyDeleteSleepTime()); // the database is struggling, give it a moment
 			else
 				Os::sleep(10);
-			
 		}
 	}
 }
 
 // ----------------------------------------------------------------------
 
+/**
+ * Take up to batchSize objects off the queue, reading the next chunk from
+ * the spill file first if the last one has been purged.  Ids read back from
+ * the spill file are taken first and placed at the front of the batch.
+ *
+ * When spilling is enabled, workers stop at shutdown without draining the
+ * queue; the destructor spills what is left instead.
+ *
+ * @param refilledCount  set to the number of ids in the batch that were read back from the spill file
+ * @return false if there was nothing to take
+ */
+bool LazyDeleter::takeBatch(std::vector<NetworkId> &batch, int batchSize, int &refilledCount)
+{
+	if (m_shutdown && isSpillEnabled())
+		return false;
+
+	refillFromSpillFile();
+
+	m_objectListLock->enter();
+	int c = 0;
+	for (; !m_refilledObjects->empty() && c < batchSize; ++c)
+	{
+		batch.push_back(m_refilledObjects->front());
+		m_refilledObjects->pop_front();
+	}
+	refilledCount = c;
+	for (; !m_objectsToDelete->empty() && c < batchSize; ++c)
+	{
+		batch.push_back(m_objectsToDelete->front());
+		m_objectsToDelete->pop_front();
+	}
+	m_objectListLock->leave();
+
+	return !batch.empty();
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Purge a batch of objects with a single call to the purge procedure.
+ * On failure the transaction is rolled back.
+ */
+bool LazyDeleter::purgeBatch(DB::Session &session, std::vector<NetworkId> const &batch)
+{
+	LazyDeleteQuery qry;
+	bool succeeded = qry.setupData(&session);
+
+	for (std::vector<NetworkId>::const_iterator i=batch.begin(); succeeded && i!=batch.end(); ++i)
+		succeeded = qry.addData(*i);
+
+	if (succeeded && (qry.getNumItems() != 0))
+		succeeded = session.exec(&qry);
+	qry.done();
+	qry.freeData();
+
+	if (succeeded)
+		session.commitTransaction();
+	else
+		session.rollbackTransaction();
+
+	return succeeded;
+}
+
+// ----------------------------------------------------------------------
+
+void LazyDeleter::requeueBatch(std::vector<NetworkId> const &batch, int refilledCount)
+{
+	std::vector<NetworkId>::const_iterator const firstQueued = batch.begin() + static_cast<std::vector<NetworkId>::difference_type>(refilledCount);
+
+	m_objectListLock->enter();
+	m_refilledObjects->insert(m_refilledObjects->begin(),batch.begin(),firstQueued);
+	m_objectsToDelete->insert(m_objectsToDelete->begin(),firstQueued,batch.end());
+	m_objectListLock->leave();
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Once a minute, log how far along the purge is.
+ */
+void LazyDeleter::reportProgress()
+{
+	unsigned long const now = Clock::getSecondsSinceStart();
+	if (now < m_lastProgressTime + 60)
+		return;
+
+	int const completedCount = getCompletedObjectCount();
+	int const completedSinceLastReport = completedCount - m_lastProgressCompletedCount;
+	m_completedObjectsPerMinute = static_cast<int>((static_cast<unsigned long>(completedSinceLastReport) * 60) / (now - m_lastProgressTime));
+	m_lastProgressTime = now;
+	m_lastProgressCompletedCount = completedCount;
+
+	size_t const queueSize = getQueueSize();
+	if (completedSinceLastReport != 0 || queueSize != 0)
+		LOG("LazyDeleter", ("%d objects purged (%d per minute), %d queued (%d spilled), batch size %d%s", completedCount, m_completedObjectsPerMinute, static_cast<int>(queueSize), getSpilledObjectCount(), m_batchSize, m_paused ? ", paused" : ""));
+}
+
+// ----------------------------------------------------------------------
+
 size_t LazyDeleter::getQueueSize() const
 {
 	size_t result;
 	m_objectListLock->enter();
-	result = m_objectsToDelete->size();
+	result = m_objectsToDelete->size() + m_refilledObjects->size();
+	m_objectListLock->leave();
+
+	return result + static_cast<size_t>(getSpilledObjectCount());
+}
+
+// ----------------------------------------------------------------------
+
+int LazyDeleter::getCompletedObjectCount() const
+{
+	int result;
+	m_objectListLock->enter();
+	result = m_completedObjectCount;
 	m_objectListLock->leave();
 
 	return result;
 }
 
+// ----------------------------------------------------------------------
+
+int LazyDeleter::getSpilledObjectCount() const
+{
+	int result;
+	m_spillLock->enter();
+	result = m_spilledObjectCount;
+	m_spillLock->leave();
+
+	return result;
+}
+
+// ======================================================================
+
+/**
+ * Safe to call from any thread without m_spillLock; m_spillEnabled follows
+ * m_spillFile, which the workers may close or reopen while refilling.
+ */
+bool LazyDeleter::isSpillEnabled() const
+{
+	return m_spillEnabled;
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Open the spill file, keeping whatever a previous run left unread in it.
+ */
+void LazyDeleter::openSpillFile()
+{
+	char const * const fileName = ConfigServerDatabase::getLazyDeleteSpillFile();
+	if (!fileName || !*fileName)
+		return;
+
+	m_spillFile = fopen(fileName, "r+b");
+	if (m_spillFile)
+	{
+		NetworkId::NetworkIdType header[2] = { 0, 0 };
+		IGNORE_RETURN(fseek(m_spillFile, 0, SEEK_END));
+		long const fileSize = ftell(m_spillFile);
+		IGNORE_RETURN(fseek(m_spillFile, 0, SEEK_SET));
+		bool const headerRead = fileSize >= cs_spillHeaderSize && fread(header, sizeof(header), 1, m_spillFile) == 1;
+
+		if (headerRead && header[0] == cs_spillFileMagic)
+		{
+			m_spillWriteOffset = cs_spillHeaderSize + (fileSize - cs_spillHeaderSize) / cs_spillRecordSize * cs_spillRecordSize;
+			m_spillReadOffset = static_cast<long>(header[1]);
+			if (m_spillReadOffset < cs_spillHeaderSize || m_spillReadOffset > m_spillWriteOffset || (m_spillReadOffset - cs_spillHeaderSize) % cs_spillRecordSize != 0)
+			{
+				WARNING(true, ("LazyDeleter spill file %s has a bad read offset, resuming from its start", fileName));
+				m_spillReadOffset = cs_spillHeaderSize;
+			}
+			m_spilledObjectCount = static_cast<int>((m_spillWriteOffset - m_spillReadOffset) / cs_spillRecordSize);
+			if (m_spilledObjectCount != 0)
+				LOG("LazyDeleter", ("Resuming %d objects left in %s", m_spilledObjectCount, fileName));
+			m_spillEnabled = true;
+			return;
+		}
+
+		// keep an unrecognized file for inspection rather than purging from it or overwriting it
+		IGNORE_RETURN(fclose(m_spillFile));
+		m_spillFile = nullptr;
+		if (fileSize > 0)
+		{
+			std::string const asideName = std::string(fileName) + ".unreadable";
+			WARNING(true, ("LazyDeleter spill file %s is not in the expected format, moving it to %s", fileName, asideName.c_str()));
+			IGNORE_RETURN(rename(fileName, asideName.c_str()));
+		}
+	}
+
+	m_spillFile = fopen(fileName, "w+b");
+	if (m_spillFile)
+	{
+		m_spillReadOffset = cs_spillHeaderSize;
+		m_spillWriteOffset = cs_spillHeaderSize;
+		m_spilledObjectCount = 0;
+		if (!writeSpillHeader())
+		{
+			IGNORE_RETURN(fclose(m_spillFile));
+			m_spillFile = nullptr;
+		}
+	}
+
+	m_spillEnabled = m_spillFile != nullptr;
+	if (!m_spillFile)
+		WARNING(true, ("LazyDeleter could not open %s, all pending deletes will be kept in memory", fileName));
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Record how far the file has been read back and purged, so the next run
+ * does not purge those ids again.  Must be called with m_spillLock held.
+ */
+bool LazyDeleter::writeSpillHeader()
+{
+	NetworkId::NetworkIdType const header[2] = { cs_spillFileMagic, static_cast<NetworkId::NetworkIdType>(m_spillReadOffset) };
+	return fseek(m_spillFile, 0, SEEK_SET) == 0 && fwrite(header, sizeof(header), 1, m_spillFile) == 1 && fflush(m_spillFile) == 0;
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Replace the spill file with one holding the given ids followed by the
+ * part of the current file that has not been read back yet.  The new file
+ * is written beside the old one and renamed over it, so a failure leaves
+ * the old file as it was.  Must be called with m_spillLock held.
+ *
+ * @return false if the file could not be rewritten.
+ */
+bool LazyDeleter::rewriteSpillFile(std::vector<NetworkId> const &leadingObjects)
+{
+	if (!m_spillFile)
+		return false;
+
+	char const * const fileName = ConfigServerDatabase::getLazyDeleteSpillFile();
+	std::string const tempName = std::string(fileName) + ".tmp";
+	FILE * const tempFile = fopen(tempName.c_str(), "wb");
+	if (!tempFile)
+	{
+		WARNING(true, ("LazyDeleter could not create %s", tempName.c_str()));
+		return false;
+	}
+
+	long const newWriteOffset = cs_spillHeaderSize + static_cast<long>(leadingObjects.size()) * cs_spillRecordSize + (m_spillWriteOffset - m_spillReadOffset);
+	NetworkId::NetworkIdType const header[2] = { cs_spillFileMagic, static_cast<NetworkId::NetworkIdType>(cs_spillHeaderSize) };
+	bool ok = fwrite(header, sizeof(header), 1, tempFile) == 1;
+
+	std::vector<NetworkId::NetworkIdType> records;
+	records.reserve(static_cast<size_t>(cs_spillReadChunk));
+	for (std::vector<NetworkId>::const_iterator i = leadingObjects.begin(); ok && i != leadingObjects.end(); ++i)
+	{
+		records.push_back(i->getValue());
+		if (records.size() == static_cast<size_t>(cs_spillReadChunk) || i + 1 == leadingObjects.end())
+		{
+			ok = fwrite(&records[0], sizeof(NetworkId::NetworkIdType), records.size(), tempFile) == records.size();
+			records.clear();
+		}
+	}
+
+	ok = ok && fseek(m_spillFile, m_spillReadOffset, SEEK_SET) == 0;
+	for (long remaining = (m_spillWriteOffset - m_spillReadOffset) / cs_spillRecordSize; ok && remaining > 0; )
+	{
+		records.resize(static_cast<size_t>(std::min(remaining, static_cast<long>(cs_spillReadChunk))));
+		ok = fread(&records[0], sizeof(NetworkId::NetworkIdType), records.size(), m_spillFile) == records.size()
+			&& fwrite(&records[0], sizeof(NetworkId::NetworkIdType), records.size(), tempFile) == records.size();
+		remaining -= static_cast<long>(records.size());
+	}
+
+	ok = (fclose(tempFile) == 0) && ok;
+	if (!ok || rename(tempName.c_str(), fileName) != 0)
+	{
+		WARNING(true, ("LazyDeleter could not rewrite %s", fileName));
+		IGNORE_RETURN(::remove(tempName.c_str()));
+		return false;
+	}
+
+	IGNORE_RETURN(fclose(m_spillFile));
+	m_spillFile = fopen(fileName, "r+b");
+	m_spillEnabled = m_spillFile != nullptr;
+	WARNING(!m_spillFile, ("LazyDeleter could not reopen %s, all pending deletes will be kept in memory", fileName));
+	m_spillReadOffset = cs_spillHeaderSize;
+	m_spillWriteOffset = newWriteOffset;
+	m_spilledObjectCount = static_cast<int>((m_spillWriteOffset - m_spillReadOffset) / cs_spillRecordSize);
+	return true;
+}
+
+// ----------------------------------------------------------------------
+
+void LazyDeleter::closeSpillFile()
+{
+	if (!m_spillFile)
+		return;
+
+	IGNORE_RETURN(fclose(m_spillFile));
+	m_spillFile = nullptr;
+	m_spillEnabled = false;
+
+	if (m_spilledObjectCount == 0)
+		IGNORE_RETURN(::remove(ConfigServerDatabase::getLazyDeleteSpillFile()));
+}
+
+// ----------------------------------------------------------------------
+
+void LazyDeleter::spillObjects(std::vector<NetworkId>::const_iterator begin, std::vector<NetworkId>::const_iterator end)
+{
+	std::vector<NetworkId::NetworkIdType> records;
+	records.reserve(static_cast<size_t>(end - begin));
+	for (std::vector<NetworkId>::const_iterator i = begin; i != end; ++i)
+		records.push_back(i->getValue());
+
+	size_t written = 0;
+	m_spillLock->enter();
+	if (m_spillFile)
+	{
+		if (fseek(m_spillFile, m_spillWriteOffset, SEEK_SET) == 0)
+			written = fwrite(&records[0], sizeof(NetworkId::NetworkIdType), records.size(), m_spillFile);
+		IGNORE_RETURN(fflush(m_spillFile));
+		m_spillWriteOffset += static_cast<long>(written * sizeof(NetworkId::NetworkIdType));
+		m_spilledObjectCount += static_cast<int>(written);
+	}
+	m_spillLock->leave();
+
+	if (written != records.size())
+	{
+		// out of disk, keep the rest in memory rather than lose them
+		WARNING(true, ("LazyDeleter could only spill %d of %d objects", static_cast<int>(written), static_cast<int>(records.size())));
+		m_objectListLock->enter();
+		m_objectsToDelete->insert(m_objectsToDelete->end(), begin + static_cast<std::vector<NetworkId>::difference_type>(written), end);
+		m_objectListLock->leave();
+	}
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Read the next chunk of spilled objects back into memory once every id
+ * from the previous chunk has been purged.  The read offset saved in the
+ * file is only advanced by commitSpillRead, after those purges commit.
+ */
+void LazyDeleter::refillFromSpillFile()
+{
+	if (!isSpillEnabled())
+		return;
+
+	m_spillLock->enter();
+
+	if (m_spillFile && m_spilledObjectCount != 0 && m_refilledOutstandingCount == 0)
+	{
+		std::vector<NetworkId::NetworkIdType> records(static_cast<size_t>(std::min(cs_spillReadChunk, m_spilledObjectCount)));
+		IGNORE_RETURN(fseek(m_spillFile, m_spillReadOffset, SEEK_SET));
+		size_t const read = fread(&records[0], sizeof(NetworkId::NetworkIdType), records.size(), m_spillFile);
+		if (read != records.size())
+		{
+			WARNING(true, ("LazyDeleter lost %d spilled objects reading %s", m_spilledObjectCount - static_cast<int>(read), ConfigServerDatabase::getLazyDeleteSpillFile()));
+			m_spilledObjectCount = static_cast<int>(read);
+		}
+		m_spillReadOffset += static_cast<long>(read * sizeof(NetworkId::NetworkIdType));
+		m_spilledObjectCount -= static_cast<int>(read);
+		m_refilledOutstandingCount = static_cast<int>(read);
+
+		m_objectListLock->enter();
+		for (size_t i = 0; i < read; ++i)
+			m_refilledObjects->push_back(NetworkId(records[i]));
+		m_objectListLock->leave();
+
+		if (read == 0)
+			commitSpillRead();
+	}
+
+	m_spillLock->leave();
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Called by a worker once a batch holding count ids read back from the
+ * spill file has been purged.  The last one out commits the chunk.
+ */
+void LazyDeleter::releaseRefilledObjects(int count)
+{
+	m_spillLock->enter();
+
+	m_refilledOutstandingCount -= count;
+	DEBUG_FATAL(m_refilledOutstandingCount < 0, ("LazyDeleter released more refilled objects than were read back"));
+	if (m_refilledOutstandingCount <= 0)
+	{
+		m_refilledOutstandingCount = 0;
+		commitSpillRead();
+	}
+
+	m_spillLock->leave();
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Save the read offset now that everything read back has been purged.
+ * The file is truncated once it has been read back completely, and
+ * compacted when the part already purged dominates it.  Must be called
+ * with m_spillLock held.
+ */
+void LazyDeleter::commitSpillRead()
+{
+	if (!m_spillFile)
+		return;
+
+	if (m_spilledObjectCount == 0)
+	{
+		m_spillFile = freopen(ConfigServerDatabase::getLazyDeleteSpillFile(), "w+b", m_spillFile);
+		m_spillReadOffset = cs_spillHeaderSize;
+		m_spillWriteOffset = cs_spillHeaderSize;
+		if (m_spillFile && !writeSpillHeader())
+		{
+			IGNORE_RETURN(fclose(m_spillFile));
+			m_spillFile = nullptr;
+		}
+		m_spillEnabled = m_spillFile != nullptr;
+		WARNING(!m_spillFile, ("LazyDeleter could not reopen %s, all pending deletes will be kept in memory", ConfigServerDatabase::getLazyDeleteSpillFile()));
+	}
+	else
+	{
+		long const consumed = m_spillReadOffset - cs_spillHeaderSize;
+		bool const compact = consumed >= cs_spillCompactSize && consumed > m_spillWriteOffset - m_spillReadOffset;
+		if (!compact || !rewriteSpillFile(std::vector<NetworkId>()))
+			WARNING(m_spillFile && !writeSpillHeader(), ("LazyDeleter could not update the read offset in %s", ConfigServerDatabase::getLazyDeleteSpillFile()));
+	}
+}
+
 // ======================================================================
@@ -12,6 +12,9 @@
 
 #include "sharedFoundation/NetworkId.h"
 
+#include <atomic>
+#include <cstdio>
+
 // ======================================================================
 
 namespace DB
@@ -26,6 +29,20 @@ class Mutex;
 
 /**
  * Singleton that purges deleted objects from the database.
+ *
+ * Purges are done by lazyDeleteThreads worker threads, each with its own
+ * database session.  Each worker sizes its batches to the time the last
+ * purge took, growing them while the database keeps up and shrinking them
+ * when purges run longer than lazyDeleteTargetBatchTime.
+ *
+ * At most lazyDeleteMaxQueuedObjects ids are kept in memory.  The rest are
+ * spilled to lazyDeleteSpillFile and read back a chunk at a time as the
+ * workers catch up.  The file records how far it has been read back and
+ * purged, and is only advanced once every id in a chunk has been purged,
+ * so a crash can repeat purges but never lose them.  It is compacted as it
+ * drains.  At shutdown it is rewritten to hold the ids still queued in
+ * memory followed by those never read back, and it is picked up again the
+ * next time the process starts.
  */
 class LazyDeleter
 {
@@ -37,9 +54,27 @@ class LazyDeleter
 	void update(float updateTime);
 	size_t getQueueSize() const;
 	int getTotalObjectCount() const;
+	int getCompletedObjectCount() const;
+	int getSpilledObjectCount() const;
+	int getBatchSize() const;
+	int getCompletedObjectsPerMinute() const;
 	
   private:
-	void workerThreadLoop();
+	void workerThreadLoop(int workerIndex);
+	bool takeBatch(std::vector<NetworkId> &batch, int batchSize, int &refilledCount);
+	bool purgeBatch(DB::Session &session, std::vector<NetworkId> const &batch);
+	void requeueBatch(std::vector<NetworkId> const &batch, int refilledCount);
+	void reportProgress();
+
+	bool isSpillEnabled() const;
+	void openSpillFile();
+	void closeSpillFile();
+	bool writeSpillHeader();
+	bool rewriteSpillFile(std::vector<NetworkId> const &leadingObjects);
+	void spillObjects(std::vector<NetworkId>::const_iterator begin, std::vector<NetworkId>::const_iterator end);
+	void refillFromSpillFile();
+	void releaseRefilledObjects(int count);
+	void commitSpillRead();
 	
   private:
 	static void remove();
@@ -52,15 +87,33 @@ class LazyDeleter
 	
   private:
 	static LazyDeleter *ms_instance;
-	Thread *m_workerThread;
+	std::vector<Thread *> *m_workerThreads;
+	std::vector<DB::Session *> *m_sessions;
 	std::vector<NetworkId> *m_incomingObjects;
 	std::deque<NetworkId> *m_objectsToDelete;
 	Mutex *m_objectListLock;
 	bool m_shutdown;
 	bool m_paused;
 	int m_batchSize;
-	DB::Session *m_session;
 	int m_totalObjectCount;
+	int m_completedObjectCount;
+
+	// ids read back from the spill file, taken ahead of m_objectsToDelete
+	std::deque<NetworkId> *m_refilledObjects;
+
+	// ids that did not fit in m_objectsToDelete, stored as NetworkIdType
+	Mutex *m_spillLock;
+	FILE *m_spillFile;
+	std::atomic<bool> m_spillEnabled;
+	int m_refilledOutstandingCount;
+	long m_spillReadOffset;
+	long m_spillWriteOffset;
+	int m_spilledObjectCount;
+
+	// progress reporting, main thread only
+	unsigned long m_lastProgressTime;
+	int m_lastProgressCompletedCount;
+	int m_completedObjectsPerMinute;
 };
 
 // ----------------------------------------------------------------------
@@ -78,6 +131,20 @@ inline int LazyDeleter::getTotalObjectCount() const
 	return m_totalObjectCount;
 }
 
+// ----------------------------------------------------------------------
+
+inline int LazyDeleter::getBatchSize() const
+{
+	return m_batchSize;
+}
+
+// ----------------------------------------------------------------------
+
+inline int LazyDeleter::getCompletedObjectsPerMinute() const
+{
+	return m_completedObjectsPerMinute;
+}
+
 // ======================================================================
 
 #endif
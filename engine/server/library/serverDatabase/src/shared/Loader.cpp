@@ -26,6 +26,8 @@
 #include "serverDatabase/TaskLoadClock.h"
 #include "serverDatabase/TaskLoadSnapshots.h"
 #include "serverDatabase/UniverseLocator.h"
+#include "serverDatabase/WorldImage.h"
+#include "serverDatabase/WorldImageChunkLocator.h"
 #include "serverNetworkMessages/CentralGameServerMessages.h"
 #include "serverNetworkMessages/ChunkObjectListMessage.h"
 #include "serverNetworkMessages/CSDBNetMessages.h"
@@ -45,6 +47,7 @@
 #include "serverUtility/ServerClock.h"
 #include "sharedDatabaseInterface/DbTaskQueue.h"
 #include "sharedDebug/Profiler.h"
+#include "sharedFoundation/Clock.h"
 #include "sharedFoundation/ExitChain.h"
 #include "sharedFoundation/NetworkIdArchive.h"
 #include "sharedLog/Log.h"
@@ -57,15 +60,89 @@
 
 // ======================================================================
 
+namespace LoaderNamespace
+{
+	/**
+	 * Interleave the bits of a chunk's coordinates (Morton / Z-order), so
+	 * that sorting by the result keeps neighbouring chunks together.
+	 */
+	uint32 getChunkOrderKey(int nodeX, int nodeZ, int minNodeX, int minNodeZ)
+	{
+		uint32 const x = static_cast<uint32>(nodeX - minNodeX);
+		uint32 const z = static_cast<uint32>(nodeZ - minNodeZ);
+
+		uint32 result = 0;
+		for (int bit = 0; bit < 16; ++bit)
+		{
+			result |= ((x >> bit) & 1u) << (2 * bit);
+			result |= ((z >> bit) & 1u) << (2 * bit + 1);
+		}
+		return result;
+	}
+
+	// ----------------------------------------------------------------------
+
+	/**
+	 * Reorder a chunk request so that spatially adjacent chunks are queued
+	 * next to each other.  Preload areas arrive as one large request, and
+	 * keeping neighbours in the same LoaderSnapshotGroup lets each group's
+	 * chunk queries hit adjacent index ranges and lets the game server
+	 * finish whole regions of the preload area sooner.
+	 */
+	void sortChunksSpatially(std::vector<RequestChunkMessage::Chunk> &chunks)
+	{
+		if (chunks.size() < 2)
+			return;
+
+		int minNodeX = chunks.front().m_nodeX;
+		int minNodeZ = chunks.front().m_nodeZ;
+		for (std::vector<RequestChunkMessage::Chunk>::const_iterator i = chunks.begin(); i != chunks.end(); ++i)
+		{
+			minNodeX = std::min(minNodeX, i->m_nodeX);
+			minNodeZ = std::min(minNodeZ, i->m_nodeZ);
+		}
+
+		std::vector<std::pair<uint32, size_t> > keys;
+		keys.reserve(chunks.size());
+		for (size_t i = 0; i < chunks.size(); ++i)
+			keys.push_back(std::make_pair(getChunkOrderKey(chunks[i].m_nodeX, chunks[i].m_nodeZ, minNodeX, minNodeZ), i));
+
+		std::stable_sort(keys.begin(), keys.end());
+
+		std::vector<RequestChunkMessage::Chunk> sorted;
+		sorted.reserve(chunks.size());
+		for (std::vector<std::pair<uint32, size_t> >::const_iterator k = keys.begin(); k != keys.end(); ++k)
+			sorted.push_back(chunks[k->second]);
+
+		chunks.swap(sorted);
+	}
+}
+
+using namespace LoaderNamespace;
+
+// ======================================================================
+
 Loader *Loader::ms_instance = nullptr;
 
 // ======================================================================
 
+Loader::LoadStageStatistics::LoadStageStatistics() :
+		groupCount(0),
+		locatorCount(0),
+		queueWaitTimeMs(0),
+		loadTimeMs(0),
+		sendTimeMs(0)
+{
+}
+
+// ======================================================================
+
 void Loader::installDerived(Loader *derivedInstance)
 {
 	DEBUG_FATAL(ms_instance,("Installed loader twice.\n"));
 	ms_instance = derivedInstance;
 	ExitChain::add(&remove, "Loader::remove");
+	WorldImage::install();
 }
 
 // ----------------------------------------------------------------------
@@ -95,6 +172,9 @@ Loader::Loader() :
 		m_unackedLoads(),
 		m_unackedLoadsTime(),
 		m_numQueuedLocators(0),
+		m_preloadingProcesses(),
+		m_loadStageStatistics(),
+		m_lastLoadStageStatistics(),
 		taskQ(new DB::TaskQueue(static_cast<unsigned int>(ConfigServerDatabase::getLoaderThreads()),DatabaseProcess::getInstance().getDBServer(),0))
 {
 	connectToMessage("LoadAckMessage");
@@ -132,11 +212,23 @@ void Loader::update(real updateTime)
 	//TODO The outgoing queue isn't very efficient, since we check the 
 	// whole thing every loop.  Maybe make something better if going 
 	// through this queue turns out to be a big time waster.
+	if (!outgoingQueue.empty())
 	{
 		PROFILER_AUTO_BLOCK_DEFINE("Outgoing Queue");
-		for (OutgoingQueueType::iterator i=outgoingQueue.begin(); i!=outgoingQueue.end(); ++i)
+
+		// Snapshots for a server must go out in the order they were loaded,
+		// so once one fails to send, hold back the rest for that server.
+		std::set<uint32> blockedServers;
+		for (OutgoingQueueType::iterator i=outgoingQueue.begin(); i!=outgoingQueue.end(); )
 		{
-			if ((*i)->send())
+			uint32 const processId = (*i)->getRequestingProcessId();
+			if (m_serverDiscardList.find(processId)!=m_serverDiscardList.end())
+			{
+				DEBUG_REPORT_LOG(true,("Discarding queued snapshot because server has disconnected.\n"));
+				delete *i;
+				i=outgoingQueue.erase(i);
+			}
+			else if (blockedServers.find(processId)==blockedServers.end() && sendSnapshot(**i))
 			{
 				DEBUG_REPORT_LOG(true,("Queued snapshot was sent.\n"));
 				delete *i;
@@ -144,12 +236,8 @@ void Loader::update(real updateTime)
 			}
 			else
 			{
-				if (m_serverDiscardList.find((*i)->getRequestingProcessId())!=m_serverDiscardList.end())
-				{
-					DEBUG_REPORT_LOG(true,("Discarding queued snapshot because server has disconnected.\n"));
-					delete *i;
-					i=outgoingQueue.erase(i);
-				}
+				IGNORE_RETURN(blockedServers.insert(processId));
+				++i;
 			}
 		}
 	}
@@ -184,6 +272,8 @@ void Loader::update(real updateTime)
 			}
 		}
 
+		reportLoadStageStatistics();
+
 		bool updateNeeded = false;
 		int loadQueueSize=taskQ->getNumPendingTasks();
 		if (!m_backlogged)
@@ -312,7 +402,16 @@ void Loader::startLoadForServer(uint32 serverId)
 				{
 					ObjectLocator * const regularLocator = NON_NULL(locators->front().first);
 					ObjectLocator * const goldLocator = locators->front().second;
-					if (dynamic_cast<ChunkLocator*>(regularLocator))
+					ChunkLocator const * const chunkLocator = dynamic_cast<ChunkLocator*>(regularLocator);
+					if (WorldImage::isExporting())
+					{
+						// one locator per group, so each chunk's messages can be recorded separately
+						if (snapshot->getLocatorCount() != 0)
+							break;
+						if (chunkLocator)
+							snapshot->setWorldImageChunk(chunkLocator->getSceneId(), chunkLocator->getNodeX(), chunkLocator->getNodeZ());
+					}
+					if (chunkLocator)
 						chunkCount++;
 					if (dynamic_cast<CharacterLocator*>(regularLocator))
 						chunkCount++;
@@ -374,7 +473,18 @@ void Loader::snapshotLoaded(LoaderSnapshotGroup *snapshot)
 {
 	PROFILER_AUTO_BLOCK_DEFINE("Loader::snapshotLoaded");
 
-	if (snapshot->send())
+	m_loadStageStatistics.queueWaitTimeMs += snapshot->getQueueWaitTimeMs();
+	m_loadStageStatistics.loadTimeMs += snapshot->getLoadTimeMs();
+
+	// Don't let this snapshot overtake earlier ones still waiting to be sent
+	if (hasQueuedSnapshots(snapshot->getRequestingProcessId()))
+	{
+		DEBUG_REPORT_LOG(true,("Earlier snapshots for this server are still queued, queueing for later.\n"));
+		queueOutgoingSnapshot(snapshot);
+		return;
+	}
+
+	if (sendSnapshot(*snapshot))
 	{
 		PROFILER_AUTO_BLOCK_DEFINE("delete snapshot");
 		delete snapshot;
@@ -410,6 +520,61 @@ void Loader::queueOutgoingSnapshot(LoaderSnapshotGroup *outgoingSnapshot)
 
 // ----------------------------------------------------------------------
 
+bool Loader::hasQueuedSnapshots(uint32 processId) const
+{
+	for (OutgoingQueueType::const_iterator i=outgoingQueue.begin(); i!=outgoingQueue.end(); ++i)
+	{
+		if ((*i)->getRequestingProcessId() == processId)
+			return true;
+	}
+	return false;
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Send a loaded snapshot to its game server, recording how long the send
+ * stage took.
+ */
+bool Loader::sendSnapshot(LoaderSnapshotGroup const &snapshot)
+{
+	unsigned long const startTime = Clock::timeMs();
+	bool const result = snapshot.send();
+	m_loadStageStatistics.sendTimeMs += Clock::timeMs() - startTime;
+
+	if (result)
+	{
+		++m_loadStageStatistics.groupCount;
+		m_loadStageStatistics.locatorCount += snapshot.getLocatorCount();
+	}
+	return result;
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Log the per-stage load times for the interval that just ended and make
+ * them available to the metrics.
+ */
+void Loader::reportLoadStageStatistics()
+{
+	LoadStageStatistics const & stats = m_loadStageStatistics;
+	if (stats.groupCount > 0)
+	{
+		LOG("LoadTimes",("Load pipeline:  %i groups (%i locators) sent, average %lu ms queued, %lu ms loading, %lu ms sending",
+			stats.groupCount,
+			stats.locatorCount,
+			stats.queueWaitTimeMs / static_cast<unsigned long>(stats.groupCount),
+			stats.loadTimeMs / static_cast<unsigned long>(stats.groupCount),
+			stats.sendTimeMs / static_cast<unsigned long>(stats.groupCount)));
+	}
+
+	m_lastLoadStageStatistics = m_loadStageStatistics;
+	m_loadStageStatistics = LoadStageStatistics();
+}
+
+// ----------------------------------------------------------------------
+
 void Loader::receiveMessage(const MessageDispatch::Emitter & source, const MessageDispatch::MessageBase & message)
 {
 	UNREF(source);
@@ -429,7 +594,8 @@ void Loader::receiveMessage(const MessageDispatch::Emitter & source, const Messa
 			Archive::ReadIterator ri = static_cast<const GameNetworkMessage &>(message).getByteStream().begin();
 			RequestChunkMessage m(ri);
 			
-			std::vector<RequestChunkMessage::Chunk> const & chunks = m.getChunks();
+			std::vector<RequestChunkMessage::Chunk> chunks(m.getChunks());
+			sortChunksSpatially(chunks);
 			for (std::vector<RequestChunkMessage::Chunk>::const_iterator i=chunks.begin(); i!=chunks.end(); ++i)
 				requestChunk(i->m_process, i->m_nodeX, i->m_nodeZ, m.getSceneId());
 			
@@ -613,6 +779,7 @@ void Loader::loadClock()
 void Loader::loadClockCompleted()
 {
 	DEBUG_FATAL(!ServerClock::getInstance().isSet(),("Clock was not set.\n"));
+	WorldImage::onClockLoaded(static_cast<int>(ServerClock::getInstance().getGameTimeSeconds()));
 	loadStartupData();
 }
 
@@ -676,6 +843,12 @@ void Loader::checkVersionNumber(int expectedVersion, bool fatalOnMismatch)
 
 void Loader::requestChunk(uint32 processId,int nodeX, int nodeZ, const std::string &sceneId)
 {
+	if (WorldImage::hasChunk(sceneId, nodeX, nodeZ))
+	{
+		addLocatorsForServer(processId, new WorldImageChunkLocator(nodeX, nodeZ, sceneId), nullptr);
+		return;
+	}
+
 	ObjectLocator * const regularLocator=new ChunkLocator(nodeX, nodeZ, sceneId, processId, true);
 	ObjectLocator * goldLocator=nullptr;
 	if (ConfigServerDatabase::getEnableGoldDatabase())
@@ -40,6 +40,23 @@ class DBCSRequestMessage;
  */
 class Loader : public MessageDispatch::Receiver
 {
+public:
+	/**
+	 * Time spent by snapshot groups in each stage of the load pipeline
+	 * (waiting for a loader thread, querying and decoding, sending to the
+	 * game server), accumulated over one reporting interval.
+	 */
+	struct LoadStageStatistics
+	{
+		LoadStageStatistics();
+
+		int           groupCount;
+		int           locatorCount;
+		unsigned long queueWaitTimeMs;
+		unsigned long loadTimeMs;
+		unsigned long sendTimeMs;
+	};
+
 public:
 	static Loader &getInstance();
 	virtual void update(real updateTime);
@@ -64,6 +81,7 @@ public:
 	int  getNumPreloads() const;
 	int  getAgeOldestUnackedLoad() const;
 	uint32 getServerOldestUnackedLoad() const;
+	LoadStageStatistics const & getLastLoadStageStatistics() const;
 	void onCharacterLocatorDeleted(const NetworkId &characterId);
 	virtual void locateStructure(const NetworkId &structureId, const std::string whoRequested) =0;
 	
@@ -82,6 +100,9 @@ public:
 	
 private:
 	void                          queueOutgoingSnapshot   (LoaderSnapshotGroup *outgoingSnapshot);
+	bool                          hasQueuedSnapshots      (uint32 processId) const;
+	bool                          sendSnapshot            (LoaderSnapshotGroup const &snapshot);
+	void                          reportLoadStageStatistics ();
 	void                          requestCharacter        (const NetworkId &characterId, uint32 gameServerId);
 	void                          loadContainedObject     (const NetworkId &containerId, const NetworkId &objectId, uint32 gameServerId);
 	void                          loadContents            (const NetworkId &containerId, uint32 gameServerId);
@@ -120,6 +141,8 @@ private:
 	UnackedLoadsTimeType  m_unackedLoadsTime;
 	int                   m_numQueuedLocators;
 	PreloadingProcessesType m_preloadingProcesses;
+	LoadStageStatistics   m_loadStageStatistics;
+	LoadStageStatistics   m_lastLoadStageStatistics;
 	
   protected:
 	DB::TaskQueue *taskQ;
@@ -151,6 +174,13 @@ inline bool Loader::isBacklogged()
 	return m_backlogged;
 }
 
+// ----------------------------------------------------------------------
+
+inline Loader::LoadStageStatistics const & Loader::getLastLoadStageStatistics() const
+{
+	return m_lastLoadStageStatistics;
+}
+
 // ======================================================================
 
 #endif
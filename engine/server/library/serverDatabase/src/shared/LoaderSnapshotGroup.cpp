@@ -8,20 +8,48 @@
 #include "serverDatabase/FirstServerDatabase.h"
 #include "serverDatabase/LoaderSnapshotGroup.h"
 
+#include "Archive/ByteStream.h"
+
 #include "serverDatabase/DatabaseProcess.h"
 #include "serverDatabase/GameServerConnection.h"
 #include "serverDatabase/Snapshot.h"
 #include "serverDatabase/WorldContainerLocator.h"
+#include "serverDatabase/WorldImage.h"
 #include "sharedDebug/Profiler.h"
 #include "sharedNetworkMessages/GenericValueTypeMessage.h"
 
+#include <chrono>
+
+// ======================================================================
+
+namespace LoaderSnapshotGroupNamespace
+{
+	int64 getMonotonicTimeMs();
+}
+
+using namespace LoaderSnapshotGroupNamespace;
+
+// ======================================================================
+
+int64 LoaderSnapshotGroupNamespace::getMonotonicTimeMs()
+{
+	return static_cast<int64>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
 // ======================================================================
 
 LoaderSnapshotGroup::LoaderSnapshotGroup(uint32 requestingProcess, Snapshot *snapshot) :
 		m_requestingProcess(requestingProcess),
 		m_snapshot(snapshot),
 		m_goldSnapshot(0),
-		m_loadSerialNumber(0)
+		m_loadSerialNumber(0),
+		m_recordWorldImageChunk(false),
+		m_worldImageSceneId(),
+		m_worldImageNodeX(0),
+		m_worldImageNodeZ(0),
+		m_createTimeMs(getMonotonicTimeMs()),
+		m_loadStartTimeMs(m_createTimeMs),
+		m_loadEndTimeMs(m_createTimeMs)
 {
 	NOT_NULL(m_snapshot);
 }
@@ -40,6 +68,9 @@ LoaderSnapshotGroup::~LoaderSnapshotGroup()
 
 bool LoaderSnapshotGroup::load(DB::Session *session)
 {
+	m_loadStartTimeMs = getMonotonicTimeMs();
+	m_loadEndTimeMs = m_loadStartTimeMs;
+
 	if (m_goldSnapshot)
 	{
 		if (! (m_goldSnapshot->load(session)))
@@ -52,7 +83,9 @@ bool LoaderSnapshotGroup::load(DB::Session *session)
 	}
 	
 	NOT_NULL(m_snapshot);
-	return (m_snapshot->load(session));
+	bool const result = m_snapshot->load(session);
+	m_loadEndTimeMs = getMonotonicTimeMs();
+	return result;
 }
 
 // ----------------------------------------------------------------------
@@ -67,6 +100,10 @@ bool LoaderSnapshotGroup::send() const
 
 	if (!connection)
 		return false;
+
+	Archive::ByteStream capturedMessages;
+	if (m_recordWorldImageChunk && WorldImage::isExporting())
+		connection->beginCapture(capturedMessages);
 	
 	if (m_goldSnapshot)
 	{
@@ -76,6 +113,13 @@ bool LoaderSnapshotGroup::send() const
 	if (success && !m_snapshot->send(connection))
 		success=false;
 
+	if (m_recordWorldImageChunk && WorldImage::isExporting())
+	{
+		int const capturedCount = connection->endCapture();
+		if (success)
+			WorldImage::recordChunk(m_worldImageSceneId, m_worldImageNodeX, m_worldImageNodeZ, capturedMessages, capturedCount);
+	}
+
 	if (success)
 	{
 		PROFILER_AUTO_BLOCK_DEFINE("send ChunkCompleteMessage");
@@ -140,4 +184,18 @@ void LoaderSnapshotGroup::setLoadSerialNumber(int loadSerialNumber)
 	m_loadSerialNumber = loadSerialNumber;
 }
 
+// ----------------------------------------------------------------------
+
+/**
+ * Record the messages this group sends as the image of the given chunk.
+ * The group must contain nothing but that chunk's locators.
+ */
+void LoaderSnapshotGroup::setWorldImageChunk(const std::string &sceneId, int nodeX, int nodeZ)
+{
+	m_recordWorldImageChunk = true;
+	m_worldImageSceneId = sceneId;
+	m_worldImageNodeX = nodeX;
+	m_worldImageNodeZ = nodeZ;
+}
+
 // ======================================================================
@@ -12,6 +12,8 @@
 
 #include "sharedFoundation/NetworkId.h"
 
+#include <string>
+
 namespace DB
 {
 	class Session;
@@ -35,6 +37,10 @@ class LoaderSnapshotGroup
 	void setUniverseAuthHack       ();
 	uint32 getRequestingProcessId  () const;
 	void setLoadSerialNumber       (int loadSerialNumber);
+	void setWorldImageChunk        (const std::string &sceneId, int nodeX, int nodeZ);
+
+	unsigned long getQueueWaitTimeMs () const;
+	unsigned long getLoadTimeMs      () const;
 
   private:
 	virtual Snapshot *makeGoldSnapshot()=0;
@@ -46,6 +52,19 @@ class LoaderSnapshotGroup
 	Snapshot *m_snapshot;
 	Snapshot *m_goldSnapshot;
 	int m_loadSerialNumber;
+
+	// chunk to record into the WorldImage when this group is sent, if any
+	bool m_recordWorldImageChunk;
+	std::string m_worldImageSceneId;
+	int m_worldImageNodeX;
+	int m_worldImageNodeZ;
+
+	// stage timestamps, used to report loader pipeline throughput.  These are
+	// taken on loader threads, so they come from a monotonic clock rather than
+	// Clock::timeMs()
+	int64 m_createTimeMs;
+	int64 m_loadStartTimeMs;
+	int64 m_loadEndTimeMs;
 };
 
 // ----------------------------------------------------------------------
@@ -55,6 +74,26 @@ inline uint32 LoaderSnapshotGroup::getRequestingProcessId() const
 	return m_requestingProcess;
 }
 
+// ----------------------------------------------------------------------
+
+/**
+ * Time the group spent waiting for a loader thread to pick it up.
+ */
+inline unsigned long LoaderSnapshotGroup::getQueueWaitTimeMs() const
+{
+	return (m_loadStartTimeMs > m_createTimeMs) ? static_cast<unsigned long>(m_loadStartTimeMs - m_createTimeMs) : 0;
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Time the group spent running its queries and decoding the rows.
+ */
+inline unsigned long LoaderSnapshotGroup::getLoadTimeMs() const
+{
+	return (m_loadEndTimeMs > m_loadStartTimeMs) ? static_cast<unsigned long>(m_loadEndTimeMs - m_loadStartTimeMs) : 0;
+}
+
 // ======================================================================
 
 #endif
@@ -26,6 +26,7 @@
 #include "serverDatabase/TaskSaveSnapshot.h"
 #include "serverDatabase/TaskChangeStationId.h"
 #include "serverDatabase/UnloadCharacterCustomPersistStep.h"
+#include "serverDatabase/WorldImage.h"
 #include "serverNetworkMessages/AddCharacterMessage.h"
 #include "serverNetworkMessages/AddResourceTypeMessage.h"
 #include "serverNetworkMessages/BountyHunterTargetMessage.h"
@@ -121,6 +122,8 @@ Persister::Persister() :
 		m_lastSaveTime(0),
 		m_lastSaveTotalObjectCount(0),
 		m_lastSaveNewObjectCount(0),
+		m_lastSaveDeltaCount(0),
+		m_lastSaveCoalescedDeltaCount(0),
 		m_lastSaveCompletionTime(),
 		m_saveCounter(0),
 		m_startSaveWhenPossible(false),
@@ -303,6 +306,20 @@ void Persister::startSave(void)
 	
 	m_newObjectCount=0;
 
+	m_lastSaveDeltaCount=0;
+	m_lastSaveCoalescedDeltaCount=0;
+	for (ServerSnapshotMap::const_iterator snap=m_currentSnapshots.begin(); snap!=m_currentSnapshots.end(); ++snap)
+	{
+		m_lastSaveDeltaCount+=snap->second->getDeltaCount();
+		m_lastSaveCoalescedDeltaCount+=snap->second->getCoalescedDeltaCount();
+	}
+	for (ServerSnapshotMap::const_iterator snap=m_newObjectSnapshots.begin(); snap!=m_newObjectSnapshots.end(); ++snap)
+	{
+		m_lastSaveDeltaCount+=snap->second->getDeltaCount();
+		m_lastSaveCoalescedDeltaCount+=snap->second->getCoalescedDeltaCount();
+	}
+	LOG("SaveTimes",("Save has %i delta fields, %i were replaced by a later value before being decoded",m_lastSaveDeltaCount,m_lastSaveCoalescedDeltaCount));
+
 	// delete any characters for this save cycle
 	if (m_charactersToDeleteNextSaveCycle && m_charactersToDeleteThisSaveCycle)
 	{
@@ -329,6 +346,10 @@ void Persister::startSave(void)
 	if (!m_currentSnapshots.empty())
 		m_currentSnapshots.begin()->second->takeTimestamp();
 
+	// the database is about to change, so it no longer matches the world image
+	if (!m_currentSnapshots.empty() || !m_newObjectSnapshots.empty())
+		WorldImage::onDatabaseSave();
+
 	// queue up snapshots to be saved
 	ServerSnapshotMap::iterator i;
 	for (i=m_currentSnapshots.begin(); i!=m_currentSnapshots.end(); ++i)
@@ -497,7 +518,9 @@ void Persister::handleBaselinesMessage(uint32 serverId, const BaselinesMessage &
 
 void Persister::handleDeleteMessage(uint32 serverId, const NetworkId &objectId, int reasonCode, bool immediate, bool demandLoadedContainer, bool cascadeReason)
 {
-	getSnapshotForObject(objectId,serverId)->handleDeleteMessage(objectId, reasonCode, immediate, demandLoadedContainer, cascadeReason);
+	Snapshot * const snapshot = getSnapshotForObject(objectId,serverId);
+	snapshot->flushPendingDeltas(objectId);
+	snapshot->handleDeleteMessage(objectId, reasonCode, immediate, demandLoadedContainer, cascadeReason);
 }
 
 // ----------------------------------------------------------------------
@@ -709,7 +732,9 @@ void Persister::receiveMessage(const MessageDispatch::Emitter & source, const Me
 			auto ri = static_cast<const GameNetworkMessage &>(message).getByteStream().begin();
 			UpdateObjectPositionMessage msg(ri);
 
-			getSnapshotForObject(msg.getNetworkId(), sourceGameServer)->handleUpdateObjectPosition(msg);
+			Snapshot * const snapshot = getSnapshotForObject(msg.getNetworkId(), sourceGameServer);
+			snapshot->flushPendingDeltas(msg.getNetworkId());
+			snapshot->handleUpdateObjectPosition(msg);
 			break;
 		}
 		case constcrc("AddCharacterMessage") :
@@ -80,6 +80,8 @@ class Persister : public MessageDispatch::Receiver
 	int getLastSaveTime();
 	int getLastSaveTotalObjectCount();
 	int getLastSaveNewObjectCount();
+	int getLastSaveDeltaCount();
+	int getLastSaveCoalescedDeltaCount();
 	std::string getLastSaveCompletionTime();
 
 	void unloadCharacter(const NetworkId &characterId, uint32 sourceServer);
@@ -134,6 +136,8 @@ class Persister : public MessageDispatch::Receiver
 	int                    m_lastSaveTime;
 	int                    m_lastSaveTotalObjectCount;
 	int                    m_lastSaveNewObjectCount;
+	int                    m_lastSaveDeltaCount;
+	int                    m_lastSaveCoalescedDeltaCount;
 	std::string            m_lastSaveCompletionTime;
 	int                    m_saveCounter;
 
@@ -235,6 +239,20 @@ inline int Persister::getLastSaveNewObjectCount()
 	return m_lastSaveNewObjectCount;
 }
 
+// ----------------------------------------------------------------------
+
+inline int Persister::getLastSaveDeltaCount()
+{
+	return m_lastSaveDeltaCount;
+}
+
+// ----------------------------------------------------------------------
+
+inline int Persister::getLastSaveCoalescedDeltaCount()
+{
+	return m_lastSaveCoalescedDeltaCount;
+}
+
 // ======================================================================
 
 #endif
@@ -9,6 +9,7 @@
 #include "serverDatabase/Snapshot.h"
 
 #include "serverDatabase/AbstractTableBuffer.h"
+#include "serverDatabase/ConfigServerDatabase.h"
 #include "serverDatabase/CustomPersistStep.h"
 #include "serverDatabase/ObjectLocator.h"
 #include "serverDatabase/SaveTimestampQuery.h"
@@ -29,7 +30,10 @@ Snapshot::Snapshot(DB::ModeQuery::Mode mode, bool useGoldDatabase) :
 		m_isBeingSaved(false),
 		m_useGoldDatabase(useGoldDatabase),
 		m_mode(mode),
-		m_timestamp(0)
+		m_timestamp(0),
+		m_pendingDeltas(),
+		m_deltaCount(0),
+		m_coalescedDeltaCount(0)
 {
 	LOG("Snapshot",("Created snapshot"));
 	++ms_creationCount;
@@ -80,8 +84,11 @@ bool Snapshot::saveToDB(DB::Session *session)
 /**
  * Called when a message is received to update an object's data.
  *
- * Identifies what package the message is part of, and invokes the
- * appropriate (virtual) function.
+ * Deltas that carry a single field holding a plain value are not decoded
+ * yet.  Only the latest value for each field is kept, and is decoded when
+ * the snapshot is saved, so a field that changes many times between saves
+ * is decoded once.  Anything else is decoded immediately, after any
+ * pending values for the object so that updates are applied in order.
  */
 
 void Snapshot::handleDeltasMessage(NetworkId & objectId, const DeltasMessage &msg)
@@ -92,39 +99,126 @@ void Snapshot::handleDeltasMessage(NetworkId & objectId, const DeltasMessage &ms
 	uint16 count;
 	Archive::get(bs,count);
 	DEBUG_REPORT_LOG(count==0,("Deltas package was empty.\n"));
+	m_deltaCount += count;
+
+	if (count == 1 && ConfigServerDatabase::getEnableDeltaCoalescing())
+	{
+		Archive::ReadIterator field(bs);
+		unsigned short int index;
+		Archive::get(field,index);
+
+		if (isLatestValueField(packageId, typeId, index))
+		{
+			PendingDeltaFieldMap &fields = m_pendingDeltas[objectId];
+			std::pair<PendingDeltaFieldMap::iterator, bool> const result = fields.insert(std::make_pair(PendingDeltaKey(packageId, index), PendingDelta()));
+			if (!result.second)
+			{
+				++m_coalescedDeltaCount;
+				result.first->second.m_data.clear();
+			}
+			result.first->second.m_typeId = typeId;
+			result.first->second.m_data.put(field.getBuffer(), field.getSize());
+			return;
+		}
+	}
+
+	flushPendingDeltas(objectId);
+
 	for (uint16 i=0; i< count; ++i)
 	{
 		unsigned short int index;
 		Archive::get(bs,index);
+		decodeDelta(objectId, packageId, typeId, index, bs);
+	}
+}
 
-		switch (packageId) {
- 			case DeltasMessage::DELTAS_SERVER:
-				decodeServerData(objectId,typeId,index,bs,false);
-				break;
-			case DeltasMessage::DELTAS_SHARED:
-				decodeSharedData(objectId,typeId,index,bs,false);
-				break;
-			case DeltasMessage::DELTAS_CLIENT_SERVER:
-				decodeClientData(objectId,typeId,index,bs,false);
-				break;
-			case DeltasMessage::DELTAS_FIRST_PARENT_CLIENT_SERVER:
-				decodeParentClientData(objectId,typeId,index,bs,false);
-				break;
-                        case DeltasMessage::DELTAS_SERVER_NP:
-                        case DeltasMessage::DELTAS_SHARED_NP:
-                        case DeltasMessage::DELTAS_CLIENT_SERVER_NP:			
-			case DeltasMessage::DELTAS_FIRST_PARENT_CLIENT_SERVER_NP:
-			case DeltasMessage::DELTAS_UI:
-				break;
-			default:
-				FATAL(true,("PackageId was invalid."));
-				break;
-		}
+// ----------------------------------------------------------------------
+
+void Snapshot::decodeDelta(const NetworkId &objectId, unsigned char packageId, Tag typeId, uint16 index, Archive::ReadIterator &bs)
+{
+	switch (packageId) {
+		case DeltasMessage::DELTAS_SERVER:
+			decodeServerData(objectId,typeId,index,bs,false);
+			break;
+		case DeltasMessage::DELTAS_SHARED:
+			decodeSharedData(objectId,typeId,index,bs,false);
+			break;
+		case DeltasMessage::DELTAS_CLIENT_SERVER:
+			decodeClientData(objectId,typeId,index,bs,false);
+			break;
+		case DeltasMessage::DELTAS_FIRST_PARENT_CLIENT_SERVER:
+			decodeParentClientData(objectId,typeId,index,bs,false);
+			break;
+		case DeltasMessage::DELTAS_SERVER_NP:
+		case DeltasMessage::DELTAS_SHARED_NP:
+		case DeltasMessage::DELTAS_CLIENT_SERVER_NP:
+		case DeltasMessage::DELTAS_FIRST_PARENT_CLIENT_SERVER_NP:
+		case DeltasMessage::DELTAS_UI:
+			break;
+		default:
+			FATAL(true,("PackageId was invalid."));
+			break;
 	}
 }
 
 // ----------------------------------------------------------------------
 
+/**
+ * Decode all the field values that are waiting to be decoded.  Must be
+ * called before the snapshot is saved.
+ */
+void Snapshot::flushPendingDeltas()
+{
+	for (PendingDeltaMap::const_iterator i=m_pendingDeltas.begin(); i!=m_pendingDeltas.end(); ++i)
+		decodePendingDeltas(i->first, i->second);
+	m_pendingDeltas.clear();
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Decode the field values waiting to be decoded for one object.  Called
+ * before anything else that changes the object's rows is applied.
+ */
+void Snapshot::flushPendingDeltas(const NetworkId &objectId)
+{
+	PendingDeltaMap::iterator const i=m_pendingDeltas.find(objectId);
+	if (i!=m_pendingDeltas.end())
+	{
+		decodePendingDeltas(i->first, i->second);
+		m_pendingDeltas.erase(i);
+	}
+}
+
+// ----------------------------------------------------------------------
+
+void Snapshot::decodePendingDeltas(const NetworkId &objectId, PendingDeltaFieldMap const &fields)
+{
+	for (PendingDeltaFieldMap::const_iterator f=fields.begin(); f!=fields.end(); ++f)
+	{
+		Archive::ReadIterator bs=f->second.m_data.begin();
+		decodeDelta(objectId, f->first.first, f->second.m_typeId, f->first.second, bs);
+	}
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Whether a field only ever holds a single value, so that a later delta
+ * for it completely replaces an earlier one.  Container fields, whose
+ * deltas are edit commands, must return false.  The default is false for
+ * every field, i.e. no coalescing.
+ */
+bool Snapshot::isLatestValueField(unsigned char packageId, Tag typeId, uint16 index) const
+{
+	UNREF(packageId);
+	UNREF(typeId);
+	UNREF(index);
+	return false;
+}
+
+// ----------------------------------------------------------------------
+
 /**
  * Called when a message is received to update an object's data.
  *
@@ -134,6 +228,8 @@ void Snapshot::handleDeltasMessage(NetworkId & objectId, const DeltasMessage &ms
 
 void Snapshot::handleBaselinesMessage(NetworkId &objectId, const BaselinesMessage &msg)
 {
+	flushPendingDeltas(objectId);
+
 	unsigned char packageId=msg.getPackageId();
 	Tag typeId=msg.getTypeId();
 	Archive::ReadIterator bs=msg.getPackage().begin();
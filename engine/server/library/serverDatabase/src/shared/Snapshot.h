@@ -17,6 +17,8 @@
 #include "sharedNetworkMessages/BatchBaselinesMessage.h"
 #include "sharedNetworkMessages/DeltasMessage.h"
 
+#include <map>
+
 namespace DB
 {
 	class Session;
@@ -55,6 +57,10 @@ public:
 
 	void handleDeltasMessage           (NetworkId & objectId, const DeltasMessage &msg);
 	void handleBaselinesMessage        (NetworkId & objectId, const BaselinesMessage &msg);
+	void flushPendingDeltas            ();
+	void flushPendingDeltas            (const NetworkId &objectId);
+	int  getDeltaCount                 () const;
+	int  getCoalescedDeltaCount        () const;
 	
 	virtual bool saveToDB              (DB::Session *session) =0;
 	virtual bool load                  (DB::Session *session) =0;
@@ -95,10 +101,31 @@ public:
 	int getTimeStamp   () const;
 	bool saveTimestamp (DB::Session *session);
 	
+  private:
+	/**
+	 * The latest value received for a field that is not decoded until the
+	 * snapshot is saved.  Holds the encoded field, without its index.
+	 */
+	struct PendingDelta
+	{
+		Tag                 m_typeId;
+		Archive::ByteStream m_data;
+	};
+
+	typedef std::pair<unsigned char, uint16> PendingDeltaKey; // package, index
+	typedef std::map<PendingDeltaKey, PendingDelta> PendingDeltaFieldMap;
+	typedef std::map<NetworkId, PendingDeltaFieldMap> PendingDeltaMap;
+
+	void decodeDelta(const NetworkId &objectId, unsigned char packageId, Tag typeId, uint16 index, Archive::ReadIterator &bs);
+	void decodePendingDeltas(const NetworkId &objectId, PendingDeltaFieldMap const &fields);
+
   private:
 	bool m_useGoldDatabase;
 	DB::ModeQuery::Mode m_mode;
 	int m_timestamp;
+	PendingDeltaMap m_pendingDeltas;
+	int m_deltaCount;
+	int m_coalescedDeltaCount;
 
 public:
 	bool m_isBeingSaved;
@@ -115,6 +142,8 @@ private:
 	virtual void decodeSharedData(const NetworkId & objectId, Tag typeId, uint16 index, Archive::ReadIterator &bs, bool isBaseline) = 0;
 	virtual void decodeClientData(const NetworkId & objectId, Tag typeId, uint16 index, Archive::ReadIterator &bs, bool isBaseline) = 0;
 	virtual void decodeParentClientData(const NetworkId & objectId, Tag typeId, uint16 index, Archive::ReadIterator &bs, bool isBaseline) = 0;
+
+	virtual bool isLatestValueField(unsigned char packageId, Tag typeId, uint16 index) const;
 	
 	virtual bool encodeParentClientData(NetworkId const & objectId, Tag typeId, std::vector<BatchBaselinesMessageData> &baselines) const = 0;
 	virtual bool encodeClientData(NetworkId const & objectId, Tag typeId, std::vector<BatchBaselinesMessageData> &baselines) const = 0;
@@ -159,5 +188,26 @@ inline int Snapshot::getTimeStamp() const
 	return m_timestamp;
 }
 
+// ----------------------------------------------------------------------
+
+/**
+ * Number of fields received in deltas messages.
+ */
+inline int Snapshot::getDeltaCount() const
+{
+	return m_deltaCount;
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Number of field updates that were replaced by a later value before
+ * they were decoded.
+ */
+inline int Snapshot::getCoalescedDeltaCount() const
+{
+	return m_coalescedDeltaCount;
+}
+
 // ======================================================================
 #endif
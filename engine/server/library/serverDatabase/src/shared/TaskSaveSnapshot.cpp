@@ -15,6 +15,8 @@
 
 TaskSaveSnapshot::TaskSaveSnapshot(Snapshot *snapshot) : m_snapshot(snapshot)
 {
+	// the snapshot is sealed once it is handed to a worker thread
+	m_snapshot->flushPendingDeltas();
 }
 
 // ----------------------------------------------------------------------
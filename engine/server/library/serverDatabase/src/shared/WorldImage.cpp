@@ -0,0 +1,419 @@
+// ======================================================================
+//
+// WorldImage.cpp
+// copyright (c) 2001 Sony Online Entertainment
+//
+// ======================================================================
+
+#include "serverDatabase/FirstServerDatabase.h"
+#include "serverDatabase/WorldImage.h"
+
+#include "Archive/ByteStream.h"
+#include "serverDatabase/ConfigServerDatabase.h"
+#include "serverDatabase/GameServerConnection.h"
+#include "sharedFoundation/Clock.h"
+#include "sharedFoundation/Crc.h"
+#include "sharedFoundation/ExitChain.h"
+#include "sharedLog/Log.h"
+
+#include <algorithm>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// ======================================================================
+
+using namespace WorldImageFormat;
+
+// ======================================================================
+
+unsigned char const *        WorldImage::ms_image         = nullptr;
+unsigned int                 WorldImage::ms_imageSize     = 0;
+WorldImage::Entry const *    WorldImage::ms_entries       = nullptr;
+uint32                       WorldImage::ms_entryCount    = 0;
+int32                        WorldImage::ms_clockStamp    = 0;
+bool                         WorldImage::ms_clockValidated = false;
+bool                         WorldImage::ms_databaseChanged = false;
+int                          WorldImage::ms_replayCount   = 0;
+FILE *                       WorldImage::ms_exportFile    = nullptr;
+std::string                  WorldImage::ms_exportFileName;
+std::set<WorldImage::Entry>  WorldImage::ms_exportEntries;
+uint32                       WorldImage::ms_exportOffset  = 0;
+int32                        WorldImage::ms_exportClockStamp = 0;
+
+// ======================================================================
+
+void WorldImage::install()
+{
+	ExitChain::add(&remove, "WorldImage::remove");
+
+	std::string const imageFile(ConfigServerDatabase::getWorldImageFile());
+	std::string const exportFile(ConfigServerDatabase::getWorldImageExportFile());
+
+	if (!imageFile.empty() && !exportFile.empty())
+	{
+		WARNING(true,("Both worldImageFile and worldImageExportFile are set.  Ignoring worldImageFile, the world will be loaded from the database and exported."));
+		IGNORE_RETURN(openExport(exportFile));
+	}
+	else if (!exportFile.empty())
+		IGNORE_RETURN(openExport(exportFile));
+	else if (!imageFile.empty())
+		IGNORE_RETURN(openImage(imageFile));
+}
+
+// ----------------------------------------------------------------------
+
+void WorldImage::remove()
+{
+	finishExport();
+	closeImage();
+}
+
+// ----------------------------------------------------------------------
+
+WorldImage::Entry WorldImage::makeKey(const std::string &sceneId, int nodeX, int nodeZ)
+{
+	Entry key;
+	key.m_sceneCrc = Crc::calculate(sceneId.c_str());
+	key.m_nodeX = nodeX;
+	key.m_nodeZ = nodeZ;
+	key.m_offset = 0;
+	key.m_length = 0;
+	key.m_messageCount = 0;
+	return key;
+}
+
+// ----------------------------------------------------------------------
+
+WorldImage::Entry const * WorldImage::findEntry(const std::string &sceneId, int nodeX, int nodeZ)
+{
+	if (!ms_entries)
+		return nullptr;
+
+	Entry const key(makeKey(sceneId, nodeX, nodeZ));
+	Entry const * const end = ms_entries + ms_entryCount;
+	Entry const * const entry = std::lower_bound(ms_entries, end, key);
+	if (entry == end || key < *entry)
+		return nullptr;
+	return entry;
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Called once the database clock has been read at startup.  An image is
+ * only served if it was exported at exactly this clock, i.e. nothing has
+ * been saved to the database since.  An export is stamped with it.
+ */
+void WorldImage::onClockLoaded(int gameTimeSeconds)
+{
+	if (ms_exportFile)
+		ms_exportClockStamp = static_cast<int32>(gameTimeSeconds);
+
+	if (ms_entries && !ms_clockValidated)
+	{
+		if (ms_clockStamp == static_cast<int32>(gameTimeSeconds))
+		{
+			ms_clockValidated = true;
+			LOG("LoadTimes",("World image matches the database clock (%d), serving %lu chunks from it", gameTimeSeconds, ms_entryCount));
+		}
+		else
+		{
+			WARNING(true,("World image was exported at database clock %ld but the database is at %d, loading the world from the database.", ms_clockStamp, gameTimeSeconds));
+			closeImage();
+		}
+	}
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Called when a save that writes to the database starts.  Chunks already
+ * queued from the image are still replayed, but the database no longer
+ * matches it, so no new requests are answered from it and an export in
+ * progress is finished with what has been recorded so far.
+ */
+void WorldImage::onDatabaseSave()
+{
+	if (ms_entries && !ms_databaseChanged)
+	{
+		ms_databaseChanged = true;
+		LOG("LoadTimes",("Database save started, no further chunk requests will be answered from the world image (%d served)", ms_replayCount));
+	}
+
+	if (ms_exportFile)
+	{
+		LOG("LoadTimes",("Database save started, finishing the world image export"));
+		finishExport();
+	}
+}
+
+// ======================================================================
+
+/**
+ * Map an exported image into memory and validate its index.
+ */
+bool WorldImage::openImage(const std::string &fileName)
+{
+	unsigned long const startTime = Clock::timeMs();
+
+#ifndef WIN32
+	int const fd = open(fileName.c_str(), O_RDONLY);
+	if (fd == -1)
+	{
+		WARNING(true,("Could not open world image %s, loading the world from the database.", fileName.c_str()));
+		return false;
+	}
+
+	struct stat fileInfo;
+	if (fstat(fd, &fileInfo) != 0 || fileInfo.st_size < static_cast<off_t>(sizeof(Header)))
+	{
+		close(fd);
+		WARNING(true,("World image %s is truncated, loading the world from the database.", fileName.c_str()));
+		return false;
+	}
+
+	void * const mapped = mmap(0, static_cast<size_t>(fileInfo.st_size), PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (mapped == MAP_FAILED)
+	{
+		WARNING(true,("Could not map world image %s, loading the world from the database.", fileName.c_str()));
+		return false;
+	}
+
+	// the index is binary searched for every chunk request, keep it resident
+	IGNORE_RETURN(madvise(mapped, static_cast<size_t>(fileInfo.st_size), MADV_WILLNEED));
+
+	ms_image = static_cast<unsigned char const *>(mapped);
+	ms_imageSize = static_cast<unsigned int>(fileInfo.st_size);
+#else
+	FILE * const f = fopen(fileName.c_str(), "rb");
+	if (!f)
+	{
+		WARNING(true,("Could not open world image %s, loading the world from the database.", fileName.c_str()));
+		return false;
+	}
+
+	IGNORE_RETURN(fseek(f, 0, SEEK_END));
+	long const fileSize = ftell(f);
+	IGNORE_RETURN(fseek(f, 0, SEEK_SET));
+
+	unsigned char * const buffer = new unsigned char[static_cast<size_t>(std::max(fileSize, 1L))];
+	if (fileSize < static_cast<long>(sizeof(Header)) || fread(buffer, 1, static_cast<size_t>(fileSize), f) != static_cast<size_t>(fileSize))
+	{
+		fclose(f);
+		delete [] buffer;
+		WARNING(true,("World image %s is truncated, loading the world from the database.", fileName.c_str()));
+		return false;
+	}
+	fclose(f);
+
+	ms_image = buffer;
+	ms_imageSize = static_cast<unsigned int>(fileSize);
+#endif
+
+	Header const * const header = reinterpret_cast<Header const *>(ms_image);
+	if (header->m_magic != cs_magic || header->m_version != cs_version)
+	{
+		WARNING(true,("World image %s has an unsupported format (version %lu, expected %lu), loading the world from the database.", fileName.c_str(), header->m_version, cs_version));
+		closeImage();
+		return false;
+	}
+
+	if (header->m_indexOffset < sizeof(Header) || header->m_indexOffset > ms_imageSize || (ms_imageSize - header->m_indexOffset) / sizeof(Entry) < header->m_entryCount)
+	{
+		WARNING(true,("World image %s has a corrupt index, loading the world from the database.", fileName.c_str()));
+		closeImage();
+		return false;
+	}
+
+	Entry const * const entries = reinterpret_cast<Entry const *>(ms_image + header->m_indexOffset);
+	for (uint32 i = 0; i < header->m_entryCount; ++i)
+	{
+		if (entries[i].m_offset < sizeof(Header) || entries[i].m_offset > header->m_indexOffset || entries[i].m_length > header->m_indexOffset - entries[i].m_offset)
+		{
+			WARNING(true,("World image %s has a corrupt index, loading the world from the database.", fileName.c_str()));
+			closeImage();
+			return false;
+		}
+	}
+
+	ms_entries = entries;
+	ms_entryCount = header->m_entryCount;
+	ms_clockStamp = header->m_clockStamp;
+	ms_clockValidated = false;
+	ms_databaseChanged = false;
+
+	LOG("LoadTimes",("Opened world image %s (%lu chunks, %u bytes, clock %ld) in %lu ms, waiting for the database clock", fileName.c_str(), ms_entryCount, ms_imageSize, ms_clockStamp, Clock::timeMs() - startTime));
+	return true;
+}
+
+// ----------------------------------------------------------------------
+
+void WorldImage::closeImage()
+{
+	if (ms_image)
+	{
+		if (ms_entries)
+			LOG("LoadTimes",("World image closed, %d chunk loads were served from it", ms_replayCount));
+
+#ifndef WIN32
+		IGNORE_RETURN(munmap(const_cast<unsigned char *>(ms_image), ms_imageSize));
+#else
+		delete [] const_cast<unsigned char *>(ms_image);
+#endif
+	}
+
+	ms_image = nullptr;
+	ms_imageSize = 0;
+	ms_entries = nullptr;
+	ms_entryCount = 0;
+	ms_clockStamp = 0;
+	ms_clockValidated = false;
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Whether a new request for the chunk should be answered from the image.
+ */
+bool WorldImage::hasChunk(const std::string &sceneId, int nodeX, int nodeZ)
+{
+	return isServing() && findEntry(sceneId, nodeX, nodeZ) != nullptr;
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Send the recorded messages for a chunk to a game server.  This still
+ * works after the image has stopped answering new requests, so chunks
+ * that were already queued from it are delivered.
+ *
+ * @return true if the image contained the chunk.  The caller is
+ * responsible for the ChunkCompleteMessage.
+ */
+bool WorldImage::replayChunk(const std::string &sceneId, int nodeX, int nodeZ, GameServerConnection &connection)
+{
+	Entry const * const entry = findEntry(sceneId, nodeX, nodeZ);
+	if (!entry)
+		return false;
+
+	unsigned char const * data = ms_image + entry->m_offset;
+	unsigned char const * const dataEnd = data + entry->m_length;
+	for (uint32 i = 0; i < entry->m_messageCount; ++i)
+	{
+		uint32 size;
+		if (static_cast<size_t>(dataEnd - data) < sizeof(size))
+			break;
+		memcpy(&size, data, sizeof(size));
+		data += sizeof(size);
+		if (static_cast<uint32>(dataEnd - data) < size)
+			break;
+
+		Archive::ByteStream const message(data, size);
+		connection.sendPacked(message);
+		data += size;
+	}
+
+	WARNING(data != dataEnd,("World image entry for chunk %s (%d, %d) is truncated", sceneId.c_str(), nodeX, nodeZ));
+	++ms_replayCount;
+	return true;
+}
+
+// ======================================================================
+
+bool WorldImage::openExport(const std::string &fileName)
+{
+	ms_exportFileName = fileName;
+	ms_exportFile = fopen((fileName + ".tmp").c_str(), "wb");
+	if (!ms_exportFile)
+	{
+		WARNING(true,("Could not create world image %s.tmp, the world will not be exported.", fileName.c_str()));
+		return false;
+	}
+
+	// placeholder, rewritten by finishExport() once the index is known
+	Header header;
+	header.m_magic = 0;
+	header.m_version = cs_version;
+	header.m_entryCount = 0;
+	header.m_indexOffset = 0;
+	header.m_clockStamp = 0;
+	IGNORE_RETURN(fwrite(&header, sizeof(header), 1, ms_exportFile));
+	ms_exportOffset = sizeof(header);
+
+	LOG("LoadTimes",("Exporting chunk loads to world image %s", fileName.c_str()));
+	return true;
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Append the messages sent for one chunk to the image being exported.
+ * Only the first load of each chunk is kept.
+ */
+void WorldImage::recordChunk(const std::string &sceneId, int nodeX, int nodeZ, const Archive::ByteStream &messages, int messageCount)
+{
+	if (!ms_exportFile)
+		return;
+
+	Entry entry(makeKey(sceneId, nodeX, nodeZ));
+	if (ms_exportEntries.find(entry) != ms_exportEntries.end())
+		return;
+
+	if (fwrite(messages.getBuffer(), 1, messages.getSize(), ms_exportFile) != messages.getSize())
+	{
+		WARNING(true,("Write to world image %s.tmp failed, abandoning the export.", ms_exportFileName.c_str()));
+		fclose(ms_exportFile);
+		ms_exportFile = nullptr;
+		ms_exportEntries.clear();
+		return;
+	}
+
+	entry.m_offset = ms_exportOffset;
+	entry.m_length = messages.getSize();
+	entry.m_messageCount = static_cast<uint32>(messageCount);
+	ms_exportOffset += messages.getSize();
+	IGNORE_RETURN(ms_exportEntries.insert(entry));
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Write the sorted index and the real header, then move the image into
+ * place so a partially written file is never picked up as an image.
+ */
+void WorldImage::finishExport()
+{
+	if (!ms_exportFile)
+		return;
+
+	Header header;
+	header.m_magic = cs_magic;
+	header.m_version = cs_version;
+	header.m_entryCount = static_cast<uint32>(ms_exportEntries.size());
+	header.m_indexOffset = ms_exportOffset;
+	header.m_clockStamp = ms_exportClockStamp;
+
+	bool ok = true;
+	for (std::set<Entry>::const_iterator i = ms_exportEntries.begin(); ok && i != ms_exportEntries.end(); ++i)
+		ok = (fwrite(&*i, sizeof(Entry), 1, ms_exportFile) == 1);
+
+	ok = ok && fseek(ms_exportFile, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, ms_exportFile) == 1;
+	ok = (fclose(ms_exportFile) == 0) && ok;
+	ms_exportFile = nullptr;
+
+	std::string const tempFileName(ms_exportFileName + ".tmp");
+	if (ok && rename(tempFileName.c_str(), ms_exportFileName.c_str()) == 0)
+		LOG("LoadTimes",("Wrote world image %s at database clock %ld, %lu chunks, %lu bytes", ms_exportFileName.c_str(), header.m_clockStamp, header.m_entryCount, header.m_indexOffset + header.m_entryCount * sizeof(Entry)));
+	else
+		WARNING(true,("Could not write world image %s", ms_exportFileName.c_str()));
+
+	ms_exportEntries.clear();
+}
+
+// ======================================================================
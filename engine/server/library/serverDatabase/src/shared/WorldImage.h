@@ -0,0 +1,114 @@
+// ======================================================================
+//
+// WorldImage.h
+// copyright (c) 2001 Sony Online Entertainment
+//
+// ======================================================================
+
+#ifndef INCLUDED_WorldImage_H
+#define INCLUDED_WorldImage_H
+
+// ======================================================================
+
+#include "serverDatabase/WorldImageFormat.h"
+
+#include <cstdio>
+#include <set>
+#include <string>
+
+namespace Archive
+{
+	class ByteStream;
+}
+class GameServerConnection;
+
+// ======================================================================
+
+/**
+ * A binary image of the messages the Loader sends to game servers when
+ * they request chunks of the world.
+ *
+ * With worldImageExportFile set, every chunk loaded from the database is
+ * recorded, exactly as it was packed for the game server, into the image.
+ * The image is stamped with the database clock it was read at and is
+ * finished when the process shuts down, or as soon as the first save
+ * changes the database.
+ *
+ * With worldImageFile set, the image is mapped into memory and, once the
+ * database clock has been loaded and matches the image's stamp, chunk
+ * requests it covers are queued as WorldImageChunkLocators.  They go
+ * through the same per-server queue, load serial numbers and acks as
+ * database loads, but replay the recorded messages instead of running
+ * any chunk queries.  Chunks the image does not cover are loaded from the
+ * database as usual.  The first save that changes the database stops the
+ * image from answering any further requests.
+ *
+ * See WorldImageFormat for the file layout.
+ */
+class WorldImage
+{
+  public:
+	static void install();
+
+	static bool isExporting();
+	static bool isServing();
+
+	static void onClockLoaded   (int gameTimeSeconds);
+	static void onDatabaseSave  ();
+
+	static bool hasChunk        (const std::string &sceneId, int nodeX, int nodeZ);
+	static void recordChunk     (const std::string &sceneId, int nodeX, int nodeZ, const Archive::ByteStream &messages, int messageCount);
+	static bool replayChunk     (const std::string &sceneId, int nodeX, int nodeZ, GameServerConnection &connection);
+
+  private:
+	typedef WorldImageFormat::Header Header;
+	typedef WorldImageFormat::Entry  Entry;
+
+  private:
+	static void remove();
+	static bool openImage(const std::string &fileName);
+	static void closeImage();
+	static bool openExport(const std::string &fileName);
+	static void finishExport();
+	static Entry makeKey(const std::string &sceneId, int nodeX, int nodeZ);
+	static Entry const * findEntry(const std::string &sceneId, int nodeX, int nodeZ);
+
+  private:
+	// serving
+	static unsigned char const * ms_image;
+	static unsigned int          ms_imageSize;
+	static Entry const *         ms_entries;
+	static uint32                ms_entryCount;
+	static int32                 ms_clockStamp;
+	static bool                  ms_clockValidated;
+	static bool                  ms_databaseChanged;
+	static int                   ms_replayCount;
+
+	// exporting
+	static FILE *                ms_exportFile;
+	static std::string           ms_exportFileName;
+	static std::set<Entry>       ms_exportEntries;
+	static uint32                ms_exportOffset;
+	static int32                 ms_exportClockStamp;
+};
+
+// ======================================================================
+
+inline bool WorldImage::isExporting()
+{
+	return ms_exportFile != nullptr;
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * True while new chunk requests may be answered from the image.
+ */
+inline bool WorldImage::isServing()
+{
+	return ms_entries != nullptr && ms_clockValidated && !ms_databaseChanged;
+}
+
+// ======================================================================
+
+#endif
@@ -0,0 +1,47 @@
+// ======================================================================
+//
+// WorldImageChunkLocator.cpp
+// copyright (c) 2001 Sony Online Entertainment
+//
+// ======================================================================
+
+#include "serverDatabase/FirstServerDatabase.h"
+#include "serverDatabase/WorldImageChunkLocator.h"
+
+#include "serverDatabase/GameServerConnection.h"
+#include "serverDatabase/WorldImage.h"
+
+// ======================================================================
+
+WorldImageChunkLocator::WorldImageChunkLocator(int nodeX, int nodeZ, const std::string &sceneId) :
+		ObjectLocator(),
+		m_nodeX(nodeX),
+		m_nodeZ(nodeZ),
+		m_sceneId(sceneId)
+{
+}
+
+// ----------------------------------------------------------------------
+
+WorldImageChunkLocator::~WorldImageChunkLocator()
+{
+}
+
+// ======================================================================
+
+bool WorldImageChunkLocator::locateObjects(DB::Session *, const std::string &, int &objectsLocated)
+{
+	objectsLocated = 0;
+	return true;
+}
+
+// ----------------------------------------------------------------------
+
+void WorldImageChunkLocator::sendPostBaselinesCustomData(GameServerConnection &conn) const
+{
+	bool const replayed = WorldImage::replayChunk(m_sceneId, m_nodeX, m_nodeZ, conn);
+	WARNING(!replayed,("Chunk %s (%d, %d) was queued from the world image but is no longer in it", m_sceneId.c_str(), m_nodeX, m_nodeZ));
+	conn.queueCompletedChunk(m_nodeX, m_nodeZ);
+}
+
+// ======================================================================
@@ -0,0 +1,46 @@
+// ======================================================================
+//
+// WorldImageChunkLocator.h
+// copyright (c) 2001 Sony Online Entertainment
+//
+// ======================================================================
+
+#ifndef INCLUDED_WorldImageChunkLocator_H
+#define INCLUDED_WorldImageChunkLocator_H
+
+#include "serverDatabase/ObjectLocator.h"
+
+#include <string>
+
+// ======================================================================
+
+/**
+ * Stands in for a ChunkLocator when the chunk is in the WorldImage.
+ * Locates nothing in the database; when the snapshot it belongs to is
+ * sent, the recorded messages for the chunk are replayed instead.  Being
+ * an ordinary locator, it is queued, batched and acknowledged exactly
+ * like a chunk loaded from the database.
+ */
+class WorldImageChunkLocator : public ObjectLocator
+{
+  public:
+	WorldImageChunkLocator(int nodeX, int nodeZ, const std::string &sceneId);
+	virtual ~WorldImageChunkLocator();
+
+  public:
+	virtual bool locateObjects(DB::Session *session, const std::string &schema, int &objectsLocated);
+	virtual void sendPostBaselinesCustomData(GameServerConnection &conn) const;
+
+  private:
+	int         m_nodeX;
+	int         m_nodeZ;
+	std::string m_sceneId;
+
+  private:
+	WorldImageChunkLocator &operator=(const WorldImageChunkLocator&); //disable
+	WorldImageChunkLocator(const WorldImageChunkLocator&); //disable
+};
+
+// ======================================================================
+
+#endif
@@ -0,0 +1,60 @@
+// ======================================================================
+//
+// WorldImageFormat.h
+// copyright (c) 2001 Sony Online Entertainment
+//
+// ======================================================================
+
+#ifndef INCLUDED_WorldImageFormat_H
+#define INCLUDED_WorldImageFormat_H
+
+// ======================================================================
+
+/**
+ * On-disk layout of a world image, shared by WorldImage and the
+ * WorldImageTool.  Only plain data lives here so the tool does not need
+ * to link against the database library.
+ *
+ * File layout (native byte order):
+ *   Header
+ *   message data:  for each chunk, messageCount x (uint32 size, packed message)
+ *   Entry[entryCount], sorted by (sceneCrc, nodeX, nodeZ)
+ */
+namespace WorldImageFormat
+{
+	uint32 const cs_magic   = 0x474d4957; // "WIMG"
+	uint32 const cs_version = 2;
+
+	struct Header
+	{
+		uint32 m_magic;
+		uint32 m_version;
+		uint32 m_entryCount;
+		uint32 m_indexOffset;
+		// database game clock (seconds) the image was exported from
+		int32  m_clockStamp;
+	};
+
+	struct Entry
+	{
+		uint32 m_sceneCrc;
+		int32  m_nodeX;
+		int32  m_nodeZ;
+		uint32 m_offset;
+		uint32 m_length;
+		uint32 m_messageCount;
+	};
+
+	inline bool operator< (const Entry &lhs, const Entry &rhs)
+	{
+		if (lhs.m_sceneCrc != rhs.m_sceneCrc)
+			return lhs.m_sceneCrc < rhs.m_sceneCrc;
+		if (lhs.m_nodeX != rhs.m_nodeX)
+			return lhs.m_nodeX < rhs.m_nodeX;
+		return lhs.m_nodeZ < rhs.m_nodeZ;
+	}
+}
+
+// ======================================================================
+
+#endif
@@ -0,0 +1 @@
+#include "../../src/shared/space/AiShipSteeringManager.h"
@@ -24,6 +24,7 @@
 #include "sharedCollision/Footprint.h"
 #include "sharedCollision/MultiList.h"
 #include "sharedCollision/SpatialDatabase.h"
+#include "sharedCollision/SpatialQueryBatch.h"
 #include "sharedGame/AiDebugString.h"
 #include "sharedFile/FileNameUtils.h"
 #include "sharedFoundation/DynamicVariableLocationData.h"
@@ -448,7 +449,9 @@ bool AiMovementLoiter::generateWaypoint()
 						Capsule const capsule(m_anchor.getPosition_p(), m_anchor.getPosition_p(), radius);
 						ColliderList collidedWith;
 
-						CollisionWorld::getDatabase()->queryFor(SpatialDatabase::Q_Static, m_controller->getCreatureCell(), restrictToSameCell, capsule, collidedWith);
+						// Creatures spawned together share an anchor and radius, so
+						// this is usually answered once per group
+						CollisionWorld::getQueryBatch().query(SpatialDatabase::Q_Static, m_controller->getCreatureCell(), restrictToSameCell, capsule, collidedWith);
 
 						// Check out the collision results
 						{
@@ -60,6 +60,7 @@
 #include "sharedCollision/CollisionProperty.h"
 #include "sharedCollision/CollisionWorld.h"
 #include "sharedCollision/Footprint.h"
+#include "sharedDebug/PerformanceTimer.h"
 #include "sharedFile/FileManifest.h"
 #include "sharedFoundation/CalendarTime.h"
 #include "sharedFoundation/ConstCharCrcLowerString.h"
@@ -354,6 +355,7 @@ static const CommandParser::CmdInfo cmds[] =
 	{"count",                           0, "",                           "Returns the number of objects allocated on this game server"},
 	{"createAt",                        1, "<templatename>",             "Create a new object where you are standing."},
 	{"createManyAt",                    2, "<count> <templatename>",     "Create new objects around where you are standing."},
+	{"benchmarkCreate",                 2, "<count> <templatename>",     "Time creating and destroying objects from a template.  The objects are never added to the world."},
 	{"createIn",                        2, "<templatename> <oid>",       "Create a new object in a container."},
 	{"createTranslateRotate",           8, "<templatename> <x> <y> <z> <quaternionW> <quaternionX> <quaternionY> <quaternionZ>", "Create a new object."},
 	{"cellCreateTranslateRotate",       8, "<templatename> <cell> <x> <y> <z> <quaternionW> <quaternionX> <quaternionY> <quaternionZ>", "Create a new object in a cell."},
@@ -926,6 +928,54 @@ bool ConsoleCommandParserObject::performParsing (const NetworkId & userId, const
 		return true;
 	}
 
+	//-----------------------------------------------------------------
+
+	else if (isCommand( argv [0], "benchmarkCreate"))
+	{
+		int const         count     = atoi(Unicode::wideToNarrow (argv [1]).c_str());
+		std::string const tmpString = getObjectTemplateShortcut(userId, Unicode::wideToNarrow(argv[2]));
+
+		ServerObjectTemplate const * const ot = getObjectTemplateForCreation(tmpString);
+		if (!ot || count <= 0)
+		{
+			result += getErrorMessage (argv[0], ERR_INVALID_TEMPLATE);
+			if (ot)
+				ot->releaseReference();
+			return true;
+		}
+
+		std::vector<ServerObject *> objects;
+		objects.reserve(static_cast<size_t>(count));
+
+		PerformanceTimer createTimer;
+		createTimer.start();
+		for (int i = 0; i < count; ++i)
+		{
+			ServerObject * const newObject = ServerWorld::createNewObject(*ot, Transform::identity, 0, false);
+			if (newObject)
+				objects.push_back(newObject);
+		}
+		createTimer.stop();
+		ot->releaseReference();
+
+		PerformanceTimer destroyTimer;
+		destroyTimer.start();
+		for (std::vector<ServerObject *>::const_iterator i = objects.begin(); i != objects.end(); ++i)
+			IGNORE_RETURN((*i)->permanentlyDestroy(DeleteReasons::God));
+		destroyTimer.stop();
+
+		float const createTime = createTimer.getElapsedTime();
+		float const destroyTime = destroyTimer.getElapsedTime();
+		char buf[256];
+		snprintf(buf, sizeof(buf), "created %d of %d objects in %.3fs (%.2fus each), destroyed in %.3fs\n",
+			static_cast<int>(objects.size()), count, createTime,
+			objects.empty() ? 0.0f : createTime * 1000000.0f / static_cast<float>(objects.size()),
+			destroyTime);
+		result += Unicode::narrowToWide(buf);
+		result += getErrorMessage (argv[0], ERR_SUCCESS);
+		return true;
+	}
+
 	//-----------------------------------------------------------------
 	else if (isCommand(argv[0], "createIn"))
 	{
@@ -50,11 +50,15 @@
 #include "serverNetworkMessages/TransferRequestMoveValidation.h"
 #include "serverScript/GameScriptObject.h"
 #include "serverUtility/AdminAccountManager.h"
+#include "sharedCollision/BoxTree.h"
+#include "sharedCollision/FloorMesh.h"
 #include "sharedDebug/DebugFlags.h"
 #include "sharedDebug/Profiler.h"
+#include "sharedFile/TreeFile.h"
 #include "sharedFoundation/CalendarTime.h"
 #include "sharedFoundation/Clock.h"
 #include "sharedFoundation/FormattedString.h"
+#include "sharedFractal/MultiFractal.h"
 #include "sharedGame/GameObjectTypes.h"
 #include "sharedGame/QuestManager.h"
 #include "sharedMath/Sphere.h"
@@ -108,7 +112,13 @@ static const CommandParser::CmdInfo cmds[] =
 	{"reloadAdminTable",         0,  "",                                  "Reload the admin permissions table."},
 	{"reloadTable",              1,  "<tableName>",                       "Reload a given datatable."},
 	{"dataTableGetString",       3,  "<table> <col> <row>",               "GetString from table."},
+	{"benchmarkTreeFileLookups", 0,  "",                                  "Time looking up every archived file, and as many missing ones, with and without the archive index."},
+	{"benchmarkDataTable",       1,  "<table> [loads]",                   "Time loading a table in place and through a copied Iff.  The loaded tables are not kept."},
 	{"reloadTerrain",            0,  "",                                  "Reload the terrain"},
+	{"verifyFractalRows",        0,  "",                                  "Compare and time fractal evaluation a row at a time and a point at a time, for every combination rule."},
+	{"bakeFloorMesh",            2,  "<floor> <output file>",             "Rewrite a floor as a baked 0007 floor."},
+	{"verifyBakedFloorMeshes",   0,  "[grid size] [loads] [queries]",     "Compare and time loading and querying a generated floor written unbaked and baked."},
+	{"verifyBoxTreeQueries",     0,  "[boxes] [queries]",                 "Compare and time box tree overlap queries through the quads and through the binary nodes."},
 	{"listRegions",              0,  "[planet]",                          "Lists the regions for a planet"},
 	{"messageCount",             0,  "",                                  "Enumerate messages by name and count"},
 	{"setPublic",                1, "0 | 1", "Set the cluster public or non-public. The cluster is closed (private) if the first parameter is 0"},
@@ -650,11 +660,97 @@ bool ConsoleCommandParserServer::performParsing(const NetworkId & userId, const
 		else
 			result += Unicode::narrowToWide("No such table");
 	}
+	else if (isAbbrev(argv[0], "benchmarkTreeFileLookups"))
+	{
+		int indexFound = 0;
+		float indexHitTime = 0.0f;
+		float indexMissTime = 0.0f;
+		int nodeFound = 0;
+		float nodeHitTime = 0.0f;
+		float nodeMissTime = 0.0f;
+		int const numberOfLookups = TreeFile::benchmarkLookups(indexFound, indexHitTime, indexMissTime, nodeFound, nodeHitTime, nodeMissTime);
+
+		char buf[256];
+		snprintf(buf, sizeof(buf), "%d files: archive index %.3fs (%d found) + %.3fs misses, search nodes %.3fs (%d found) + %.3fs misses\n",
+			numberOfLookups, indexHitTime, indexFound, indexMissTime, nodeHitTime, nodeFound, nodeMissTime);
+		result += Unicode::narrowToWide(buf);
+	}
+	else if (isAbbrev(argv[0], "benchmarkDataTable"))
+	{
+		std::string const tableName = Unicode::wideToNarrow(argv[1]);
+		int const numberOfLoads = argv.size() > 2 ? std::max(1, atoi(Unicode::wideToNarrow(argv[2]).c_str())) : 100;
+		float viewTime = 0.0f;
+		float iffTime = 0.0f;
+		if (DataTableManager::benchmarkLoad(tableName.c_str(), numberOfLoads, viewTime, iffTime))
+		{
+			char buf[256];
+			snprintf(buf, sizeof(buf), "%s, %d loads: in place %.3fs, through Iff %.3fs\n", tableName.c_str(), numberOfLoads, viewTime, iffTime);
+			result += Unicode::narrowToWide(buf);
+		}
+		else
+			result += Unicode::narrowToWide("No such table");
+	}
 	else if (isAbbrev(argv[0], "reloadTerrain"))
 	{
 		GameServer::getInstance().loadTerrain();
 		result += getErrorMessage(argv[0], ERR_SUCCESS);
 	}
+	else if (isAbbrev(argv[0], "verifyFractalRows"))
+	{
+		int numberOfPoints = 0;
+		float rowTime = 0.0f;
+		float pointTime = 0.0f;
+		float const maximumError = MultiFractal::verifyRowEvaluation(numberOfPoints, rowTime, pointTime);
+
+		char buf[256];
+		snprintf(buf, sizeof(buf), "%d points: rows %.3fs, single points %.3fs, maximum error %g\n", numberOfPoints, rowTime, pointTime, maximumError);
+		result += Unicode::narrowToWide(buf);
+	}
+	else if (isAbbrev(argv[0], "bakeFloorMesh"))
+	{
+		std::string const inputFileName = Unicode::wideToNarrow(argv[1]);
+		std::string const outputFileName = Unicode::wideToNarrow(argv[2]);
+		if (FloorMesh::bake(inputFileName.c_str(), outputFileName.c_str()))
+			result += getErrorMessage(argv[0], ERR_SUCCESS);
+		else
+			result += getErrorMessage(argv[0], ERR_FAIL);
+	}
+	else if (isAbbrev(argv[0], "verifyBakedFloorMeshes"))
+	{
+		int const gridSize = argv.size() > 1 ? std::max(1, atoi(Unicode::wideToNarrow(argv[1]).c_str())) : 64;
+		int const numberOfLoads = argv.size() > 2 ? std::max(1, atoi(Unicode::wideToNarrow(argv[2]).c_str())) : 100;
+		int const numberOfQueries = argv.size() > 3 ? std::max(1, atoi(Unicode::wideToNarrow(argv[3]).c_str())) : 10000;
+		FloorMesh::BakedLoadTimes unbakedTimes = { 0.0f, 0.0f, 0.0f };
+		FloorMesh::BakedLoadTimes bakedTimes = { 0.0f, 0.0f, 0.0f };
+		int const mismatches = FloorMesh::verifyBakedLoad(gridSize, numberOfLoads, numberOfQueries, unbakedTimes, bakedTimes);
+
+		char buf[256];
+		snprintf(buf, sizeof(buf), "%d loads: unbaked %.3fs, baked %.3fs\n", numberOfLoads, unbakedTimes.load, bakedTimes.load);
+		result += Unicode::narrowToWide(buf);
+		snprintf(buf, sizeof(buf), "%d line queries: unbaked %.3fs, baked %.3fs\n", numberOfQueries, unbakedTimes.lineQueries, bakedTimes.lineQueries);
+		result += Unicode::narrowToWide(buf);
+		snprintf(buf, sizeof(buf), "%d contact queries: unbaked %.3fs, baked %.3fs\n", numberOfQueries, unbakedTimes.contactQueries, bakedTimes.contactQueries);
+		result += Unicode::narrowToWide(buf);
+		snprintf(buf, sizeof(buf), "%d mismatches\n", mismatches);
+		result += Unicode::narrowToWide(buf);
+	}
+	else if (isAbbrev(argv[0], "verifyBoxTreeQueries"))
+	{
+		int const numberOfBoxes = argv.size() > 1 ? std::max(1, atoi(Unicode::wideToNarrow(argv[1]).c_str())) : 256;
+		int const numberOfQueries = argv.size() > 2 ? std::max(1, atoi(Unicode::wideToNarrow(argv[2]).c_str())) : 20000;
+		float quadTime = 0.0f;
+		float nodeTime = 0.0f;
+		int const mismatches = BoxTree::verifyQuadQueries(numberOfBoxes, numberOfQueries, quadTime, nodeTime);
+
+		if (mismatches < 0)
+			result += Unicode::narrowToWide("The tree is too deep for quads\n");
+		else
+		{
+			char buf[256];
+			snprintf(buf, sizeof(buf), "%d boxes, %d overlap queries: quads %.3fs, binary nodes %.3fs, %d mismatches\n", numberOfBoxes, 2 * numberOfQueries, quadTime, nodeTime, mismatches);
+			result += Unicode::narrowToWide(buf);
+		}
+	}
 	else if (isAbbrev(argv[0], "messageCount"))
 	{
 		std::vector<std::pair<std::string, int> > messages = GameNetworkMessage::getMessageCount();
@@ -3512,6 +3608,15 @@ bool ConsoleCommandParserServer::performParsing2(const NetworkId & userId, const
 		snprintf(numBuf, sizeof(numBuf), "%d", ObjectTracker::getNumDelayedHibernatingAI());
 		result += Unicode::narrowToWide(std::string("Number of Delayed Hibernating AI: ") + std::string(numBuf)) + unl;
 
+		snprintf(numBuf, sizeof(numBuf), "%d", ObjectTracker::getNumNearLodAI());
+		result += Unicode::narrowToWide(std::string("Number of Near LOD AI: ") + std::string(numBuf)) + unl;
+
+		snprintf(numBuf, sizeof(numBuf), "%d", ObjectTracker::getNumMediumLodAI());
+		result += Unicode::narrowToWide(std::string("Number of Medium LOD AI: ") + std::string(numBuf)) + unl;
+
+		snprintf(numBuf, sizeof(numBuf), "%d", ObjectTracker::getNumFarLodAI());
+		result += Unicode::narrowToWide(std::string("Number of Far LOD AI: ") + std::string(numBuf)) + unl;
+
 		snprintf(numBuf, sizeof(numBuf), "%d", ObjectTracker::getNumIntangibles());
 		result += Unicode::narrowToWide(std::string("Number of Intangibles: ") + std::string(numBuf)) + unl;
 
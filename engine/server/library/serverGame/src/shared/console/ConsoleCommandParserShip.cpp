@@ -10,11 +10,13 @@
 
 #include "UnicodeUtils.h"
 #include "serverGame/CreatureObject.h"
+#include "serverGame/ProjectileManager.h"
 #include "serverGame/ServerWorld.h"
 #include "serverGame/ShipComponentDataManager.h"
 #include "serverGame/ShipInternalDamageOverTime.h"
 #include "serverGame/ShipInternalDamageOverTimeManager.h"
 #include "serverGame/ShipObject.h"
+#include "serverGame/SpaceVisibilityManager.h"
 #include "sharedFoundation/ConstCharCrcString.h"
 #include "sharedFoundation/Crc.h"
 #include "sharedFoundation/PersistentCrcString.h"
@@ -50,6 +52,8 @@ namespace
 		MAKE_COMMAND(idotList);
 		MAKE_COMMAND(idotSet);
 		MAKE_COMMAND(idotRemove);
+		MAKE_COMMAND(benchmarkProjectiles);
+		MAKE_COMMAND(benchmarkVisibility);
 #undef MAKE_COMMAND
 	}
 
@@ -65,6 +69,8 @@ namespace
 		{CommandNames::idotList,               0, "[networkId]",                              "List all active IDOTS."},
 		{CommandNames::idotSet,                3, "<slot> <damage rate> <damage threshold> [networkId]",  "Set an active IDOT."},
 		{CommandNames::idotRemove,             1, "<slot> [networkId]",                                   "Remove an active IDOT."},
+		{CommandNames::benchmarkProjectiles,   1, "<passes>",                                             "Time finding what every live shot hits, through the binned candidates and through one query per shot."},
+		{CommandNames::benchmarkVisibility,    1, "<passes>",                                             "Time the objects lost and gained moving each tracked object one visibility node, from sorted arrays and from sets."},
 
 		{"", 0, "", ""} // this must be last
 	};
@@ -573,6 +579,46 @@ bool ConsoleCommandParserShip::performParsing (const NetworkId & userId, const S
 		return true;
 	}
 
+	//----------------------------------------------------------------------
+
+	else if (isCommand (argv[0], CommandNames::benchmarkProjectiles))
+	{
+		int const passes = std::max(1, atoi(Unicode::wideToNarrow(argv[1]).c_str()));
+		int segmentCount = 0;
+		int binnedHits = 0;
+		int queryHits = 0;
+		float binnedTime = 0.0f;
+		float queryTime = 0.0f;
+
+		ProjectileManager::benchmarkHitTests(passes, segmentCount, binnedHits, queryHits, binnedTime, queryTime);
+
+		char buf[256];
+		snprintf(buf, sizeof(buf), "%d shots, %d passes: binned %.3fs (%d hits), one query per shot %.3fs (%d hits)\n",
+			segmentCount, passes, binnedTime, binnedHits, queryTime, queryHits);
+		result += Unicode::narrowToWide(buf);
+
+		return true;
+	}
+
+	//----------------------------------------------------------------------
+
+	else if (isCommand (argv[0], CommandNames::benchmarkVisibility))
+	{
+		int const passes = std::max(1, atoi(Unicode::wideToNarrow(argv[1]).c_str()));
+		int objectCount = 0;
+		float arrayTime = 0.0f;
+		float setTime = 0.0f;
+
+		int const mismatches = SpaceVisibilityManager::benchmarkNodeDifferences(passes, objectCount, arrayTime, setTime);
+
+		char buf[256];
+		snprintf(buf, sizeof(buf), "%d objects, %d passes: sorted arrays %.3fs, sets %.3fs, %d mismatches\n",
+			objectCount, passes, arrayTime, setTime, mismatches);
+		result += Unicode::narrowToWide(buf);
+
+		return true;
+	}
+
 	//----------------------------------------------------------------------
 		
 	return false;
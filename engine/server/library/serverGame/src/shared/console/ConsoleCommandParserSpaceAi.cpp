@@ -14,6 +14,7 @@
 #include "serverGame/AiShipBehaviorBase.h"
 #include "serverGame/AiShipController.h"
 #include "serverGame/AiShipPilotData.h"
+#include "serverGame/AiShipSteeringManager.h"
 #include "serverGame/Chat.h"
 #include "serverGame/CreatureObject.h"
 #include "serverGame/SpacePath.h"
@@ -34,6 +35,7 @@ static const CommandParser::CmdInfo cmds[] =
 	{"peace", 0, "", "Sets all AI to stop attacking."},
 	{"path", 1, "", "Sends the pathing points for the specified AI to the client."},
 	{"reloaddata", 0, "", "Reloads pilottype.tab"},
+	{"benchmarkSteering", 1, "<passes>", "Times squad separation for every AI ship, by the bulk steering pass and by each ship walking its squad."},
 #ifdef _DEBUG
 	{"clientDebug", 0, "", "Toggles client AI debugging."},
 	{"serverDebug", 0, "", "Toggles the server to send AI debugging."},
@@ -164,6 +166,22 @@ bool ConsoleCommandParserSpaceAi::performParsing(const NetworkId & userId, const
 
 		result += getErrorMessage(argv[0], ERR_SUCCESS);
 	}
+	else if (isAbbrev(argv[0], "benchmarkSteering"))
+	{
+		int const passes = std::max(1, atoi(Unicode::wideToNarrow(argv[1]).c_str()));
+		int const ships = AiShipSteeringManager::getNumberOfShips();
+		float passTime = 0.0f;
+		float walkTime = 0.0f;
+
+		AiShipSteeringManager::benchmarkSquadAvoidance(passes, passTime, walkTime);
+
+		float const shipPasses = static_cast<float>(std::max(1, passes * ships));
+		char buf[256];
+		snprintf(buf, sizeof(buf), "%d ships, %d passes: bulk pass %.3fs (%.2fus per ship), squad walk %.3fs (%.2fus per ship)\n",
+			ships, passes, passTime, passTime * 1000000.0f / shipPasses, walkTime, walkTime * 1000000.0f / shipPasses);
+		result += Unicode::narrowToWide(buf);
+		result += getErrorMessage(argv[0], ERR_SUCCESS);
+	}
 #ifdef _DEBUG
 	else if (isAbbrev(argv[0], "clientDebug"))
 	{
@@ -25,6 +25,7 @@
 #include "serverGame/AiCreatureData.h"
 #include "serverGame/AiLogManager.h"
 #include "serverGame/CellObject.h"
+#include "serverGame/Client.h"
 #include "serverGame/ConfigServerGame.h"
 #include "serverGame/ContainerInterface.h"
 #include "serverGame/CreatureObject.h"
@@ -69,6 +70,7 @@
 #include "UnicodeUtils.h"
 
 #include <algorithm>
+#include <limits>
 
 using namespace Scripting;
 
@@ -87,6 +89,7 @@ namespace AiCreatureControllerNamespace
 
 	void remove();
 	Location getLocation(ServerObject const & serverObject);
+	float getNearestObserverDistanceSquared(ServerObject const & serverObject);
 }
 
 using namespace AiCreatureControllerNamespace;
@@ -113,6 +116,23 @@ Location AiCreatureControllerNamespace::getLocation(ServerObject const & serverO
 	return Location(positionRelativeToCellOrWorld, networkIdForCellOrWorld, Location::getCrcBySceneName(serverObject.getSceneId()));
 }
 
+//-----------------------------------------------------------------------
+float AiCreatureControllerNamespace::getNearestObserverDistanceSquared(ServerObject const & serverObject)
+{
+	Vector const & position_w = serverObject.getPosition_w();
+	float result = std::numeric_limits<float>::max();
+
+	ObserverList const & observers = serverObject.getObservers();
+	for (ObserverList::const_iterator i = observers.begin(); i != observers.end(); ++i)
+	{
+		ServerObject const * const characterObject = (*i)->getCharacterObject();
+		if (characterObject != nullptr)
+			result = std::min(result, position_w.magnitudeBetweenSquared(characterObject->getPosition_w()));
+	}
+
+	return result;
+}
+
 // ======================================================================
 //
 // AiCreatureController
@@ -151,6 +171,8 @@ AICreatureController::AICreatureController(CreatureObject * newOwner)
  , m_aiDebugStringCrc(0)
 #endif // _DEBUG
  , m_invalidTarget(false)
+ , m_lodLevel(LL_none)
+ , m_lodCheckTimer(0.0f)
 {
 	m_creatureName.setSourceObject(this);
 }
@@ -167,6 +189,8 @@ AICreatureController::~AICreatureController()
 	if (owner != nullptr && owner->isAuthoritative() && !getHibernate() && m_hibernationDelay.get() > 0 && m_hibernationTimer.get() > 0)
 		ObjectTracker::removeDelayedHibernatingAI();
 
+	setLodLevel(LL_none);
+
 	if ((owner != nullptr) && AiLogManager::isLogging(owner->getNetworkId()))
 	{
 		AiLogManager::setLogging(owner->getNetworkId(), false);
@@ -515,8 +539,11 @@ float AICreatureController::realAlter(float time)
 #endif // _DEBUG
 
 //		DEBUG_REPORT_LOG(true, ("[aitest] Hibernating %s from alter\n", creatureOwner->getNetworkId().getValueString().c_str()));
+		setLodLevel(LL_none);
 		return alterResult;
 	}
+
+	updateLodLevel(time);
 	
 	// check floating
 	{
@@ -703,10 +730,139 @@ float AICreatureController::realAlter(float time)
 	}
 #endif // _DEBUG
 
+	// creatures far from whoever is observing them can wait longer for their next alter
+	AlterResult::incorporateLongAlterResult(alterResult, getLodAlterTime());
+
 	// done
 	return alterResult;
 }
 
+//-----------------------------------------------------------------------
+
+/**
+ * Pick how often this creature should alter.  Hibernating creatures are out
+ * of the alter path altogether; the rest alter at a rate that drops with
+ * distance to the nearest observing player.
+ */
+void AICreatureController::updateLodLevel(float time)
+{
+	CreatureObject const * const creatureOwner = getCreature();
+
+	if (!ConfigServerGame::getAiLodEnabled() || !creatureOwner->isAuthoritative())
+	{
+		setLodLevel(LL_none);
+		return;
+	}
+
+	// creatures that are fighting or following someone react at the full rate
+	if (   creatureOwner->isInCombat()
+	    || !creatureOwner->isHateListEmpty()
+	    || isRetreating()
+	    || creatureOwner->getMasterId().isValid())
+	{
+		setLodLevel(LL_near);
+		m_lodCheckTimer = ConfigServerGame::getAiLodCheckTime();
+		return;
+	}
+
+	// staying near a little too long is cheap, so only look again now and then
+	if (m_lodLevel == LL_near)
+	{
+		m_lodCheckTimer -= time;
+		if (m_lodCheckTimer > 0.0f)
+			return;
+	}
+
+	m_lodCheckTimer = ConfigServerGame::getAiLodCheckTime();
+
+	float const distanceSquared = getNearestObserverDistanceSquared(*creatureOwner);
+	if (distanceSquared <= sqr(ConfigServerGame::getAiLodNearDistance()))
+		setLodLevel(LL_near);
+	else if (distanceSquared <= sqr(ConfigServerGame::getAiLodMediumDistance()))
+		setLodLevel(LL_medium);
+	else
+		setLodLevel(LL_far);
+}
+
+//-----------------------------------------------------------------------
+
+void AICreatureController::setLodLevel(LodLevel lodLevel)
+{
+	if (lodLevel != m_lodLevel)
+	{
+		trackLodLevel(m_lodLevel, false);
+		trackLodLevel(lodLevel, true);
+		m_lodLevel = lodLevel;
+	}
+}
+
+//-----------------------------------------------------------------------
+
+void AICreatureController::trackLodLevel(LodLevel lodLevel, bool add)
+{
+	switch (lodLevel)
+	{
+	case LL_near:
+		if (add)
+			ObjectTracker::addNearLodAI();
+		else
+			ObjectTracker::removeNearLodAI();
+		break;
+	case LL_medium:
+		if (add)
+			ObjectTracker::addMediumLodAI();
+		else
+			ObjectTracker::removeMediumLodAI();
+		break;
+	case LL_far:
+		if (add)
+			ObjectTracker::addFarLodAI();
+		else
+			ObjectTracker::removeFarLodAI();
+		break;
+	case LL_none:
+	default:
+		break;
+	}
+}
+
+//-----------------------------------------------------------------------
+
+float AICreatureController::getLodAlterTime() const
+{
+	switch (m_lodLevel)
+	{
+	case LL_medium:
+		return ConfigServerGame::getAiLodMediumAlterTime();
+	case LL_far:
+		return ConfigServerGame::getAiLodFarAlterTime();
+	case LL_none:
+	case LL_near:
+	default:
+		break;
+	}
+
+	return AlterResult::cms_alterNextFrame;
+}
+
+//-----------------------------------------------------------------------
+
+/**
+ * Bring a creature altering at a reduced rate back to the full rate, for
+ * events it must react to right away (a player entering one of its trigger
+ * volumes, or combat starting).  Hibernating creatures are woken by being
+ * observed instead.
+ */
+void AICreatureController::wakeFromLod()
+{
+	if (m_lodLevel != LL_medium && m_lodLevel != LL_far)
+		return;
+
+	setLodLevel(LL_near);
+	m_lodCheckTimer = ConfigServerGame::getAiLodCheckTime();
+	getCreature()->scheduleForAlter();
+}
+
 //----------------------------------------------------------------------
 void AICreatureController::changeMovement(AiMovementBasePtr newMovement)
 {
@@ -135,6 +135,8 @@ public:
 	void                 setHibernationDelay     (float delay);
 //	float                getHibernationDelay     () const;
 
+	void                 wakeFromLod             ( void );
+
 	int                  getStuckCounter         ( void ) const;
 
 	void                 setAuthority            ( bool authority );
@@ -198,10 +200,24 @@ protected:
 
 private:
 
+	// how often an observed creature alters, by distance to the nearest observer
+	enum LodLevel
+	{
+		LL_none,
+		LL_near,
+		LL_medium,
+		LL_far
+	};
+
 #ifdef _DEBUG
 	void sendDebugAiToClients(AiDebugString & aiDebugString);
 #endif // _DEBUG
 
+	void updateLodLevel(float time);
+	void setLodLevel(LodLevel lodLevel);
+	static void trackLodLevel(LodLevel lodLevel, bool add);
+	float getLodAlterTime() const;
+
 	void setPrimaryWeapon(CrcString const & objectTemplate);
 	void setSecondaryWeapon(CrcString const & objectTemplate);
 	void destroyPrimaryWeapon();
@@ -256,6 +272,9 @@ private:
 #endif // _DEBUG
 
 	bool   m_invalidTarget;
+
+	LodLevel m_lodLevel;
+	float    m_lodCheckTimer;
 private:
 	AICreatureController();
 	AICreatureController(AICreatureController const & rhs);
@@ -21,6 +21,7 @@
 #include "serverGame/AiShipBehaviorTrack.h"
 #include "serverGame/AiShipBehaviorWaypoint.h"
 #include "serverGame/AiShipPilotData.h"
+#include "serverGame/AiShipSteeringManager.h"
 #include "serverGame/AiShipTurretTargetingSystem.h"
 #include "serverGame/ConfigServerGame.h"
 #include "serverGame/CreatureObject.h"
@@ -180,6 +181,7 @@ AiShipController::AiShipController(ShipObject * const owner) :
 	m_attackOrders(AO_attackFreely),
 	m_exclusiveAggroSet(new CachedNetworkIdSet)
 {
+	AiShipSteeringManager::add(*this);
 }
 
 // ----------------------------------------------------------------------
@@ -188,6 +190,8 @@ AiShipController::~AiShipController()
 {
 	LOGC(ConfigServerGame::isSpaceAiLoggingEnabled(), "debug_ai", ("AiShipController::~AiShipController() owner(%s) DESTROYING UNIT", getOwner()->getDebugInformation().c_str()));
 
+	AiShipSteeringManager::remove(*this);
+
 	// Remove this unit from its squad
 
 	if (m_squad != nullptr)
@@ -595,12 +599,18 @@ void AiShipController::moveTo(Vector const & position_w, float const throttle, f
 		setThrottle(clamp(s_slowdownThrottlePositionMin, getThrottle() - (getThrottle() * deltaTime * throttleGain), 1.0f));
 	}
 
-	// See if we need to avoid an obstacle
+	// See if we need to avoid an obstacle, using this frame's steering pass if it has the answer
 
 	Vector resultAvoidancePosition_w;
-	Vector const & shipVelocity = getShipOwner()->getCurrentVelocity_p();
+	bool avoidObstacle = false;
+
+	if (!AiShipSteeringManager::findAvoidancePosition(*this, position_w, avoidObstacle, resultAvoidancePosition_w))
+	{
+		Vector const & shipVelocity = getShipOwner()->getCurrentVelocity_p();
+		avoidObstacle = SpaceAvoidanceManager::getAvoidancePosition(*getOwner(), shipVelocity, position_w, resultAvoidancePosition_w);
+	}
 
-	if (SpaceAvoidanceManager::getAvoidancePosition(*getOwner(), shipVelocity, position_w, resultAvoidancePosition_w))
+	if (avoidObstacle)
 	{
 		IGNORE_RETURN(face(resultAvoidancePosition_w, deltaTime));
 	}
@@ -608,7 +618,12 @@ void AiShipController::moveTo(Vector const & position_w, float const throttle, f
 	{
 		// See if we need to avoid another squad member
 
-		Vector const squadAvoidanceVector(getSquad().getAvoidanceVector(*getShipOwner()));
+		Vector squadAvoidanceVector;
+
+		if (!AiShipSteeringManager::findSquadAvoidanceVector(*this, squadAvoidanceVector))
+		{
+			squadAvoidanceVector = getSquad().getAvoidanceVector(*getShipOwner());
+		}
 
 		if (squadAvoidanceVector != Vector::zero)
 		{
@@ -1125,6 +1140,13 @@ SpaceSquad const & AiShipController::getSquad() const
 
 // ----------------------------------------------------------------------
 
+bool AiShipController::hasSquad() const
+{
+	return (m_squad != nullptr);
+}
+
+// ----------------------------------------------------------------------
+
 void AiShipController::setFormationPosition_l(Vector const & position_l)
 {
 	m_formationPosition_l = position_l;
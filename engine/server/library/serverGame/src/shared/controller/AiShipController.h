@@ -78,6 +78,7 @@ public:
 	void setSquad(SpaceSquad * const squad);
 	SpaceSquad & getSquad();
 	SpaceSquad const & getSquad() const;
+	bool hasSquad() const;
 
 	bool isSquadLeader() const;
 
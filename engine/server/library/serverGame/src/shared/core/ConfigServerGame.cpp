@@ -186,6 +186,12 @@ void ConfigServerGame::install(void)
 	KEY_FLOAT   (hibernateDistance, 128.0f);
 	KEY_FLOAT   (minHibernateAlter, 4.0f);
 	KEY_FLOAT   (maxHibernateAlter, 6.0f);
+	KEY_BOOL    (aiLodEnabled, true);
+	KEY_FLOAT   (aiLodNearDistance, 48.0f);
+	KEY_FLOAT   (aiLodMediumDistance, 128.0f);
+	KEY_FLOAT   (aiLodMediumAlterTime, 1.0f);
+	KEY_FLOAT   (aiLodFarAlterTime, 3.0f);
+	KEY_FLOAT   (aiLodCheckTime, 2.0f);
 	KEY_INT     (aiPulseQueuePerFrame, 100);
 	KEY_INT     (aiPulseQueueMaxWaitTimeMs, 1000);
 	KEY_FLOAT   (aiBaseAggroRadius, 24.0f);
@@ -257,6 +263,10 @@ void ConfigServerGame::install(void)
 	KEY_INT     (maxFreeTrialMoney, 50000); //50k credits limited to demo customers
 	KEY_BOOL    (enablePreload, false);
 	KEY_BOOL    (buildPreloadLists, false);
+	KEY_STRING  (preloadManifest, "");
+	KEY_STRING  (preloadManifestExport, "");
+	KEY_INT     (preloadThreads, 2);
+	KEY_INT     (preloadPublishMsPerFrame, 5);
 	KEY_BOOL    (logAuthTransfer, false);
 
 	KEY_INT     (overrideUpdateRadius, 0);
@@ -359,12 +369,17 @@ void ConfigServerGame::install(void)
 	KEY_BOOL    (sendAsteroidExtents, false);
 	KEY_BOOL    (createZoneObjects, true);
 	KEY_INT     (shipUpdatesPerSecond, 32);
+	KEY_INT     (shipUpdateBytesPerSecond, 1024);
+	KEY_FLOAT   (shipUpdateBurstSeconds, 0.25f);
+	KEY_INT     (shipUpdateLagThresholdMs, 400);
+	KEY_INT     (shipUpdateUnchangedResendMs, 2000);
 	KEY_BOOL    (debugSpaceVisibilityManager, false);
 	KEY_INT     (groundFrameRateLimit, 5);
 	KEY_INT     (spaceFrameRateLimit, 12);
 	KEY_BOOL    (aiLoggingEnabled, false);
 	KEY_BOOL    (shipShotValidationEnabled, true);
 	KEY_INT     (spaceAiEnemySearchesPerFrame, 15);
+	KEY_BOOL    (spaceAiBulkSteering, false);
 	KEY_BOOL    (groundShouldSleep, true);
 	KEY_BOOL    (spaceShouldSleep, true);
 	KEY_BOOL    (shipMoveValidationEnabled, true);
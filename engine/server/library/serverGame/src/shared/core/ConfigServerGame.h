@@ -251,6 +251,12 @@ class ConfigServerGame
 		float           hibernateDistance;
 		float           minHibernateAlter;
 		float           maxHibernateAlter;
+		bool            aiLodEnabled;         // if true, observed AI farther from players alter less often
+		float           aiLodNearDistance;
+		float           aiLodMediumDistance;
+		float           aiLodMediumAlterTime;
+		float           aiLodFarAlterTime;
+		float           aiLodCheckTime;
 		int             aiPulseQueuePerFrame;
 		int             aiPulseQueueMaxWaitTimeMs;
 		float           aiBaseAggroRadius;
@@ -305,6 +311,10 @@ class ConfigServerGame
 
 		bool            buildPreloadLists;
 		bool            enablePreload;
+		const char *    preloadManifest;
+		const char *    preloadManifestExport;
+		int             preloadThreads;
+		int             preloadPublishMsPerFrame;
 		bool            logAuthTransfer;
 
 		int             overrideUpdateRadius;
@@ -410,12 +420,17 @@ class ConfigServerGame
 		bool            sendAsteroidExtents;
 		bool            createZoneObjects;
 		int             shipUpdatesPerSecond;
+		int             shipUpdateBytesPerSecond; // per client, 0 for no byte budget
+		float           shipUpdateBurstSeconds;
+		int             shipUpdateLagThresholdMs;
+		int             shipUpdateUnchangedResendMs;
 		bool            debugSpaceVisibilityManager;
 		int             groundFrameRateLimit;
 		int             spaceFrameRateLimit;
 		bool            aiLoggingEnabled;
 		bool            shipShotValidationEnabled;
 		int             spaceAiEnemySearchesPerFrame;
+		bool            spaceAiBulkSteering;
 		bool            groundShouldSleep;
 		bool            spaceShouldSleep;
 		bool            shipMoveValidationEnabled;
@@ -784,6 +799,12 @@ class ConfigServerGame
 	static const float      getHibernateDistance(void);
 	static const float      getMinHibernateAlter(void);
 	static const float      getMaxHibernateAlter(void);
+	static const bool       getAiLodEnabled(void);
+	static const float      getAiLodNearDistance(void);
+	static const float      getAiLodMediumDistance(void);
+	static const float      getAiLodMediumAlterTime(void);
+	static const float      getAiLodFarAlterTime(void);
+	static const float      getAiLodCheckTime(void);
 	static const int        getAiPulseQueuePerFrame();
 	static const unsigned int getAiPulseQueueMaxWaitTimeMs();
 
@@ -834,6 +855,10 @@ class ConfigServerGame
 
 	static bool             getBuildPreloadLists();
 	static bool             getEnablePreload();
+	static const char *     getPreloadManifest();
+	static const char *     getPreloadManifestExport();
+	static int              getPreloadThreads();
+	static int              getPreloadPublishMsPerFrame();
 	static bool             getLogAuthTransfer();
 
 	static int              getOverrideUpdateRadius();
@@ -933,6 +958,10 @@ class ConfigServerGame
 	static bool             getSendAsteroidExtents();
 	static bool             getCreateZoneObjects();
 	static int              getShipUpdatesPerSecond();
+	static int              getShipUpdateBytesPerSecond();
+	static float            getShipUpdateBurstSeconds();
+	static int              getShipUpdateLagThresholdMs();
+	static int              getShipUpdateUnchangedResendMs();
 	static bool             getDebugSpaceVisibilityManager();
 	static int              getGroundFrameRateLimit();
 	static int              getSpaceFrameRateLimit();
@@ -940,6 +969,7 @@ class ConfigServerGame
 	static bool             isAiLoggingEnabled();
 	static bool             getShipShotValidationEnabled();
 	static int              getSpaceAiEnemySearchesPerFrame();
+	static bool             getSpaceAiBulkSteering();
 	static bool             getGroundShouldSleep();
 	static bool             getSpaceShouldSleep();
 	static bool             getShipMoveValidationEnabled();
@@ -2118,6 +2148,48 @@ inline const float ConfigServerGame::getMaxHibernateAlter(void)
 
 // ----------------------------------------------------------------------
 
+inline const bool ConfigServerGame::getAiLodEnabled(void)
+{
+	return data->aiLodEnabled;
+}
+
+// ----------------------------------------------------------------------
+
+inline const float ConfigServerGame::getAiLodNearDistance(void)
+{
+	return data->aiLodNearDistance;
+}
+
+// ----------------------------------------------------------------------
+
+inline const float ConfigServerGame::getAiLodMediumDistance(void)
+{
+	return data->aiLodMediumDistance;
+}
+
+// ----------------------------------------------------------------------
+
+inline const float ConfigServerGame::getAiLodMediumAlterTime(void)
+{
+	return data->aiLodMediumAlterTime;
+}
+
+// ----------------------------------------------------------------------
+
+inline const float ConfigServerGame::getAiLodFarAlterTime(void)
+{
+	return data->aiLodFarAlterTime;
+}
+
+// ----------------------------------------------------------------------
+
+inline const float ConfigServerGame::getAiLodCheckTime(void)
+{
+	return data->aiLodCheckTime;
+}
+
+// ----------------------------------------------------------------------
+
 inline const int ConfigServerGame::getAiPulseQueuePerFrame()
 {
 	return data->aiPulseQueuePerFrame;
@@ -2407,6 +2479,34 @@ inline bool ConfigServerGame::getBuildPreloadLists()
 
 // ----------------------------------------------------------------------
 
+inline const char * ConfigServerGame::getPreloadManifest()
+{
+	return data->preloadManifest;
+}
+
+// ----------------------------------------------------------------------
+
+inline const char * ConfigServerGame::getPreloadManifestExport()
+{
+	return data->preloadManifestExport;
+}
+
+// ----------------------------------------------------------------------
+
+inline int ConfigServerGame::getPreloadThreads()
+{
+	return data->preloadThreads;
+}
+
+// ----------------------------------------------------------------------
+
+inline int ConfigServerGame::getPreloadPublishMsPerFrame()
+{
+	return data->preloadPublishMsPerFrame;
+}
+
+// ----------------------------------------------------------------------
+
 inline bool ConfigServerGame::getLogAuthTransfer()
 {
 	return data->logAuthTransfer;
@@ -2897,6 +2997,34 @@ inline int ConfigServerGame::getShipUpdatesPerSecond()
 
 // ----------------------------------------------------------------------
 
+inline int ConfigServerGame::getShipUpdateBytesPerSecond()
+{
+	return data->shipUpdateBytesPerSecond;
+}
+
+// ----------------------------------------------------------------------
+
+inline float ConfigServerGame::getShipUpdateBurstSeconds()
+{
+	return data->shipUpdateBurstSeconds;
+}
+
+// ----------------------------------------------------------------------
+
+inline int ConfigServerGame::getShipUpdateLagThresholdMs()
+{
+	return data->shipUpdateLagThresholdMs;
+}
+
+// ----------------------------------------------------------------------
+
+inline int ConfigServerGame::getShipUpdateUnchangedResendMs()
+{
+	return data->shipUpdateUnchangedResendMs;
+}
+
+// ----------------------------------------------------------------------
+
 inline bool ConfigServerGame::getDebugSpaceVisibilityManager()
 {
 	return data->debugSpaceVisibilityManager;
@@ -2946,6 +3074,13 @@ inline int ConfigServerGame::getSpaceAiEnemySearchesPerFrame()
 
 // ----------------------------------------------------------------------
 
+inline bool ConfigServerGame::getSpaceAiBulkSteering()
+{
+	return data->spaceAiBulkSteering;
+}
+
+// ----------------------------------------------------------------------
+
 inline bool ConfigServerGame::getGroundShouldSleep()
 {
 	return data->groundShouldSleep;
@@ -56,6 +56,7 @@
 #include "serverGame/PlayerSanityChecker.h"
 #include "serverGame/PlayerShipController.h"
 #include "serverGame/PositionUpdateTracker.h"
+#include "serverGame/PreloadManager.h"
 #include "serverGame/PurgeManager.h"
 #include "serverGame/Region.h"
 #include "serverGame/RegionMaster.h"
@@ -191,6 +192,7 @@
 #include "sharedGame/QuestManager.h"
 #include "sharedLog/FileLogObserver.h"
 #include "sharedLog/Log.h"
+#include "sharedMath/Rectangle2d.h"
 #include "sharedMessageDispatch/MessageManager.h"
 #include "sharedNetwork/NetworkSetupData.h"
 #include "sharedNetwork/Service.h"
@@ -987,9 +989,16 @@ void GameServer::receiveMessage(const MessageDispatch::Emitter & source, const M
 			GameServer::getInstance().sendToPlanetServer(m);
 
 			std::vector <std::pair<int, int>> const &chunks = m.getChunks();
+			TerrainObject * const terrainObject = TerrainObject::getInstance();
 			for (std::vector < std::pair < int, int > > ::const_iterator i = chunks.begin(); i != chunks.end();
 			++i)
-			ServerBuildoutManager::onChunkComplete(i->first, i->second);
+			{
+				ServerBuildoutManager::onChunkComplete(i->first, i->second);
+
+				// generate terrain ahead of the players the loaded objects will bring
+				if (terrainObject)
+					terrainObject->pregenerateRegion(Rectangle2d(static_cast<float>(i->first), static_cast<float>(i->second), static_cast<float>(i->first + 100), static_cast<float>(i->second + 100)));
+			}
 			break;
 		}
 
@@ -4124,6 +4133,11 @@ void GameServer::run(void)
 				MetricsManager::update(static_cast<float>(lastFrameTime));
 		}
 
+		{
+			PROFILER_AUTO_BLOCK_DEFINE("PreloadManager::update");
+			PreloadManager::update();
+		}
+
 		{
 			PROFILER_AUTO_BLOCK_DEFINE("ServerWorld::update");
 			ServerWorld::update(Clock::frameTime());
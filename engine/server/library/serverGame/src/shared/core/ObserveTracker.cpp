@@ -60,6 +60,8 @@ namespace ObserveTrackerNamespace
 	void observeContents(Client &client, ServerObject &obj, std::set<NetworkId> const *oldObserveList, bool recursive);
 	void observeContentsIfObservedWithParent(Client &client, ServerObject &obj, std::set<NetworkId> const *oldObserveList);
 	bool shouldObserveCellContentsDueToClientContainmentChain(Client const &client, ServerObject const &portallizedObject);
+	ServerObject const *getInteriorTransitionOwner(ServerObject const *oldContainer, ServerObject const &newContainer);
+	void observeInteriorTransition(Client &client, ServerObject &obj, ServerObject &newCell, ServerObject const &portallizedObject);
 	void observeMissionCriticalObjects(Client &client, CreatureObject const &clientCreature);
 	void handleUnobserveCallback(void const *);
 }
@@ -212,6 +214,34 @@ void ObserveTracker::onClientLostVisibleObjectSpace(Client &client, ServerObject
 
 // ----------------------------------------------------------------------
 
+void ObserveTracker::onClientAddedVisibleObjectsSpace(Client &client, std::vector<ServerObject *> const &visibleObjects)
+{
+	for (std::vector<ServerObject *>::const_iterator i = visibleObjects.begin(); i != visibleObjects.end(); ++i)
+	{
+		DEBUG_REPORT_LOG(ConfigServerGame::getDebugSpaceVisibilityManager(),("ObserveTracker::onClientAddedVisibleObjectsSpace(Client &client, %s);\n",(*i)->getNetworkId().getValueString().c_str()));
+
+		IGNORE_RETURN(observe(client, **i));
+	}
+}
+
+// ----------------------------------------------------------------------
+
+void ObserveTracker::onClientLostVisibleObjectsSpace(Client &client, std::vector<ServerObject *> const &visibleObjects)
+{
+	// do not unobserve mission critical objects
+	CreatureObject const * const creatureObject = safe_cast<CreatureObject const *>(client.getCharacterObject());
+
+	for (std::vector<ServerObject *>::const_iterator i = visibleObjects.begin(); i != visibleObjects.end(); ++i)
+	{
+		DEBUG_REPORT_LOG(ConfigServerGame::getDebugSpaceVisibilityManager(),("ObserveTracker::onClientLostVisibleObjectsSpace(Client &client, %s);\n",(*i)->getNetworkId().getValueString().c_str()));
+
+		if (!creatureObject || !creatureObject->isMissionCriticalObject((*i)->getNetworkId()))
+			setUnobserveCallback(client, **i);
+	}
+}
+
+// ----------------------------------------------------------------------
+
 void ObserveTracker::onClientEnteredNetworkTriggerVolume(Client &client, TriggerVolume &triggerVolume, std::set<NetworkId> const *oldObserveList)
 {
 	IGNORE_RETURN(observe(client, triggerVolume.getOwner(), oldObserveList));
@@ -327,17 +357,25 @@ void ObserveTracker::onClientAboutToTransferAuthority(Client &client)
 
 // ----------------------------------------------------------------------
 
-void ObserveTracker::onObjectContainerChanged(ServerObject &obj)
+void ObserveTracker::onObjectContainerChanged(ServerObject &obj, ServerObject const *oldContainer)
 {
 	ServerObject * const newContainer = safe_cast<ServerObject *>(ContainerInterface::getContainedByObject(obj));
 	if (newContainer)
 	{
+		// Set if obj only moved from one cell of a building to another.
+		ServerObject const * const interiorOwner = getInteriorTransitionOwner(oldContainer, *newContainer);
+
 		// If an object controlled by a client is entering a new container, they
 		// should reobserve their containment chain, which will observe newly
 		// exposed contents as appropriate.
 		Client * const client = obj.getClient();
 		if (client)
-			FATAL(!observeContainmentChain(*client, obj, 0), ("Client for object %s could not observe its own containment chain.", obj.getDebugInformation().c_str()));
+		{
+			if (interiorOwner && isObserving(*client, *interiorOwner) && isObserving(*client, *newContainer))
+				observeInteriorTransition(*client, obj, *newContainer, *interiorOwner);
+			else
+				FATAL(!observeContainmentChain(*client, obj, 0), ("Client for object %s could not observe its own containment chain.", obj.getDebugInformation().c_str()));
+		}
 
 		{
 			// all clients that were observing obj but are not observing its new container must unobserve obj
@@ -358,6 +396,10 @@ void ObserveTracker::onObjectContainerChanged(ServerObject &obj)
 				std::set<Client *> const &newObservers = newContainer->getObservers();
 				for (std::set<Client *>::const_iterator i = newObservers.begin(); i != newObservers.end(); ++i)
 				{
+					// clients already observing obj inside the same building have nothing new to observe
+					if (interiorOwner && isObserving(**i, obj))
+						continue;
+
 					if (isObservedWith ||
 						(*i)->getOpenedContainers().count(newContainer) ||
 						(newContainerCell != nullptr && shouldObserveCellContentsDueToClientContainmentChain(**i, *newContainerContainer)))
@@ -956,6 +998,53 @@ bool ObserveTrackerNamespace::shouldObserveCellContentsDueToClientContainmentCha
 
 // ----------------------------------------------------------------------
 
+/**
+ * Get the building (or other portallized object) whose cells an object
+ * moved between.
+ *
+ * @return The portallized object if oldContainer and newContainer are both
+ * its cells and it is not itself contained, or 0
+ */
+ServerObject const *ObserveTrackerNamespace::getInteriorTransitionOwner(ServerObject const *oldContainer, ServerObject const &newContainer)
+{
+	if (!oldContainer || !oldContainer->getCellProperty() || !newContainer.getCellProperty())
+		return 0;
+
+	ServerObject const * const portallizedObject = safe_cast<ServerObject const *>(ContainerInterface::getContainedByObject(newContainer));
+	if (   !portallizedObject
+	    || portallizedObject != ContainerInterface::getContainedByObject(*oldContainer)
+	    || ContainerInterface::getContainedByObject(*portallizedObject))
+		return 0;
+
+	return portallizedObject;
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Observe what a client's object moving between two cells of a building
+ * newly exposes.
+ *
+ * A client whose object is inside a building already observes every cell of
+ * it and their contents: all of it was observed when the object got into the
+ * building, and objects entering a cell since were observed as they entered.
+ * Objects in cells have no network trigger volumes, so nothing in the
+ * building can be waiting to be unobserved.  Walking the whole containment
+ * graph again, as observeContainmentChain() does through the building, would
+ * only find objects already observed; the cell moved into is all that needs
+ * looking at.
+ */
+void ObserveTrackerNamespace::observeInteriorTransition(Client &client, ServerObject &obj, ServerObject &newCell, ServerObject const &portallizedObject)
+{
+	removeUnobserveCallback(&client, const_cast<ServerObject &>(portallizedObject));
+
+	// observing the cell observes its contents, since the client is inside the building
+	if (!observe(client, newCell, 0) || !observe(client, obj, 0))
+		FATAL(!observeContainmentChain(client, obj, 0), ("Client for object %s could not observe its own containment chain.", obj.getDebugInformation().c_str()));
+}
+
+// ----------------------------------------------------------------------
+
 void ObserveTrackerNamespace::observeMissionCriticalObjects(Client &client, CreatureObject const &clientCreature)
 {
 	CreatureObject::MissionCriticalObjectSet const & missionCriticalObjects = clientCreature.getMissionCriticalObjects();
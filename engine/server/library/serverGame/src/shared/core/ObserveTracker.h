@@ -32,6 +32,8 @@ public:
 	static void onClientExitedNetworkTriggerVolume(Client &client, TriggerVolume &triggerVolume);
 	static void onClientAddedVisibleObjectSpace(Client &client, ServerObject &visibleObject);
 	static void onClientLostVisibleObjectSpace(Client &client, ServerObject &visibleObject);
+	static void onClientAddedVisibleObjectsSpace(Client &client, std::vector<ServerObject *> const &visibleObjects);
+	static void onClientLostVisibleObjectsSpace(Client &client, std::vector<ServerObject *> const &visibleObjects);
 	static void onClientEnteredPortalTriggerVolume(Client &client, TriggerVolume &triggerVolume, std::set<NetworkId> const *oldObserveList = 0);
 	static void onClientExitedPortalTriggerVolume(Client &client, TriggerVolume &triggerVolume);
 	static bool onClientOpenedContainer(Client &client, ServerObject &obj, int sequence, std::string const &slotDesc, bool sendOpenContainerNotification = true);
@@ -39,7 +41,7 @@ public:
 	static void onClientJoinedGroup(Client &client, ServerObject &group);
 	static void onClientLeftGroup(Client &client, ServerObject &group);
 	static void onClientAboutToTransferAuthority(Client &client);
-	static void onObjectContainerChanged(ServerObject &obj);
+	static void onObjectContainerChanged(ServerObject &obj, ServerObject const *oldContainer = 0);
 	static void onObjectArrangementChanged(ServerObject &obj);
 	static void onObjectMadeInvisible(ServerObject &obj);
 	static void onObjectMadeVisibleTo(ServerObject &obj, const std::vector<ServerObject *> & observers);
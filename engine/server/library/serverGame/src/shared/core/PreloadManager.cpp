@@ -6,12 +6,23 @@
 #include "PreloadManager.h"
 
 #include "serverGame/ConfigServerGame.h"
+#include "sharedFile/MemoryFile.h"
+#include "sharedFile/TreeFile.h"
+#include "sharedFoundation/Clock.h"
 #include "sharedFoundation/ExitChain.h"
+#include "sharedFoundation/Os.h"
+#include "sharedLog/Log.h"
 #include "sharedObject/ObjectTemplate.h"
 #include "sharedObject/ObjectTemplateList.h"
+#include "sharedSynchronization/Mutex.h"
+#include "sharedThread/RunThread.h"
+#include "sharedThread/ThreadHandle.h"
 #include "sharedUtility/DataTableManager.h"
 
+#include <algorithm>
 #include <cstdio>
+#include <deque>
+#include <string>
 #include <vector>
 
 //------------------------------------------------------------------------------------------
@@ -116,7 +127,230 @@ namespace PreloadManagerNameSpace
 		WARNING(true, ("Building preload lists only works under linux"));
 #endif
 	}
-	
+
+	// ----------------------------------------------------------------------
+	// manifest preloading
+	//
+	// The worker threads only read the files listed in the manifest into
+	// memory, inflating compressed ones; parsing them touches the template
+	// and data table lists, which are not thread safe, so that is done on
+	// the main thread in update(), a few milliseconds per frame.  Each file
+	// is handed to the TreeFile cache while it is fetched so the parse never
+	// goes to disk.
+	//
+	// Files TreeFile::install already cached from the SharedFile preload
+	// list are left out of the manifest: opening them on a worker would
+	// take them from the cache, and adding them back would collide with
+	// their entry.
+
+	struct PreloadedFile
+	{
+		std::string   fileName;
+		AbstractFile *file;
+		int           bytes;
+	};
+	typedef std::deque<PreloadedFile> PreloadedFiles;
+
+	int const                cms_maximumReadyBytes = 16 * 1024 * 1024;
+
+	std::vector<std::string> ms_manifest;
+	std::vector<ThreadHandle> ms_workerThreads;
+
+	// guarded by ms_mutex
+	Mutex                    ms_mutex;
+	int                      ms_nextManifestIndex;
+	int                      ms_numberOfRunningWorkers;
+	bool                     ms_stopWorkers;
+	PreloadedFiles           ms_readyFiles;
+	int                      ms_readyBytes;
+
+	int                      ms_numberOfObjectTemplatesPublished;
+	int                      ms_numberOfDataTablesPublished;
+	int                      ms_numberOfFilesSkipped;
+	unsigned long            ms_preloadStartTime;
+
+	bool isDataTable(std::string const & fileName)
+	{
+		return fileName.compare(0, 11, "datatables/") == 0;
+	}
+
+	bool isAlreadyLoaded(std::string const & fileName)
+	{
+		if (isDataTable(fileName))
+			return DataTableManager::isOpen(fileName);
+
+		return ObjectTemplateList::isLoaded(fileName);
+	}
+
+	void readManifest(char const * fileName)
+	{
+		FILE* fp = fopen(fileName, "r");
+		if (!fp)
+		{
+			WARNING(true, ("PreloadManager could not open preload manifest %s", fileName));
+			return;
+		}
+
+		// accepts the preload lists and the output of logLoadedObjectTemplates ("<references> <name>")
+		char buf [512];
+		while (fgets(buf, sizeof(buf), fp))
+		{
+			char * line = buf;
+			size_t len = strlen(line);
+			while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r' || line[len - 1] == ' '))
+				line[--len] = 0;
+
+			char * tmp = strstr(line, "object/");
+			if (!tmp)
+				tmp = strstr(line, "datatables/");
+			if (!tmp)
+				continue;
+
+			char fixedFileName[Os::MAX_PATH_LENGTH];
+			TreeFile::fixUpFileName(tmp, fixedFileName);
+			if (TreeFile::hasCachedFile(fixedFileName))
+				++ms_numberOfFilesSkipped;
+			else
+				ms_manifest.push_back(fixedFileName);
+		}
+
+		fclose(fp);
+	}
+
+	void writeManifest(char const * fileName)
+	{
+		FILE* fp = fopen(fileName, "w");
+		if (!fp)
+		{
+			WARNING(true, ("PreloadManager could not write preload manifest %s", fileName));
+			return;
+		}
+
+		std::vector<std::string> names;
+		DataTableManager::getOpenTableNames(names);
+		ObjectTemplateList::getLoadedObjectTemplateNames(names);
+
+		for (std::vector<std::string>::const_iterator i = names.begin(); i != names.end(); ++i)
+			fprintf(fp, "%s\n", i->c_str());
+
+		fclose(fp);
+
+		LOG("Preload", ("Wrote %d entries to preload manifest %s", static_cast<int>(names.size()), fileName));
+	}
+
+	void workerThread()
+	{
+		for (;;)
+		{
+			ms_mutex.enter();
+
+				if (ms_stopWorkers || ms_nextManifestIndex >= static_cast<int>(ms_manifest.size()))
+				{
+					--ms_numberOfRunningWorkers;
+					ms_mutex.leave();
+					return;
+				}
+
+				// let the main thread catch up before reading any further ahead
+				bool const postpone = ms_readyBytes > cms_maximumReadyBytes;
+				int const index = postpone ? -1 : ms_nextManifestIndex++;
+
+			ms_mutex.leave();
+
+			if (postpone)
+			{
+				Os::sleep(10);
+				continue;
+			}
+
+			std::string const & fileName = ms_manifest[static_cast<size_t>(index)];
+
+			AbstractFile * file = TreeFile::open(fileName.c_str(), AbstractFile::PriorityLow, true);
+			if (!file)
+				continue;
+
+			int const bytes = file->length();
+			AbstractFile * const memoryFile = new MemoryFile(file);
+			delete file;
+			file = memoryFile;
+
+			PreloadedFile preloadedFile;
+			preloadedFile.fileName = fileName;
+			preloadedFile.file = file;
+			preloadedFile.bytes = bytes;
+
+			ms_mutex.enter();
+				ms_readyFiles.push_back(preloadedFile);
+				ms_readyBytes += bytes;
+			ms_mutex.leave();
+		}
+	}
+
+	void startWorkers()
+	{
+		ms_nextManifestIndex = 0;
+		ms_stopWorkers = false;
+		ms_readyBytes = 0;
+		ms_preloadStartTime = Clock::timeMs();
+
+		int const numberOfWorkers = std::max(1, ConfigServerGame::getPreloadThreads());
+		ms_numberOfRunningWorkers = numberOfWorkers;
+
+		for (int i = 0; i < numberOfWorkers; ++i)
+		{
+			ThreadHandle threadHandle;
+			threadHandle = runNamedThread("PreloadManager", workerThread);
+			ms_workerThreads.push_back(threadHandle);
+		}
+	}
+
+	void stopWorkers()
+	{
+		ms_mutex.enter();
+			ms_stopWorkers = true;
+		ms_mutex.leave();
+
+		for (std::vector<ThreadHandle>::iterator i = ms_workerThreads.begin(); i != ms_workerThreads.end(); ++i)
+			(*i)->wait();
+		ms_workerThreads.clear();
+
+		for (PreloadedFiles::iterator j = ms_readyFiles.begin(); j != ms_readyFiles.end(); ++j)
+			delete j->file;
+		ms_readyFiles.clear();
+		ms_readyBytes = 0;
+	}
+
+	void publish(PreloadedFile const & preloadedFile)
+	{
+		if (isAlreadyLoaded(preloadedFile.fileName) || TreeFile::hasCachedFile(preloadedFile.fileName.c_str()))
+		{
+			// fetched by the game, or as the base of another template, since the manifest was read,
+			// or cached by someone else, whose entry must not be replaced or removed
+			delete preloadedFile.file;
+			++ms_numberOfFilesSkipped;
+			return;
+		}
+
+		TreeFile::addCachedFile(preloadedFile.fileName.c_str(), preloadedFile.file);
+
+		if (isDataTable(preloadedFile.fileName))
+		{
+			if (DataTableManager::getTable(preloadedFile.fileName, true))
+				++ms_numberOfDataTablesPublished;
+		}
+		else
+		{
+			const ObjectTemplate * objectTemplate = ObjectTemplateList::fetch(preloadedFile.fileName);
+			if (objectTemplate)
+			{
+				ms_objectTemplateList.push_back(objectTemplate);
+				++ms_numberOfObjectTemplatesPublished;
+			}
+		}
+
+		// drops the file if the fetch did not use it, leaving the files preloaded by TreeFile::install
+		TreeFile::removeCachedFile(preloadedFile.fileName.c_str());
+	}
 }
 
 using namespace PreloadManagerNameSpace;
@@ -146,6 +380,14 @@ void PreloadManager::install()
 		loadObjectTemplates();
 	}
 
+	char const * const manifest = ConfigServerGame::getPreloadManifest();
+	if (manifest && *manifest)
+	{
+		readManifest(manifest);
+		if (!ms_manifest.empty())
+			startWorkers();
+	}
+
 	ExitChain::add(remove, "PreloadManager::remove");
 }
 
@@ -159,6 +401,13 @@ void PreloadManager::remove()
 		return;
 	}
 
+	stopWorkers();
+	ms_manifest.clear();
+
+	char const * const manifestExport = ConfigServerGame::getPreloadManifestExport();
+	if (manifestExport && *manifestExport)
+		writeManifest(manifestExport);
+
 	for (std::vector<const ObjectTemplate*>::iterator i = ms_objectTemplateList.begin(); i != ms_objectTemplateList.end(); ++i)
 	{
 		(*i)->releaseReference();
@@ -169,7 +418,60 @@ void PreloadManager::remove()
 		DataTableManager::close(*j);
 	}
 */
+	ms_objectTemplateList.clear();
+
 	m_installed = false;
 }
 
 //------------------------------------------------------------------------------------------
+
+/**
+ * Parse the files the preload workers have read, for up to
+ * preloadPublishMsPerFrame milliseconds.  Called once per frame.
+ */
+void PreloadManager::update()
+{
+	if (ms_workerThreads.empty())
+		return;
+
+	unsigned long const startTime = Clock::timeMs();
+	unsigned long const budget = static_cast<unsigned long>(std::max(1, ConfigServerGame::getPreloadPublishMsPerFrame()));
+
+	for (;;)
+	{
+		ms_mutex.enter();
+
+			if (ms_readyFiles.empty())
+			{
+				bool const finished = ms_numberOfRunningWorkers == 0;
+				ms_mutex.leave();
+
+				if (finished)
+				{
+					stopWorkers();
+					LOG("Preload", ("Preloaded %d object templates and %d data tables from the manifest in %lu ms (%d already loaded)", ms_numberOfObjectTemplatesPublished, ms_numberOfDataTablesPublished, Clock::timeMs() - ms_preloadStartTime, ms_numberOfFilesSkipped));
+				}
+				return;
+			}
+
+			PreloadedFile const preloadedFile = ms_readyFiles.front();
+			ms_readyFiles.pop_front();
+			ms_readyBytes -= preloadedFile.bytes;
+
+		ms_mutex.leave();
+
+		publish(preloadedFile);
+
+		if (Clock::timeMs() - startTime >= budget)
+			return;
+	}
+}
+
+//------------------------------------------------------------------------------------------
+
+bool PreloadManager::isPreloading()
+{
+	return !ms_workerThreads.empty();
+}
+
+//------------------------------------------------------------------------------------------
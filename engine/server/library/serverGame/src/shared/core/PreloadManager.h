@@ -13,6 +13,9 @@ public:
 	static void install();
 	static void remove();
 
+	static void update();
+	static bool isPreloading();
+
 private:
 	PreloadManager();
 	PreloadManager(const PreloadManager&);
@@ -10,6 +10,7 @@
 #include "SwgGameServer/CombatEngine.h"
 #include "serverGame/AiCombatPulseQueue.h"
 #include "serverGame/AiCreatureController.h"
+#include "serverGame/AiShipSteeringManager.h"
 #include "serverGame/AuthTransferTracker.h"
 #include "serverGame/CellObject.h"
 #include "serverGame/CollisionCallbacks.h"
@@ -106,6 +107,7 @@
 #include "sharedFile/Iff.h"
 #include "sharedFoundation/Clock.h"
 #include "sharedFoundation/ConstCharCrcString.h"
+#include "sharedFoundation/CrcConstexpr.hpp"
 #include "sharedFoundation/Scheduler.h"
 #include "sharedFoundation/Timer.h"
 #include "sharedGame/SharedBattlefieldMarkerObjectTemplate.h"
@@ -2013,7 +2015,7 @@ ServerObject * ServerWorld::getObject(int index)
 
 static Object *beginCreateServerCellObject(int index)
 {
-	ServerObject *newObject = ServerWorld::createNewObject("object/cell/cell.iff", Transform::identity, 0, false);
+	ServerObject *newObject = ServerWorld::createNewObject(constcrc("object/cell/cell.iff"), Transform::identity, 0, false);
 	NOT_NULL(newObject);
 	safe_cast<CellObject *>(newObject)->setCell(index);
 
@@ -2686,6 +2688,11 @@ void ServerWorld::update(real time)
 	// scheduler code
 	World::beginFrame();
 	{
+		{
+			PROFILER_AUTO_BLOCK_DEFINE("AiShipSteeringManager::update");
+			AiShipSteeringManager::update();
+		}
+
 		{
 			PROFILER_AUTO_BLOCK_DEFINE("Alter");
 			AlterScheduler::alter(time);
@@ -10,8 +10,10 @@
 #include "serverGame/ObjectTracker.h"
 #include "serverGame/ServerUIManager.h"
 #include "serverGame/ServerUniverse.h"
+#include "serverGame/ShipClientUpdateTracker.h"
 #include "serverNetworkMessages/MetricsDataMessage.h"
 #include "serverScript/GameScriptObject.h"
+#include "sharedCollision/CollisionWorld.h"
 #include "sharedFoundation/CalendarTime.h"
 #include "sharedFoundation/FormattedString.h"
 #include "sharedFoundation/Os.h"
@@ -48,6 +50,9 @@ m_numStaticAI(0),
 m_numCombatAI(0),
 m_numHibernatingAI(0),
 m_numDelayedHibernatingAI(0),
+m_numNearLodAI(0),
+m_numMediumLodAI(0),
+m_numFarLodAI(0),
 m_allocations(0),
 m_gameProcessId(0),
 m_noBuild(0),
@@ -83,6 +88,9 @@ m_numResourceTypesImported(0)
 	ADD_METRICS_DATA(numCombatAI, 0, true);
 	ADD_METRICS_DATA(numHibernatingAI, 0, true);
 	ADD_METRICS_DATA(numDelayedHibernatingAI, 0, true);
+	ADD_METRICS_DATA(numNearLodAI, 0, false);
+	ADD_METRICS_DATA(numMediumLodAI, 0, false);
+	ADD_METRICS_DATA(numFarLodAI, 0, false);
 
 	ADD_METRICS_DATA(numIntangibles, 0, false);
 	ADD_METRICS_DATA(numGroupObjects, 0, false);
@@ -107,6 +115,23 @@ m_numResourceTypesImported(0)
 	ADD_METRICS_DATA(numResourceTypesNative, 0, false);
 	ADD_METRICS_DATA(numResourceTypesImported, 0, false);
 
+	ADD_METRICS_DATA(numActiveColliders, 0, false);
+	ADD_METRICS_DATA(numSweptColliders, 0, false);
+	ADD_METRICS_DATA(collisionTotalUs, 0, false);
+	ADD_METRICS_DATA(collisionSweepUs, 0, false);
+	ADD_METRICS_DATA(collisionSweepResolveUs, 0, false);
+	ADD_METRICS_DATA(collisionFloorUpdateUs, 0, false);
+	ADD_METRICS_DATA(collisionFootprintUpdateUs, 0, false);
+	ADD_METRICS_DATA(collisionDetectUs, 0, false);
+	ADD_METRICS_DATA(collisionResolveUs, 0, false);
+	ADD_METRICS_DATA(collisionPostUpdateUs, 0, false);
+	ADD_METRICS_DATA(shipUpdateClients, 0, false);
+	ADD_METRICS_DATA(shipUpdateBytesPerClient, 0, false);
+	ADD_METRICS_DATA(shipUpdateMaxBytesPerClient, 0, false);
+	ADD_METRICS_DATA(shipUpdatesSent, 0, false);
+	ADD_METRICS_DATA(shipUpdatesUnchanged, 0, false);
+	ADD_METRICS_DATA(shipUpdateThrottledClients, 0, false);
+
 	std::string label = NetworkHandler::getHostName();
 
 	for (std::string::iterator i = label.begin(); i != label.end(); ++i)
@@ -210,6 +235,9 @@ void GameServerMetricsData::updateData()
 	m_data[m_numCombatAI].m_value = ObjectTracker::getNumCombatAI();
 	m_data[m_numHibernatingAI].m_value = ObjectTracker::getNumHibernatingAI();
 	m_data[m_numDelayedHibernatingAI].m_value = ObjectTracker::getNumDelayedHibernatingAI();
+	m_data[m_numNearLodAI].m_value = ObjectTracker::getNumNearLodAI();
+	m_data[m_numMediumLodAI].m_value = ObjectTracker::getNumMediumLodAI();
+	m_data[m_numFarLodAI].m_value = ObjectTracker::getNumFarLodAI();
 
 	m_data[m_gameProcessId].m_value = static_cast<int>(GameServer::getInstance().getProcessId());
 
@@ -251,6 +279,28 @@ void GameServerMetricsData::updateData()
 	m_data[m_numResourceTypesNative].m_value = ServerUniverse::getInstance().getNumNativeResourceTypes();
 	m_data[m_numResourceTypesImported].m_value = ServerUniverse::getInstance().getNumImportedResourceTypes();
 
+	// collision timings are from the last CollisionWorld::update
+	CollisionWorld::UpdateTimings const & collisionTimings = CollisionWorld::getLastUpdateTimings();
+	m_data[m_numActiveColliders].m_value = collisionTimings.activeColliders;
+	m_data[m_numSweptColliders].m_value = collisionTimings.sweptColliders;
+	m_data[m_collisionTotalUs].m_value = static_cast<int>(collisionTimings.total * 1000000.0f);
+	m_data[m_collisionSweepUs].m_value = static_cast<int>(collisionTimings.sweep * 1000000.0f);
+	m_data[m_collisionSweepResolveUs].m_value = static_cast<int>(collisionTimings.sweepResolve * 1000000.0f);
+	m_data[m_collisionFloorUpdateUs].m_value = static_cast<int>(collisionTimings.floorUpdate * 1000000.0f);
+	m_data[m_collisionFootprintUpdateUs].m_value = static_cast<int>(collisionTimings.footprintUpdate * 1000000.0f);
+	m_data[m_collisionDetectUs].m_value = static_cast<int>(collisionTimings.collisionDetect * 1000000.0f);
+	m_data[m_collisionResolveUs].m_value = static_cast<int>(collisionTimings.resolveCollisions * 1000000.0f);
+	m_data[m_collisionPostUpdateUs].m_value = static_cast<int>(collisionTimings.postUpdate * 1000000.0f);
+
+	// ship update traffic is averaged over the last second
+	ShipClientUpdateTracker::Statistics const & shipUpdateStatistics = ShipClientUpdateTracker::getStatistics();
+	m_data[m_shipUpdateClients].m_value = shipUpdateStatistics.clients;
+	m_data[m_shipUpdateBytesPerClient].m_value = shipUpdateStatistics.bytesPerClientPerSecond;
+	m_data[m_shipUpdateMaxBytesPerClient].m_value = shipUpdateStatistics.maxBytesPerClientPerSecond;
+	m_data[m_shipUpdatesSent].m_value = shipUpdateStatistics.updatesPerSecond;
+	m_data[m_shipUpdatesUnchanged].m_value = shipUpdateStatistics.unchangedUpdatesPerSecond;
+	m_data[m_shipUpdateThrottledClients].m_value = shipUpdateStatistics.throttledClientsPerSecond;
+
 /*****************  Disabled due to stats failing to update on live **********************
 	std::map< std::string, uint32 >& cpmap = Client::getPacketBytesPerMinStats();
 	std::map< std::string, uint32 >::iterator cpiter;
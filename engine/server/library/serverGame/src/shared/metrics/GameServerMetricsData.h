@@ -46,6 +46,9 @@ private:
 	unsigned long m_numCombatAI;
 	unsigned long m_numHibernatingAI;
 	unsigned long m_numDelayedHibernatingAI;
+	unsigned long m_numNearLodAI;
+	unsigned long m_numMediumLodAI;
+	unsigned long m_numFarLodAI;
 
 	unsigned long m_allocations;
 
@@ -68,6 +71,23 @@ private:
 	unsigned long m_numResourceTypesNative;
 	unsigned long m_numResourceTypesImported;
 
+	unsigned long m_numActiveColliders;
+	unsigned long m_numSweptColliders;
+	unsigned long m_collisionTotalUs;
+	unsigned long m_collisionSweepUs;
+	unsigned long m_collisionSweepResolveUs;
+	unsigned long m_collisionFloorUpdateUs;
+	unsigned long m_collisionFootprintUpdateUs;
+	unsigned long m_collisionDetectUs;
+	unsigned long m_collisionResolveUs;
+	unsigned long m_collisionPostUpdateUs;
+	unsigned long m_shipUpdateClients;
+	unsigned long m_shipUpdateBytesPerClient;
+	unsigned long m_shipUpdateMaxBytesPerClient;
+	unsigned long m_shipUpdatesSent;
+	unsigned long m_shipUpdatesUnchanged;
+	unsigned long m_shipUpdateThrottledClients;
+
 	std::map< std::string, unsigned long > m_packetDataMap;
 
 private:
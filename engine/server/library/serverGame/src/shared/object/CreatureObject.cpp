@@ -3901,6 +3901,10 @@ void CreatureObject::setInCombat(bool inCombat)
 		}
 		else
 		{
+			AICreatureController * const aiCreatureController = AICreatureController::asAiCreatureController(getController());
+			if (aiCreatureController != nullptr)
+				aiCreatureController->wakeFromLod();
+
 			// if we are crafting, end the crafting session
 
 			PlayerObject * const player = PlayerCreatureController::getPlayerObject(this);
@@ -237,7 +237,9 @@ bool LineOfSightCache::checkLOS(Object const &a, Object const &b)
 		if (targetTop.y < targetHeight)
 			targetTop.y = targetHeight;
 
-		// Check both directions for obstructions
+		// Check both directions for obstructions.  Both checks look along the
+		// same segment, so the second is answered from the candidates the
+		// collision world's query batch kept for the first
 		QueryInteractionResult qirResult = QIR_None;
 		float outHitTime = 0.f;
 		Object const *outHitObject = 0;
@@ -25,6 +25,9 @@ int ObjectTracker::m_numUniverseObjects=0;
 int ObjectTracker::m_numCombatAI=0;
 int ObjectTracker::m_numHibernatingAI=0;
 int ObjectTracker::m_numDelayedHibernatingAI=0;
+int ObjectTracker::m_numNearLodAI=0;
+int ObjectTracker::m_numMediumLodAI=0;
+int ObjectTracker::m_numFarLodAI=0;
 
 int ObjectTracker::m_numIntangibles=0;
 int ObjectTracker::m_numGroupObjects=0;
@@ -179,6 +182,27 @@ int ObjectTracker::getNumDelayedHibernatingAI()
 
 //------------------------------------------------------------------------------------------
 
+int ObjectTracker::getNumNearLodAI()
+{
+	return m_numNearLodAI;
+}
+
+//------------------------------------------------------------------------------------------
+
+int ObjectTracker::getNumMediumLodAI()
+{
+	return m_numMediumLodAI;
+}
+
+//------------------------------------------------------------------------------------------
+
+int ObjectTracker::getNumFarLodAI()
+{
+	return m_numFarLodAI;
+}
+
+//------------------------------------------------------------------------------------------
+
 int ObjectTracker::getNumIntangibles()
 {
 	return m_numIntangibles;
@@ -297,6 +321,27 @@ void ObjectTracker::addDelayedHibernatingAI()
 
 //------------------------------------------------------------------------------------------
 
+void ObjectTracker::addNearLodAI()
+{
+	++m_numNearLodAI;
+}
+
+//------------------------------------------------------------------------------------------
+
+void ObjectTracker::addMediumLodAI()
+{
+	++m_numMediumLodAI;
+}
+
+//------------------------------------------------------------------------------------------
+
+void ObjectTracker::addFarLodAI()
+{
+	++m_numFarLodAI;
+}
+
+//------------------------------------------------------------------------------------------
+
 void ObjectTracker::addIntangible()
 {
 	++m_numIntangibles;
@@ -421,6 +466,30 @@ void ObjectTracker::removeDelayedHibernatingAI()
 
 //------------------------------------------------------------------------------------------
 
+void ObjectTracker::removeNearLodAI()
+{
+	if (m_numNearLodAI > 0)
+		--m_numNearLodAI;
+}
+
+//------------------------------------------------------------------------------------------
+
+void ObjectTracker::removeMediumLodAI()
+{
+	if (m_numMediumLodAI > 0)
+		--m_numMediumLodAI;
+}
+
+//------------------------------------------------------------------------------------------
+
+void ObjectTracker::removeFarLodAI()
+{
+	if (m_numFarLodAI > 0)
+		--m_numFarLodAI;
+}
+
+//------------------------------------------------------------------------------------------
+
 void ObjectTracker::removeIntangible()
 {
 	--m_numIntangibles;
@@ -23,6 +23,9 @@ public:
 	static int getNumCombatAI();
 	static int getNumHibernatingAI();
 	static int getNumDelayedHibernatingAI();
+	static int getNumNearLodAI();
+	static int getNumMediumLodAI();
+	static int getNumFarLodAI();
 
 	static int getNumIntangibles();
 	static int getNumMissionDatas();
@@ -44,6 +47,9 @@ public:
 	static void addCombatAI();
 	static void addHibernatingAI();
 	static void addDelayedHibernatingAI();
+	static void addNearLodAI();
+	static void addMediumLodAI();
+	static void addFarLodAI();
 
 	static void addIntangible();
 	static void addGroupObject();
@@ -65,6 +71,9 @@ public:
 	static void removeCombatAI();
 	static void removeHibernatingAI();
 	static void removeDelayedHibernatingAI();
+	static void removeNearLodAI();
+	static void removeMediumLodAI();
+	static void removeFarLodAI();
 
 	static void removeIntangible();
 	static void removeGroupObject();
@@ -96,6 +105,9 @@ private:
 	static int m_numCombatAI;
 	static int m_numHibernatingAI;
 	static int m_numDelayedHibernatingAI;
+	static int m_numNearLodAI;
+	static int m_numMediumLodAI;
+	static int m_numFarLodAI;
 
 	static int m_numIntangibles;
 	static int m_numGroupObjects;
@@ -10,6 +10,7 @@
 #include "serverGame/ServerObject.h"
 
 #include "UnicodeUtils.h"
+#include "serverGame/AiCreatureController.h"
 #include "serverGame/AuthTransferTracker.h"
 #include "serverGame/BuildingObject.h"
 #include "serverGame/CellObject.h"
@@ -3119,7 +3120,7 @@ void ServerObject::containerHandleUpdateClients(ServerObject* oldContainer, Serv
 	if (addWorld)
 		addToWorld();
 
-	ObserveTracker::onObjectContainerChanged(*this);
+	ObserveTracker::onObjectContainerChanged(*this, oldContainer);
 	synchronizationOnContainerChange(oldContainer, newContainer);
 }
 
@@ -3241,6 +3242,13 @@ float ServerObject::getFarNetworkUpdateRadius() const
 
 void ServerObject::onTriggerEnter(ServerObject & object, TriggerVolume & triggerVolume)
 {
+	// ai altering at a reduced rate must react to players coming close
+	if (object.isPlayerControlled() && isAuthoritative())
+	{
+		AICreatureController * const aiCreatureController = AICreatureController::asAiCreatureController(getController());
+		if (aiCreatureController != nullptr)
+			aiCreatureController->wakeFromLod();
+	}
 }
 
 //-----------------------------------------------------------------------
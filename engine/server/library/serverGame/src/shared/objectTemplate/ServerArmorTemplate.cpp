@@ -163,6 +163,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_integrity.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerArmorTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -183,7 +188,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter integrity has not been defined in template %s!", DataResource::getName()));
-			return base->getIntegrity();
+			return m_integrity.storeResolvedValue(0, randomDrawCount, base->getIntegrity());
 		}
 	}
 
@@ -216,7 +221,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_integrity.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerArmorTemplate::getIntegrity
 
 int ServerArmorTemplate::getIntegrityMin(bool testData) const
@@ -227,6 +232,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_integrity.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerArmorTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -247,7 +257,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter integrity has not been defined in template %s!", DataResource::getName()));
-			return base->getIntegrityMin();
+			return m_integrity.storeResolvedValue(1, randomDrawCount, base->getIntegrityMin());
 		}
 	}
 
@@ -280,7 +290,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_integrity.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerArmorTemplate::getIntegrityMin
 
 int ServerArmorTemplate::getIntegrityMax(bool testData) const
@@ -291,6 +301,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_integrity.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerArmorTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -311,7 +326,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter integrity has not been defined in template %s!", DataResource::getName()));
-			return base->getIntegrityMax();
+			return m_integrity.storeResolvedValue(2, randomDrawCount, base->getIntegrityMax());
 		}
 	}
 
@@ -344,7 +359,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_integrity.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerArmorTemplate::getIntegrityMax
 
 int ServerArmorTemplate::getEffectiveness(bool testData) const
@@ -355,6 +370,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_effectiveness.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerArmorTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -375,7 +395,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter effectiveness has not been defined in template %s!", DataResource::getName()));
-			return base->getEffectiveness();
+			return m_effectiveness.storeResolvedValue(0, randomDrawCount, base->getEffectiveness());
 		}
 	}
 
@@ -408,7 +428,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_effectiveness.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerArmorTemplate::getEffectiveness
 
 int ServerArmorTemplate::getEffectivenessMin(bool testData) const
@@ -419,6 +439,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_effectiveness.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerArmorTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -439,7 +464,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter effectiveness has not been defined in template %s!", DataResource::getName()));
-			return base->getEffectivenessMin();
+			return m_effectiveness.storeResolvedValue(1, randomDrawCount, base->getEffectivenessMin());
 		}
 	}
 
@@ -472,7 +497,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_effectiveness.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerArmorTemplate::getEffectivenessMin
 
 int ServerArmorTemplate::getEffectivenessMax(bool testData) const
@@ -483,6 +508,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_effectiveness.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerArmorTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -503,7 +533,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter effectiveness has not been defined in template %s!", DataResource::getName()));
-			return base->getEffectivenessMax();
+			return m_effectiveness.storeResolvedValue(2, randomDrawCount, base->getEffectivenessMax());
 		}
 	}
 
@@ -536,7 +566,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_effectiveness.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerArmorTemplate::getEffectivenessMax
 
 void ServerArmorTemplate::getSpecialProtection(SpecialProtection &data, int index) const
@@ -700,6 +730,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_vulnerability.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerArmorTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -720,7 +755,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter vulnerability has not been defined in template %s!", DataResource::getName()));
-			return base->getVulnerability();
+			return m_vulnerability.storeResolvedValue(0, randomDrawCount, base->getVulnerability());
 		}
 	}
 
@@ -753,7 +788,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_vulnerability.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerArmorTemplate::getVulnerability
 
 int ServerArmorTemplate::getVulnerabilityMin(bool testData) const
@@ -764,6 +799,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_vulnerability.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerArmorTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -784,7 +824,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter vulnerability has not been defined in template %s!", DataResource::getName()));
-			return base->getVulnerabilityMin();
+			return m_vulnerability.storeResolvedValue(1, randomDrawCount, base->getVulnerabilityMin());
 		}
 	}
 
@@ -817,7 +857,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_vulnerability.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerArmorTemplate::getVulnerabilityMin
 
 int ServerArmorTemplate::getVulnerabilityMax(bool testData) const
@@ -828,6 +868,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_vulnerability.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerArmorTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -848,7 +893,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter vulnerability has not been defined in template %s!", DataResource::getName()));
-			return base->getVulnerabilityMax();
+			return m_vulnerability.storeResolvedValue(2, randomDrawCount, base->getVulnerabilityMax());
 		}
 	}
 
@@ -881,7 +926,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_vulnerability.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerArmorTemplate::getVulnerabilityMax
 
 int ServerArmorTemplate::getEncumbrance(int index) const
@@ -120,6 +120,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_maintenanceCost.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerBuildingObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -140,7 +145,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maintenanceCost has not been defined in template %s!", DataResource::getName()));
-			return base->getMaintenanceCost();
+			return m_maintenanceCost.storeResolvedValue(0, randomDrawCount, base->getMaintenanceCost());
 		}
 	}
 
@@ -173,7 +178,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maintenanceCost.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerBuildingObjectTemplate::getMaintenanceCost
 
 int ServerBuildingObjectTemplate::getMaintenanceCostMin(bool testData) const
@@ -184,6 +189,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_maintenanceCost.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerBuildingObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -204,7 +214,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maintenanceCost has not been defined in template %s!", DataResource::getName()));
-			return base->getMaintenanceCostMin();
+			return m_maintenanceCost.storeResolvedValue(1, randomDrawCount, base->getMaintenanceCostMin());
 		}
 	}
 
@@ -237,7 +247,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maintenanceCost.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerBuildingObjectTemplate::getMaintenanceCostMin
 
 int ServerBuildingObjectTemplate::getMaintenanceCostMax(bool testData) const
@@ -248,6 +258,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_maintenanceCost.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerBuildingObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -268,7 +283,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maintenanceCost has not been defined in template %s!", DataResource::getName()));
-			return base->getMaintenanceCostMax();
+			return m_maintenanceCost.storeResolvedValue(2, randomDrawCount, base->getMaintenanceCostMax());
 		}
 	}
 
@@ -301,7 +316,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maintenanceCost.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerBuildingObjectTemplate::getMaintenanceCostMax
 
 bool ServerBuildingObjectTemplate::getIsPublic(bool testData) const
@@ -609,6 +609,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_minDrainModifier.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -629,7 +634,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter minDrainModifier has not been defined in template %s!", DataResource::getName()));
-			return base->getMinDrainModifier();
+			return m_minDrainModifier.storeResolvedValue(0, randomDrawCount, base->getMinDrainModifier());
 		}
 	}
 
@@ -662,7 +667,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_minDrainModifier.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerCreatureObjectTemplate::getMinDrainModifier
 
 float ServerCreatureObjectTemplate::getMinDrainModifierMin(bool testData) const
@@ -673,6 +678,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_minDrainModifier.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -693,7 +703,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter minDrainModifier has not been defined in template %s!", DataResource::getName()));
-			return base->getMinDrainModifierMin();
+			return m_minDrainModifier.storeResolvedValue(1, randomDrawCount, base->getMinDrainModifierMin());
 		}
 	}
 
@@ -726,7 +736,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_minDrainModifier.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerCreatureObjectTemplate::getMinDrainModifierMin
 
 float ServerCreatureObjectTemplate::getMinDrainModifierMax(bool testData) const
@@ -737,6 +747,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_minDrainModifier.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -757,7 +772,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter minDrainModifier has not been defined in template %s!", DataResource::getName()));
-			return base->getMinDrainModifierMax();
+			return m_minDrainModifier.storeResolvedValue(2, randomDrawCount, base->getMinDrainModifierMax());
 		}
 	}
 
@@ -790,7 +805,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_minDrainModifier.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerCreatureObjectTemplate::getMinDrainModifierMax
 
 float ServerCreatureObjectTemplate::getMaxDrainModifier(bool testData) const
@@ -801,6 +816,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_maxDrainModifier.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -821,7 +841,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxDrainModifier has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxDrainModifier();
+			return m_maxDrainModifier.storeResolvedValue(0, randomDrawCount, base->getMaxDrainModifier());
 		}
 	}
 
@@ -854,7 +874,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxDrainModifier.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerCreatureObjectTemplate::getMaxDrainModifier
 
 float ServerCreatureObjectTemplate::getMaxDrainModifierMin(bool testData) const
@@ -865,6 +885,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_maxDrainModifier.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -885,7 +910,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxDrainModifier has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxDrainModifierMin();
+			return m_maxDrainModifier.storeResolvedValue(1, randomDrawCount, base->getMaxDrainModifierMin());
 		}
 	}
 
@@ -918,7 +943,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxDrainModifier.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerCreatureObjectTemplate::getMaxDrainModifierMin
 
 float ServerCreatureObjectTemplate::getMaxDrainModifierMax(bool testData) const
@@ -929,6 +954,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_maxDrainModifier.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -949,7 +979,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxDrainModifier has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxDrainModifierMax();
+			return m_maxDrainModifier.storeResolvedValue(2, randomDrawCount, base->getMaxDrainModifierMax());
 		}
 	}
 
@@ -982,7 +1012,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxDrainModifier.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerCreatureObjectTemplate::getMaxDrainModifierMax
 
 float ServerCreatureObjectTemplate::getMinFaucetModifier(bool testData) const
@@ -993,6 +1023,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_minFaucetModifier.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1013,7 +1048,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter minFaucetModifier has not been defined in template %s!", DataResource::getName()));
-			return base->getMinFaucetModifier();
+			return m_minFaucetModifier.storeResolvedValue(0, randomDrawCount, base->getMinFaucetModifier());
 		}
 	}
 
@@ -1046,7 +1081,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_minFaucetModifier.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerCreatureObjectTemplate::getMinFaucetModifier
 
 float ServerCreatureObjectTemplate::getMinFaucetModifierMin(bool testData) const
@@ -1057,6 +1092,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_minFaucetModifier.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1077,7 +1117,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter minFaucetModifier has not been defined in template %s!", DataResource::getName()));
-			return base->getMinFaucetModifierMin();
+			return m_minFaucetModifier.storeResolvedValue(1, randomDrawCount, base->getMinFaucetModifierMin());
 		}
 	}
 
@@ -1110,7 +1150,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_minFaucetModifier.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerCreatureObjectTemplate::getMinFaucetModifierMin
 
 float ServerCreatureObjectTemplate::getMinFaucetModifierMax(bool testData) const
@@ -1121,6 +1161,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_minFaucetModifier.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1141,7 +1186,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter minFaucetModifier has not been defined in template %s!", DataResource::getName()));
-			return base->getMinFaucetModifierMax();
+			return m_minFaucetModifier.storeResolvedValue(2, randomDrawCount, base->getMinFaucetModifierMax());
 		}
 	}
 
@@ -1174,7 +1219,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_minFaucetModifier.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerCreatureObjectTemplate::getMinFaucetModifierMax
 
 float ServerCreatureObjectTemplate::getMaxFaucetModifier(bool testData) const
@@ -1185,6 +1230,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_maxFaucetModifier.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1205,7 +1255,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxFaucetModifier has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxFaucetModifier();
+			return m_maxFaucetModifier.storeResolvedValue(0, randomDrawCount, base->getMaxFaucetModifier());
 		}
 	}
 
@@ -1238,7 +1288,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxFaucetModifier.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerCreatureObjectTemplate::getMaxFaucetModifier
 
 float ServerCreatureObjectTemplate::getMaxFaucetModifierMin(bool testData) const
@@ -1249,6 +1299,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_maxFaucetModifier.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1269,7 +1324,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxFaucetModifier has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxFaucetModifierMin();
+			return m_maxFaucetModifier.storeResolvedValue(1, randomDrawCount, base->getMaxFaucetModifierMin());
 		}
 	}
 
@@ -1302,7 +1357,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxFaucetModifier.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerCreatureObjectTemplate::getMaxFaucetModifierMin
 
 float ServerCreatureObjectTemplate::getMaxFaucetModifierMax(bool testData) const
@@ -1313,6 +1368,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_maxFaucetModifier.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1333,7 +1393,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxFaucetModifier has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxFaucetModifierMax();
+			return m_maxFaucetModifier.storeResolvedValue(2, randomDrawCount, base->getMaxFaucetModifierMax());
 		}
 	}
 
@@ -1366,7 +1426,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxFaucetModifier.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerCreatureObjectTemplate::getMaxFaucetModifierMax
 
 void ServerCreatureObjectTemplate::getAttribMods(AttribMod &data, int index) const
@@ -1539,6 +1599,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_shockWounds.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1559,7 +1624,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter shockWounds has not been defined in template %s!", DataResource::getName()));
-			return base->getShockWounds();
+			return m_shockWounds.storeResolvedValue(0, randomDrawCount, base->getShockWounds());
 		}
 	}
 
@@ -1592,7 +1657,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_shockWounds.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerCreatureObjectTemplate::getShockWounds
 
 int ServerCreatureObjectTemplate::getShockWoundsMin(bool testData) const
@@ -1603,6 +1668,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_shockWounds.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1623,7 +1693,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter shockWounds has not been defined in template %s!", DataResource::getName()));
-			return base->getShockWoundsMin();
+			return m_shockWounds.storeResolvedValue(1, randomDrawCount, base->getShockWoundsMin());
 		}
 	}
 
@@ -1656,7 +1726,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_shockWounds.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerCreatureObjectTemplate::getShockWoundsMin
 
 int ServerCreatureObjectTemplate::getShockWoundsMax(bool testData) const
@@ -1667,6 +1737,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_shockWounds.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1687,7 +1762,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter shockWounds has not been defined in template %s!", DataResource::getName()));
-			return base->getShockWoundsMax();
+			return m_shockWounds.storeResolvedValue(2, randomDrawCount, base->getShockWoundsMax());
 		}
 	}
 
@@ -1720,7 +1795,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_shockWounds.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerCreatureObjectTemplate::getShockWoundsMax
 
 bool ServerCreatureObjectTemplate::getCanCreateAvatar(bool testData) const
@@ -1815,6 +1890,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_approachTriggerRange.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1835,7 +1915,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter approachTriggerRange has not been defined in template %s!", DataResource::getName()));
-			return base->getApproachTriggerRange();
+			return m_approachTriggerRange.storeResolvedValue(0, randomDrawCount, base->getApproachTriggerRange());
 		}
 	}
 
@@ -1868,7 +1948,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_approachTriggerRange.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerCreatureObjectTemplate::getApproachTriggerRange
 
 float ServerCreatureObjectTemplate::getApproachTriggerRangeMin(bool testData) const
@@ -1879,6 +1959,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_approachTriggerRange.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1899,7 +1984,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter approachTriggerRange has not been defined in template %s!", DataResource::getName()));
-			return base->getApproachTriggerRangeMin();
+			return m_approachTriggerRange.storeResolvedValue(1, randomDrawCount, base->getApproachTriggerRangeMin());
 		}
 	}
 
@@ -1932,7 +2017,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_approachTriggerRange.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerCreatureObjectTemplate::getApproachTriggerRangeMin
 
 float ServerCreatureObjectTemplate::getApproachTriggerRangeMax(bool testData) const
@@ -1943,6 +2028,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_approachTriggerRange.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1963,7 +2053,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter approachTriggerRange has not been defined in template %s!", DataResource::getName()));
-			return base->getApproachTriggerRangeMax();
+			return m_approachTriggerRange.storeResolvedValue(2, randomDrawCount, base->getApproachTriggerRangeMax());
 		}
 	}
 
@@ -1996,7 +2086,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_approachTriggerRange.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerCreatureObjectTemplate::getApproachTriggerRangeMax
 
 float ServerCreatureObjectTemplate::getMaxMentalStates(MentalStates index) const
@@ -639,6 +639,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_itemsPerContainer.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerDraftSchematicObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -659,7 +664,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter itemsPerContainer has not been defined in template %s!", DataResource::getName()));
-			return base->getItemsPerContainer();
+			return m_itemsPerContainer.storeResolvedValue(0, randomDrawCount, base->getItemsPerContainer());
 		}
 	}
 
@@ -692,7 +697,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_itemsPerContainer.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerDraftSchematicObjectTemplate::getItemsPerContainer
 
 int ServerDraftSchematicObjectTemplate::getItemsPerContainerMin(bool testData) const
@@ -703,6 +708,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_itemsPerContainer.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerDraftSchematicObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -723,7 +733,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter itemsPerContainer has not been defined in template %s!", DataResource::getName()));
-			return base->getItemsPerContainerMin();
+			return m_itemsPerContainer.storeResolvedValue(1, randomDrawCount, base->getItemsPerContainerMin());
 		}
 	}
 
@@ -756,7 +766,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_itemsPerContainer.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerDraftSchematicObjectTemplate::getItemsPerContainerMin
 
 int ServerDraftSchematicObjectTemplate::getItemsPerContainerMax(bool testData) const
@@ -767,6 +777,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_itemsPerContainer.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerDraftSchematicObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -787,7 +802,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter itemsPerContainer has not been defined in template %s!", DataResource::getName()));
-			return base->getItemsPerContainerMax();
+			return m_itemsPerContainer.storeResolvedValue(2, randomDrawCount, base->getItemsPerContainerMax());
 		}
 	}
 
@@ -820,7 +835,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_itemsPerContainer.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerDraftSchematicObjectTemplate::getItemsPerContainerMax
 
 float ServerDraftSchematicObjectTemplate::getManufactureTime(bool testData) const
@@ -831,6 +846,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_manufactureTime.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerDraftSchematicObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -851,7 +871,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter manufactureTime has not been defined in template %s!", DataResource::getName()));
-			return base->getManufactureTime();
+			return m_manufactureTime.storeResolvedValue(0, randomDrawCount, base->getManufactureTime());
 		}
 	}
 
@@ -884,7 +904,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_manufactureTime.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerDraftSchematicObjectTemplate::getManufactureTime
 
 float ServerDraftSchematicObjectTemplate::getManufactureTimeMin(bool testData) const
@@ -895,6 +915,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_manufactureTime.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerDraftSchematicObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -915,7 +940,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter manufactureTime has not been defined in template %s!", DataResource::getName()));
-			return base->getManufactureTimeMin();
+			return m_manufactureTime.storeResolvedValue(1, randomDrawCount, base->getManufactureTimeMin());
 		}
 	}
 
@@ -948,7 +973,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_manufactureTime.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerDraftSchematicObjectTemplate::getManufactureTimeMin
 
 float ServerDraftSchematicObjectTemplate::getManufactureTimeMax(bool testData) const
@@ -959,6 +984,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_manufactureTime.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerDraftSchematicObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -979,7 +1009,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter manufactureTime has not been defined in template %s!", DataResource::getName()));
-			return base->getManufactureTimeMax();
+			return m_manufactureTime.storeResolvedValue(2, randomDrawCount, base->getManufactureTimeMax());
 		}
 	}
 
@@ -1012,7 +1042,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_manufactureTime.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerDraftSchematicObjectTemplate::getManufactureTimeMax
 
 float ServerDraftSchematicObjectTemplate::getPrototypeTime(bool testData) const
@@ -1023,6 +1053,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_prototypeTime.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerDraftSchematicObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1043,7 +1078,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter prototypeTime has not been defined in template %s!", DataResource::getName()));
-			return base->getPrototypeTime();
+			return m_prototypeTime.storeResolvedValue(0, randomDrawCount, base->getPrototypeTime());
 		}
 	}
 
@@ -1076,7 +1111,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_prototypeTime.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerDraftSchematicObjectTemplate::getPrototypeTime
 
 float ServerDraftSchematicObjectTemplate::getPrototypeTimeMin(bool testData) const
@@ -1087,6 +1122,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_prototypeTime.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerDraftSchematicObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1107,7 +1147,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter prototypeTime has not been defined in template %s!", DataResource::getName()));
-			return base->getPrototypeTimeMin();
+			return m_prototypeTime.storeResolvedValue(1, randomDrawCount, base->getPrototypeTimeMin());
 		}
 	}
 
@@ -1140,7 +1180,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_prototypeTime.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerDraftSchematicObjectTemplate::getPrototypeTimeMin
 
 float ServerDraftSchematicObjectTemplate::getPrototypeTimeMax(bool testData) const
@@ -1151,6 +1191,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_prototypeTime.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerDraftSchematicObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1171,7 +1216,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter prototypeTime has not been defined in template %s!", DataResource::getName()));
-			return base->getPrototypeTimeMax();
+			return m_prototypeTime.storeResolvedValue(2, randomDrawCount, base->getPrototypeTimeMax());
 		}
 	}
 
@@ -1204,7 +1249,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_prototypeTime.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerDraftSchematicObjectTemplate::getPrototypeTimeMax
 
 #ifdef _DEBUG
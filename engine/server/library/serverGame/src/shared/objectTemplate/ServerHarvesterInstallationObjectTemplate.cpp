@@ -120,6 +120,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_maxExtractionRate.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerHarvesterInstallationObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -140,7 +145,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxExtractionRate has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxExtractionRate();
+			return m_maxExtractionRate.storeResolvedValue(0, randomDrawCount, base->getMaxExtractionRate());
 		}
 	}
 
@@ -173,7 +178,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxExtractionRate.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerHarvesterInstallationObjectTemplate::getMaxExtractionRate
 
 int ServerHarvesterInstallationObjectTemplate::getMaxExtractionRateMin(bool testData) const
@@ -184,6 +189,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_maxExtractionRate.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerHarvesterInstallationObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -204,7 +214,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxExtractionRate has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxExtractionRateMin();
+			return m_maxExtractionRate.storeResolvedValue(1, randomDrawCount, base->getMaxExtractionRateMin());
 		}
 	}
 
@@ -237,7 +247,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxExtractionRate.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerHarvesterInstallationObjectTemplate::getMaxExtractionRateMin
 
 int ServerHarvesterInstallationObjectTemplate::getMaxExtractionRateMax(bool testData) const
@@ -248,6 +258,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_maxExtractionRate.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerHarvesterInstallationObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -268,7 +283,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxExtractionRate has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxExtractionRateMax();
+			return m_maxExtractionRate.storeResolvedValue(2, randomDrawCount, base->getMaxExtractionRateMax());
 		}
 	}
 
@@ -301,7 +316,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxExtractionRate.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerHarvesterInstallationObjectTemplate::getMaxExtractionRateMax
 
 int ServerHarvesterInstallationObjectTemplate::getCurrentExtractionRate(bool testData) const
@@ -312,6 +327,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_currentExtractionRate.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerHarvesterInstallationObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -332,7 +352,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter currentExtractionRate has not been defined in template %s!", DataResource::getName()));
-			return base->getCurrentExtractionRate();
+			return m_currentExtractionRate.storeResolvedValue(0, randomDrawCount, base->getCurrentExtractionRate());
 		}
 	}
 
@@ -365,7 +385,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_currentExtractionRate.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerHarvesterInstallationObjectTemplate::getCurrentExtractionRate
 
 int ServerHarvesterInstallationObjectTemplate::getCurrentExtractionRateMin(bool testData) const
@@ -376,6 +396,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_currentExtractionRate.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerHarvesterInstallationObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -396,7 +421,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter currentExtractionRate has not been defined in template %s!", DataResource::getName()));
-			return base->getCurrentExtractionRateMin();
+			return m_currentExtractionRate.storeResolvedValue(1, randomDrawCount, base->getCurrentExtractionRateMin());
 		}
 	}
 
@@ -429,7 +454,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_currentExtractionRate.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerHarvesterInstallationObjectTemplate::getCurrentExtractionRateMin
 
 int ServerHarvesterInstallationObjectTemplate::getCurrentExtractionRateMax(bool testData) const
@@ -440,6 +465,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_currentExtractionRate.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerHarvesterInstallationObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -460,7 +490,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter currentExtractionRate has not been defined in template %s!", DataResource::getName()));
-			return base->getCurrentExtractionRateMax();
+			return m_currentExtractionRate.storeResolvedValue(2, randomDrawCount, base->getCurrentExtractionRateMax());
 		}
 	}
 
@@ -493,7 +523,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_currentExtractionRate.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerHarvesterInstallationObjectTemplate::getCurrentExtractionRateMax
 
 int ServerHarvesterInstallationObjectTemplate::getMaxHopperSize(bool testData) const
@@ -504,6 +534,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_maxHopperSize.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerHarvesterInstallationObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -524,7 +559,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxHopperSize has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxHopperSize();
+			return m_maxHopperSize.storeResolvedValue(0, randomDrawCount, base->getMaxHopperSize());
 		}
 	}
 
@@ -557,7 +592,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxHopperSize.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerHarvesterInstallationObjectTemplate::getMaxHopperSize
 
 int ServerHarvesterInstallationObjectTemplate::getMaxHopperSizeMin(bool testData) const
@@ -568,6 +603,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_maxHopperSize.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerHarvesterInstallationObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -588,7 +628,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxHopperSize has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxHopperSizeMin();
+			return m_maxHopperSize.storeResolvedValue(1, randomDrawCount, base->getMaxHopperSizeMin());
 		}
 	}
 
@@ -621,7 +661,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxHopperSize.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerHarvesterInstallationObjectTemplate::getMaxHopperSizeMin
 
 int ServerHarvesterInstallationObjectTemplate::getMaxHopperSizeMax(bool testData) const
@@ -632,6 +672,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_maxHopperSize.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerHarvesterInstallationObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -652,7 +697,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxHopperSize has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxHopperSizeMax();
+			return m_maxHopperSize.storeResolvedValue(2, randomDrawCount, base->getMaxHopperSizeMax());
 		}
 	}
 
@@ -685,7 +730,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxHopperSize.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerHarvesterInstallationObjectTemplate::getMaxHopperSizeMax
 
 const std::string & ServerHarvesterInstallationObjectTemplate::getMasterClassName(bool testData) const
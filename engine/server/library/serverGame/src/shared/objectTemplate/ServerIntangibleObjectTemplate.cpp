@@ -120,6 +120,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_count.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerIntangibleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -140,7 +145,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter count has not been defined in template %s!", DataResource::getName()));
-			return base->getCount();
+			return m_count.storeResolvedValue(0, randomDrawCount, base->getCount());
 		}
 	}
 
@@ -173,7 +178,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_count.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerIntangibleObjectTemplate::getCount
 
 int ServerIntangibleObjectTemplate::getCountMin(bool testData) const
@@ -184,6 +189,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_count.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerIntangibleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -204,7 +214,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter count has not been defined in template %s!", DataResource::getName()));
-			return base->getCountMin();
+			return m_count.storeResolvedValue(1, randomDrawCount, base->getCountMin());
 		}
 	}
 
@@ -237,7 +247,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_count.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerIntangibleObjectTemplate::getCountMin
 
 int ServerIntangibleObjectTemplate::getCountMax(bool testData) const
@@ -248,6 +258,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_count.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerIntangibleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -268,7 +283,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter count has not been defined in template %s!", DataResource::getName()));
-			return base->getCountMax();
+			return m_count.storeResolvedValue(2, randomDrawCount, base->getCountMax());
 		}
 	}
 
@@ -301,7 +316,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_count.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerIntangibleObjectTemplate::getCountMax
 
 #ifdef _DEBUG
@@ -415,6 +415,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_itemCount.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerManufactureSchematicObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -435,7 +440,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter itemCount has not been defined in template %s!", DataResource::getName()));
-			return base->getItemCount();
+			return m_itemCount.storeResolvedValue(0, randomDrawCount, base->getItemCount());
 		}
 	}
 
@@ -468,7 +473,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_itemCount.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerManufactureSchematicObjectTemplate::getItemCount
 
 int ServerManufactureSchematicObjectTemplate::getItemCountMin(bool testData) const
@@ -479,6 +484,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_itemCount.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerManufactureSchematicObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -499,7 +509,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter itemCount has not been defined in template %s!", DataResource::getName()));
-			return base->getItemCountMin();
+			return m_itemCount.storeResolvedValue(1, randomDrawCount, base->getItemCountMin());
 		}
 	}
 
@@ -532,7 +542,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_itemCount.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerManufactureSchematicObjectTemplate::getItemCountMin
 
 int ServerManufactureSchematicObjectTemplate::getItemCountMax(bool testData) const
@@ -543,6 +553,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_itemCount.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerManufactureSchematicObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -563,7 +578,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter itemCount has not been defined in template %s!", DataResource::getName()));
-			return base->getItemCountMax();
+			return m_itemCount.storeResolvedValue(2, randomDrawCount, base->getItemCountMax());
 		}
 	}
 
@@ -596,7 +611,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_itemCount.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerManufactureSchematicObjectTemplate::getItemCountMax
 
 void ServerManufactureSchematicObjectTemplate::getAttributes(SchematicAttribute &data, int index) const
@@ -500,6 +500,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_volume.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -520,7 +525,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter volume has not been defined in template %s!", DataResource::getName()));
-			return base->getVolume();
+			return m_volume.storeResolvedValue(0, randomDrawCount, base->getVolume());
 		}
 	}
 
@@ -553,7 +558,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_volume.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerObjectTemplate::getVolume
 
 int ServerObjectTemplate::getVolumeMin(bool testData) const
@@ -564,6 +569,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_volume.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -584,7 +594,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter volume has not been defined in template %s!", DataResource::getName()));
-			return base->getVolumeMin();
+			return m_volume.storeResolvedValue(1, randomDrawCount, base->getVolumeMin());
 		}
 	}
 
@@ -617,7 +627,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_volume.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerObjectTemplate::getVolumeMin
 
 int ServerObjectTemplate::getVolumeMax(bool testData) const
@@ -628,6 +638,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_volume.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -648,7 +663,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter volume has not been defined in template %s!", DataResource::getName()));
-			return base->getVolumeMax();
+			return m_volume.storeResolvedValue(2, randomDrawCount, base->getVolumeMax());
 		}
 	}
 
@@ -681,7 +696,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_volume.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerObjectTemplate::getVolumeMax
 
 ServerObjectTemplate::VisibleFlags ServerObjectTemplate::getVisibleFlags(int index) const
@@ -908,6 +923,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_complexity.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -928,7 +948,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter complexity has not been defined in template %s!", DataResource::getName()));
-			return base->getComplexity();
+			return m_complexity.storeResolvedValue(0, randomDrawCount, base->getComplexity());
 		}
 	}
 
@@ -961,7 +981,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_complexity.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerObjectTemplate::getComplexity
 
 float ServerObjectTemplate::getComplexityMin(bool testData) const
@@ -972,6 +992,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_complexity.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -992,7 +1017,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter complexity has not been defined in template %s!", DataResource::getName()));
-			return base->getComplexityMin();
+			return m_complexity.storeResolvedValue(1, randomDrawCount, base->getComplexityMin());
 		}
 	}
 
@@ -1025,7 +1050,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_complexity.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerObjectTemplate::getComplexityMin
 
 float ServerObjectTemplate::getComplexityMax(bool testData) const
@@ -1036,6 +1061,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_complexity.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1056,7 +1086,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter complexity has not been defined in template %s!", DataResource::getName()));
-			return base->getComplexityMax();
+			return m_complexity.storeResolvedValue(2, randomDrawCount, base->getComplexityMax());
 		}
 	}
 
@@ -1089,7 +1119,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_complexity.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerObjectTemplate::getComplexityMax
 
 int ServerObjectTemplate::getTintIndex(bool testData) const
@@ -1100,6 +1130,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_tintIndex.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1120,7 +1155,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter tintIndex has not been defined in template %s!", DataResource::getName()));
-			return base->getTintIndex();
+			return m_tintIndex.storeResolvedValue(0, randomDrawCount, base->getTintIndex());
 		}
 	}
 
@@ -1153,7 +1188,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_tintIndex.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerObjectTemplate::getTintIndex
 
 int ServerObjectTemplate::getTintIndexMin(bool testData) const
@@ -1164,6 +1199,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_tintIndex.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1184,7 +1224,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter tintIndex has not been defined in template %s!", DataResource::getName()));
-			return base->getTintIndexMin();
+			return m_tintIndex.storeResolvedValue(1, randomDrawCount, base->getTintIndexMin());
 		}
 	}
 
@@ -1217,7 +1257,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_tintIndex.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerObjectTemplate::getTintIndexMin
 
 int ServerObjectTemplate::getTintIndexMax(bool testData) const
@@ -1228,6 +1268,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_tintIndex.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1248,7 +1293,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter tintIndex has not been defined in template %s!", DataResource::getName()));
-			return base->getTintIndexMax();
+			return m_tintIndex.storeResolvedValue(2, randomDrawCount, base->getTintIndexMax());
 		}
 	}
 
@@ -1281,7 +1326,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_tintIndex.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerObjectTemplate::getTintIndexMax
 
 float ServerObjectTemplate::getUpdateRanges(UpdateRanges index) const
@@ -120,6 +120,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_maxResources.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerResourceContainerObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -140,7 +145,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxResources has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxResources();
+			return m_maxResources.storeResolvedValue(0, randomDrawCount, base->getMaxResources());
 		}
 	}
 
@@ -173,7 +178,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxResources.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerResourceContainerObjectTemplate::getMaxResources
 
 int ServerResourceContainerObjectTemplate::getMaxResourcesMin(bool testData) const
@@ -184,6 +189,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_maxResources.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerResourceContainerObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -204,7 +214,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxResources has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxResourcesMin();
+			return m_maxResources.storeResolvedValue(1, randomDrawCount, base->getMaxResourcesMin());
 		}
 	}
 
@@ -237,7 +247,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxResources.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerResourceContainerObjectTemplate::getMaxResourcesMin
 
 int ServerResourceContainerObjectTemplate::getMaxResourcesMax(bool testData) const
@@ -248,6 +258,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_maxResources.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerResourceContainerObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -268,7 +283,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxResources has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxResourcesMax();
+			return m_maxResources.storeResolvedValue(2, randomDrawCount, base->getMaxResourcesMax());
 		}
 	}
 
@@ -301,7 +316,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxResources.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerResourceContainerObjectTemplate::getMaxResourcesMax
 
 #ifdef _DEBUG
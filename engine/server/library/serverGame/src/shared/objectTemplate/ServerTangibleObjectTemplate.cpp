@@ -233,6 +233,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_maxHitPoints.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerTangibleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -253,7 +258,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxHitPoints has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxHitPoints();
+			return m_maxHitPoints.storeResolvedValue(0, randomDrawCount, base->getMaxHitPoints());
 		}
 	}
 
@@ -286,7 +291,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxHitPoints.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerTangibleObjectTemplate::getMaxHitPoints
 
 int ServerTangibleObjectTemplate::getMaxHitPointsMin(bool testData) const
@@ -297,6 +302,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_maxHitPoints.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerTangibleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -317,7 +327,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxHitPoints has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxHitPointsMin();
+			return m_maxHitPoints.storeResolvedValue(1, randomDrawCount, base->getMaxHitPointsMin());
 		}
 	}
 
@@ -350,7 +360,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxHitPoints.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerTangibleObjectTemplate::getMaxHitPointsMin
 
 int ServerTangibleObjectTemplate::getMaxHitPointsMax(bool testData) const
@@ -361,6 +371,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_maxHitPoints.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerTangibleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -381,7 +396,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxHitPoints has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxHitPointsMax();
+			return m_maxHitPoints.storeResolvedValue(2, randomDrawCount, base->getMaxHitPointsMax());
 		}
 	}
 
@@ -414,7 +429,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxHitPoints.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerTangibleObjectTemplate::getMaxHitPointsMax
 
 const ServerArmorTemplate * ServerTangibleObjectTemplate::getArmor() const
@@ -458,6 +473,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_interestRadius.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerTangibleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -478,7 +498,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter interestRadius has not been defined in template %s!", DataResource::getName()));
-			return base->getInterestRadius();
+			return m_interestRadius.storeResolvedValue(0, randomDrawCount, base->getInterestRadius());
 		}
 	}
 
@@ -511,7 +531,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_interestRadius.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerTangibleObjectTemplate::getInterestRadius
 
 int ServerTangibleObjectTemplate::getInterestRadiusMin(bool testData) const
@@ -522,6 +542,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_interestRadius.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerTangibleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -542,7 +567,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter interestRadius has not been defined in template %s!", DataResource::getName()));
-			return base->getInterestRadiusMin();
+			return m_interestRadius.storeResolvedValue(1, randomDrawCount, base->getInterestRadiusMin());
 		}
 	}
 
@@ -575,7 +600,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_interestRadius.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerTangibleObjectTemplate::getInterestRadiusMin
 
 int ServerTangibleObjectTemplate::getInterestRadiusMax(bool testData) const
@@ -586,6 +611,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_interestRadius.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerTangibleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -606,7 +636,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter interestRadius has not been defined in template %s!", DataResource::getName()));
-			return base->getInterestRadiusMax();
+			return m_interestRadius.storeResolvedValue(2, randomDrawCount, base->getInterestRadiusMax());
 		}
 	}
 
@@ -639,7 +669,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_interestRadius.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerTangibleObjectTemplate::getInterestRadiusMax
 
 int ServerTangibleObjectTemplate::getCount(bool testData) const
@@ -650,6 +680,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_count.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerTangibleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -670,7 +705,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter count has not been defined in template %s!", DataResource::getName()));
-			return base->getCount();
+			return m_count.storeResolvedValue(0, randomDrawCount, base->getCount());
 		}
 	}
 
@@ -703,7 +738,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_count.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerTangibleObjectTemplate::getCount
 
 int ServerTangibleObjectTemplate::getCountMin(bool testData) const
@@ -714,6 +749,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_count.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerTangibleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -734,7 +774,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter count has not been defined in template %s!", DataResource::getName()));
-			return base->getCountMin();
+			return m_count.storeResolvedValue(1, randomDrawCount, base->getCountMin());
 		}
 	}
 
@@ -767,7 +807,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_count.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerTangibleObjectTemplate::getCountMin
 
 int ServerTangibleObjectTemplate::getCountMax(bool testData) const
@@ -778,6 +818,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_count.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerTangibleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -798,7 +843,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter count has not been defined in template %s!", DataResource::getName()));
-			return base->getCountMax();
+			return m_count.storeResolvedValue(2, randomDrawCount, base->getCountMax());
 		}
 	}
 
@@ -831,7 +876,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_count.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerTangibleObjectTemplate::getCountMax
 
 int ServerTangibleObjectTemplate::getCondition(bool testData) const
@@ -842,6 +887,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_condition.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerTangibleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -862,7 +912,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter condition has not been defined in template %s!", DataResource::getName()));
-			return base->getCondition();
+			return m_condition.storeResolvedValue(0, randomDrawCount, base->getCondition());
 		}
 	}
 
@@ -895,7 +945,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_condition.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerTangibleObjectTemplate::getCondition
 
 int ServerTangibleObjectTemplate::getConditionMin(bool testData) const
@@ -906,6 +956,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_condition.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerTangibleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -926,7 +981,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter condition has not been defined in template %s!", DataResource::getName()));
-			return base->getConditionMin();
+			return m_condition.storeResolvedValue(1, randomDrawCount, base->getConditionMin());
 		}
 	}
 
@@ -959,7 +1014,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_condition.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerTangibleObjectTemplate::getConditionMin
 
 int ServerTangibleObjectTemplate::getConditionMax(bool testData) const
@@ -970,6 +1025,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_condition.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerTangibleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -990,7 +1050,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter condition has not been defined in template %s!", DataResource::getName()));
-			return base->getConditionMax();
+			return m_condition.storeResolvedValue(2, randomDrawCount, base->getConditionMax());
 		}
 	}
 
@@ -1023,7 +1083,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_condition.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerTangibleObjectTemplate::getConditionMax
 
 bool ServerTangibleObjectTemplate::getWantSawAttackTriggers(bool testData) const
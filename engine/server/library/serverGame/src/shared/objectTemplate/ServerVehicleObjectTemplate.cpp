@@ -162,6 +162,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_currentFuel.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -182,7 +187,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter currentFuel has not been defined in template %s!", DataResource::getName()));
-			return base->getCurrentFuel();
+			return m_currentFuel.storeResolvedValue(0, randomDrawCount, base->getCurrentFuel());
 		}
 	}
 
@@ -215,7 +220,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_currentFuel.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerVehicleObjectTemplate::getCurrentFuel
 
 float ServerVehicleObjectTemplate::getCurrentFuelMin(bool testData) const
@@ -226,6 +231,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_currentFuel.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -246,7 +256,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter currentFuel has not been defined in template %s!", DataResource::getName()));
-			return base->getCurrentFuelMin();
+			return m_currentFuel.storeResolvedValue(1, randomDrawCount, base->getCurrentFuelMin());
 		}
 	}
 
@@ -279,7 +289,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_currentFuel.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerVehicleObjectTemplate::getCurrentFuelMin
 
 float ServerVehicleObjectTemplate::getCurrentFuelMax(bool testData) const
@@ -290,6 +300,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_currentFuel.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -310,7 +325,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter currentFuel has not been defined in template %s!", DataResource::getName()));
-			return base->getCurrentFuelMax();
+			return m_currentFuel.storeResolvedValue(2, randomDrawCount, base->getCurrentFuelMax());
 		}
 	}
 
@@ -343,7 +358,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_currentFuel.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerVehicleObjectTemplate::getCurrentFuelMax
 
 float ServerVehicleObjectTemplate::getMaxFuel(bool testData) const
@@ -354,6 +369,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_maxFuel.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -374,7 +394,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxFuel has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxFuel();
+			return m_maxFuel.storeResolvedValue(0, randomDrawCount, base->getMaxFuel());
 		}
 	}
 
@@ -407,7 +427,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxFuel.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerVehicleObjectTemplate::getMaxFuel
 
 float ServerVehicleObjectTemplate::getMaxFuelMin(bool testData) const
@@ -418,6 +438,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_maxFuel.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -438,7 +463,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxFuel has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxFuelMin();
+			return m_maxFuel.storeResolvedValue(1, randomDrawCount, base->getMaxFuelMin());
 		}
 	}
 
@@ -471,7 +496,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxFuel.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerVehicleObjectTemplate::getMaxFuelMin
 
 float ServerVehicleObjectTemplate::getMaxFuelMax(bool testData) const
@@ -482,6 +507,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_maxFuel.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -502,7 +532,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxFuel has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxFuelMax();
+			return m_maxFuel.storeResolvedValue(2, randomDrawCount, base->getMaxFuelMax());
 		}
 	}
 
@@ -535,7 +565,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxFuel.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerVehicleObjectTemplate::getMaxFuelMax
 
 float ServerVehicleObjectTemplate::getConsumpsion(bool testData) const
@@ -546,6 +576,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_consumpsion.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -566,7 +601,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter consumpsion has not been defined in template %s!", DataResource::getName()));
-			return base->getConsumpsion();
+			return m_consumpsion.storeResolvedValue(0, randomDrawCount, base->getConsumpsion());
 		}
 	}
 
@@ -599,7 +634,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_consumpsion.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerVehicleObjectTemplate::getConsumpsion
 
 float ServerVehicleObjectTemplate::getConsumpsionMin(bool testData) const
@@ -610,6 +645,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_consumpsion.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -630,7 +670,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter consumpsion has not been defined in template %s!", DataResource::getName()));
-			return base->getConsumpsionMin();
+			return m_consumpsion.storeResolvedValue(1, randomDrawCount, base->getConsumpsionMin());
 		}
 	}
 
@@ -663,7 +703,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_consumpsion.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerVehicleObjectTemplate::getConsumpsionMin
 
 float ServerVehicleObjectTemplate::getConsumpsionMax(bool testData) const
@@ -674,6 +714,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_consumpsion.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -694,7 +739,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter consumpsion has not been defined in template %s!", DataResource::getName()));
-			return base->getConsumpsionMax();
+			return m_consumpsion.storeResolvedValue(2, randomDrawCount, base->getConsumpsionMax());
 		}
 	}
 
@@ -727,7 +772,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_consumpsion.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerVehicleObjectTemplate::getConsumpsionMax
 
 #ifdef _DEBUG
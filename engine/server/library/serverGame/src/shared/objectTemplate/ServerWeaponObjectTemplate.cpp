@@ -288,6 +288,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_elementalValue.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -308,7 +313,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter elementalValue has not been defined in template %s!", DataResource::getName()));
-			return base->getElementalValue();
+			return m_elementalValue.storeResolvedValue(0, randomDrawCount, base->getElementalValue());
 		}
 	}
 
@@ -341,7 +346,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_elementalValue.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getElementalValue
 
 int ServerWeaponObjectTemplate::getElementalValueMin(bool testData) const
@@ -352,6 +357,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_elementalValue.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -372,7 +382,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter elementalValue has not been defined in template %s!", DataResource::getName()));
-			return base->getElementalValueMin();
+			return m_elementalValue.storeResolvedValue(1, randomDrawCount, base->getElementalValueMin());
 		}
 	}
 
@@ -405,7 +415,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_elementalValue.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getElementalValueMin
 
 int ServerWeaponObjectTemplate::getElementalValueMax(bool testData) const
@@ -416,6 +426,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_elementalValue.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -436,7 +451,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter elementalValue has not been defined in template %s!", DataResource::getName()));
-			return base->getElementalValueMax();
+			return m_elementalValue.storeResolvedValue(2, randomDrawCount, base->getElementalValueMax());
 		}
 	}
 
@@ -469,7 +484,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_elementalValue.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getElementalValueMax
 
 int ServerWeaponObjectTemplate::getMinDamageAmount(bool testData) const
@@ -480,6 +495,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_minDamageAmount.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -500,7 +520,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter minDamageAmount has not been defined in template %s!", DataResource::getName()));
-			return base->getMinDamageAmount();
+			return m_minDamageAmount.storeResolvedValue(0, randomDrawCount, base->getMinDamageAmount());
 		}
 	}
 
@@ -533,7 +553,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_minDamageAmount.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getMinDamageAmount
 
 int ServerWeaponObjectTemplate::getMinDamageAmountMin(bool testData) const
@@ -544,6 +564,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_minDamageAmount.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -564,7 +589,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter minDamageAmount has not been defined in template %s!", DataResource::getName()));
-			return base->getMinDamageAmountMin();
+			return m_minDamageAmount.storeResolvedValue(1, randomDrawCount, base->getMinDamageAmountMin());
 		}
 	}
 
@@ -597,7 +622,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_minDamageAmount.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getMinDamageAmountMin
 
 int ServerWeaponObjectTemplate::getMinDamageAmountMax(bool testData) const
@@ -608,6 +633,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_minDamageAmount.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -628,7 +658,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter minDamageAmount has not been defined in template %s!", DataResource::getName()));
-			return base->getMinDamageAmountMax();
+			return m_minDamageAmount.storeResolvedValue(2, randomDrawCount, base->getMinDamageAmountMax());
 		}
 	}
 
@@ -661,7 +691,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_minDamageAmount.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getMinDamageAmountMax
 
 int ServerWeaponObjectTemplate::getMaxDamageAmount(bool testData) const
@@ -672,6 +702,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_maxDamageAmount.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -692,7 +727,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxDamageAmount has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxDamageAmount();
+			return m_maxDamageAmount.storeResolvedValue(0, randomDrawCount, base->getMaxDamageAmount());
 		}
 	}
 
@@ -725,7 +760,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxDamageAmount.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getMaxDamageAmount
 
 int ServerWeaponObjectTemplate::getMaxDamageAmountMin(bool testData) const
@@ -736,6 +771,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_maxDamageAmount.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -756,7 +796,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxDamageAmount has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxDamageAmountMin();
+			return m_maxDamageAmount.storeResolvedValue(1, randomDrawCount, base->getMaxDamageAmountMin());
 		}
 	}
 
@@ -789,7 +829,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxDamageAmount.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getMaxDamageAmountMin
 
 int ServerWeaponObjectTemplate::getMaxDamageAmountMax(bool testData) const
@@ -800,6 +840,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_maxDamageAmount.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -820,7 +865,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxDamageAmount has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxDamageAmountMax();
+			return m_maxDamageAmount.storeResolvedValue(2, randomDrawCount, base->getMaxDamageAmountMax());
 		}
 	}
 
@@ -853,7 +898,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxDamageAmount.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getMaxDamageAmountMax
 
 float ServerWeaponObjectTemplate::getAttackSpeed(bool testData) const
@@ -864,6 +909,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_attackSpeed.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -884,7 +934,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter attackSpeed has not been defined in template %s!", DataResource::getName()));
-			return base->getAttackSpeed();
+			return m_attackSpeed.storeResolvedValue(0, randomDrawCount, base->getAttackSpeed());
 		}
 	}
 
@@ -917,7 +967,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_attackSpeed.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getAttackSpeed
 
 float ServerWeaponObjectTemplate::getAttackSpeedMin(bool testData) const
@@ -928,6 +978,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_attackSpeed.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -948,7 +1003,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter attackSpeed has not been defined in template %s!", DataResource::getName()));
-			return base->getAttackSpeedMin();
+			return m_attackSpeed.storeResolvedValue(1, randomDrawCount, base->getAttackSpeedMin());
 		}
 	}
 
@@ -981,7 +1036,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_attackSpeed.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getAttackSpeedMin
 
 float ServerWeaponObjectTemplate::getAttackSpeedMax(bool testData) const
@@ -992,6 +1047,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_attackSpeed.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1012,7 +1072,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter attackSpeed has not been defined in template %s!", DataResource::getName()));
-			return base->getAttackSpeedMax();
+			return m_attackSpeed.storeResolvedValue(2, randomDrawCount, base->getAttackSpeedMax());
 		}
 	}
 
@@ -1045,7 +1105,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_attackSpeed.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getAttackSpeedMax
 
 float ServerWeaponObjectTemplate::getAudibleRange(bool testData) const
@@ -1056,6 +1116,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_audibleRange.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1076,7 +1141,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter audibleRange has not been defined in template %s!", DataResource::getName()));
-			return base->getAudibleRange();
+			return m_audibleRange.storeResolvedValue(0, randomDrawCount, base->getAudibleRange());
 		}
 	}
 
@@ -1109,7 +1174,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_audibleRange.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getAudibleRange
 
 float ServerWeaponObjectTemplate::getAudibleRangeMin(bool testData) const
@@ -1120,6 +1185,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_audibleRange.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1140,7 +1210,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter audibleRange has not been defined in template %s!", DataResource::getName()));
-			return base->getAudibleRangeMin();
+			return m_audibleRange.storeResolvedValue(1, randomDrawCount, base->getAudibleRangeMin());
 		}
 	}
 
@@ -1173,7 +1243,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_audibleRange.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getAudibleRangeMin
 
 float ServerWeaponObjectTemplate::getAudibleRangeMax(bool testData) const
@@ -1184,6 +1254,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_audibleRange.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1204,7 +1279,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter audibleRange has not been defined in template %s!", DataResource::getName()));
-			return base->getAudibleRangeMax();
+			return m_audibleRange.storeResolvedValue(2, randomDrawCount, base->getAudibleRangeMax());
 		}
 	}
 
@@ -1237,7 +1312,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_audibleRange.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getAudibleRangeMax
 
 float ServerWeaponObjectTemplate::getMinRange(bool testData) const
@@ -1248,6 +1323,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_minRange.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1268,7 +1348,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter minRange has not been defined in template %s!", DataResource::getName()));
-			return base->getMinRange();
+			return m_minRange.storeResolvedValue(0, randomDrawCount, base->getMinRange());
 		}
 	}
 
@@ -1301,7 +1381,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_minRange.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getMinRange
 
 float ServerWeaponObjectTemplate::getMinRangeMin(bool testData) const
@@ -1312,6 +1392,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_minRange.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1332,7 +1417,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter minRange has not been defined in template %s!", DataResource::getName()));
-			return base->getMinRangeMin();
+			return m_minRange.storeResolvedValue(1, randomDrawCount, base->getMinRangeMin());
 		}
 	}
 
@@ -1365,7 +1450,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_minRange.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getMinRangeMin
 
 float ServerWeaponObjectTemplate::getMinRangeMax(bool testData) const
@@ -1376,6 +1461,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_minRange.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1396,7 +1486,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter minRange has not been defined in template %s!", DataResource::getName()));
-			return base->getMinRangeMax();
+			return m_minRange.storeResolvedValue(2, randomDrawCount, base->getMinRangeMax());
 		}
 	}
 
@@ -1429,7 +1519,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_minRange.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getMinRangeMax
 
 float ServerWeaponObjectTemplate::getMaxRange(bool testData) const
@@ -1440,6 +1530,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_maxRange.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1460,7 +1555,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxRange has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxRange();
+			return m_maxRange.storeResolvedValue(0, randomDrawCount, base->getMaxRange());
 		}
 	}
 
@@ -1493,7 +1588,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxRange.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getMaxRange
 
 float ServerWeaponObjectTemplate::getMaxRangeMin(bool testData) const
@@ -1504,6 +1599,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_maxRange.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1524,7 +1624,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxRange has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxRangeMin();
+			return m_maxRange.storeResolvedValue(1, randomDrawCount, base->getMaxRangeMin());
 		}
 	}
 
@@ -1557,7 +1657,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxRange.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getMaxRangeMin
 
 float ServerWeaponObjectTemplate::getMaxRangeMax(bool testData) const
@@ -1568,6 +1668,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_maxRange.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1588,7 +1693,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxRange has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxRangeMax();
+			return m_maxRange.storeResolvedValue(2, randomDrawCount, base->getMaxRangeMax());
 		}
 	}
 
@@ -1621,7 +1726,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxRange.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getMaxRangeMax
 
 float ServerWeaponObjectTemplate::getDamageRadius(bool testData) const
@@ -1632,6 +1737,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_damageRadius.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1652,7 +1762,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter damageRadius has not been defined in template %s!", DataResource::getName()));
-			return base->getDamageRadius();
+			return m_damageRadius.storeResolvedValue(0, randomDrawCount, base->getDamageRadius());
 		}
 	}
 
@@ -1685,7 +1795,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_damageRadius.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getDamageRadius
 
 float ServerWeaponObjectTemplate::getDamageRadiusMin(bool testData) const
@@ -1696,6 +1806,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_damageRadius.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1716,7 +1831,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter damageRadius has not been defined in template %s!", DataResource::getName()));
-			return base->getDamageRadiusMin();
+			return m_damageRadius.storeResolvedValue(1, randomDrawCount, base->getDamageRadiusMin());
 		}
 	}
 
@@ -1749,7 +1864,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_damageRadius.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getDamageRadiusMin
 
 float ServerWeaponObjectTemplate::getDamageRadiusMax(bool testData) const
@@ -1760,6 +1875,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_damageRadius.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1780,7 +1900,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter damageRadius has not been defined in template %s!", DataResource::getName()));
-			return base->getDamageRadiusMax();
+			return m_damageRadius.storeResolvedValue(2, randomDrawCount, base->getDamageRadiusMax());
 		}
 	}
 
@@ -1813,7 +1933,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_damageRadius.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getDamageRadiusMax
 
 float ServerWeaponObjectTemplate::getWoundChance(bool testData) const
@@ -1824,6 +1944,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_woundChance.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1844,7 +1969,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter woundChance has not been defined in template %s!", DataResource::getName()));
-			return base->getWoundChance();
+			return m_woundChance.storeResolvedValue(0, randomDrawCount, base->getWoundChance());
 		}
 	}
 
@@ -1877,7 +2002,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_woundChance.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getWoundChance
 
 float ServerWeaponObjectTemplate::getWoundChanceMin(bool testData) const
@@ -1888,6 +2013,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_woundChance.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1908,7 +2038,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter woundChance has not been defined in template %s!", DataResource::getName()));
-			return base->getWoundChanceMin();
+			return m_woundChance.storeResolvedValue(1, randomDrawCount, base->getWoundChanceMin());
 		}
 	}
 
@@ -1941,7 +2071,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_woundChance.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getWoundChanceMin
 
 float ServerWeaponObjectTemplate::getWoundChanceMax(bool testData) const
@@ -1952,6 +2082,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_woundChance.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1972,7 +2107,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter woundChance has not been defined in template %s!", DataResource::getName()));
-			return base->getWoundChanceMax();
+			return m_woundChance.storeResolvedValue(2, randomDrawCount, base->getWoundChanceMax());
 		}
 	}
 
@@ -2005,7 +2140,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_woundChance.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getWoundChanceMax
 
 int ServerWeaponObjectTemplate::getAttackCost(bool testData) const
@@ -2016,6 +2151,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_attackCost.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -2036,7 +2176,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter attackCost has not been defined in template %s!", DataResource::getName()));
-			return base->getAttackCost();
+			return m_attackCost.storeResolvedValue(0, randomDrawCount, base->getAttackCost());
 		}
 	}
 
@@ -2069,7 +2209,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_attackCost.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getAttackCost
 
 int ServerWeaponObjectTemplate::getAttackCostMin(bool testData) const
@@ -2080,6 +2220,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_attackCost.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -2100,7 +2245,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter attackCost has not been defined in template %s!", DataResource::getName()));
-			return base->getAttackCostMin();
+			return m_attackCost.storeResolvedValue(1, randomDrawCount, base->getAttackCostMin());
 		}
 	}
 
@@ -2133,7 +2278,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_attackCost.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getAttackCostMin
 
 int ServerWeaponObjectTemplate::getAttackCostMax(bool testData) const
@@ -2144,6 +2289,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_attackCost.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -2164,7 +2314,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter attackCost has not been defined in template %s!", DataResource::getName()));
-			return base->getAttackCostMax();
+			return m_attackCost.storeResolvedValue(2, randomDrawCount, base->getAttackCostMax());
 		}
 	}
 
@@ -2197,7 +2347,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_attackCost.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getAttackCostMax
 
 int ServerWeaponObjectTemplate::getAccuracy(bool testData) const
@@ -2208,6 +2358,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_accuracy.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -2228,7 +2383,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter accuracy has not been defined in template %s!", DataResource::getName()));
-			return base->getAccuracy();
+			return m_accuracy.storeResolvedValue(0, randomDrawCount, base->getAccuracy());
 		}
 	}
 
@@ -2261,7 +2416,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_accuracy.storeResolvedValue(0, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getAccuracy
 
 int ServerWeaponObjectTemplate::getAccuracyMin(bool testData) const
@@ -2272,6 +2427,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_accuracy.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -2292,7 +2452,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter accuracy has not been defined in template %s!", DataResource::getName()));
-			return base->getAccuracyMin();
+			return m_accuracy.storeResolvedValue(1, randomDrawCount, base->getAccuracyMin());
 		}
 	}
 
@@ -2325,7 +2485,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_accuracy.storeResolvedValue(1, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getAccuracyMin
 
 int ServerWeaponObjectTemplate::getAccuracyMax(bool testData) const
@@ -2336,6 +2496,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_accuracy.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const ServerWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -2356,7 +2521,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter accuracy has not been defined in template %s!", DataResource::getName()));
-			return base->getAccuracyMax();
+			return m_accuracy.storeResolvedValue(2, randomDrawCount, base->getAccuracyMax());
 		}
 	}
 
@@ -2389,7 +2554,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_accuracy.storeResolvedValue(2, randomDrawCount, value);
 }	// ServerWeaponObjectTemplate::getAccuracyMax
 
 #ifdef _DEBUG
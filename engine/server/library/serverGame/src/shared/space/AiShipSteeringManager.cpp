@@ -0,0 +1,544 @@
+// ======================================================================
+//
+// AiShipSteeringManager.cpp
+//
+// Copyright 2004 Sony Online Entertainment
+//
+// ======================================================================
+
+#include "serverGame/FirstServerGame.h"
+#include "serverGame/AiShipSteeringManager.h"
+
+#include "serverGame/AiShipController.h"
+#include "serverGame/ConfigServerGame.h"
+#include "serverGame/ShipObject.h"
+#include "serverGame/SpaceSquad.h"
+#include "sharedCollision/CollisionProperty.h"
+#include "sharedCollision/CollisionWorld.h"
+#include "sharedCollision/SpaceAvoidanceManager.h"
+#include "sharedCollision/SpatialQueryBatch.h"
+#include "sharedDebug/PerformanceTimer.h"
+#include "sharedMath/Capsule.h"
+#include "sharedObject/CellProperty.h"
+#include "sharedObject/World.h"
+
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+// ======================================================================
+
+namespace AiShipSteeringManagerNamespace
+{
+	enum Flags
+	{
+		F_gathered = 0x01, // this frame's pass has the ship's state
+		F_steered  = 0x02, // the ship asked for avoidance since the last pass
+		F_queried  = 0x04  // the pass queried for obstacles toward the ship's goal
+	};
+
+	typedef std::vector<AiShipController *>                     ShipList;
+	typedef std::unordered_map<AiShipController const *, int>   ShipIndexMap;
+	typedef std::unordered_map<SpaceSquad const *, int>         SquadIndexMap;
+
+	// Grid cells never grow past this, so one capital ship can't make every
+	// ship in its squad walk the whole squad
+	float const cs_maximumCellSize = 256.0f;
+
+	void resizeShipArrays(size_t size);
+	void gatherShips();
+	void buildGrid();
+	void findSquadAvoidance();
+	int getShipIndex(AiShipController const &controller);
+	uint32 getBucket(int x, int y, int z, int squadIndex);
+
+	ShipList     s_ships;
+	ShipIndexMap s_shipIndices;
+
+	// Ship state for the pass, parallel to s_ships
+	std::vector<Vector>                     s_positions;
+	std::vector<float>                      s_comfortDistances;
+	std::vector<SpaceSquad const *>         s_squads;
+	std::vector<Vector>                     s_goalPositions;
+	std::vector<SpatialQueryBatch::QueryId> s_queryIds;
+	std::vector<Vector>                     s_squadAvoidanceVectors;
+	std::vector<uint8>                      s_flags;
+
+	// Squads with more than one ship in the pass.  Each squad's cells are as
+	// large as its largest comfort distance, up to cs_maximumCellSize; the
+	// ships in squad s are s_squadShips[s_squadStarts[s]] up to
+	// s_squadShips[s_squadStarts[s+1]]
+	SquadIndexMap       s_squadIndices;
+	std::vector<float>  s_squadCellSizes;
+	std::vector<int>    s_squadStarts;
+	std::vector<int>    s_squadShips;
+	std::vector<int>    s_shipSquadIndices;
+
+	// Hashed grid over ship positions, each squad in cells of its own size;
+	// the ships in bucket b are s_bucketShips[s_bucketStarts[b]] up to
+	// s_bucketShips[s_bucketStarts[b+1]]
+	std::vector<int>    s_bucketStarts;
+	std::vector<int>    s_bucketShips;
+	std::vector<uint32> s_shipBuckets;
+	uint32              s_bucketMask = 0;
+
+	int s_frameNumber = -1;
+
+	ColliderList s_colliderList;
+
+	// Written by benchmarkSquadAvoidance() so the timed squad walks aren't optimized away
+	volatile float s_benchmarkSink = 0.0f;
+}
+
+using namespace AiShipSteeringManagerNamespace;
+
+// ======================================================================
+
+void AiShipSteeringManagerNamespace::resizeShipArrays(size_t const size)
+{
+	s_positions.resize(size);
+	s_comfortDistances.resize(size, 0.0f);
+	s_squads.resize(size, nullptr);
+	s_goalPositions.resize(size);
+	s_queryIds.resize(size, SpatialQueryBatch::cms_invalidQueryId);
+	s_squadAvoidanceVectors.resize(size);
+	s_flags.resize(size, 0);
+}
+
+// ----------------------------------------------------------------------
+
+int AiShipSteeringManagerNamespace::getShipIndex(AiShipController const &controller)
+{
+	ShipIndexMap::const_iterator const i = s_shipIndices.find(&controller);
+	return (i != s_shipIndices.end()) ? i->second : -1;
+}
+
+// ----------------------------------------------------------------------
+
+uint32 AiShipSteeringManagerNamespace::getBucket(int const x, int const y, int const z, int const squadIndex)
+{
+	return ((static_cast<uint32>(x) * 73856093u) ^ (static_cast<uint32>(y) * 19349663u) ^ (static_cast<uint32>(z) * 83492791u) ^ (static_cast<uint32>(squadIndex) * 2654435761u)) & s_bucketMask;
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Copy out the state of every ship, and queue obstacle queries toward the
+ * goals of ships that were steering last frame, since they are most likely
+ * to steer toward the same goals this frame.
+ */
+
+void AiShipSteeringManagerNamespace::gatherShips()
+{
+	SpatialQueryBatch &queryBatch = CollisionWorld::getQueryBatch();
+	CellProperty const * const worldCell = CellProperty::getWorldCellProperty();
+	int const queryMask = SpaceAvoidanceManager::getQueryMask(false);
+	float const comfortDistanceGain = SpaceSquad::getFlockingComfortDistanceGain();
+
+	size_t const shipCount = s_ships.size();
+	for (size_t i = 0; i < shipCount; ++i)
+	{
+		AiShipController const &controller = *s_ships[i];
+		ShipObject const &ship = *NON_NULL(controller.getShipOwner());
+
+		bool const steered = (s_flags[i] & F_steered) != 0;
+		uint8 flags = F_gathered;
+
+		s_positions[i] = ship.getPosition_w();
+		s_comfortDistances[i] = ship.getRadius() * comfortDistanceGain;
+		s_squads[i] = controller.hasSquad() ? &controller.getSquad() : nullptr;
+		s_goalPositions[i] = controller.getMoveToGoalPosition_w();
+		s_queryIds[i] = SpatialQueryBatch::cms_invalidQueryId;
+		s_squadAvoidanceVectors[i] = Vector::zero;
+
+		CollisionProperty const * const collisionProperty = ship.getCollisionProperty();
+		if (steered && collisionProperty && ship.getCurrentVelocity_p().approximateMagnitude() > FLT_MIN)
+		{
+			float const collisionRadius = collisionProperty->getBoundingSphere_w().getRadius();
+			Capsule const queryCapsule_w(SpaceAvoidanceManager::getQueryCapsule(ship.getPosition_w(), collisionRadius, s_goalPositions[i]));
+			s_queryIds[i] = queryBatch.addCapsule(queryMask, worldCell, false, queryCapsule_w);
+			flags |= F_queried;
+		}
+
+		s_flags[i] = flags;
+	}
+}
+
+// ----------------------------------------------------------------------
+
+void AiShipSteeringManagerNamespace::buildGrid()
+{
+	size_t const shipCount = s_ships.size();
+
+	//-- number the squads and size their cells
+
+	s_squadIndices.clear();
+	s_squadCellSizes.clear();
+	s_shipSquadIndices.assign(shipCount, -1);
+
+	for (size_t i = 0; i < shipCount; ++i)
+	{
+		SpaceSquad const * const squad = s_squads[i];
+		if (!squad || squad->getUnitCount() <= 1)
+			continue;
+
+		std::pair<SquadIndexMap::iterator, bool> const result = s_squadIndices.insert(SquadIndexMap::value_type(squad, static_cast<int>(s_squadCellSizes.size())));
+		if (result.second)
+			s_squadCellSizes.push_back(1.0f);
+
+		int const squadIndex = result.first->second;
+		float & cellSize = s_squadCellSizes[static_cast<size_t>(squadIndex)];
+		cellSize = std::max(cellSize, std::min(s_comfortDistances[i], cs_maximumCellSize));
+		s_shipSquadIndices[i] = squadIndex;
+	}
+
+	//-- list each squad's ships together, for ships too large for their cells
+
+	size_t const squadCount = s_squadCellSizes.size();
+
+	s_squadStarts.assign(squadCount + 1, 0);
+	s_squadShips.resize(shipCount);
+
+	for (size_t i = 0; i < shipCount; ++i)
+		if (s_shipSquadIndices[i] >= 0)
+			++s_squadStarts[static_cast<size_t>(s_shipSquadIndices[i] + 1)];
+
+	for (size_t squadIndex = 0; squadIndex < squadCount; ++squadIndex)
+		s_squadStarts[squadIndex + 1] += s_squadStarts[squadIndex];
+
+	static std::vector<int> s_squadFill;
+	s_squadFill.assign(s_squadStarts.begin(), s_squadStarts.end() - 1);
+	for (size_t i = 0; i < shipCount; ++i)
+		if (s_shipSquadIndices[i] >= 0)
+			s_squadShips[static_cast<size_t>(s_squadFill[static_cast<size_t>(s_shipSquadIndices[i])]++)] = static_cast<int>(i);
+
+	//-- bin the ships, each in its squad's cells
+
+	uint32 bucketCount = 16;
+	while (bucketCount < shipCount * 2)
+		bucketCount <<= 1;
+	s_bucketMask = bucketCount - 1;
+
+	s_bucketStarts.assign(bucketCount + 1, 0);
+	s_bucketShips.resize(shipCount);
+	s_shipBuckets.resize(shipCount);
+
+	for (size_t i = 0; i < shipCount; ++i)
+	{
+		int const squadIndex = s_shipSquadIndices[i];
+		if (squadIndex < 0)
+			continue;
+
+		float const oneOverCellSize = 1.0f / s_squadCellSizes[static_cast<size_t>(squadIndex)];
+		Vector const &position_w = s_positions[i];
+		uint32 const bucket = getBucket(static_cast<int>(floorf(position_w.x * oneOverCellSize)), static_cast<int>(floorf(position_w.y * oneOverCellSize)), static_cast<int>(floorf(position_w.z * oneOverCellSize)), squadIndex);
+		s_shipBuckets[i] = bucket;
+		++s_bucketStarts[bucket + 1];
+	}
+
+	for (uint32 bucket = 0; bucket < bucketCount; ++bucket)
+		s_bucketStarts[bucket + 1] += s_bucketStarts[bucket];
+
+	static std::vector<int> s_bucketFill;
+	s_bucketFill.assign(s_bucketStarts.begin(), s_bucketStarts.end() - 1);
+	for (size_t i = 0; i < shipCount; ++i)
+		if (s_shipSquadIndices[i] >= 0)
+			s_bucketShips[static_cast<size_t>(s_bucketFill[s_shipBuckets[i]]++)] = static_cast<int>(i);
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Find the vector each ship steers along to separate from its closest
+ * squad mate within its comfort distance, as SpaceSquad::getAvoidanceVector()
+ * does.
+ *
+ * A ship whose comfort distance fits in its squad's cells only looks at the
+ * cells around its own.  A ship larger than that, which only happens once
+ * the cells hit cs_maximumCellSize, looks at every ship in its squad.
+ */
+
+void AiShipSteeringManagerNamespace::findSquadAvoidance()
+{
+	float const seperationGain = SpaceSquad::getFlockingSeperationGain();
+	if (seperationGain <= 0.0f)
+		return;
+
+	size_t const shipCount = s_ships.size();
+
+	for (size_t i = 0; i < shipCount; ++i)
+	{
+		int const squadIndex = s_shipSquadIndices[i];
+		if (squadIndex < 0)
+			continue;
+
+		SpaceSquad const * const squad = s_squads[i];
+		Vector const &unitPosition_w = s_positions[i];
+		float const comfortDistanceSquared = sqr(s_comfortDistances[i]);
+		float closestDistanceSquared = std::numeric_limits<float>::max();
+		Vector seperationVector;
+
+		float const cellSize = s_squadCellSizes[static_cast<size_t>(squadIndex)];
+
+		if (s_comfortDistances[i] > cellSize)
+		{
+			int const end = s_squadStarts[static_cast<size_t>(squadIndex + 1)];
+
+			for (int k = s_squadStarts[static_cast<size_t>(squadIndex)]; k < end; ++k)
+			{
+				size_t const j = static_cast<size_t>(s_squadShips[static_cast<size_t>(k)]);
+				if (j == i)
+					continue;
+
+				Vector const &squadUnitPosition_w = s_positions[j];
+				float const distanceFromUnitSquared = Vector(squadUnitPosition_w - unitPosition_w).magnitudeSquared();
+
+				if (   (distanceFromUnitSquared <= comfortDistanceSquared)
+				    && (distanceFromUnitSquared < closestDistanceSquared))
+				{
+					closestDistanceSquared = distanceFromUnitSquared;
+					seperationVector = (unitPosition_w - squadUnitPosition_w) * 1000.0f;
+				}
+			}
+		}
+		else
+		{
+			float const oneOverCellSize = 1.0f / cellSize;
+			int const cellX = static_cast<int>(floorf(unitPosition_w.x * oneOverCellSize));
+			int const cellY = static_cast<int>(floorf(unitPosition_w.y * oneOverCellSize));
+			int const cellZ = static_cast<int>(floorf(unitPosition_w.z * oneOverCellSize));
+
+			for (int x = cellX - 1; x <= cellX + 1; ++x)
+			{
+				for (int y = cellY - 1; y <= cellY + 1; ++y)
+				{
+					for (int z = cellZ - 1; z <= cellZ + 1; ++z)
+					{
+						uint32 const bucket = getBucket(x, y, z, squadIndex);
+						int const end = s_bucketStarts[bucket + 1];
+
+						for (int k = s_bucketStarts[bucket]; k < end; ++k)
+						{
+							size_t const j = static_cast<size_t>(s_bucketShips[static_cast<size_t>(k)]);
+							if (j == i || s_squads[j] != squad)
+								continue;
+
+							Vector const &squadUnitPosition_w = s_positions[j];
+							float const distanceFromUnitSquared = Vector(squadUnitPosition_w - unitPosition_w).magnitudeSquared();
+
+							if (   (distanceFromUnitSquared <= comfortDistanceSquared)
+							    && (distanceFromUnitSquared < closestDistanceSquared))
+							{
+								closestDistanceSquared = distanceFromUnitSquared;
+								seperationVector = (unitPosition_w - squadUnitPosition_w) * 1000.0f;
+							}
+						}
+					}
+				}
+			}
+		}
+
+		if (closestDistanceSquared <= comfortDistanceSquared)
+			s_squadAvoidanceVectors[i] = seperationVector * seperationGain;
+	}
+}
+
+// ======================================================================
+
+void AiShipSteeringManager::update()
+{
+	if (s_ships.empty() || !ConfigServerGame::getSpaceAiBulkSteering())
+	{
+		s_frameNumber = -1;
+		return;
+	}
+
+	PROFILER_AUTO_BLOCK_DEFINE("AiShipSteeringManager::update");
+
+	s_frameNumber = World::getFrameNumber();
+
+	gatherShips();
+
+	{
+		PROFILER_AUTO_BLOCK_DEFINE("obstacle queries");
+		CollisionWorld::getQueryBatch().execute();
+	}
+
+	{
+		PROFILER_AUTO_BLOCK_DEFINE("squad avoidance");
+		buildGrid();
+		findSquadAvoidance();
+	}
+}
+
+// ----------------------------------------------------------------------
+
+void AiShipSteeringManager::add(AiShipController &controller)
+{
+	if (s_shipIndices.insert(ShipIndexMap::value_type(&controller, static_cast<int>(s_ships.size()))).second)
+	{
+		s_ships.push_back(&controller);
+		resizeShipArrays(s_ships.size());
+	}
+}
+
+// ----------------------------------------------------------------------
+
+void AiShipSteeringManager::remove(AiShipController &controller)
+{
+	ShipIndexMap::iterator const i = s_shipIndices.find(&controller);
+	if (i == s_shipIndices.end())
+		return;
+
+	// Move the last ship into the removed ship's place
+	size_t const index = static_cast<size_t>(i->second);
+	size_t const last = s_ships.size() - 1;
+	s_shipIndices.erase(i);
+
+	if (index != last)
+	{
+		s_ships[index] = s_ships[last];
+		s_positions[index] = s_positions[last];
+		s_comfortDistances[index] = s_comfortDistances[last];
+		s_squads[index] = s_squads[last];
+		s_goalPositions[index] = s_goalPositions[last];
+		s_queryIds[index] = s_queryIds[last];
+		s_squadAvoidanceVectors[index] = s_squadAvoidanceVectors[last];
+		s_flags[index] = s_flags[last];
+		s_shipIndices[s_ships[index]] = static_cast<int>(index);
+	}
+
+	s_ships.pop_back();
+	resizeShipArrays(s_ships.size());
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Get this frame's obstacle avoidance for a ship.
+ *
+ * @return false if the pass has no answer for the ship steering toward
+ * goalPosition_w, in which case the caller should use SpaceAvoidanceManager
+ */
+
+bool AiShipSteeringManager::findAvoidancePosition(AiShipController &controller, Vector const &goalPosition_w, bool &hasAvoidancePosition, Vector &avoidancePosition_w)
+{
+	int const index = getShipIndex(controller);
+	if (index < 0)
+		return false;
+
+	size_t const i = static_cast<size_t>(index);
+	s_flags[i] |= F_steered;
+
+	if (   s_frameNumber != World::getFrameNumber()
+	    || (s_flags[i] & F_queried) == 0
+	    || s_goalPositions[i] != goalPosition_w)
+		return false;
+
+	SpatialQueryBatch const &queryBatch = CollisionWorld::getQueryBatch();
+	if (!queryBatch.isAnswered(s_queryIds[i]))
+		return false;
+
+	s_colliderList.clear();
+	queryBatch.getResults(s_queryIds[i], s_colliderList);
+
+	ShipObject const &ship = *NON_NULL(controller.getShipOwner());
+	float const collisionRadius = NON_NULL(ship.getCollisionProperty())->getBoundingSphere_w().getRadius();
+	hasAvoidancePosition = SpaceAvoidanceManager::getAvoidancePosition(ship.getTransform_o2w(), collisionRadius, ship.getCurrentVelocity_p(), goalPosition_w, s_colliderList, avoidancePosition_w, &ship);
+
+	return true;
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Get this frame's squad separation for a ship.
+ *
+ * @return false if the pass has no answer for the ship, in which case the
+ * caller should use SpaceSquad::getAvoidanceVector()
+ */
+
+bool AiShipSteeringManager::findSquadAvoidanceVector(AiShipController const &controller, Vector &squadAvoidanceVector)
+{
+	if (s_frameNumber != World::getFrameNumber())
+		return false;
+
+	int const index = getShipIndex(controller);
+	if (index < 0)
+		return false;
+
+	size_t const i = static_cast<size_t>(index);
+	if (   (s_flags[i] & F_gathered) == 0
+	    || s_squads[i] != (controller.hasSquad() ? &controller.getSquad() : nullptr))
+		return false;
+
+	squadAvoidanceVector = s_squadAvoidanceVectors[i];
+	return true;
+}
+
+// ----------------------------------------------------------------------
+
+int AiShipSteeringManager::getNumberOfShips()
+{
+	return static_cast<int>(s_ships.size());
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Time squad separation for every registered ship, done by the pass and
+ * done by each ship walking its squad through SpaceSquad::getAvoidanceVector().
+ * No obstacle queries are queued.  The pass overwrites this frame's ship
+ * state, so ships steer the usual way until the next update() runs.
+ */
+
+void AiShipSteeringManager::benchmarkSquadAvoidance(int const passes, float &passTime, float &walkTime)
+{
+	passTime = 0.0f;
+	walkTime = 0.0f;
+
+	s_frameNumber = -1;
+
+	float const comfortDistanceGain = SpaceSquad::getFlockingComfortDistanceGain();
+	size_t const shipCount = s_ships.size();
+
+	for (size_t i = 0; i < shipCount; ++i)
+	{
+		AiShipController const &controller = *s_ships[i];
+		ShipObject const &ship = *NON_NULL(controller.getShipOwner());
+
+		s_positions[i] = ship.getPosition_w();
+		s_comfortDistances[i] = ship.getRadius() * comfortDistanceGain;
+		s_squads[i] = controller.hasSquad() ? &controller.getSquad() : nullptr;
+		s_squadAvoidanceVectors[i] = Vector::zero;
+	}
+
+	PerformanceTimer timer;
+	timer.start();
+	for (int pass = 0; pass < passes; ++pass)
+	{
+		buildGrid();
+		findSquadAvoidance();
+	}
+	timer.stop();
+	passTime = timer.getElapsedTime();
+
+	Vector total;
+	timer.start();
+	for (int pass = 0; pass < passes; ++pass)
+	{
+		for (size_t i = 0; i < shipCount; ++i)
+		{
+			AiShipController const &controller = *s_ships[i];
+			if (controller.hasSquad())
+				total += controller.getSquad().getAvoidanceVector(*NON_NULL(controller.getShipOwner()));
+		}
+	}
+	timer.stop();
+	walkTime = timer.getElapsedTime();
+
+	s_benchmarkSink = total.x + total.y + total.z;
+}
+
+// ======================================================================
@@ -0,0 +1,50 @@
+// ======================================================================
+//
+// AiShipSteeringManager.h
+//
+// Copyright 2004 Sony Online Entertainment
+//
+// ======================================================================
+
+#ifndef INCLUDED_AiShipSteeringManager_H
+#define INCLUDED_AiShipSteeringManager_H
+
+// ======================================================================
+
+class AiShipController;
+class Vector;
+
+// ======================================================================
+
+/**
+ * Works out the avoidance steering of every AI ship in one pass per frame.
+ *
+ * Before objects alter, the state of each registered ship is gathered into
+ * contiguous arrays.  The obstacle queries of the ships that were steering
+ * last frame are answered together through the collision world's query
+ * batch, and squad separation is found from a hashed grid over all ship
+ * positions instead of each ship walking its squad.  AiShipController::moveTo
+ * then looks its answers up here, and works them out itself when the pass
+ * has none for it (a ship added this frame, a new goal, or the collision
+ * world changed since the pass).
+ */
+
+class AiShipSteeringManager
+{
+public:
+	static void update();
+	static void add(AiShipController &controller);
+	static void remove(AiShipController &controller);
+
+	static bool findAvoidancePosition(AiShipController &controller, Vector const &goalPosition_w, bool &hasAvoidancePosition, Vector &avoidancePosition_w);
+	static bool findSquadAvoidanceVector(AiShipController const &controller, Vector &squadAvoidanceVector);
+
+	static int getNumberOfShips();
+
+	static void benchmarkSquadAvoidance(int passes, float &passTime, float &walkTime);
+};
+
+// ======================================================================
+
+#endif // INCLUDED_AiShipSteeringManager_H
+
@@ -124,7 +124,10 @@ bool Missile::fire()
 			{
 				Object const * const collider = &(NON_NULL(*i)->getOwner());
 				if (collider != sourceServerObject && collider != targetServerObject)
+				{
 					destroy();
+					break;
+				}
 			}
 		}
 				
@@ -19,6 +19,8 @@
 #include "sharedUtility/DataTable.h"
 #include "sharedUtility/DataTableManager.h"
 
+#include <algorithm>
+
 // ======================================================================
 
 MissileManager * MissileManager::ms_instance = nullptr;
@@ -177,7 +179,7 @@ Missile * MissileManager::addMissile(const NetworkId &sourceShip, const NetworkI
 {
 	Missile * const newMissile = new Missile(sourceShip, sourcePlayer, weaponIndex, missileType, targetShip, targetedComponent);
 	m_missiles[newMissile->getMissileId()]=newMissile;
-	IGNORE_RETURN(m_missilesForTarget.insert(std::make_pair(targetShip, newMissile->getMissileId())));
+	m_missilesForTarget[targetShip].push_back(newMissile);
 	return newMissile;
 }
 
@@ -191,16 +193,19 @@ bool MissileManager::removeMissile(int missileId)
 		WARNING_STRICT_FATAL(true,("called removeMissile with missile %i that doesn't exist.",missileId));
 		return false;
 	}
-	NetworkId targetShip(i->second->getTargetShip());
-
-	std::pair<MissilesForTargetType::iterator, MissilesForTargetType::iterator> range=m_missilesForTarget.equal_range(targetShip);
-	for (MissilesForTargetType::iterator j=range.first; j!=range.second; ++j)
+	MissilesForTargetType::iterator j=m_missilesForTarget.find(i->second->getTargetShip());
+	if (j!=m_missilesForTarget.end())
 	{
-		if (j->second == missileId)
+		MissileList &targetMissiles = j->second;
+		MissileList::iterator k=std::find(targetMissiles.begin(), targetMissiles.end(), i->second);
+		if (k!=targetMissiles.end())
 		{
-			m_missilesForTarget.erase(j);
-			break;
+			// order doesn't matter, so fill the hole with the last missile
+			*k = targetMissiles.back();
+			targetMissiles.pop_back();
 		}
+		if (targetMissiles.empty())
+			m_missilesForTarget.erase(j);
 	}
 	
 	delete i->second;
@@ -239,15 +244,19 @@ const Missile * MissileManager::getConstMissile(int missileId) const
  */
 int MissileManager::getNearestUnlockedMissileForTarget(const NetworkId &target) const
 {
-	const std::pair<MissilesForTargetType::const_iterator, MissilesForTargetType::const_iterator> range=m_missilesForTarget.equal_range(target);
+	MissilesForTargetType::const_iterator const targetMissiles=m_missilesForTarget.find(target);
+	if (targetMissiles==m_missilesForTarget.end())
+		return 0;
 
+	// ties go to the missile fired first, which has the lowest id
 	const Missile *targetedMissile=nullptr;
-	for (MissilesForTargetType::const_iterator i=range.first; i!=range.second; ++i)
+	for (MissileList::const_iterator i=targetMissiles->second.begin(); i!=targetMissiles->second.end(); ++i)
 	{
-		const Missile * const missile=getConstMissile(i->second);
-		DEBUG_FATAL(!missile,("Programmer bug:  Missile %i was in m_missilesForTarget, but was not in m_missiles",i->second));
-		if (missile && missile->getState() == Missile::MS_Launched &&
-			(!targetedMissile || (missile->getImpactTime() < targetedMissile->getImpactTime()))) //lint !e774:  missile is non-nullptr in debug mode
+		const Missile * const missile=NON_NULL(*i);
+		if (missile->getState() == Missile::MS_Launched &&
+			(!targetedMissile
+			 || (missile->getImpactTime() < targetedMissile->getImpactTime())
+			 || (missile->getImpactTime() == targetedMissile->getImpactTime() && missile->getMissileId() < targetedMissile->getMissileId())))
 				targetedMissile = missile;
 	}
 
@@ -274,15 +283,20 @@ bool MissileManager::isTargetedByMissile(const NetworkId &target) const
  */
 void MissileManager::getAllUnlockedMissilesForTarget(const NetworkId &target, std::vector<int> &results) const
 {
-	const std::pair<MissilesForTargetType::const_iterator, MissilesForTargetType::const_iterator> range=m_missilesForTarget.equal_range(target);
+	MissilesForTargetType::const_iterator const targetMissiles=m_missilesForTarget.find(target);
+	if (targetMissiles==m_missilesForTarget.end())
+		return;
 
-	for (MissilesForTargetType::const_iterator i=range.first; i!=range.second; ++i)
+	std::vector<int>::size_type const firstResult = results.size();
+	for (MissileList::const_iterator i=targetMissiles->second.begin(); i!=targetMissiles->second.end(); ++i)
 	{
-		const Missile * const missile=getConstMissile(i->second);
-		DEBUG_FATAL(!missile,("Programmer bug:  Missile %i was in m_missilesForTarget, but was not in m_missiles",i->second));
-		if (missile && missile->getState() == Missile::MS_Launched) //lint !e774 // not always true (in release mode)
+		const Missile * const missile=NON_NULL(*i);
+		if (missile->getState() == Missile::MS_Launched)
 			results.push_back(missile->getMissileId());
 	}
+
+	// report them in firing order, as scripts may pick the first
+	std::sort(results.begin() + static_cast<std::vector<int>::difference_type>(firstResult), results.end());
 }
 
 // ----------------------------------------------------------------------
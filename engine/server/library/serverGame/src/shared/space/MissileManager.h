@@ -13,7 +13,8 @@
 #include "sharedFoundation/NetworkId.h"
 #include "sharedGame/ShipChassisSlotType.h"
 #include <queue>
-#include <functional>
+#include <unordered_map>
+#include <vector>
 
 // ======================================================================
 
@@ -54,10 +55,10 @@ class MissileManager
 	static MissileManager & getInstance       ();
 
   private:
-	class QueueSorter : public std::binary_function<std::pair<int, int>, std::pair<int, int>, bool>
+	class QueueSorter
 	{
 	  public:
-		bool operator() (const std::pair<int, int> &lhs, const std::pair<int, int> &rhs);
+		bool operator() (const std::pair<uint32, int> &lhs, const std::pair<uint32, int> &rhs) const;
 	};
 
 	struct MissileTypeDataRecord
@@ -69,8 +70,9 @@ class MissileManager
 		float m_targetAcquisitionAngle;
 	};
 	
-	typedef std::map<int, Missile*> MissilesType;
-	typedef std::multimap<NetworkId, int> MissilesForTargetType;
+	typedef std::unordered_map<int, Missile*> MissilesType;
+	typedef std::vector<Missile*> MissileList;
+	typedef std::unordered_map<NetworkId, MissileList> MissilesForTargetType;
 	typedef std::priority_queue<std::pair<uint32, int>, std::vector<std::pair<uint32, int> >, QueueSorter> MissileQueueType;
 	typedef std::map<int, MissileTypeDataRecord> MissileTypeDataType;
 
@@ -103,9 +105,15 @@ inline MissileManager & MissileManager::getInstance()
 
 // ======================================================================
 
-inline bool MissileManager::QueueSorter::operator() (const std::pair<int, int> &lhs, const std::pair<int, int> &rhs)
+/**
+ * Orders the queue so the missile due soonest is on top.  Missiles due at
+ * the same time resolve in firing order, lowest id first.
+ */
+inline bool MissileManager::QueueSorter::operator() (const std::pair<uint32, int> &lhs, const std::pair<uint32, int> &rhs) const
 {
-	return (lhs.first < rhs.first);
+	if (lhs.first != rhs.first)
+		return (rhs.first < lhs.first);
+	return (rhs.second < lhs.second);
 }
 
 // ======================================================================
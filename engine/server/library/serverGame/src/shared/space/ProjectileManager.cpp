@@ -20,6 +20,7 @@
 #include "sharedCollision/CollisionWorld.h"
 #include "sharedCollision/Extent.h"
 #include "sharedCollision/SpatialDatabase.h"
+#include "sharedDebug/PerformanceTimer.h"
 #include "sharedGame/GameObjectTypes.h"
 #include "sharedGame/SharedObjectTemplate.h"
 #include "sharedMath/MultiShape.h"
@@ -29,295 +30,659 @@
 #include "sharedObject/AppearanceTemplate.h"
 #include "sharedObject/CellProperty.h"
 
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PROJECTILEMANAGER_USE_SSE2 1
+#include <emmintrin.h>
+#else
+#define PROJECTILEMANAGER_USE_SSE2 0
+#endif
+
 // ======================================================================
 
 namespace ProjectileManagerNamespace
 {
-
 	// ======================================================================
+	// What a shot needs to know to decide whether it may hit something and
+	// to tell the scripts about it.  Kept out of the per-frame arrays below
+	// since it is only read when a shot actually hits.
 
-	class Projectile
+	struct Shot
 	{
-	public:
-
-		// ----------------------------------------------------------------------
-
-		Projectile(ShipObject &owner, int weaponIndex, int projectileIndex, int targetedComponent, float startDeltaTime, Vector const &position_w, Vector const &direction_w, float length, float speed, float duration, bool fromAutoTurret, bool isBeam) :
-			m_owner(&owner),
-			m_weaponIndex(weaponIndex),
-			m_projectileIndex(projectileIndex),
-			m_targetedComponent(targetedComponent),
-			m_startDeltaTime(startDeltaTime),
-			m_position_w(position_w),
-			m_direction_w(direction_w),
-			m_length(length),
-			m_speed(speed),
-			m_duration(duration),
-			m_fromAutoTurret(fromAutoTurret)
+		Shot() :
+			owner(),
+			weaponIndex(0),
+			targetedComponent(0),
+			fromAutoTurret(false)
 		{
-
-				if (isBeam)
-				{
-					//-- offset transform used for beam positioning
-					m_position_w = m_owner->rotateTranslate_w2o(m_position_w);
-					m_direction_w = m_owner->rotate_w2o(m_direction_w);
-					m_length = m_speed * m_duration;
-				}
 		}
 
-		// ----------------------------------------------------------------------
-
-		Projectile(Projectile const &rhs) :
-			m_owner(rhs.m_owner),
-			m_weaponIndex(rhs.m_weaponIndex),
-			m_projectileIndex(rhs.m_projectileIndex),
-			m_targetedComponent(rhs.m_targetedComponent),
-			m_startDeltaTime(rhs.m_startDeltaTime),
-			m_position_w(rhs.m_position_w),
-			m_direction_w(rhs.m_direction_w),
-			m_length(rhs.m_length),
-			m_speed(rhs.m_speed),
-			m_duration(rhs.m_duration),
-			m_fromAutoTurret(rhs.m_fromAutoTurret)
+		Shot(ShipObject &shotOwner, int shotWeaponIndex, int shotTargetedComponent, bool shotFromAutoTurret) :
+			owner(&shotOwner),
+			weaponIndex(shotWeaponIndex),
+			targetedComponent(shotTargetedComponent),
+			fromAutoTurret(shotFromAutoTurret)
 		{
 		}
 
-		//----------------------------------------------------------------------
-
-		Projectile() :
-			m_owner(nullptr),
-			m_weaponIndex(0),
-			m_projectileIndex(0),
-			m_targetedComponent(0),
-			m_startDeltaTime(0.0f),
-			m_position_w(),
-			m_direction_w(),
-			m_length(0.0f),
-			m_speed(0.0f),
-			m_duration(0.0f),
-			m_fromAutoTurret(false)
+		Watcher<ShipObject> owner;
+		int weaponIndex;
+		int targetedComponent;
+		bool fromAutoTurret;
+	};
+
+	// ----------------------------------------------------------------------
+	// Beams sweep the same path through their owner's space every frame, so
+	// their position and path are kept in the owner's object space.
+
+	struct Beam
+	{
+		Shot shot;
+		Vector position_o;
+		Vector path_o;
+	};
+
+	// ----------------------------------------------------------------------
+	// A copy of everything trigger() needs, since the scripts it runs may
+	// fire new shots and grow the bolt arrays under a reference.
+
+	struct Hit
+	{
+		Shot shot;
+		Watcher<ServerObject> target;
+		Vector position_o;
+	};
+
+	// ----------------------------------------------------------------------
+	// Short segments are grouped by the coarse cell their start lies in, and
+	// each group makes one database query over its bounds.
+
+	struct QueryCell
+	{
+		int x;
+		int y;
+		int z;
+		int segment;
+	};
+
+	inline bool operator<(QueryCell const &lhs, QueryCell const &rhs)
+	{
+		if (lhs.x != rhs.x)
+			return lhs.x < rhs.x;
+		if (lhs.y != rhs.y)
+			return lhs.y < rhs.y;
+		return lhs.z < rhs.z;
+	}
+
+	// ======================================================================
+
+	bool projectileCollidesWith(ShipObject const &actorShip, Object const &target);
+	void trigger(Hit const &hit);
+
+	void clearCandidates();
+	void querySegments();
+	void gatherCandidates();
+	int getBucket(int x, int y, int z);
+	void findSphereHits(Vector const &start_w, Vector const &path_w, float const *x, float const *y, float const *z, float const *radiusSquared, int const *ids, int count, std::vector<int> &hits);
+	void testCandidate(ShipObject const &owner, CollisionProperty &collision, Vector const &start_w, Vector const &end_w, Object *&hitObject, float &smallestTime, Vector &hitPosition_o);
+	bool findHit(ShipObject const &owner, Vector const &start_w, Vector const &path_w, Object *&hitObject, Vector &hitPosition_o);
+	bool findHitByQuery(ShipObject const &owner, Vector const &start_w, Vector const &path_w, Object *&hitObject, Vector &hitPosition_o);
+
+	void removeBolt(int index);
+
+	// ======================================================================
+
+	float const cs_projectileRadius = 1.f;
+
+	//-- grid used to bin the potential targets each frame
+	float const cs_gridCellSize = 256.f;
+	float const cs_inverseGridCellSize = 1.f / cs_gridCellSize;
+	int const cs_gridBucketCount = 4096;
+	int const cs_maximumCellsPerCandidate = 64;
+	int const cs_maximumCellsPerQuery = 64;
+
+	//-- cells used to group segments into database queries
+	float const cs_queryCellSize = 512.f;
+	float const cs_inverseQueryCellSize = 1.f / cs_queryCellSize;
+
+	// ======================================================================
+	// Bolts, one array per field so the per-frame step streams through only
+	// the data it needs.  Removal swaps the last bolt into the hole in every
+	// array.
+
+	std::vector<Vector> s_boltPositions_w;
+	std::vector<Vector> s_boltDirections_w;
+	std::vector<float> s_boltSpeeds;
+	std::vector<float> s_boltLengths;
+	std::vector<float> s_boltDurations;
+	std::vector<float> s_boltStartDeltaTimes;
+	std::vector<Shot> s_boltShots;
+
+	//-- this frame's swept segment for each bolt
+	std::vector<Vector> s_boltStarts_w;
+	std::vector<Vector> s_boltPaths_w;
+
+	//----------------------------------------------------------------------
+
+	typedef std::pair<NetworkId /* ship id */, int /*weaponIndex */> ShipWeaponPair;
+	typedef std::map<ShipWeaponPair, Beam> BeamMap;
+	BeamMap s_beamMap;
+
+	//-- this frame's beams, copied out of the map so hit scripts may start and stop beams
+	std::vector<ShipWeaponPair> s_beamKeys;
+	std::vector<Shot> s_beamShots;
+	std::vector<Vector> s_beamStarts_w;
+	std::vector<Vector> s_beamPaths_w;
+
+	// ----------------------------------------------------------------------
+	// Everything a shot could hit this frame.  Each candidate's bounding
+	// sphere, grown by the projectile radius, is stored once in the flat
+	// arrays and once per grid bucket it overlaps in the bucketed arrays.
+	// Candidates too large for the grid go in an extra bucket that every
+	// query tests.
+
+	ColliderList s_candidates;
+	std::vector<float> s_candidateX;
+	std::vector<float> s_candidateY;
+	std::vector<float> s_candidateZ;
+	std::vector<float> s_candidateRadiusSquared;
+	std::vector<int> s_candidateIds;
+	std::vector<uint32> s_candidateMarks;
+	uint32 s_candidateMark;
+
+	std::vector<int> s_bucketStarts;
+	std::vector<float> s_bucketX;
+	std::vector<float> s_bucketY;
+	std::vector<float> s_bucketZ;
+	std::vector<float> s_bucketRadiusSquared;
+	std::vector<int> s_bucketIds;
+	std::vector<std::pair<int, int> > s_bucketEntries;
+
+	std::vector<int> s_sphereHits;
+	std::vector<QueryCell> s_queryCells;
+
+	// ======================================================================
+}
+using namespace ProjectileManagerNamespace;
+
+// ======================================================================
+
+bool ProjectileManagerNamespace::projectileCollidesWith(ShipObject const &actorShip, Object const &target)
+{
+	// Projectiles collide with anything that isn't a friendly, visible, non-capital ship
+	ShipObject const * const targetShip = target.asServerObject() ? target.asServerObject()->asShipObject() : 0;
+	if (   &actorShip != &target
+	    && !target.getKill()
+	    && (   !targetShip
+	        || (   targetShip->isVisible()
+	            && (   targetShip->isCapitalShip()
+	                || Pvp::canAttack(actorShip, *targetShip)))))
+		return true;
+	return false;
+}
+
+// ----------------------------------------------------------------------
+
+void ProjectileManagerNamespace::trigger(Hit const &hit)
+{
+	// Our projectile has hit a server object. Fire off a OnShipHit Trigger for that object.
+	// If our object is a ship, then we check PvP rules before damaging the target.
+	ShipObject * const actorShip = hit.shot.owner.getPointer();
+	ServerObject * const target = hit.target.getPointer();
+
+	//-- an earlier hit this frame may have killed either party
+	if (!actorShip || !target || target->getKill())
+		return;
+
+	ShipObject * const targetShip = target->asShipObject();
+
+	// For small ships, a hit anywhere on the ship counts as hitting the selected target.  For capital ships,
+	// it detects what component was actually hit
+	int actualComponentHit = hit.shot.targetedComponent;
+
+	if (targetShip && targetShip->isCapitalShip())
+	{
+		actualComponentHit = targetShip->findTargetChassisSlotByPosition(hit.position_o);
+	}
+
+	// trigger target that it was hit
+	{
+		ScriptParams params;
+		params.addParam(actorShip->getNetworkId());
+		params.addParam(hit.shot.weaponIndex);
+		params.addParam(false);
+		params.addParam(static_cast<int>(0));
+		params.addParam(actualComponentHit);
+		params.addParam(hit.shot.fromAutoTurret);
+		params.addParam(hit.position_o.x);
+		params.addParam(hit.position_o.y);
+		params.addParam(hit.position_o.z);
+		if(!targetShip) // For Non ship objects. Just trigger the event.
+			IGNORE_RETURN(target->getScriptObject()->trigAllScripts(Scripting::TRIG_SHIP_HIT, params));
+		if(targetShip  && Pvp::canAttack(*actorShip, *targetShip)) // For ship objects AND PvP rule is OK
 		{
+			// Trigger event and decrease ship HP.
+			IGNORE_RETURN(target->getScriptObject()->trigAllScripts(Scripting::TRIG_SHIP_HIT, params));
+			targetShip->setNumberOfHits(targetShip->getNumberOfHits() + 1);
 		}
+	}
+
+	// trigger attacker that they hit
+	{
+		ScriptParams params;
+		params.addParam(target->getNetworkId());
+		params.addParam(hit.shot.weaponIndex);
+		params.addParam(actualComponentHit);
+		IGNORE_RETURN(actorShip->getScriptObject()->trigAllScripts(Scripting::TRIG_SHIP_HITTING, params));
+	}
+}
+
+// ----------------------------------------------------------------------
 
-		// ----------------------------------------------------------------------
+void ProjectileManagerNamespace::clearCandidates()
+{
+	s_candidates.clear();
+	s_candidateX.clear();
+	s_candidateY.clear();
+	s_candidateZ.clear();
+	s_candidateRadiusSquared.clear();
+	s_candidateIds.clear();
+	s_bucketEntries.clear();
+	s_bucketStarts.assign(cs_gridBucketCount + 2, 0);
+}
 
-		~Projectile()
+// ----------------------------------------------------------------------
+
+int ProjectileManagerNamespace::getBucket(int const x, int const y, int const z)
+{
+	uint32 const hash = (static_cast<uint32>(x) * 73856093u) ^ (static_cast<uint32>(y) * 19349663u) ^ (static_cast<uint32>(z) * 83492791u);
+	return static_cast<int>(hash & static_cast<uint32>(cs_gridBucketCount - 1));
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Query the database for everything this frame's segments could hit.
+ *
+ * A segment longer than a query cell makes its own query along its path,
+ * as every shot used to.  The rest are grouped by the query cell their
+ * start lies in and each group makes one query over the group's bounds,
+ * so shots spread across the zone never query the space between them.
+ * Groups overlap, so the results are made unique afterwards.
+ */
+
+void ProjectileManagerNamespace::querySegments()
+{
+	SpatialDatabase const * const database = CollisionWorld::getDatabase();
+	CellProperty const * const worldCell = CellProperty::getWorldCellProperty();
+
+	s_queryCells.clear();
+
+	int const boltCount = static_cast<int>(s_boltStarts_w.size());
+	int const segmentCount = boltCount + static_cast<int>(s_beamStarts_w.size());
+
+	for (int i = 0; i < segmentCount; ++i)
+	{
+		Vector const & start_w = i < boltCount ? s_boltStarts_w[static_cast<size_t>(i)] : s_beamStarts_w[static_cast<size_t>(i - boltCount)];
+		Vector const & path_w = i < boltCount ? s_boltPaths_w[static_cast<size_t>(i)] : s_beamPaths_w[static_cast<size_t>(i - boltCount)];
+
+		if (path_w.magnitudeSquared() > cs_queryCellSize * cs_queryCellSize)
 		{
+			database->queryFor(static_cast<int>(SpatialDatabase::Q_Physicals), worldCell, true, Capsule(Sphere(start_w, cs_projectileRadius), path_w), s_candidates);
+			continue;
 		}
 
-		// ----------------------------------------------------------------------
+		QueryCell cell;
+		cell.x = static_cast<int>(floorf(start_w.x * cs_inverseQueryCellSize));
+		cell.y = static_cast<int>(floorf(start_w.y * cs_inverseQueryCellSize));
+		cell.z = static_cast<int>(floorf(start_w.z * cs_inverseQueryCellSize));
+		cell.segment = i;
+		s_queryCells.push_back(cell);
+	}
+
+	std::sort(s_queryCells.begin(), s_queryCells.end());
+
+	int const cellCount = static_cast<int>(s_queryCells.size());
+
+	for (int first = 0; first < cellCount;)
+	{
+		QueryCell const & cell = s_queryCells[static_cast<size_t>(first)];
 
-		bool update(float const elapsedTime, bool isBeam)
+		Vector segmentMin_w(Vector::maxXYZ);
+		Vector segmentMax_w(Vector::negativeMaxXYZ);
+
+		int last = first;
+		for (; last < cellCount && !(cell < s_queryCells[static_cast<size_t>(last)]); ++last)
 		{
-			// If the object no longer exists, kill the projectile
-			if (!m_owner.getPointer())
-				return false;
-				
-			//-- for beam weapons, the m_position_w and m_direction_w vectors are actually in the ship's object space, not world space.
-			//-- these values are not changed by this update() method
+			int const segment = s_queryCells[static_cast<size_t>(last)].segment;
+			Vector const & start_w = segment < boltCount ? s_boltStarts_w[static_cast<size_t>(segment)] : s_beamStarts_w[static_cast<size_t>(segment - boltCount)];
+			Vector const end_w(start_w + (segment < boltCount ? s_boltPaths_w[static_cast<size_t>(segment)] : s_beamPaths_w[static_cast<size_t>(segment - boltCount)]));
 
-			Vector projectilePosition_w;
-			Vector projectilePath;
+			segmentMin_w.set(std::min(segmentMin_w.x, std::min(start_w.x, end_w.x)), std::min(segmentMin_w.y, std::min(start_w.y, end_w.y)), std::min(segmentMin_w.z, std::min(start_w.z, end_w.z)));
+			segmentMax_w.set(std::max(segmentMax_w.x, std::max(start_w.x, end_w.x)), std::max(segmentMax_w.y, std::max(start_w.y, end_w.y)), std::max(segmentMax_w.z, std::max(start_w.z, end_w.z)));
+		}
 
-			Vector moveAmountThisFrame;
+		Vector const center_w((segmentMin_w + segmentMax_w) * 0.5f);
+		float const radius = (segmentMax_w - segmentMin_w).magnitude() * 0.5f + cs_projectileRadius;
 
-			if (isBeam)
-			{
-				projectilePosition_w = m_owner->rotateTranslate_o2w(m_position_w);
-				projectilePath = m_owner->rotate_o2w(m_direction_w * m_length);
-			}
-			else
-			{
-				// Move the projectile appropriately for the amount of time passed.  Return whether the projectile should still exist.
-				// If the projectile collides with something or its time expires, it should no longer exist.
-				moveAmountThisFrame = m_direction_w * (m_speed * elapsedTime);
-				projectilePath = moveAmountThisFrame + (m_direction_w * m_length);
-				
-				//-- We need to take into consideration that the object has actually been 
-				//   advanced forward in time by the time it makes it into the ProjectileManager.
-				//   The very first update should be from where the proijectile originated.
-				//   To catch potential cheaters, we will not allow this time to be beyond 0.25 seconds.
-				projectilePosition_w = m_position_w;
-				if (m_startDeltaTime > 0.f)
-				{
-					float const deltaTime = std::min(m_startDeltaTime, 0.25f);
-					m_startDeltaTime = 0.f;
-					
-					Vector const positionOffset_w(m_direction_w * m_speed * deltaTime);
-					projectilePosition_w -= positionOffset_w;
-					projectilePath += positionOffset_w;
-				}
-			}
+		database->queryFor(static_cast<int>(SpatialDatabase::Q_Physicals), worldCell, true, Capsule(Sphere(center_w, radius), Vector::zero), s_candidates);
 
-			// Get all objects that collide with the line segment from m_position_w to endPosition.  Don't collide with the owner.
-			float const projectileSize = 1.f;
-			Capsule const projectileCapsule_w(Sphere(projectilePosition_w, projectileSize), projectilePath);
-			ColliderList collidedWith;
-			CollisionWorld::getDatabase()->queryFor(static_cast<int>(SpatialDatabase::Q_Physicals), CellProperty::getWorldCellProperty(), true, projectileCapsule_w, collidedWith);
+		first = last;
+	}
 
-			Object * closestObject = nullptr;
-			float smallestTime = 0.0f;
-			Vector collisionPosition_o;
+	std::sort(s_candidates.begin(), s_candidates.end());
+	s_candidates.erase(std::unique(s_candidates.begin(), s_candidates.end()), s_candidates.end());
+}
 
-			for (ColliderList::const_iterator i = collidedWith.begin(); i != collidedWith.end(); ++i)
-			{
-				Object &collider = NON_NULL(*i)->getOwner();
-				if (projectileCollidesWith(collider))
-				{
-					// find which object it collided with first, and when
-					BaseExtent const * const extent_l = (*i)->getExtent_l();
-					if (extent_l == nullptr)
-						WARNING(true, ("ProjectileManager collided with object with nullptr extent. [%s], appearance=[%s]", collider.getDebugName(), collider.getAppearanceTemplateName()));
-					else
-					{
-						Vector const start_o = collider.rotateTranslate_w2o(projectilePosition_w);
-						Vector const end_o = collider.rotateTranslate_w2o(projectilePosition_w + projectilePath);
-						float time;
-						if (extent_l->intersect(start_o, end_o, nullptr, &time))
-						{
-							if (!closestObject || time < smallestTime)
-							{
-								closestObject = &collider;
-								smallestTime = time;
-								collisionPosition_o = Vector::linearInterpolate(start_o, end_o, time);
-							}
-						}
-					}
-				}
-			}
+// ----------------------------------------------------------------------
+/**
+ * Find everything any shot could hit this frame and bin it.
+ */
 
-			if (closestObject)
-			{
-				ServerObject * const so = closestObject->asServerObject();
-				if (so)
-					trigger(*so, collisionPosition_o);
-				
-				return false;
-			}
-			
-			if (!isBeam)
-			{
-				// update the position and remaining duration
-				m_position_w += moveAmountThisFrame;
-				m_duration -= elapsedTime;
-			}
+void ProjectileManagerNamespace::gatherCandidates()
+{
+	clearCandidates();
+	querySegments();
 
-			return m_duration > 0.0f;
-		}
+	int const candidateCount = static_cast<int>(s_candidates.size());
 
-		// ----------------------------------------------------------------------
+	s_candidateX.reserve(s_candidates.size());
+	s_candidateY.reserve(s_candidates.size());
+	s_candidateZ.reserve(s_candidates.size());
+	s_candidateRadiusSquared.reserve(s_candidates.size());
+	s_candidateIds.reserve(s_candidates.size());
 
-		bool projectileCollidesWith(Object const &target) const
+	if (static_cast<int>(s_candidateMarks.size()) < candidateCount)
+		s_candidateMarks.resize(s_candidates.size(), 0);
+
+	for (int i = 0; i < candidateCount; ++i)
+	{
+		Sphere const & sphere_w = NON_NULL(s_candidates[static_cast<size_t>(i)])->getBoundingSphere_w();
+		Vector const & center = sphere_w.getCenter();
+		float const candidateRadius = sphere_w.getRadius() + cs_projectileRadius;
+
+		s_candidateX.push_back(center.x);
+		s_candidateY.push_back(center.y);
+		s_candidateZ.push_back(center.z);
+		s_candidateRadiusSquared.push_back(candidateRadius * candidateRadius);
+		s_candidateIds.push_back(i);
+
+		int const minX = static_cast<int>(floorf((center.x - candidateRadius) * cs_inverseGridCellSize));
+		int const minY = static_cast<int>(floorf((center.y - candidateRadius) * cs_inverseGridCellSize));
+		int const minZ = static_cast<int>(floorf((center.z - candidateRadius) * cs_inverseGridCellSize));
+		int const maxX = static_cast<int>(floorf((center.x + candidateRadius) * cs_inverseGridCellSize));
+		int const maxY = static_cast<int>(floorf((center.y + candidateRadius) * cs_inverseGridCellSize));
+		int const maxZ = static_cast<int>(floorf((center.z + candidateRadius) * cs_inverseGridCellSize));
+
+		if ((maxX - minX + 1) * (maxY - minY + 1) * (maxZ - minZ + 1) > cs_maximumCellsPerCandidate)
 		{
-			// Projectiles collide with anything that isn't a friendly, visible, non-capital ship
-			ShipObject const * const actorShip = m_owner.getPointer();
-			ShipObject const * const targetShip = target.asServerObject() ? target.asServerObject()->asShipObject() : 0;
-			if (   actorShip != &target
-			    && !target.getKill()
-			    && (   !targetShip
-			        || (   targetShip->isVisible()
-			            && (   targetShip->isCapitalShip()
-			                || Pvp::canAttack(*actorShip, *targetShip)))))
-				return true;
-			return false;
+			s_bucketEntries.push_back(std::make_pair(cs_gridBucketCount, i));
+			continue;
 		}
 
-		// ----------------------------------------------------------------------
+		for (int x = minX; x <= maxX; ++x)
+			for (int y = minY; y <= maxY; ++y)
+				for (int z = minZ; z <= maxZ; ++z)
+					s_bucketEntries.push_back(std::make_pair(getBucket(x, y, z), i));
+	}
 
-		void trigger(ServerObject &target, Vector const & collisionPosition_o) const
-		{
-			// Our projectile has hit a server object. Fire off a OnShipHit Trigger for that object.
-			// If our object is a ship, then we check PvP rules before damaging the target.
-			ShipObject * const actorShip = m_owner.getPointer();
-			ShipObject * const targetShip = target.asShipObject();
-
-/*
-			DEBUG_REPORT_LOG(actorShip && targetShip, ("%s shooting %s (%s).\n",
-				actorShip->getNetworkId().getValueString().c_str(),
-				targetShip->getNetworkId().getValueString().c_str(),
-				Pvp::canAttack(*actorShip, *targetShip) ? "allowed" : "denied"));
-*/
-
-			if ( actorShip )
-			{
-				// For small ships, a hit anywhere on the ship counts as hitting the selected target.  For capital ships,
-				// it detects what component was actually hit
-				int actualComponentHit = m_targetedComponent;
+	//-- counting sort the entries by bucket so each bucket's spheres are contiguous
+	int const entryCount = static_cast<int>(s_bucketEntries.size());
 
-				if (targetShip && targetShip->isCapitalShip())
-				{
-					actualComponentHit = targetShip->findTargetChassisSlotByPosition(collisionPosition_o);
-				}
-				
-				// trigger target that it was hit
-				{
-					ScriptParams params;
-					params.addParam(actorShip->getNetworkId());
-					params.addParam(m_weaponIndex);
-					params.addParam(false);
-					params.addParam(static_cast<int>(0));
-					params.addParam(actualComponentHit);
-					params.addParam(m_fromAutoTurret);
-					params.addParam(collisionPosition_o.x);
-					params.addParam(collisionPosition_o.y);
-					params.addParam(collisionPosition_o.z);
-					if(!targetShip) // For Non ship objects. Just trigger the event.
-						IGNORE_RETURN(target.getScriptObject()->trigAllScripts(Scripting::TRIG_SHIP_HIT, params));
-					if(targetShip  && Pvp::canAttack(*actorShip, *targetShip)) // For ship objects AND PvP rule is OK
-					{
-						// Trigger event and decrease ship HP.
-						IGNORE_RETURN(target.getScriptObject()->trigAllScripts(Scripting::TRIG_SHIP_HIT, params));
-						targetShip->setNumberOfHits(targetShip->getNumberOfHits() + 1);	
-					}
-				}
+	for (int i = 0; i < entryCount; ++i)
+		++s_bucketStarts[static_cast<size_t>(s_bucketEntries[static_cast<size_t>(i)].first + 1)];
+
+	for (int i = 1; i < cs_gridBucketCount + 2; ++i)
+		s_bucketStarts[static_cast<size_t>(i)] += s_bucketStarts[static_cast<size_t>(i - 1)];
+
+	s_bucketX.resize(s_bucketEntries.size());
+	s_bucketY.resize(s_bucketEntries.size());
+	s_bucketZ.resize(s_bucketEntries.size());
+	s_bucketRadiusSquared.resize(s_bucketEntries.size());
+	s_bucketIds.resize(s_bucketEntries.size());
+
+	static std::vector<int> cursors;
+	cursors.assign(s_bucketStarts.begin(), s_bucketStarts.end() - 1);
+
+	for (int i = 0; i < entryCount; ++i)
+	{
+		std::pair<int, int> const & entry = s_bucketEntries[static_cast<size_t>(i)];
+		size_t const source = static_cast<size_t>(entry.second);
+		size_t const destination = static_cast<size_t>(cursors[static_cast<size_t>(entry.first)]++);
+
+		s_bucketX[destination] = s_candidateX[source];
+		s_bucketY[destination] = s_candidateY[source];
+		s_bucketZ[destination] = s_candidateZ[source];
+		s_bucketRadiusSquared[destination] = s_candidateRadiusSquared[source];
+		s_bucketIds[destination] = entry.second;
+	}
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Append to hits the id of each sphere the segment passes through.
+ *
+ * Each sphere is tested against the point of the segment closest to its
+ * center.  Spheres are tested four at a time where SSE2 is available.
+ */
+
+void ProjectileManagerNamespace::findSphereHits(Vector const &start_w, Vector const &path_w, float const * const x, float const * const y, float const * const z, float const * const radiusSquared, int const * const ids, int const count, std::vector<int> &hits)
+{
+	float const pathLengthSquared = path_w.magnitudeSquared();
+	float const inversePathLengthSquared = pathLengthSquared > 0.f ? 1.f / pathLengthSquared : 0.f;
+
+	int i = 0;
+
+#if PROJECTILEMANAGER_USE_SSE2
+	__m128 const startX = _mm_set1_ps(start_w.x);
+	__m128 const startY = _mm_set1_ps(start_w.y);
+	__m128 const startZ = _mm_set1_ps(start_w.z);
+	__m128 const pathX = _mm_set1_ps(path_w.x);
+	__m128 const pathY = _mm_set1_ps(path_w.y);
+	__m128 const pathZ = _mm_set1_ps(path_w.z);
+	__m128 const inverseLength = _mm_set1_ps(inversePathLengthSquared);
+	__m128 const zero = _mm_setzero_ps();
+	__m128 const one = _mm_set1_ps(1.f);
+
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128 const toCenterX = _mm_sub_ps(_mm_loadu_ps(x + i), startX);
+		__m128 const toCenterY = _mm_sub_ps(_mm_loadu_ps(y + i), startY);
+		__m128 const toCenterZ = _mm_sub_ps(_mm_loadu_ps(z + i), startZ);
+
+		__m128 const dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(toCenterX, pathX), _mm_mul_ps(toCenterY, pathY)), _mm_mul_ps(toCenterZ, pathZ));
+		__m128 const t = _mm_min_ps(_mm_max_ps(_mm_mul_ps(dot, inverseLength), zero), one);
+
+		__m128 const offsetX = _mm_sub_ps(toCenterX, _mm_mul_ps(t, pathX));
+		__m128 const offsetY = _mm_sub_ps(toCenterY, _mm_mul_ps(t, pathY));
+		__m128 const offsetZ = _mm_sub_ps(toCenterZ, _mm_mul_ps(t, pathZ));
+		__m128 const distanceSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(offsetX, offsetX), _mm_mul_ps(offsetY, offsetY)), _mm_mul_ps(offsetZ, offsetZ));
+
+		int mask = _mm_movemask_ps(_mm_cmple_ps(distanceSquared, _mm_loadu_ps(radiusSquared + i)));
+		for (int lane = i; mask; mask >>= 1, ++lane)
+			if (mask & 1)
+				hits.push_back(ids[lane]);
+	}
+#endif
+
+	for (; i < count; ++i)
+	{
+		float const toCenterX = x[i] - start_w.x;
+		float const toCenterY = y[i] - start_w.y;
+		float const toCenterZ = z[i] - start_w.z;
+
+		float const dot = toCenterX * path_w.x + toCenterY * path_w.y + toCenterZ * path_w.z;
+		float const t = std::min(std::max(dot * inversePathLengthSquared, 0.f), 1.f);
+
+		float const offsetX = toCenterX - t * path_w.x;
+		float const offsetY = toCenterY - t * path_w.y;
+		float const offsetZ = toCenterZ - t * path_w.z;
+
+		if (offsetX * offsetX + offsetY * offsetY + offsetZ * offsetZ <= radiusSquared[i])
+			hits.push_back(ids[i]);
+	}
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Find the first object the segment hits that the owner's shots may hit.
+ *
+ * The candidates' bounding spheres are only a broad phase; anything whose
+ * sphere the segment passes through is then tested against its extent as
+ * before.
+ */
+
+bool ProjectileManagerNamespace::findHit(ShipObject const &owner, Vector const &start_w, Vector const &path_w, Object *&hitObject, Vector &hitPosition_o)
+{
+	s_sphereHits.clear();
+
+	Vector const end_w(start_w + path_w);
+	Vector const segmentMin_w(std::min(start_w.x, end_w.x), std::min(start_w.y, end_w.y), std::min(start_w.z, end_w.z));
+	Vector const segmentMax_w(std::max(start_w.x, end_w.x), std::max(start_w.y, end_w.y), std::max(start_w.z, end_w.z));
+
+	int const minX = static_cast<int>(floorf(segmentMin_w.x * cs_inverseGridCellSize));
+	int const minY = static_cast<int>(floorf(segmentMin_w.y * cs_inverseGridCellSize));
+	int const minZ = static_cast<int>(floorf(segmentMin_w.z * cs_inverseGridCellSize));
+	int const maxX = static_cast<int>(floorf(segmentMax_w.x * cs_inverseGridCellSize));
+	int const maxY = static_cast<int>(floorf(segmentMax_w.y * cs_inverseGridCellSize));
+	int const maxZ = static_cast<int>(floorf(segmentMax_w.z * cs_inverseGridCellSize));
 
-				// trigger attacker that they hit
+	if ((maxX - minX + 1) * (maxY - minY + 1) * (maxZ - minZ + 1) > cs_maximumCellsPerQuery)
+	{
+		//-- long segments are cheaper to test against every candidate than to walk the grid
+		findSphereHits(start_w, path_w, &s_candidateX[0], &s_candidateY[0], &s_candidateZ[0], &s_candidateRadiusSquared[0], &s_candidateIds[0], static_cast<int>(s_candidateIds.size()), s_sphereHits);
+	}
+	else
+	{
+		for (int x = minX; x <= maxX; ++x)
+			for (int y = minY; y <= maxY; ++y)
+				for (int z = minZ; z <= maxZ; ++z)
 				{
-					ScriptParams params;
-					params.addParam(target.getNetworkId());
-					params.addParam(m_weaponIndex);
-					params.addParam(actualComponentHit);
-					IGNORE_RETURN(actorShip->getScriptObject()->trigAllScripts(Scripting::TRIG_SHIP_HITTING, params));
+					int const bucket = getBucket(x, y, z);
+					int const first = s_bucketStarts[static_cast<size_t>(bucket)];
+					int const count = s_bucketStarts[static_cast<size_t>(bucket + 1)] - first;
+					if (count)
+						findSphereHits(start_w, path_w, &s_bucketX[0] + first, &s_bucketY[0] + first, &s_bucketZ[0] + first, &s_bucketRadiusSquared[0] + first, &s_bucketIds[0] + first, count, s_sphereHits);
 				}
-			}
-		}
 
-		// ----------------------------------------------------------------------
+		int const first = s_bucketStarts[cs_gridBucketCount];
+		int const count = s_bucketStarts[cs_gridBucketCount + 1] - first;
+		if (count)
+			findSphereHits(start_w, path_w, &s_bucketX[0] + first, &s_bucketY[0] + first, &s_bucketZ[0] + first, &s_bucketRadiusSquared[0] + first, &s_bucketIds[0] + first, count, s_sphereHits);
+	}
+
+	//-- a candidate spanning several cells may be reported more than once
+	if (++s_candidateMark == 0)
+	{
+		//-- the mark wrapped, so clear the old marks before any of them can match again
+		std::fill(s_candidateMarks.begin(), s_candidateMarks.end(), 0);
+		s_candidateMark = 1;
+	}
+
+	hitObject = nullptr;
+	float smallestTime = 0.0f;
+
+	for (std::vector<int>::const_iterator i = s_sphereHits.begin(); i != s_sphereHits.end(); ++i)
+	{
+		uint32 & mark = s_candidateMarks[static_cast<size_t>(*i)];
+		if (mark == s_candidateMark)
+			continue;
+		mark = s_candidateMark;
+
+		testCandidate(owner, *NON_NULL(s_candidates[static_cast<size_t>(*i)]), start_w, end_w, hitObject, smallestTime, hitPosition_o);
+	}
+
+	return hitObject != nullptr;
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Test one candidate's extent against the segment, keeping it as the hit
+ * if it is hit before any earlier candidate.
+ */
+
+void ProjectileManagerNamespace::testCandidate(ShipObject const &owner, CollisionProperty &collision, Vector const &start_w, Vector const &end_w, Object *&hitObject, float &smallestTime, Vector &hitPosition_o)
+{
+	Object &collider = collision.getOwner();
+
+	//-- a hit earlier this frame may have taken the candidate out of the world
+	if (!collider.isInWorld())
+		return;
 
-		ShipObject * getOwner()
+	if (!projectileCollidesWith(owner, collider))
+		return;
+
+	// find which object it collided with first, and when
+	BaseExtent const * const extent_l = collision.getExtent_l();
+	if (extent_l == nullptr)
+		WARNING(true, ("ProjectileManager collided with object with nullptr extent. [%s], appearance=[%s]", collider.getDebugName(), collider.getAppearanceTemplateName()));
+	else
+	{
+		Vector const start_o = collider.rotateTranslate_w2o(start_w);
+		Vector const end_o = collider.rotateTranslate_w2o(end_w);
+		float time;
+		if (extent_l->intersect(start_o, end_o, nullptr, &time))
 		{
-			return m_owner.getPointer();
+			if (!hitObject || time < smallestTime)
+			{
+				hitObject = &collider;
+				smallestTime = time;
+				hitPosition_o = Vector::linearInterpolate(start_o, end_o, time);
+			}
 		}
+	}
+}
 
-	private:
-
-		Watcher<ShipObject> m_owner;
-		int m_weaponIndex;
-		int m_projectileIndex;
-		int m_targetedComponent;
-		float m_startDeltaTime;
-		Vector m_position_w;
-		Vector m_direction_w;
-		float m_length;
-		float m_speed;
-		float m_duration;
-		bool m_fromAutoTurret;
-	};
+// ----------------------------------------------------------------------
+/**
+ * Find the first object the segment hits with a database query of its own,
+ * as every shot did before the candidates were binned.  Only used to time
+ * and check the binned tests.
+ */
 
-	// ======================================================================
+bool ProjectileManagerNamespace::findHitByQuery(ShipObject const &owner, Vector const &start_w, Vector const &path_w, Object *&hitObject, Vector &hitPosition_o)
+{
+	static ColliderList collidedWith;
+	collidedWith.clear();
+	CollisionWorld::getDatabase()->queryFor(static_cast<int>(SpatialDatabase::Q_Physicals), CellProperty::getWorldCellProperty(), true, Capsule(Sphere(start_w, cs_projectileRadius), path_w), collidedWith);
 
-	std::vector<Projectile> s_projectiles;
+	Vector const end_w(start_w + path_w);
+	hitObject = nullptr;
+	float smallestTime = 0.0f;
 
-	//----------------------------------------------------------------------
+	for (ColliderList::const_iterator i = collidedWith.begin(); i != collidedWith.end(); ++i)
+		testCandidate(owner, *NON_NULL(*i), start_w, end_w, hitObject, smallestTime, hitPosition_o);
 
-	typedef std::pair<NetworkId /* ship id */, int /*weaponIndex */> ShipWeaponPair;
-	typedef std::map<ShipWeaponPair, Projectile> ProjectileMap;
-	ProjectileMap s_projectileBeamMap;
+	return hitObject != nullptr;
+}
+
+// ----------------------------------------------------------------------
 
+void ProjectileManagerNamespace::removeBolt(int const index)
+{
+	size_t const i = static_cast<size_t>(index);
+	size_t const last = s_boltShots.size() - 1;
 
-	// ======================================================================
+	if (i != last)
+	{
+		s_boltPositions_w[i] = s_boltPositions_w[last];
+		s_boltDirections_w[i] = s_boltDirections_w[last];
+		s_boltSpeeds[i] = s_boltSpeeds[last];
+		s_boltLengths[i] = s_boltLengths[last];
+		s_boltDurations[i] = s_boltDurations[last];
+		s_boltStartDeltaTimes[i] = s_boltStartDeltaTimes[last];
+		s_boltShots[i] = s_boltShots[last];
+	}
+
+	s_boltPositions_w.pop_back();
+	s_boltDirections_w.pop_back();
+	s_boltSpeeds.pop_back();
+	s_boltLengths.pop_back();
+	s_boltDurations.pop_back();
+	s_boltStartDeltaTimes.pop_back();
+	s_boltShots.pop_back();
 }
-using namespace ProjectileManagerNamespace;
 
 // ======================================================================
 
@@ -326,16 +691,26 @@ void ProjectileManager::create(Client const *gunnerClient, ShipObject &owner, in
 	UNREF(gunnerClient);
 	bool const isBeam = owner.isBeamWeapon(weaponIndex);
 
-	Projectile const projectile(owner, weaponIndex, projectileIndex, targetedComponent, startDeltaTime, transform_p.getPosition_p(), transform_p.getLocalFrameK_p(), length, speed, duration, fromAutoTurret, isBeam);
+	Shot const shot(owner, weaponIndex, targetedComponent, fromAutoTurret);
 
 	if (isBeam)
 	{
-		s_projectileBeamMap[ShipWeaponPair(owner.getNetworkId(), weaponIndex)] = projectile;
+		//-- offset transform used for beam positioning
+		Beam & beam = s_beamMap[ShipWeaponPair(owner.getNetworkId(), weaponIndex)];
+		beam.shot = shot;
+		beam.position_o = owner.rotateTranslate_w2o(transform_p.getPosition_p());
+		beam.path_o = owner.rotate_w2o(transform_p.getLocalFrameK_p()) * (speed * duration);
 	}
 	else
 	{
-		// add the projectile to the active projectiles vector
-		s_projectiles.push_back(projectile);
+		// add the projectile to the active projectiles
+		s_boltPositions_w.push_back(transform_p.getPosition_p());
+		s_boltDirections_w.push_back(transform_p.getLocalFrameK_p());
+		s_boltSpeeds.push_back(speed);
+		s_boltLengths.push_back(length);
+		s_boltDurations.push_back(duration);
+		s_boltStartDeltaTimes.push_back(startDeltaTime);
+		s_boltShots.push_back(shot);
 	}
 
 	// send the projectile to all clients observing the owner except the owner
@@ -379,41 +754,27 @@ void ProjectileManager::create(Client const *gunnerClient, ShipObject &owner, in
 void ProjectileManager::stopBeam(ShipObject & shipOwner, int weaponIndex)
 {
 	ShipWeaponPair const key(shipOwner.getNetworkId(), weaponIndex);
-	s_projectileBeamMap.erase(key);
+	s_beamMap.erase(key);
 }
 
 // ----------------------------------------------------------------------
 
 void ProjectileManager::update(float timePassed) // static
 {
-	{
-		// Call Projectile::update all projectiles, removing from the vector if Projectile::update() returns false
-		unsigned int i = 0;
-		while (i < s_projectiles.size())
-		{
-			if (s_projectiles[i].update(timePassed, false))
-				++i;
-			else
-			{
-				s_projectiles[i] = s_projectiles[s_projectiles.size()-1];
-				s_projectiles.pop_back();
-			}
-		}
-	}
+	int const boltCount = static_cast<int>(s_boltShots.size());
 
 	//--
-	//-- Update the beam weapons
+	//-- Drop beams that can no longer fire
 	//--
 
 	{
-		for (ProjectileMap::iterator it = s_projectileBeamMap.begin(); it != s_projectileBeamMap.end();)
+		for (BeamMap::iterator it = s_beamMap.begin(); it != s_beamMap.end();)
 		{
 			ShipWeaponPair const & key = (*it).first;
 			NetworkId const & shipId = key.first;
 			int weaponIndex = key.second;
-			Projectile & projectile = (*it).second;
 
-			ShipObject * const shipObject = projectile.getOwner();
+			ShipObject * const shipObject = (*it).second.shot.owner.getPointer();
 
 			if (nullptr == shipObject)
 			{
@@ -429,7 +790,6 @@ void ProjectileManager::update(float timePassed) // static
 					}
 					else
 					{
-						projectile.update(timePassed, true);
 						++it;
 						continue;
 					}
@@ -437,10 +797,247 @@ void ProjectileManager::update(float timePassed) // static
 			}
 
 			//-- this beam is no longer valid, remove it
-			s_projectileBeamMap.erase(it++);
+			s_beamMap.erase(it++);
+		}
+	}
+
+	if (boltCount == 0 && s_beamMap.empty())
+		return;
+
+	//--
+	//-- Work out the segment each bolt sweeps this frame
+	//--
+
+	s_boltStarts_w.resize(s_boltShots.size());
+	s_boltPaths_w.resize(s_boltShots.size());
+
+	for (int i = 0; i < boltCount; ++i)
+	{
+		Vector const & direction_w = s_boltDirections_w[static_cast<size_t>(i)];
+		Vector path_w(direction_w * (s_boltSpeeds[static_cast<size_t>(i)] * timePassed + s_boltLengths[static_cast<size_t>(i)]));
+		Vector start_w(s_boltPositions_w[static_cast<size_t>(i)]);
+
+		//-- We need to take into consideration that the object has actually been
+		//   advanced forward in time by the time it makes it into the ProjectileManager.
+		//   The very first update should be from where the proijectile originated.
+		//   To catch potential cheaters, we will not allow this time to be beyond 0.25 seconds.
+		float & startDeltaTime = s_boltStartDeltaTimes[static_cast<size_t>(i)];
+		if (startDeltaTime > 0.f)
+		{
+			float const deltaTime = std::min(startDeltaTime, 0.25f);
+			startDeltaTime = 0.f;
+
+			Vector const positionOffset_w(direction_w * (s_boltSpeeds[static_cast<size_t>(i)] * deltaTime));
+			start_w -= positionOffset_w;
+			path_w += positionOffset_w;
+		}
+
+		s_boltStarts_w[static_cast<size_t>(i)] = start_w;
+		s_boltPaths_w[static_cast<size_t>(i)] = path_w;
+	}
+
+	//-- beams sweep their owner-relative path from wherever the owner is now
+	s_beamKeys.clear();
+	s_beamShots.clear();
+	s_beamStarts_w.clear();
+	s_beamPaths_w.clear();
+
+	for (BeamMap::const_iterator it = s_beamMap.begin(); it != s_beamMap.end(); ++it)
+	{
+		ShipObject const * const shipObject = NON_NULL((*it).second.shot.owner.getPointer());
+		s_beamKeys.push_back((*it).first);
+		s_beamShots.push_back((*it).second.shot);
+		s_beamStarts_w.push_back(shipObject->rotateTranslate_o2w((*it).second.position_o));
+		s_beamPaths_w.push_back(shipObject->rotate_o2w((*it).second.path_o));
+	}
+
+	//--
+	//-- Gather and bin everything the segments could hit
+	//--
+
+	gatherCandidates();
+
+	//--
+	//-- Test the segments, telling the scripts about each hit as it is found
+	//-- the way a shot always has.  A script may fire new shots, which are
+	//-- appended to the bolt arrays and first tested next frame, or move or
+	//-- destroy a candidate.  So the candidates are gathered again before
+	//-- the first test after any trigger, rather than held across it.
+	//--
+
+	bool candidatesStale = false;
+
+	for (int i = 0; i < boltCount; ++i)
+	{
+		Hit hit;
+		hit.shot = s_boltShots[static_cast<size_t>(i)];
+
+		ShipObject const * const owner = hit.shot.owner.getPointer();
+
+		if (!owner)
+		{
+			s_boltDurations[static_cast<size_t>(i)] = 0.f;
+			continue;
+		}
+
+		if (candidatesStale)
+		{
+			gatherCandidates();
+			candidatesStale = false;
+		}
+
+		Object * hitObject = nullptr;
+
+		if (!s_candidates.empty() && findHit(*owner, s_boltStarts_w[static_cast<size_t>(i)], s_boltPaths_w[static_cast<size_t>(i)], hitObject, hit.position_o))
+		{
+			s_boltDurations[static_cast<size_t>(i)] = 0.f;
+
+			hit.target = hitObject->asServerObject();
+			if (hit.target.getPointer())
+			{
+				trigger(hit);
+				candidatesStale = true;
+			}
+		}
+	}
+
+	int const beamCount = static_cast<int>(s_beamKeys.size());
+
+	for (int i = 0; i < beamCount; ++i)
+	{
+		//-- an earlier hit script may have stopped this beam
+		if (s_beamMap.find(s_beamKeys[static_cast<size_t>(i)]) == s_beamMap.end())
+			continue;
+
+		Hit hit;
+		hit.shot = s_beamShots[static_cast<size_t>(i)];
+
+		ShipObject const * const owner = hit.shot.owner.getPointer();
+
+		if (!owner)
+			continue;
+
+		if (candidatesStale)
+		{
+			gatherCandidates();
+			candidatesStale = false;
+		}
+
+		Object * hitObject = nullptr;
+
+		if (!s_candidates.empty() && findHit(*owner, s_beamStarts_w[static_cast<size_t>(i)], s_beamPaths_w[static_cast<size_t>(i)], hitObject, hit.position_o))
+		{
+			hit.target = hitObject->asServerObject();
+			if (hit.target.getPointer())
+			{
+				trigger(hit);
+				candidatesStale = true;
+			}
+		}
+	}
+
+	//--
+	//-- Move the bolts on and drop the expired ones
+	//--
+
+	for (int i = 0; i < boltCount; ++i)
+	{
+		s_boltPositions_w[static_cast<size_t>(i)] += s_boltDirections_w[static_cast<size_t>(i)] * (s_boltSpeeds[static_cast<size_t>(i)] * timePassed);
+		s_boltDurations[static_cast<size_t>(i)] -= timePassed;
+	}
+
+	{
+		int i = 0;
+		while (i < static_cast<int>(s_boltShots.size()))
+		{
+			if (s_boltDurations[static_cast<size_t>(i)] > 0.0f)
+				++i;
+			else
+				removeBolt(i);
 		}
 	}
 }
 
-// ======================================================================
+// ----------------------------------------------------------------------
+/**
+ * Time finding what every live bolt and beam would hit from where it is
+ * now, through the binned candidates and through one database query per
+ * shot.  Nothing is triggered and no projectile is moved.
+ */
+
+void ProjectileManager::benchmarkHitTests(int const passes, int &segmentCount, int &binnedHits, int &queryHits, float &binnedTime, float &queryTime)
+{
+	//-- the segments this frame's update would sweep, without the time step
+	s_boltStarts_w.assign(s_boltPositions_w.begin(), s_boltPositions_w.end());
+	s_boltPaths_w.resize(s_boltShots.size());
 
+	int const boltCount = static_cast<int>(s_boltShots.size());
+	for (int i = 0; i < boltCount; ++i)
+		s_boltPaths_w[static_cast<size_t>(i)] = s_boltDirections_w[static_cast<size_t>(i)] * s_boltLengths[static_cast<size_t>(i)];
+
+	s_beamKeys.clear();
+	s_beamShots.clear();
+	s_beamStarts_w.clear();
+	s_beamPaths_w.clear();
+
+	for (BeamMap::const_iterator it = s_beamMap.begin(); it != s_beamMap.end(); ++it)
+	{
+		ShipObject const * const shipObject = (*it).second.shot.owner.getPointer();
+		if (!shipObject)
+			continue;
+
+		s_beamKeys.push_back((*it).first);
+		s_beamShots.push_back((*it).second.shot);
+		s_beamStarts_w.push_back(shipObject->rotateTranslate_o2w((*it).second.position_o));
+		s_beamPaths_w.push_back(shipObject->rotate_o2w((*it).second.path_o));
+	}
+
+	segmentCount = boltCount + static_cast<int>(s_beamShots.size());
+	binnedHits = 0;
+	queryHits = 0;
+
+	Object * hitObject = nullptr;
+	Vector hitPosition_o;
+
+	PerformanceTimer timer;
+	timer.start();
+	for (int pass = 0; pass < passes; ++pass)
+	{
+		gatherCandidates();
+
+		if (s_candidates.empty())
+			continue;
+
+		for (int i = 0; i < segmentCount; ++i)
+		{
+			Shot const & shot = i < boltCount ? s_boltShots[static_cast<size_t>(i)] : s_beamShots[static_cast<size_t>(i - boltCount)];
+			ShipObject const * const owner = shot.owner.getPointer();
+			Vector const & start_w = i < boltCount ? s_boltStarts_w[static_cast<size_t>(i)] : s_beamStarts_w[static_cast<size_t>(i - boltCount)];
+			Vector const & path_w = i < boltCount ? s_boltPaths_w[static_cast<size_t>(i)] : s_beamPaths_w[static_cast<size_t>(i - boltCount)];
+
+			if (owner && findHit(*owner, start_w, path_w, hitObject, hitPosition_o))
+				++binnedHits;
+		}
+	}
+	timer.stop();
+	binnedTime = timer.getElapsedTime();
+
+	timer.start();
+	for (int pass = 0; pass < passes; ++pass)
+	{
+		for (int i = 0; i < segmentCount; ++i)
+		{
+			Shot const & shot = i < boltCount ? s_boltShots[static_cast<size_t>(i)] : s_beamShots[static_cast<size_t>(i - boltCount)];
+			ShipObject const * const owner = shot.owner.getPointer();
+			Vector const & start_w = i < boltCount ? s_boltStarts_w[static_cast<size_t>(i)] : s_beamStarts_w[static_cast<size_t>(i - boltCount)];
+			Vector const & path_w = i < boltCount ? s_boltPaths_w[static_cast<size_t>(i)] : s_beamPaths_w[static_cast<size_t>(i - boltCount)];
+
+			if (owner && findHitByQuery(*owner, start_w, path_w, hitObject, hitPosition_o))
+				++queryHits;
+		}
+	}
+	timer.stop();
+	queryTime = timer.getElapsedTime();
+}
+
+// ======================================================================
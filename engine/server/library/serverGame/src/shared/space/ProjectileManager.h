@@ -24,6 +24,8 @@ public:
 	static void create(Client const *gunnerClient, ShipObject &owner, int weaponIndex, int projectileIndex, int targetedComponent, float startDeltaTime, Transform const & transform_p, float length, float speed, float duration, bool const fromAutoTurret);
 	static void stopBeam(ShipObject & shipOwner, int weaponIndex);
 	static void update(float timePassed);
+
+	static void benchmarkHitTests(int passes, int &segmentCount, int &binnedHits, int &queryHits, float &binnedTime, float &queryTime);
 };
 
 // ======================================================================
@@ -18,7 +18,9 @@
 #include "serverGame/PlayerShipController.h"
 #include "serverGame/ShipObject.h"
 #include "serverNetworkMessages/GameConnectionServerMessages.h"
+#include "sharedFoundation/Clock.h"
 #include "sharedFoundation/ConstCharCrcString.h"
+#include "sharedFoundation/Crc.h"
 #include "sharedFoundation/PointerDeleter.h"
 #include "sharedMathArchive/TransformArchive.h"
 #include "sharedNetworkMessages/ShipUpdateTransformMessage.h"
@@ -39,12 +41,33 @@ namespace ShipClientUpdateTrackerNamespace
 
 	// ----------------------------------------------------------------------
 
+	// bytes of ShipUpdateTransformMessage a client receives for one update
+	int const cs_shipUpdateBytes =
+		  2 // member count
+		+ 4 // crc
+		+ 2 // shipId
+		+ PackedTransform::cs_packedSize
+		+ PackedVelocity::cs_packedSize
+		+ PackedRotationRate::cs_packedSize*3
+		+ 4 // syncstamp
+		;
+
+	// the relative speed at which a ship is updated twice as often
+	float const cs_relativeSpeedPriorityScale = 50.f;
+
+	// the least share of a client's byte budget left by lag or congestion
+	float const cs_minimumBudgetScale = 0.25f;
+
+	// ----------------------------------------------------------------------
+
 	class ClientShipEntry
 	{
 	public:
 		ClientShipEntry(unsigned int priority, ShipObject const &ship) :
 			m_priority(priority),
-			m_ship(ship)
+			m_ship(ship),
+			m_lastSentState(0),
+			m_lastSentTimeMs(0)
 		{
 		}
 
@@ -68,12 +91,29 @@ namespace ShipClientUpdateTrackerNamespace
 			return m_ship;
 		}
 
+		// True if the client was sent this quantized state recently enough
+		// that sending it again would tell it nothing new.
+		bool wasSent(uint32 state, uint32 timeMs) const
+		{
+			return m_lastSentTimeMs != 0
+				&& state == m_lastSentState
+				&& timeMs - m_lastSentTimeMs < static_cast<uint32>(ConfigServerGame::getShipUpdateUnchangedResendMs());
+		}
+
+		void setSent(uint32 state, uint32 timeMs)
+		{
+			m_lastSentState = state;
+			m_lastSentTimeMs = timeMs;
+		}
+
 	private:
 		ClientShipEntry();
 
 	private:
 		unsigned int m_priority;
 		CachedNetworkId m_ship;
+		uint32 m_lastSentState;
+		uint32 m_lastSentTimeMs;
 	};
 
 	// ----------------------------------------------------------------------
@@ -86,7 +126,9 @@ namespace ShipClientUpdateTrackerNamespace
 			queuedShipIds(),
 			updateQueue(),
 			unusedTime(0.0f),
-			lastSentPriority(0)
+			lastSentPriority(0),
+			byteTokens(static_cast<float>(cs_shipUpdateBytes)),
+			windowBytes(0)
 		{
 		}
 
@@ -115,13 +157,28 @@ namespace ShipClientUpdateTrackerNamespace
 		ClientShipUpdateQueue updateQueue;
 		float unusedTime;
 		unsigned int lastSentPriority;
+		float byteTokens;
+		int windowBytes;
 	};
 
 	typedef std::map<Client *, ClientShipUpdateInfo> ClientShipUpdateInfoMap;
+	typedef std::map<ShipObject const *, uint32> ShipStateMap;
 
 	bool s_installed = false;
 	ClientShipUpdateInfoMap s_clientShipUpdateInfoMap;
 
+	// quantized ship states computed this frame
+	ShipStateMap s_shipStates;
+
+	// counts for the current statistics window
+	float s_windowTime = 0.f;
+	int s_windowBytes = 0;
+	int s_windowUpdates = 0;
+	int s_windowUnchangedUpdates = 0;
+	int s_windowThrottledClients = 0;
+
+	ShipClientUpdateTracker::Statistics s_statistics;
+
 	// ----------------------------------------------------------------------
 
 	bool compareClientShipEntryPriorities(ClientShipEntry const *lhs, ClientShipEntry const *rhs)
@@ -131,6 +188,98 @@ namespace ShipClientUpdateTrackerNamespace
 
 	// ----------------------------------------------------------------------
 
+	/**
+	 * The rate a client's byte budget refills at.
+	 *
+	 * The configured rate is scaled down for clients reporting lag to their
+	 * connection server, and for everyone behind a connection server link
+	 * that has more bytes waiting than its congestion window will pass.
+	 *
+	 * @return Bytes per second, or 0 if there is no byte budget
+	 */
+	float getClientBytesPerSecond(Client const &client)
+	{
+		int const bytesPerSecond = ConfigServerGame::getShipUpdateBytesPerSecond();
+		if (bytesPerSecond <= 0)
+			return 0.f;
+
+		float scale = 1.f;
+
+		int const lagThresholdMs = ConfigServerGame::getShipUpdateLagThresholdMs();
+		int const lagMs = client.getConnectionServerLag();
+		if (lagThresholdMs > 0 && lagMs > lagThresholdMs)
+			scale = static_cast<float>(lagThresholdMs)/static_cast<float>(lagMs);
+
+		ConnectionServerConnection const * const connection = const_cast<Client &>(client).getConnection();
+		if (connection)
+		{
+			int const congestionWindowSize = connection->getCongestionWindowSize();
+			int const pendingBytes = connection->getPendingBytes();
+			if (congestionWindowSize > 0 && pendingBytes > congestionWindowSize)
+				scale = std::min(scale, static_cast<float>(congestionWindowSize)/static_cast<float>(pendingBytes));
+		}
+
+		return static_cast<float>(bytesPerSecond)*std::max(scale, cs_minimumBudgetScale);
+	}
+
+	// ----------------------------------------------------------------------
+
+	/**
+	 * A checksum of the ship's transform and motion as they would be packed
+	 * into an update, computed once per frame.
+	 */
+	uint32 getShipState(ShipObject const &ship)
+	{
+		std::pair<ShipStateMap::iterator, bool> const result = s_shipStates.insert(ShipStateMap::value_type(&ship, 0));
+		if (result.second)
+		{
+			ShipController const * const controller = safe_cast<ShipController const *>(ship.getController());
+
+			static Archive::ByteStream bs;
+			bs.clear();
+			Archive::put(bs, PackedTransform(controller->getTransform()));
+			Archive::put(bs, PackedVelocity(controller->getVelocity()));
+			Archive::put(bs, PackedRotationRate(controller->getYawRate()));
+			Archive::put(bs, PackedRotationRate(controller->getPitchRate()));
+			Archive::put(bs, PackedRotationRate(controller->getRollRate()));
+
+			result.first->second = Crc::calculate(bs.getBuffer(), static_cast<int>(bs.getSize()));
+		}
+		return result.first->second;
+	}
+
+	// ----------------------------------------------------------------------
+
+	void updateStatistics(float elapsedTime)
+	{
+		s_windowTime += elapsedTime;
+		if (s_windowTime < 1.f)
+			return;
+
+		int const clientCount = static_cast<int>(s_clientShipUpdateInfoMap.size());
+		int maxBytes = 0;
+		for (ClientShipUpdateInfoMap::iterator i = s_clientShipUpdateInfoMap.begin(); i != s_clientShipUpdateInfoMap.end(); ++i)
+		{
+			maxBytes = std::max(maxBytes, (*i).second.windowBytes);
+			(*i).second.windowBytes = 0;
+		}
+
+		s_statistics.clients = clientCount;
+		s_statistics.bytesPerClientPerSecond = clientCount ? static_cast<int>(static_cast<float>(s_windowBytes)/(s_windowTime*static_cast<float>(clientCount))) : 0;
+		s_statistics.maxBytesPerClientPerSecond = static_cast<int>(static_cast<float>(maxBytes)/s_windowTime);
+		s_statistics.updatesPerSecond = static_cast<int>(static_cast<float>(s_windowUpdates)/s_windowTime);
+		s_statistics.unchangedUpdatesPerSecond = static_cast<int>(static_cast<float>(s_windowUnchangedUpdates)/s_windowTime);
+		s_statistics.throttledClientsPerSecond = static_cast<int>(static_cast<float>(s_windowThrottledClients)/s_windowTime);
+
+		s_windowTime = 0.f;
+		s_windowBytes = 0;
+		s_windowUpdates = 0;
+		s_windowUnchangedUpdates = 0;
+		s_windowThrottledClients = 0;
+	}
+
+	// ----------------------------------------------------------------------
+
 	void remove()
 	{
 		FATAL(!s_installed, ("ShipClientUpdateTracker not installed"));
@@ -160,6 +309,9 @@ void ShipClientUpdateTracker::update(float elapsedTime) // static
 	typedef std::map<ConnectionServerConnection *, std::map<ShipObject *, std::vector<NetworkId> > > ShipDistributionList;
 	ShipDistributionList shipDistributionList;
 
+	s_shipStates.clear();
+	uint32 const timeMs = Clock::timeMs();
+
 	// Run through all clients, gathering where updates need to be sent this frame.
 	ClientShipUpdateInfoMap::iterator i = s_clientShipUpdateInfoMap.begin();
 	while (i != s_clientShipUpdateInfoMap.end())
@@ -179,8 +331,25 @@ void ShipClientUpdateTracker::update(float elapsedTime) // static
 		int updateCount = static_cast<int>(updatesPerSecond*deltaTime);
 		updateInfo.unusedTime = deltaTime-static_cast<float>(updateCount)/updatesPerSecond;
 
+		// Updates are also limited by a byte budget for the client, which
+		// refills at a rate following the client's connection.  Ships left
+		// in the queue keep their place, so the ones passed over go first
+		// once the budget allows.
+		float const bytesPerSecond = getClientBytesPerSecond(*client);
+		if (bytesPerSecond > 0.f)
+		{
+			float const capacity = std::max(bytesPerSecond*ConfigServerGame::getShipUpdateBurstSeconds(), static_cast<float>(cs_shipUpdateBytes));
+			updateInfo.byteTokens = std::min(updateInfo.byteTokens+bytesPerSecond*elapsedTime, capacity);
+		}
+
 		while (updateCount && !updateQueue.empty())
 		{
+			if (bytesPerSecond > 0.f && updateInfo.byteTokens < static_cast<float>(cs_shipUpdateBytes))
+			{
+				++s_windowThrottledClients;
+				break;
+			}
+
 			--updateCount;
 
 			ClientShipEntry * const top = updateQueue.front();
@@ -217,7 +386,27 @@ void ShipClientUpdateTracker::update(float elapsedTime) // static
 						// Don't send position updates to players in ships that are teleporting
 						ShipObject const * const clientShip = ShipObject::getContainingShipObject(characterObject);
 						if (!clientShip || !safe_cast<PlayerShipController const *>(clientShip->getController())->isTeleporting() || !clientShip->getPilot())
-							shipDistributionList[client->getConnection()][ship].push_back(characterObject->getNetworkId());
+						{
+							// Updates are sent unreliably, so an unchanged state is
+							// still resent now and then in case the last one was lost.
+							// A skipped update doesn't count against the client.
+							uint32 const state = getShipState(*ship);
+							if (top->wasSent(state, timeMs))
+							{
+								++updateCount;
+								++s_windowUnchangedUpdates;
+							}
+							else
+							{
+								shipDistributionList[client->getConnection()][ship].push_back(characterObject->getNetworkId());
+								top->setSent(state, timeMs);
+
+								updateInfo.byteTokens -= static_cast<float>(cs_shipUpdateBytes);
+								updateInfo.windowBytes += cs_shipUpdateBytes;
+								s_windowBytes += cs_shipUpdateBytes;
+								++s_windowUpdates;
+							}
+						}
 					}
 				}
 				reenqueues.push_back(top);
@@ -245,6 +434,8 @@ void ShipClientUpdateTracker::update(float elapsedTime) // static
 			++i;
 	}
 
+	updateStatistics(elapsedTime);
+
 	// Push out updates now that we've determined what needs to be pushed this frame.
 
 	// The first implementation of this is here to show what we are logically
@@ -270,15 +461,7 @@ void ShipClientUpdateTracker::update(float elapsedTime) // static
 
 			static ConstCharCrcString const s_gcmname("GameClientMessage");
 			static ConstCharCrcString const s_sutmname("ShipUpdateTransformMessage");
-			static unsigned int const s_sutmByteStreamLength =
-				  2 // member count
-				+ 4 // crc
-				+ 2 // shipId
-				+ PackedTransform::cs_packedSize
-				+ PackedVelocity::cs_packedSize
-				+ PackedRotationRate::cs_packedSize*3
-				+ 4 // syncstamp
-				;
+			static unsigned int const s_sutmByteStreamLength = static_cast<unsigned int>(cs_shipUpdateBytes);
 
 			Archive::put(bs, static_cast<unsigned short>(4/*gcmMemberCount*/));
 			Archive::put(bs, s_gcmname.getCrc());
@@ -347,10 +530,26 @@ unsigned int ShipClientUpdateTracker::getShipUpdatePriorityValue(Client const &c
 		float const distance = shipOffset.magnitude();
 		float const angle = acosf(clientTopmost->getObjectFrameK_p().dot(shipOffset/distance));
 		float const anglePriorityAdjust = 1.f+((clamp(PI_OVER_4, angle, PI)-PI_OVER_4)/(PI-PI_OVER_4))*4.f; // 1 when roughly in view frustum, up to 5 directly behind
-		return static_cast<unsigned int>(clamp(100.f, distance, 8192.f)*anglePriorityAdjust);
+
+		// Ships moving quickly relative to the client drift further from where
+		// the client predicts them between updates, so they are updated more often
+		Vector relativeVelocity = ship.getCurrentVelocity_p();
+		ShipObject const * const clientShip = ShipObject::getContainingShipObject(characterObject);
+		if (clientShip)
+			relativeVelocity -= clientShip->getCurrentVelocity_p();
+		float const velocityPriorityAdjust = 1.f+relativeVelocity.magnitude()/cs_relativeSpeedPriorityScale;
+
+		return static_cast<unsigned int>(std::max(100.f, clamp(100.f, distance, 8192.f)*anglePriorityAdjust/velocityPriorityAdjust));
 	}
 	return 100;
 }
 
+// ----------------------------------------------------------------------
+
+ShipClientUpdateTracker::Statistics const &ShipClientUpdateTracker::getStatistics() // static
+{
+	return s_statistics;
+}
+
 // ======================================================================
 
@@ -18,12 +18,35 @@ class ShipObject;
 
 class ShipClientUpdateTracker
 {
+public:
+	// Averaged over the last second
+	struct Statistics
+	{
+		Statistics() :
+			clients(0),
+			bytesPerClientPerSecond(0),
+			maxBytesPerClientPerSecond(0),
+			updatesPerSecond(0),
+			unchangedUpdatesPerSecond(0),
+			throttledClientsPerSecond(0)
+		{
+		}
+
+		int clients;
+		int bytesPerClientPerSecond;
+		int maxBytesPerClientPerSecond;
+		int updatesPerSecond;
+		int unchangedUpdatesPerSecond; // skipped because the client already had that state
+		int throttledClientsPerSecond; // clients held back by their byte budget, per frame
+	};
+
 public:
 	static void install();
 	static void update(float elapsedTime);
 	static void queueForUpdate(Client &client, ShipObject const &ship);
 	static void onClientDestroyed(Client &client);
 	static unsigned int getShipUpdatePriorityValue(Client const &client, ShipObject const &ship);
+	static Statistics const &getStatistics();
 };
 
 // ======================================================================
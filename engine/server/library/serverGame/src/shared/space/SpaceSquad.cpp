@@ -92,6 +92,18 @@ void SpaceSquad::remove()
 	s_formationPriorityList.clear();
 }
 
+// ----------------------------------------------------------------------
+float SpaceSquad::getFlockingSeperationGain()
+{
+	return s_flockingSeperationGain;
+}
+
+// ----------------------------------------------------------------------
+float SpaceSquad::getFlockingComfortDistanceGain()
+{
+	return s_flockingComfortDistanceGain;
+}
+
 // ----------------------------------------------------------------------
 SpaceSquad::SpaceSquad()
  : Squad()
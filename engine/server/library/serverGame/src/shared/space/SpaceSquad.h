@@ -29,6 +29,9 @@ public:
 
 	static void install();
 
+	static float getFlockingSeperationGain();
+	static float getFlockingComfortDistanceGain();
+
 public:
 
 	virtual char const * getClassName() const;
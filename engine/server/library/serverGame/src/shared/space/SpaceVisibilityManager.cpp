@@ -12,10 +12,12 @@
 #include "serverGame/ObserveTracker.h"
 #include "serverGame/ServerObject.h"
 #include "serverGame/VisibleObjectNotification.h"
+#include "sharedDebug/PerformanceTimer.h"
 #include "sharedDebug/Profiler.h"
 #include "sharedObject/NetworkIdManager.h"
 
 #include <algorithm>
+#include <set>
 #include <unordered_map>
 
 // ======================================================================
@@ -34,10 +36,15 @@ namespace SpaceVisibilityManager_namespace
 	class TrackedObject;
 	class Node;
 
-	typedef std::set<Client*>                            ClientSet;
-	typedef std::set<TrackedObject*>                     ObjectSet;
-	typedef std::map<Client*, TrackedObject*>            ClientToObjectMapType;
+	// Node and client membership is kept in sorted vectors rather than sets:
+	// nodes are walked and differenced far more often than they change, and
+	// the sorted arrays keep each node's members contiguous.
+
+	typedef std::vector<Client*>                         ClientSet;
+	typedef std::vector<TrackedObject*>                  ObjectSet;
+	typedef std::unordered_map<Client*, TrackedObject*>  ClientToObjectMapType;
 	typedef std::unordered_map<NetworkId, TrackedObject*>     TrackedObjectsType;
+	typedef std::vector<ServerObject*>                   ServerObjectList;
 
 	// Classes
 
@@ -69,7 +76,9 @@ namespace SpaceVisibilityManager_namespace
 
 		void                    addClient                 (Client &newClient);
 		void                    allClientsObserveObject   (ServerObject &newObject) const;
+		void                    allClientsObserveObjects  (ServerObjectList const &newObjects) const;
 		void                    allClientsUnobserveObject (ServerObject &object) const;
+		void                    allClientsUnobserveObjects(ServerObjectList const &objects) const;
 		const NodeId &          getCurrentLocation        () const;
 		Node &                  getCurrentNode            () const;
 		const CachedNetworkId & getNetworkId              () const;
@@ -102,6 +111,7 @@ namespace SpaceVisibilityManager_namespace
 		void removeVisibleObject            (TrackedObject &newObject);
 		void getVisibleObjectDifference     (const Node &otherNode, std::vector<TrackedObject*> & lostObjects, std::vector<TrackedObject*> & gainedObjects) const;
 		ObjectSet const &getObservingObjects() const;
+		ObjectSet const &getVisibleObjects  () const;
 		
 	private:
 		ObjectSet   m_visibleObjects;
@@ -113,6 +123,11 @@ namespace SpaceVisibilityManager_namespace
 
 	// Functions
 
+	template <typename T>
+	bool            insertSorted            (std::vector<T*> &list, T *value);
+	template <typename T>
+	bool            eraseSorted             (std::vector<T*> &list, T *value);
+
 	void            addToNodesInRange       (TrackedObject &object, const NodeId &location, int range);
 	void            addToNodesInVolume      (TrackedObject & object, int minX, int maxX, int minY, int maxY, int minZ, int maxZ);
 	int             coordinateToNodeIndex   (float coordinate);
@@ -135,6 +150,42 @@ using namespace SpaceVisibilityManager_namespace;
 
 // ======================================================================
 
+/**
+ * Insert a value into a sorted list.
+ *
+ * @return false if the value was already in the list
+ */
+template <typename T>
+bool SpaceVisibilityManager_namespace::insertSorted(std::vector<T*> &list, T *value)
+{
+	typename std::vector<T*>::iterator const i = std::lower_bound(list.begin(), list.end(), value);
+	if (i != list.end() && *i == value)
+		return false;
+
+	IGNORE_RETURN(list.insert(i, value));
+	return true;
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Remove a value from a sorted list.
+ *
+ * @return false if the value was not in the list
+ */
+template <typename T>
+bool SpaceVisibilityManager_namespace::eraseSorted(std::vector<T*> &list, T *value)
+{
+	typename std::vector<T*>::iterator const i = std::lower_bound(list.begin(), list.end(), value);
+	if (i == list.end() || *i != value)
+		return false;
+
+	IGNORE_RETURN(list.erase(i));
+	return true;
+}
+
+// ======================================================================
+
 void SpaceVisibilityManager::addClient(Client & client, ServerObject & observingObject)
 {
 	PROFILER_AUTO_BLOCK_DEFINE("SpaceVisibilityManager::addClient");
@@ -413,6 +464,98 @@ void SpaceVisibilityManager::getClientsInRange(Vector const &location, float rad
 	}
 }
 
+// ----------------------------------------------------------------------
+
+/**
+ * Time the lost and gained objects each tracked object would see on moving
+ * one node along x, from the nodes' sorted arrays and from std::set copies
+ * of them, as the nodes used to keep.  Nothing is moved or observed.
+ *
+ * @return the number of moves whose two differences disagreed
+ */
+int SpaceVisibilityManager::benchmarkNodeDifferences(int passes, int &objectCount, float &arrayTime, float &setTime)
+{
+	typedef std::set<TrackedObject*> TrackedObjectSet;
+	typedef std::pair<Node const *, Node const *> NodePair;
+
+	std::vector<NodePair> moves;
+	moves.reserve(ms_trackedObjects.size());
+
+	for (TrackedObjectsType::const_iterator i = ms_trackedObjects.begin(); i != ms_trackedObjects.end(); ++i)
+	{
+		if (!i->second)
+			continue;
+
+		NodeId const & location = i->second->getCurrentLocation();
+		int const x = location.m_x < ms_maxNodeIndex ? location.m_x + 1 : location.m_x - 1;
+		moves.push_back(NodePair(&getNode(location), &getNode(NodeId(x, location.m_y, location.m_z))));
+	}
+
+	objectCount = static_cast<int>(moves.size());
+
+	std::unordered_map<Node const *, TrackedObjectSet> nodeSets;
+	for (std::vector<NodePair>::const_iterator i = moves.begin(); i != moves.end(); ++i)
+	{
+		ObjectSet const & from = i->first->getVisibleObjects();
+		ObjectSet const & to = i->second->getVisibleObjects();
+		nodeSets[i->first].insert(from.begin(), from.end());
+		nodeSets[i->second].insert(to.begin(), to.end());
+	}
+
+	std::vector<TrackedObject*> lostObjects;
+	std::vector<TrackedObject*> gainedObjects;
+	std::vector<TrackedObject*> setLostObjects;
+	std::vector<TrackedObject*> setGainedObjects;
+	int mismatches = 0;
+
+	for (std::vector<NodePair>::const_iterator i = moves.begin(); i != moves.end(); ++i)
+	{
+		TrackedObjectSet const & from = nodeSets[i->first];
+		TrackedObjectSet const & to = nodeSets[i->second];
+		lostObjects.clear();
+		gainedObjects.clear();
+		setLostObjects.clear();
+		setGainedObjects.clear();
+		i->second->getVisibleObjectDifference(*i->first, lostObjects, gainedObjects);
+		IGNORE_RETURN(std::set_difference(from.begin(), from.end(), to.begin(), to.end(), std::back_insert_iterator<std::vector<TrackedObject*> >(setLostObjects)));
+		IGNORE_RETURN(std::set_difference(to.begin(), to.end(), from.begin(), from.end(), std::back_insert_iterator<std::vector<TrackedObject*> >(setGainedObjects)));
+		if (lostObjects != setLostObjects || gainedObjects != setGainedObjects)
+			++mismatches;
+	}
+
+	PerformanceTimer timer;
+	timer.start();
+	for (int pass = 0; pass < passes; ++pass)
+	{
+		for (std::vector<NodePair>::const_iterator i = moves.begin(); i != moves.end(); ++i)
+		{
+			lostObjects.clear();
+			gainedObjects.clear();
+			i->second->getVisibleObjectDifference(*i->first, lostObjects, gainedObjects);
+		}
+	}
+	timer.stop();
+	arrayTime = timer.getElapsedTime();
+
+	timer.start();
+	for (int pass = 0; pass < passes; ++pass)
+	{
+		for (std::vector<NodePair>::const_iterator i = moves.begin(); i != moves.end(); ++i)
+		{
+			TrackedObjectSet const & from = nodeSets[i->first];
+			TrackedObjectSet const & to = nodeSets[i->second];
+			lostObjects.clear();
+			gainedObjects.clear();
+			IGNORE_RETURN(std::set_difference(from.begin(), from.end(), to.begin(), to.end(), std::back_insert_iterator<std::vector<TrackedObject*> >(lostObjects)));
+			IGNORE_RETURN(std::set_difference(to.begin(), to.end(), from.begin(), from.end(), std::back_insert_iterator<std::vector<TrackedObject*> >(gainedObjects)));
+		}
+	}
+	timer.stop();
+	setTime = timer.getElapsedTime();
+
+	return mismatches;
+}
+
 // ======================================================================
 
 Node::Node() :
@@ -425,8 +568,8 @@ Node::Node() :
 
 void Node::addVisibleObject(TrackedObject &newObject)
 {
-	std::pair<ObjectSet::iterator, bool> result = m_visibleObjects.insert(&newObject);
-	DEBUG_FATAL(!result.second,("Called Node::addVisibleObject(%s), but the object was already in the node.",newObject.getNetworkId().getValueString().c_str()));
+	bool const result = insertSorted(m_visibleObjects, &newObject);
+	DEBUG_FATAL(!result,("Called Node::addVisibleObject(%s), but the object was already in the node.",newObject.getNetworkId().getValueString().c_str()));
 	UNREF(result);
 
 	ServerObject &asServerObject = newObject.getServerObject();
@@ -458,9 +601,9 @@ void Node::getAllVisibleObjects(std::vector<ServerObject*> & results) const
 
 void Node::removeVisibleObject(TrackedObject &object)
 {
-	size_t result = m_visibleObjects.erase(&object);
+	bool const result = eraseSorted(m_visibleObjects, &object);
 	UNREF(result);  // for release mode
-	DEBUG_FATAL(result != 1,("Programmer bug:  Node::removeVisibleObject(%s) called on an object that was not in the list",object.getNetworkId().getValueString().c_str()));
+	DEBUG_FATAL(!result,("Programmer bug:  Node::removeVisibleObject(%s) called on an object that was not in the list",object.getNetworkId().getValueString().c_str()));
 
 	ServerObject &asServerObject = object.getServerObject();
 
@@ -479,14 +622,16 @@ void Node::removeVisibleObject(TrackedObject &object)
 void Node::addObservingObject (TrackedObject & newObject, bool observeNow)
 {
 	DEBUG_FATAL(!newObject.hasClients(),("Programmer bug:  called Node::addObservingObject(%s) with an object that did not have any clients attached.",newObject.getNetworkId().getValueString().c_str()));
-	std::pair<ObjectSet::iterator, bool> result = m_observingObjects.insert(&newObject);
+	bool const result = insertSorted(m_observingObjects, &newObject);
 	UNREF(result);
-	DEBUG_REPORT_LOG(ConfigServerGame::getDebugSpaceVisibilityManager() && !result.second,("Called Node::addObservingObject(%s), but it was already on the list\n",newObject.getNetworkId().getValueString().c_str()));
+	DEBUG_REPORT_LOG(ConfigServerGame::getDebugSpaceVisibilityManager() && !result,("Called Node::addObservingObject(%s), but it was already on the list\n",newObject.getNetworkId().getValueString().c_str()));
 
 	if (observeNow)
 	{
-		for (ObjectSet::iterator j=m_visibleObjects.begin(); j!=m_visibleObjects.end(); ++j)
-			newObject.allClientsObserveObject((*j)->getServerObject());
+		static ServerObjectList visibleObjects;
+		visibleObjects.clear();
+		getAllVisibleObjects(visibleObjects);
+		newObject.allClientsObserveObjects(visibleObjects);
 	}
 } //lint !e1764 parameter can't really be made const, but lint thinks it can
 
@@ -499,9 +644,9 @@ void Node::addObservingObject (TrackedObject & newObject, bool observeNow)
  */
 void Node::removeObservingObject (TrackedObject & oldObject)
 {
-	size_t result=m_observingObjects.erase(&oldObject);
+	bool const result=eraseSorted(m_observingObjects, &oldObject);
 	UNREF(result); // for release mode
-	DEBUG_FATAL(result!=1,("Programmer bug:  removeObservingObject called on an object that was not in the observing list on the node"));
+	DEBUG_FATAL(!result,("Programmer bug:  removeObservingObject called on an object that was not in the observing list on the node"));
 } //lint !e1764 parameter can't really be made const, but lint thinks it can
 
 // ----------------------------------------------------------------------
@@ -528,6 +673,13 @@ ObjectSet const &Node::getObservingObjects() const
 	return m_observingObjects;
 }
 
+// ----------------------------------------------------------------------
+
+ObjectSet const &Node::getVisibleObjects() const
+{
+	return m_visibleObjects;
+}
+
 // ======================================================================
 
 TrackedObject::TrackedObject(const ServerObject &object, int updateRadius) :
@@ -581,7 +733,7 @@ void TrackedObject::addClient(Client &newClient)
 {
 	if (!m_clients)
 		m_clients=new ClientSet;
-	IGNORE_RETURN(m_clients->insert(&newClient));
+	IGNORE_RETURN(insertSorted(*m_clients, &newClient));
 } //lint !e1764 (newClient can't really be made const)
 
 // ----------------------------------------------------------------------
@@ -590,7 +742,7 @@ void TrackedObject::removeClient(Client &client)
 {
 	if (m_clients)
 	{
-		IGNORE_RETURN(m_clients->erase(&client));
+		IGNORE_RETURN(eraseSorted(*m_clients, &client));
 		if (m_clients->empty())
 		{
 			delete m_clients;
@@ -621,6 +773,24 @@ void TrackedObject::allClientsObserveObject(ServerObject &newObject) const
 
 // ----------------------------------------------------------------------
 
+/**
+ * Tell all clients watching this object about several new objects they
+ * should observe.
+ */
+void TrackedObject::allClientsObserveObjects(ServerObjectList const &newObjects) const
+{
+	if (m_clients && !newObjects.empty())
+	{
+		for (ClientSet::iterator j=m_clients->begin(); j!=m_clients->end(); ++j)
+		{
+			NOT_NULL(*j);
+			ObserveTracker::onClientAddedVisibleObjectsSpace(**j, newObjects);
+		}
+	}
+}
+
+// ----------------------------------------------------------------------
+
 /**
  * Tell all clients watching this object that an object should not longer
  * be observed
@@ -639,6 +809,24 @@ void TrackedObject::allClientsUnobserveObject(ServerObject &object) const
 
 // ----------------------------------------------------------------------
 
+/**
+ * Tell all clients watching this object that several objects should no
+ * longer be observed
+ */
+void TrackedObject::allClientsUnobserveObjects(ServerObjectList const &objects) const
+{
+	if (m_clients && !objects.empty())
+	{
+		for (ClientSet::iterator j=m_clients->begin(); j!=m_clients->end(); ++j)
+		{
+			NOT_NULL(*j);
+			ObserveTracker::onClientLostVisibleObjectsSpace(**j, objects);
+		}
+	}
+}
+
+// ----------------------------------------------------------------------
+
 Node & TrackedObject::getCurrentNode() const
 {
 	return getNode(m_currentLocation);
@@ -768,6 +956,7 @@ void TrackedObject::moveTo(const NodeId &newLocation)
 
 			static std::vector<TrackedObject*> lostObjects;
 			static std::vector<TrackedObject*> gainedObjects;
+			static ServerObjectList changedObjects;
 			lostObjects.clear();
 			gainedObjects.clear();
 
@@ -776,15 +965,19 @@ void TrackedObject::moveTo(const NodeId &newLocation)
 			newNode.getVisibleObjectDifference(oldNode, lostObjects, gainedObjects);
 
 			{
+				changedObjects.clear();
 				for (std::vector<TrackedObject*>::const_iterator i = lostObjects.begin(); i != lostObjects.end(); ++i)
 					if (*i != this)
-						allClientsUnobserveObject((*i)->getServerObject());
+						changedObjects.push_back(&(*i)->getServerObject());
+				allClientsUnobserveObjects(changedObjects);
 			}
 				
 			{
+				changedObjects.clear();
 				for (std::vector<TrackedObject*>::const_iterator i = gainedObjects.begin(); i != gainedObjects.end(); ++i)
 					if (*i != this)
-						allClientsObserveObject((*i)->getServerObject());
+						changedObjects.push_back(&(*i)->getServerObject());
+				allClientsObserveObjects(changedObjects);
 			}
 		}
 	}
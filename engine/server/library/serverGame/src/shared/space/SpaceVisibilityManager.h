@@ -28,6 +28,8 @@ class SpaceVisibilityManager
 
 	static void getObjectsVisibleFromLocation (const Vector & location, std::vector<ServerObject*> &results);
 	static void getClientsInRange (const Vector &location, float radius, std::set<Client*> &results);
+
+	static int  benchmarkNodeDifferences (int passes, int &objectCount, float &arrayTime, float &setTime);
 };
 
 
@@ -189,19 +189,20 @@ jint JNICALL ScriptMethodsDataTableNamespace::dataTableGetInt(JNIEnv *env, jobje
 		DEBUG_WARNING(true, ("JavaLibaray::dataTableGetInt [%s] - Invalid row %d of table %s.", dt->getName().c_str(), row, tableNameString.c_str()));
 		return 0;
 	}
-	if (!dt->doesColumnExist(columnNameString))
+	int const columnNumber = dt->findColumnNumber(columnNameString);
+	if (columnNumber < 0)
 	{
 		DEBUG_WARNING(true, ("JavaLibrary::dataTableGetInt [%s] - Invalid column name <%s> of table %s.", dt->getName().c_str(), columnNameString.c_str(), tableNameString.c_str()));
 		return 0;
 	}
 
-	if (dt->getDataTypeForColumn(columnNameString).getBasicType() != DataTableColumnType::DT_Int)
+	if (dt->getDataTypeForColumn(columnNumber).getBasicType() != DataTableColumnType::DT_Int)
 	{
 		DEBUG_WARNING(true, ("JavaLibrary::dataTableGetInt [%s] - Invalid type (not an int), column <%s> of table %s.", dt->getName().c_str(), columnNameString.c_str(), tableNameString.c_str()));
 		return 0;
 	}
 
-	return dt->getIntValue(columnNameString, row);
+	return dt->getIntValue(columnNumber, row);
 }
 
 //------------------------------------------------------------------------
@@ -240,19 +241,20 @@ jfloat JNICALL ScriptMethodsDataTableNamespace::dataTableGetFloat(JNIEnv *env, j
 		DEBUG_WARNING(true, ("JavaLibaray::dataTableGetFloat [%s] - Invalid row %d of table %s.", dt->getName().c_str(), row, tableNameString.c_str()));
 		return 0;
 	}
-	if (!dt->doesColumnExist(columnNameString))
+	int const columnNumber = dt->findColumnNumber(columnNameString);
+	if (columnNumber < 0)
 	{
 		DEBUG_WARNING(true, ("JavaLibrary::dataTableGetFloat [%s] - Invalid column name <%s> of table %s.", dt->getName().c_str(), columnNameString.c_str(), tableNameString.c_str()));
 		return 0;
 	}
 
-	if (dt->getDataTypeForColumn(columnNameString).getBasicType() != DataTableColumnType::DT_Float)
+	if (dt->getDataTypeForColumn(columnNumber).getBasicType() != DataTableColumnType::DT_Float)
 	{
 		DEBUG_WARNING(true, ("JavaLibrary::dataTableGetFloat [%s] - Invalid type (not a float), column <%s> of table %s.", dt->getName().c_str(), columnNameString.c_str(), tableNameString.c_str()));
 		return 0;
 	}
 
-	return dt->getFloatValue(columnNameString, row);
+	return dt->getFloatValue(columnNumber, row);
 }
 
 //------------------------------------------------------------------------
@@ -291,19 +293,20 @@ jstring JNICALL ScriptMethodsDataTableNamespace::dataTableGetString(JNIEnv *env,
 		DEBUG_WARNING(true, ("JavaLibaray::dataTableGetString [%s] - Invalid row %d of table %s.", dt->getName().c_str(), row, tableNameString.c_str()));
 		return 0;
 	}
-	if (!dt->doesColumnExist(columnNameString))
+	int const columnNumber = dt->findColumnNumber(columnNameString);
+	if (columnNumber < 0)
 	{
 		DEBUG_WARNING(true, ("JavaLibrary::dataTableGetString [%s] - Invalid column name <%s> of table %s.", dt->getName().c_str(), columnNameString.c_str(), tableNameString.c_str()));
 		return 0;
 	}
 
-	if (dt->getDataTypeForColumn(columnNameString).getBasicType() != DataTableColumnType::DT_String)
+	if (dt->getDataTypeForColumn(columnNumber).getBasicType() != DataTableColumnType::DT_String)
 	{
 		DEBUG_WARNING(true, ("JavaLibrary::dataTableGetString [%s] - Invalid type (not a string), column <%s> of table %s.", dt->getName().c_str(), columnNameString.c_str(), tableNameString.c_str()));
 		return 0;
 	}
 
-	JavaString javaString(dt->getStringValue(columnNameString, row));
+	JavaString javaString(dt->getStringValue(columnNumber, row));
 	return javaString.getReturnValue();
 }
 
@@ -1622,7 +1622,7 @@ jboolean JNICALL ScriptMethodsObjectCreateNamespace::createRemoteTheaterDatatabl
 	// create the spawner
 	Transform tr;
 	tr.setPosition_p(location);
-	ServerObject * spawner = ServerWorld::createNewObject("object/tangible/spawning/remote_theater_spawner.iff", tr, 0, false);
+	ServerObject * spawner = ServerWorld::createNewObject(constcrc("object/tangible/spawning/remote_theater_spawner.iff"), tr, 0, false);
 	if (spawner == nullptr)
 	{
 		WARNING(true, ("JavaLibrary::createRemoteTheaterDatatable unable to "
@@ -1745,7 +1745,7 @@ jboolean JNICALL ScriptMethodsObjectCreateNamespace::createRemoteTheaterDatatabl
 	// create the spawner
 	Transform tr;
 	tr.setPosition_p(theaterCenter);
-	ServerObject * spawner = ServerWorld::createNewObject("object/tangible/spawning/remote_theater_spawner.iff", tr, 0, false);
+	ServerObject * spawner = ServerWorld::createNewObject(constcrc("object/tangible/spawning/remote_theater_spawner.iff"), tr, 0, false);
 	if (spawner == nullptr)
 	{
 		WARNING(true, ("JavaLibrary::createRemoteTheaterDatatable unable to "
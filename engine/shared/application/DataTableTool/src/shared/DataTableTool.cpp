@@ -49,6 +49,7 @@ static const char * const LNAME_INPUT_FILE           = "inputFile";
 static const char * const LNAME_OUTPUT_FILE          = "outputFile";
 static const char * const LNAME_TEST                 = "test";
 static const char * const LNAME_CLIENT               = "client";
+static const char * const LNAME_SERVER_FORMAT        = "serverFormat";
 //static const char * const LNAME_P4EDIT               = "edit"; deprecated
 //static const char * const LNAME_P4ADD                = "add"; deprecated
 static const char         SNAME_HELP                 = 'h';
@@ -58,6 +59,7 @@ static const char         SNAME_TEST                 = 't';
 //static const char       SNAME_P4EDIT               = 'e'; deprecated
 //static const char       SNAME_P4ADD                = 'a'; deprecated
 static const char         SNAME_CLIENT               = 'c';
+static const char         SNAME_SERVER_FORMAT        = 's';
 
 static CommandLine::OptionSpec optionSpecArray[] =
 {
@@ -84,6 +86,9 @@ static CommandLine::OptionSpec optionSpecArray[] =
                 // and automatically add shared datatables to your client once they have been compiled
                 OP_SINGLE_LIST_NODE(SNAME_CLIENT, LNAME_CLIENT, OP_ARG_NONE, OP_MULTIPLE_DENIED, OP_NODE_OPTIONAL),
 
+				// write sys.server tables in the faster loading server-only format (optional)
+				OP_SINGLE_LIST_NODE(SNAME_SERVER_FORMAT, LNAME_SERVER_FORMAT, OP_ARG_NONE, OP_MULTIPLE_DENIED, OP_NODE_OPTIONAL),
+
 				// perforce operations (deprecated)
 				//OP_SINGLE_LIST_NODE(SNAME_P4ADD, LNAME_P4ADD, OP_ARG_NONE, OP_MULTIPLE_DENIED, OP_NODE_OPTIONAL),
 				//OP_SINGLE_LIST_NODE(SNAME_P4EDIT, LNAME_P4EDIT, OP_ARG_NONE, OP_MULTIPLE_DENIED, OP_NODE_OPTIONAL),
@@ -168,6 +173,8 @@ void DataTableTool::run(void)
 		doClientOutput = true;
 	}
 
+	bool const serverFormat = CommandLine::getOccurrenceCount(SNAME_SERVER_FORMAT) != 0;
+
 	m_inputFile = CommandLine::getOptionString(SNAME_INPUT_FILE);
 
 	//isXml = DataTableWriter::isXmlFile(m_inputFile.c_str());
@@ -197,6 +204,7 @@ void DataTableTool::run(void)
 			printf("ERROR: The output file is not available for writing: %s\n\n", m_outputFile.c_str());
 		}
 
+		dl.setServerFormat(serverFormat && isServerOnlyTable(m_outputFile));
 		bool success = dl.save( m_outputFile.c_str() );
 
 		printf("%s creating data table: %s\n", success ? "SUCCESS" : "FAILURE", m_outputFile.c_str());
@@ -226,6 +234,7 @@ void DataTableTool::run(void)
 				continue;
 			}
 
+			dl.setServerFormat(serverFormat && isServerOnlyTable(tableFileName));
 			bool success = dl.saveTable( tableName.c_str(), tableFileName.c_str() );
 
 			printf("%s creating data table: %s\n", success ? "SUCCESS" : "FAILURE", tableFileName.c_str());
@@ -317,6 +326,13 @@ void DataTableTool::getDefaultOutputFileName(const std::string & inputFileName,
 
 // ----------------------------------------------------------------------
 
+bool DataTableTool::isServerOnlyTable(const std::string & fileName)
+{
+	return fileName.find("sys.server") != std::string::npos;
+}
+
+// ----------------------------------------------------------------------
+
 void DataTableTool::removeFileName(std::string & outputFileName)
 {
 #if defined(PLATFORM_WIN32)
@@ -411,6 +427,7 @@ void DataTableTool::usage(void)
 	printf("     For XML files, this option is not valid.\n");
 	printf("  -t run diagnotic test \n");
 	printf("  -c compile sys.shared datatables to /client directory as well as /data directory  \n");
+	printf("  -s write sys.server datatables in the server-only format (the client can not read it)\n");
 	getchar();
 }
 
@@ -33,6 +33,7 @@ private:
 	static void createOutputDirectoryForFile(const std::string & fileName);
 	static void getDefaultOutputFileName(const std::string & inputFileName, std::string & outputFileName, bool onlyConvertPath);
 	static void removeFileName(std::string & outputFileName);
+	static bool isServerOnlyTable(const std::string & fileName);
 
 	static std::string m_inputFile;
 	static std::string m_outputFile;
@@ -0,0 +1 @@
+#include "../../src/shared/core/SpatialQueryBatch.h"
@@ -12,19 +12,32 @@
 #include "sharedCollision/Containment3d.h"
 #include "sharedCollision/Distance3d.h"
 
+#include "sharedDebug/PerformanceTimer.h"
+
 #include "sharedFile/Iff.h"
+#include "sharedFile/IffView.h"
 
 #include "sharedFoundation/ExitChain.h"
 
 #include "sharedMath/VectorArgb.h"
 #include "sharedMath/DebugShapeRenderer.h"
 #include "sharedMath/Line3d.h"
+#include "sharedMath/Ray3d.h"
+#include "sharedMath/Segment3d.h"
 
 #include "sharedFoundation/MemoryBlockManagerMacros.h"
 #include "sharedFoundation/MemoryBlockManager.h"
 
+#include <algorithm>
 #include <vector>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BOXTREE_USE_SSE2 1
+#include <emmintrin.h>
+#else
+#define BOXTREE_USE_SSE2 0
+#endif
+
 const Tag TAG_BTRE = TAG(B,T,R,E);
 const Tag TAG_NODS = TAG(N,O,D,S);
 
@@ -60,6 +73,7 @@ public:
 	void    deleteChildren  ( void );
 
 	void    read            ( Iff & iff, BoxTreeNode * base );
+	void    read            ( IffView & iff, BoxTreeNode * base );
 	void    write           ( Iff & iff, BoxTreeNode * base );
 
 	bool    findClosest     ( Vector const & V, float maxDistance, float & outDistance, int & outId ) const;
@@ -345,6 +359,26 @@ void BoxTreeNode::read ( Iff & iff, BoxTreeNode * base )
 	m_childB = ( indexB != -1 ? base + indexB : nullptr );
 }
 
+// ----------
+
+void BoxTreeNode::read ( IffView & iff, BoxTreeNode * base )
+{
+	Vector max = iff.read_floatVector();
+	Vector min = iff.read_floatVector();
+
+	m_box = AxialBox(min,max);
+
+	m_index = iff.read_int32();
+
+	m_userId = iff.read_int32();
+
+	int indexA = iff.read_int32();
+	int indexB = iff.read_int32();
+
+	m_childA = ( indexA != -1 ? base + indexA : nullptr );
+	m_childB = ( indexB != -1 ? base + indexB : nullptr );
+}
+
 // ----------------------------------------------------------------------
 
 bool BoxTreeNode::findClosest ( Vector const & V, float maxDistance, float & outDistance, int & outIndex ) const
@@ -407,6 +441,351 @@ bool BoxTreeNode::findClosest ( Vector const & V, float maxDistance, float & out
 	}
 }
 
+// ======================================================================
+// Queries run over a copy of the tree collapsed into four-wide nodes. Each
+// quad holds the boxes of up to four subtrees laid out by axis, so a query
+// tests all four at once, and quads are stored depth-first so a query
+// mostly walks forward through memory. Unused slots hold an inverted box
+// that nothing overlaps, with no child and no user id.
+
+struct alignas(64) BoxTreeQuad
+{
+	float   m_minX[4];
+	float   m_minY[4];
+	float   m_minZ[4];
+	float   m_maxX[4];
+	float   m_maxY[4];
+	float   m_maxZ[4];
+
+	int     m_child[4];     // Index of the quad holding the slot's subtree, or -1 for a leaf
+	int     m_userId[4];
+};
+
+// ----------------------------------------------------------------------
+
+namespace BoxTreeNamespace
+{
+	// Quads still to be visited are kept on a fixed stack. Each quad visited
+	// pushes at most four and pops one, so trees deeper than the stack allows
+	// are queried through the binary nodes instead.
+
+	int const cs_quadStackSize = 256;
+
+	inline bool isLeaf ( BoxTreeNode const * node )
+	{
+		return (node->m_childA == nullptr) && (node->m_childB == nullptr);
+	}
+
+	inline float getSurfaceArea ( AxialBox const & box )
+	{
+		Vector const size = box.getMax() - box.getMin();
+
+		return size.x * size.y + size.y * size.z + size.z * size.x;
+	}
+
+	int buildQuad ( BoxTreeQuadVec & quads, BoxTreeNode const * nodeA, BoxTreeNode const * nodeB, int depth, int & maxDepth );
+
+	// ----------
+	// Tests a line, ray, or segment against the four slots of a quad. This
+	// is the same slab test as Overlap3d, in the same order, so a slot is
+	// hit exactly when Overlap3d::Test would hit its box.
+
+	class SlabQuadTest
+	{
+	public:
+
+		SlabQuadTest ( Vector const & point, Vector const & delta, float start, float end );
+
+		int operator() ( BoxTreeQuad const & quad ) const;
+
+	private:
+
+		Vector  m_point;
+		Vector  m_delta;
+		float   m_start;
+		float   m_end;
+	};
+
+	// ----------
+
+	class BoxQuadTest
+	{
+	public:
+
+		explicit BoxQuadTest ( AxialBox const & box );
+
+		int operator() ( BoxTreeQuad const & quad ) const;
+
+	private:
+
+		AxialBox    m_box;
+	};
+
+#if BOXTREE_USE_SSE2
+
+	inline void clipAxis ( float point, float delta, float const * boxMin, float const * boxMax, __m128 & enter, __m128 & exit, __m128 & inside )
+	{
+		__m128 const P = _mm_set1_ps(point);
+		__m128 const minimum = _mm_load_ps(boxMin);
+		__m128 const maximum = _mm_load_ps(boxMax);
+
+		if(delta == 0.0f)
+		{
+			inside = _mm_and_ps(inside,_mm_and_ps(_mm_cmpgt_ps(P,minimum),_mm_cmplt_ps(P,maximum)));
+
+			return;
+		}
+
+		__m128 const V = _mm_set1_ps(delta);
+		__m128 const timeMin = _mm_div_ps(_mm_sub_ps(minimum,P),V);
+		__m128 const timeMax = _mm_div_ps(_mm_sub_ps(maximum,P),V);
+
+		// The operand order matches std::max/std::min in IntersectRanges
+
+		if(delta > 0.0f)
+		{
+			enter = _mm_max_ps(timeMin,enter);
+			exit = _mm_min_ps(timeMax,exit);
+		}
+		else
+		{
+			enter = _mm_max_ps(timeMax,enter);
+			exit = _mm_min_ps(timeMin,exit);
+		}
+	}
+
+#else
+
+	inline bool clipAxis ( float point, float delta, float boxMin, float boxMax, float & enter, float & exit )
+	{
+		if(delta == 0.0f)
+		{
+			return (point > boxMin) && (point < boxMax);
+		}
+
+		float const timeMin = (boxMin - point) / delta;
+		float const timeMax = (boxMax - point) / delta;
+
+		if(delta > 0.0f)
+		{
+			enter = std::max(enter,timeMin);
+			exit = std::min(exit,timeMax);
+		}
+		else
+		{
+			enter = std::max(enter,timeMax);
+			exit = std::min(exit,timeMin);
+		}
+
+		return true;
+	}
+
+#endif
+}
+
+using namespace BoxTreeNamespace;
+
+// ----------------------------------------------------------------------
+
+int BoxTreeNamespace::buildQuad ( BoxTreeQuadVec & quads, BoxTreeNode const * nodeA, BoxTreeNode const * nodeB, int depth, int & maxDepth )
+{
+	maxDepth = std::max(maxDepth,depth);
+
+	// Gather up to four subtrees for this quad, opening the largest internal
+	// node first so the slots end up roughly the same size. An opened node is
+	// replaced in place by its children, which keeps the slots in depth-first
+	// order.
+
+	BoxTreeNode const * slots[4];
+	int slotCount = 0;
+
+	if(nodeA) slots[slotCount++] = nodeA;
+	if(nodeB) slots[slotCount++] = nodeB;
+
+	for(;;)
+	{
+		int open = -1;
+		float openArea = -1.0f;
+
+		for(int i = 0; i < slotCount; i++)
+		{
+			BoxTreeNode const * node = slots[i];
+
+			if((node->m_userId != -1) || isLeaf(node)) continue;
+
+			int childCount = (node->m_childA ? 1 : 0) + (node->m_childB ? 1 : 0);
+
+			if(slotCount - 1 + childCount > 4) continue;
+
+			float area = getSurfaceArea(node->m_box);
+
+			if(area > openArea)
+			{
+				open = i;
+				openArea = area;
+			}
+		}
+
+		if(open == -1) break;
+
+		BoxTreeNode const * children[2];
+		int childCount = 0;
+
+		if(slots[open]->m_childA) children[childCount++] = slots[open]->m_childA;
+		if(slots[open]->m_childB) children[childCount++] = slots[open]->m_childB;
+
+		for(int i = slotCount - 1; i > open; i--)
+		{
+			slots[i + childCount - 1] = slots[i];
+		}
+
+		for(int i = 0; i < childCount; i++)
+		{
+			slots[open + i] = children[i];
+		}
+
+		slotCount += childCount - 1;
+	}
+
+	// ----------
+	// The quad goes in ahead of its subtrees. Building a subtree can grow the
+	// vector, so the quad is only filled in once they're done.
+
+	int index = quads.size();
+
+	quads.push_back(BoxTreeQuad());
+
+	int childQuads[4] = { -1, -1, -1, -1 };
+
+	for(int i = 0; i < slotCount; i++)
+	{
+		if(!isLeaf(slots[i]))
+		{
+			childQuads[i] = buildQuad(quads,slots[i]->m_childA,slots[i]->m_childB,depth + 1,maxDepth);
+		}
+	}
+
+	BoxTreeQuad & quad = quads[index];
+
+	for(int i = 0; i < 4; i++)
+	{
+		if(i < slotCount)
+		{
+			Vector const & min = slots[i]->m_box.getMin();
+			Vector const & max = slots[i]->m_box.getMax();
+
+			quad.m_minX[i] = min.x;
+			quad.m_minY[i] = min.y;
+			quad.m_minZ[i] = min.z;
+			quad.m_maxX[i] = max.x;
+			quad.m_maxY[i] = max.y;
+			quad.m_maxZ[i] = max.z;
+
+			quad.m_child[i] = childQuads[i];
+			quad.m_userId[i] = slots[i]->m_userId;
+		}
+		else
+		{
+			quad.m_minX[i] = quad.m_minY[i] = quad.m_minZ[i] = REAL_MAX;
+			quad.m_maxX[i] = quad.m_maxY[i] = quad.m_maxZ[i] = -REAL_MAX;
+
+			quad.m_child[i] = -1;
+			quad.m_userId[i] = -1;
+		}
+	}
+
+	return index;
+}
+
+// ----------------------------------------------------------------------
+
+BoxTreeNamespace::SlabQuadTest::SlabQuadTest ( Vector const & point, Vector const & delta, float start, float end )
+: m_point(point),
+  m_delta(delta),
+  m_start(start),
+  m_end(end)
+{
+}
+
+int BoxTreeNamespace::SlabQuadTest::operator() ( BoxTreeQuad const & quad ) const
+{
+#if BOXTREE_USE_SSE2
+
+	__m128 enter = _mm_set1_ps(m_start);
+	__m128 exit = _mm_set1_ps(m_end);
+	__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+	clipAxis(m_point.x,m_delta.x,quad.m_minX,quad.m_maxX,enter,exit,inside);
+	clipAxis(m_point.y,m_delta.y,quad.m_minY,quad.m_maxY,enter,exit,inside);
+	clipAxis(m_point.z,m_delta.z,quad.m_minZ,quad.m_maxZ,enter,exit,inside);
+
+	return _mm_movemask_ps(_mm_and_ps(inside,_mm_cmpnlt_ps(exit,enter)));
+
+#else
+
+	int mask = 0;
+
+	for(int i = 0; i < 4; i++)
+	{
+		float enter = m_start;
+		float exit = m_end;
+
+		if(!clipAxis(m_point.x,m_delta.x,quad.m_minX[i],quad.m_maxX[i],enter,exit)) continue;
+		if(!clipAxis(m_point.y,m_delta.y,quad.m_minY[i],quad.m_maxY[i],enter,exit)) continue;
+		if(!clipAxis(m_point.z,m_delta.z,quad.m_minZ[i],quad.m_maxZ[i],enter,exit)) continue;
+
+		if(!(exit < enter)) mask |= 1 << i;
+	}
+
+	return mask;
+
+#endif
+}
+
+// ----------------------------------------------------------------------
+
+BoxTreeNamespace::BoxQuadTest::BoxQuadTest ( AxialBox const & box )
+: m_box(box)
+{
+}
+
+int BoxTreeNamespace::BoxQuadTest::operator() ( BoxTreeQuad const & quad ) const
+{
+	Vector const & min = m_box.getMin();
+	Vector const & max = m_box.getMax();
+
+#if BOXTREE_USE_SSE2
+
+	__m128 miss = _mm_cmpgt_ps(_mm_load_ps(quad.m_minX),_mm_set1_ps(max.x));
+	miss = _mm_or_ps(miss,_mm_cmpgt_ps(_mm_load_ps(quad.m_minY),_mm_set1_ps(max.y)));
+	miss = _mm_or_ps(miss,_mm_cmpgt_ps(_mm_load_ps(quad.m_minZ),_mm_set1_ps(max.z)));
+	miss = _mm_or_ps(miss,_mm_cmpgt_ps(_mm_set1_ps(min.x),_mm_load_ps(quad.m_maxX)));
+	miss = _mm_or_ps(miss,_mm_cmpgt_ps(_mm_set1_ps(min.y),_mm_load_ps(quad.m_maxY)));
+	miss = _mm_or_ps(miss,_mm_cmpgt_ps(_mm_set1_ps(min.z),_mm_load_ps(quad.m_maxZ)));
+
+	return ~_mm_movemask_ps(miss) & 0xf;
+
+#else
+
+	int mask = 0;
+
+	for(int i = 0; i < 4; i++)
+	{
+		if(quad.m_minX[i] > max.x) continue;
+		if(quad.m_minY[i] > max.y) continue;
+		if(quad.m_minZ[i] > max.z) continue;
+		if(min.x > quad.m_maxX[i]) continue;
+		if(min.y > quad.m_maxY[i]) continue;
+		if(min.z > quad.m_maxZ[i]) continue;
+
+		mask |= 1 << i;
+	}
+
+	return mask;
+
+#endif
+}
+
 // ======================================================================
 
 void BoxTree::install()
@@ -418,6 +797,7 @@ void BoxTree::install()
 
 BoxTree::BoxTree()
 : m_flatNodes(nullptr),
+  m_quads(nullptr),
   m_root(nullptr),
   m_testCounter(0)
 {
@@ -478,6 +858,8 @@ void BoxTree::build ( BoxVec const & boxes )
 	m_root->deleteChildren();
 	delete m_root;
 	m_root = &m_flatNodes->front();
+
+	buildQuads();
 }
 
 // ----------------------------------------------------------------------
@@ -543,6 +925,46 @@ static inline void templateTestOverlapRecurse( BoxTreeNode const * node, TestSha
 	}
 }
 
+template< class QuadTest >
+static inline bool templateTestOverlapQuads( BoxTreeQuadVec const & quads, QuadTest const & quadTest, IdVec & outIds )
+{
+	int oldSize = outIds.size();
+
+	int stack[cs_quadStackSize];
+	int stackSize = 0;
+
+	stack[stackSize++] = 0;
+
+	while(stackSize > 0)
+	{
+		BoxTreeQuad const & quad = quads[stack[--stackSize]];
+
+		int mask = quadTest(quad);
+
+		if(mask == 0) continue;
+
+		for(int i = 0; i < 4; i++)
+		{
+			if((mask & (1 << i)) && (quad.m_userId[i] != -1))
+			{
+				outIds.push_back(quad.m_userId[i]);
+			}
+		}
+
+		// Push in reverse so the first slot's subtree is visited first
+
+		for(int i = 3; i >= 0; i--)
+		{
+			if((mask & (1 << i)) && (quad.m_child[i] != -1))
+			{
+				stack[stackSize++] = quad.m_child[i];
+			}
+		}
+	}
+
+	return oldSize != static_cast<int>(outIds.size());
+}
+
 template< class TestShape >
 static inline bool templateTestOverlap( BoxTree const & tree, TestShape const & testShape, IdVec & outIds )
 {
@@ -593,16 +1015,110 @@ static inline bool templateTestOverlap2( BoxTree const & tree, TestShape const &
 
 // ----------
 
-bool BoxTree::testOverlap ( AxialBox const & box,      IdVec & outIds ) const   { return templateTestOverlap(*this,box,outIds); }
-bool BoxTree::testOverlap ( Line3d const & line,       IdVec & outIds ) const   { return templateTestOverlap(*this,line,outIds); }
-bool BoxTree::testOverlap ( Ray3d const & ray,         IdVec & outIds ) const   { return templateTestOverlap(*this,ray,outIds); }
-bool BoxTree::testOverlap ( Segment3d const & segment, IdVec & outIds ) const   { return templateTestOverlap(*this,segment,outIds); }
+bool BoxTree::testOverlap ( AxialBox const & box, IdVec & outIds ) const
+{
+	if(m_quads) return templateTestOverlapQuads(*m_quads,BoxQuadTest(box),outIds);
+
+	return templateTestOverlap(*this,box,outIds);
+}
+
+bool BoxTree::testOverlap ( Line3d const & line, IdVec & outIds ) const
+{
+	if(m_quads) return templateTestOverlapQuads(*m_quads,SlabQuadTest(line.getPoint(),line.getNormal(),-REAL_MAX,REAL_MAX),outIds);
+
+	return templateTestOverlap(*this,line,outIds);
+}
+
+bool BoxTree::testOverlap ( Ray3d const & ray, IdVec & outIds ) const
+{
+	if(m_quads) return templateTestOverlapQuads(*m_quads,SlabQuadTest(ray.getPoint(),ray.getNormal(),0.0f,REAL_MAX),outIds);
+
+	return templateTestOverlap(*this,ray,outIds);
+}
+
+bool BoxTree::testOverlap ( Segment3d const & segment, IdVec & outIds ) const
+{
+	if(m_quads) return templateTestOverlapQuads(*m_quads,SlabQuadTest(segment.getBegin(),segment.getDelta(),0.0f,1.0f),outIds);
+
+	return templateTestOverlap(*this,segment,outIds);
+}
 
 // ----------------------------------------------------------------------
 
 bool BoxTree::findClosest ( Vector const & V, float maxDistance, float & outDistance, int & outId ) const
 {
-	return getRoot()->findClosest(V,maxDistance,outDistance,outId);
+	if(!m_quads) return getRoot()->findClosest(V,maxDistance,outDistance,outId);
+
+	// Same pruning as BoxTreeNode::findClosest - a subtree is skipped once it's
+	// no closer than the best leaf so far - with the squared distances to a
+	// quad's four boxes computed together.
+
+	float bestDistance = maxDistance;
+	int bestId = -1;
+	bool found = false;
+
+	int stack[cs_quadStackSize];
+	int stackSize = 0;
+
+	stack[stackSize++] = 0;
+
+	while(stackSize > 0)
+	{
+		BoxTreeQuad const & quad = (*m_quads)[stack[--stackSize]];
+
+		float distance[4];
+
+#if BOXTREE_USE_SSE2
+
+		__m128 const PX = _mm_set1_ps(V.x);
+		__m128 const PY = _mm_set1_ps(V.y);
+		__m128 const PZ = _mm_set1_ps(V.z);
+
+		__m128 const DX = _mm_sub_ps(_mm_min_ps(_mm_max_ps(PX,_mm_load_ps(quad.m_minX)),_mm_load_ps(quad.m_maxX)),PX);
+		__m128 const DY = _mm_sub_ps(_mm_min_ps(_mm_max_ps(PY,_mm_load_ps(quad.m_minY)),_mm_load_ps(quad.m_maxY)),PY);
+		__m128 const DZ = _mm_sub_ps(_mm_min_ps(_mm_max_ps(PZ,_mm_load_ps(quad.m_minZ)),_mm_load_ps(quad.m_maxZ)),PZ);
+
+		_mm_storeu_ps(distance,_mm_add_ps(_mm_add_ps(_mm_mul_ps(DX,DX),_mm_mul_ps(DY,DY)),_mm_mul_ps(DZ,DZ)));
+
+#else
+
+		for(int i = 0; i < 4; i++)
+		{
+			float dx = clamp(quad.m_minX[i],V.x,quad.m_maxX[i]) - V.x;
+			float dy = clamp(quad.m_minY[i],V.y,quad.m_maxY[i]) - V.y;
+			float dz = clamp(quad.m_minZ[i],V.z,quad.m_maxZ[i]) - V.z;
+
+			distance[i] = dx * dx + dy * dy + dz * dz;
+		}
+
+#endif
+
+		for(int i = 3; i >= 0; i--)
+		{
+			if((quad.m_child[i] == -1) && (quad.m_userId[i] == -1)) continue;
+
+			if(distance[i] >= bestDistance) continue;
+
+			if(quad.m_child[i] != -1)
+			{
+				stack[stackSize++] = quad.m_child[i];
+			}
+			else
+			{
+				bestDistance = distance[i];
+				bestId = quad.m_userId[i];
+				found = true;
+			}
+		}
+	}
+
+	if(found)
+	{
+		outDistance = bestDistance;
+		outId = bestId;
+	}
+
+	return found;
 }
 
 // ----------------------------------------------------------------------
@@ -660,6 +1176,8 @@ void BoxTree::read ( Iff & iff )
 	{
 		m_root = &m_flatNodes->front();
 	}
+
+	buildQuads();
 }
 
 // ----------------------------------------------------------------------
@@ -672,18 +1190,26 @@ void BoxTree::read_0000 ( Iff & iff )
 
 	// ----------
 
+	// The nodes are stored flat with child links as indices, so they're
+	// read straight out of the file data and the links fixed up against
+	// the new array.
+
 	iff.enterChunk(TAG_NODS);
 	{
-		int nodeCount = iff.read_int32();
+		IffView view(iff);
+
+		int nodeCount = view.read_int32();
 
 		m_flatNodes = new BoxTreeNodeVec(nodeCount);
 
-		BoxTreeNode * base = &m_flatNodes->front();
+		BoxTreeNode * base = m_flatNodes->empty() ? nullptr : &m_flatNodes->front();
 
 		for(int i = 0; i < nodeCount; i++)
 		{
-			m_flatNodes->at(i).read(iff,base);
+			(*m_flatNodes)[i].read(view,base);
 		}
+
+		view.advance(iff);
 	}
 	iff.exitChunk(TAG_NODS);
 
@@ -706,6 +1232,9 @@ void BoxTree::clear ( void )
 
 	delete m_flatNodes;
 	m_flatNodes = nullptr;
+
+	delete m_quads;
+	m_quads = nullptr;
 }
 
 // ----------------------------------------------------------------------
@@ -728,3 +1257,140 @@ void BoxTree::pack ( void )
 }
 
 // ----------------------------------------------------------------------
+
+void BoxTree::buildQuads ( void )
+{
+	delete m_quads;
+	m_quads = nullptr;
+
+	if(!m_root) return;
+
+	int maxDepth = 0;
+
+	m_quads = new BoxTreeQuadVec();
+	m_quads->reserve(getNodeCount() / 3 + 1);
+
+	IGNORE_RETURN(buildQuad(*m_quads,m_root,nullptr,0,maxDepth));
+
+	if(3 * maxDepth + 4 > cs_quadStackSize)
+	{
+		DEBUG_WARNING(true,("BoxTree::buildQuads - tree is %d quads deep, queries will use the binary nodes",maxDepth));
+
+		delete m_quads;
+		m_quads = nullptr;
+	}
+}
+
+// ----------------------------------------------------------------------
+// Build a tree over random boxes, run the same random box and segment
+// overlap and closest point queries through the quads and through the
+// binary nodes, and count the queries on which they report different ids.
+// Returns -1 if the tree is too deep to have quads.
+
+static float verifyRandom( unsigned int & seed, float low, float high )
+{
+	seed = seed * 1664525u + 1013904223u;
+	return low + (high - low) * static_cast<float>(seed >> 8) / static_cast<float>(1 << 24);
+}
+
+int BoxTree::verifyQuadQueries ( int boxCount, int queryCount, float & quadTime, float & nodeTime )
+{
+	// fixed seed, so a failure can be repeated
+	unsigned int seed = 12345;
+
+	BoxVec boxes;
+	boxes.reserve(boxCount);
+
+	for(int i = 0; i < boxCount; i++)
+	{
+		Vector const corner(verifyRandom(seed,-100.0f,100.0f),verifyRandom(seed,-20.0f,20.0f),verifyRandom(seed,-100.0f,100.0f));
+		Vector const size(verifyRandom(seed,0.5f,8.0f),verifyRandom(seed,0.5f,4.0f),verifyRandom(seed,0.5f,8.0f));
+
+		boxes.push_back(AxialBox(corner,corner + size));
+	}
+
+	BoxTree tree;
+	tree.build(boxes);
+
+	if(!tree.m_quads)
+		return -1;
+
+	std::vector<AxialBox> queryBoxes;
+	std::vector<Segment3d> querySegments;
+	queryBoxes.reserve(queryCount);
+	querySegments.reserve(queryCount);
+
+	for(int i = 0; i < queryCount; i++)
+	{
+		Vector const corner(verifyRandom(seed,-110.0f,110.0f),verifyRandom(seed,-25.0f,25.0f),verifyRandom(seed,-110.0f,110.0f));
+		Vector const size(verifyRandom(seed,0.0f,10.0f),verifyRandom(seed,0.0f,10.0f),verifyRandom(seed,0.0f,10.0f));
+		Vector const delta(verifyRandom(seed,-40.0f,40.0f),verifyRandom(seed,-10.0f,10.0f),verifyRandom(seed,-40.0f,40.0f));
+
+		queryBoxes.push_back(AxialBox(corner,corner + size));
+		querySegments.push_back(Segment3d(corner,corner + delta));
+	}
+
+	IdVec quadIds;
+	IdVec nodeIds;
+	IdVec sortedQuadIds;
+	IdVec sortedNodeIds;
+	int mismatches = 0;
+
+	for(int i = 0; i < queryCount; i++)
+	{
+		quadIds.clear();
+		nodeIds.clear();
+		IGNORE_RETURN(tree.testOverlap(queryBoxes[i],quadIds));
+		IGNORE_RETURN(templateTestOverlap(tree,queryBoxes[i],nodeIds));
+		IGNORE_RETURN(tree.testOverlap(querySegments[i],quadIds));
+		IGNORE_RETURN(templateTestOverlap(tree,querySegments[i],nodeIds));
+
+		sortedQuadIds.assign(quadIds.begin(),quadIds.end());
+		sortedNodeIds.assign(nodeIds.begin(),nodeIds.end());
+		std::sort(sortedQuadIds.begin(),sortedQuadIds.end());
+		std::sort(sortedNodeIds.begin(),sortedNodeIds.end());
+
+		float quadDistance = 0.0f;
+		float nodeDistance = 0.0f;
+		int quadId = -1;
+		int nodeId = -1;
+		bool const quadFound = tree.findClosest(querySegments[i].getBegin(),20.0f,quadDistance,quadId);
+		bool const nodeFound = tree.getRoot()->findClosest(querySegments[i].getBegin(),20.0f,nodeDistance,nodeId);
+
+		if(sortedQuadIds != sortedNodeIds || quadFound != nodeFound || (quadFound && quadDistance != nodeDistance))
+			++mismatches;
+	}
+
+	PerformanceTimer timer;
+	int hits = 0;
+
+	timer.start();
+	for(int i = 0; i < queryCount; i++)
+	{
+		quadIds.clear();
+		IGNORE_RETURN(tree.testOverlap(queryBoxes[i],quadIds));
+		IGNORE_RETURN(tree.testOverlap(querySegments[i],quadIds));
+		hits += static_cast<int>(quadIds.size());
+	}
+	timer.stop();
+	quadTime = timer.getElapsedTime();
+
+	timer.start();
+	for(int i = 0; i < queryCount; i++)
+	{
+		nodeIds.clear();
+		IGNORE_RETURN(templateTestOverlap(tree,queryBoxes[i],nodeIds));
+		IGNORE_RETURN(templateTestOverlap(tree,querySegments[i],nodeIds));
+		hits -= static_cast<int>(nodeIds.size());
+	}
+	timer.stop();
+	nodeTime = timer.getElapsedTime();
+
+	//-- the timed passes must agree too
+	if(hits != 0)
+		++mismatches;
+
+	return mismatches;
+}
+
+// ----------------------------------------------------------------------
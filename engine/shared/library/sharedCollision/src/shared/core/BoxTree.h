@@ -15,6 +15,7 @@
 #include "sharedFoundation/Tag.h"
 
 class BoxTreeNode;
+struct BoxTreeQuad;
 class DebugShapeRenderer;
 
 class Line3d;
@@ -25,6 +26,7 @@ class BoxTreeNode;
 class Iff;
 
 typedef std::vector<BoxTreeNode> BoxTreeNodeVec;
+typedef std::vector<BoxTreeQuad> BoxTreeQuadVec;
 typedef std::vector<AxialBox> BoxVec;
 typedef std::vector<int> IdVec;
 
@@ -35,6 +37,7 @@ class BoxTree
 public:
 
 	static void install();
+	static int verifyQuadQueries( int boxCount, int queryCount, float & quadTime, float & nodeTime );
 
 public:
 
@@ -78,9 +81,13 @@ protected:
 
 	bool    isFlat          ( void ) const;
 
+	void    buildQuads      ( void );
+
 	// ----------
 
 	BoxTreeNodeVec *    m_flatNodes;
+
+	BoxTreeQuadVec *    m_quads;    // The flat nodes collapsed four-wide for queries, or null if the tree is too deep
 	
 	BoxTreeNode *       m_root;
 	
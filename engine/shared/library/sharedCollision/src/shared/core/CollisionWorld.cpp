@@ -28,6 +28,7 @@
 #include "sharedCollision/SetupSharedCollision.h"
 #include "sharedCollision/SimpleExtent.h"
 #include "sharedCollision/SpatialDatabase.h"
+#include "sharedCollision/SpatialQueryBatch.h"
 #include "sharedDebug/PerformanceTimer.h"
 #include "sharedDebug/Profiler.h"
 #include "sharedDebug/Report.h"
@@ -35,6 +36,7 @@
 #include "sharedFoundation/FloatingPointUnit.h"
 #include "sharedLog/Log.h"
 #include "sharedMath/AxialBox.h"
+#include "sharedMath/Capsule.h"
 #include "sharedMath/Circle.h"
 #include "sharedMath/Cylinder.h"
 #include "sharedMath/DebugShapeRenderer.h"
@@ -46,7 +48,12 @@
 #include "sharedMath/Sphere.h"
 #include "sharedObject/Appearance.h"
 #include "sharedObject/CellProperty.h"
+#include "sharedSynchronization/Mutex.h"
+#include "sharedSynchronization/Semaphore.h"
 #include "sharedTerrain/TerrainObject.h"
+#include "sharedThread/RunThread.h"
+#include "sharedThread/ThreadHandle.h"
+#include <algorithm>
 #include <limits>
 
 // ----------
@@ -66,12 +73,34 @@ namespace CollisionWorldNamespace
 
 	// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
+	// a spatial sweep for a collider without a footprint, queried on a sweep thread
+	struct Sweep
+	{
+		Sweep();
+
+		CollisionProperty * collider;
+		Capsule             capsule_w;
+		ColliderList        collidedWith;
+	};
+
+	typedef std::vector<Sweep> Sweeps;
+
+	void  startSweepThreads();
+	void  stopSweepThreads();
+	void  sweepThread();
+	void  runSweeps();
+
+	// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
 	int const cs_nearWarpCollisionSegmentCount = 20;
 	int const cs_farWarpCollisionSegmentCount = 250;
 
+	int const cs_sweepBatchSize = 16;
+
 	// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
 	SpatialDatabase *  ms_database = nullptr;
+	SpatialQueryBatch * ms_queryBatch = nullptr;
 
 	bool               ms_updating = false;
 	bool               ms_serverSide = false;
@@ -81,6 +110,22 @@ namespace CollisionWorldNamespace
 	WarpWarningCallback  s_nearWarpWarningCallback;
 	WarpWarningCallback  s_farWarpWarningCallback;
 
+	CollisionWorld::UpdateTimings  ms_lastUpdateTimings;
+
+	std::vector<ThreadHandle>  ms_sweepThreads;
+	Semaphore                  ms_sweepStart;
+	Semaphore                  ms_sweepDone;
+
+	// guarded by ms_sweepMutex
+	Mutex                      ms_sweepMutex;
+	int                        ms_nextSweep;
+	bool                       ms_stopSweepThreads;
+
+	// only written by the main thread while the sweep threads wait
+	Sweeps                     ms_sweeps;
+	int                        ms_numberOfSweeps;
+	int                        ms_sweepQueryMask;
+
 	char const * ms_sptatialDatabaseNames[] = {
 													"None",
 													"Static",
@@ -198,6 +243,13 @@ float getCellTime = 0.0f;
 float resolveCollisionsTime = 0.0f;
 float totalCollisionTime = 0.0f;
 float postUpdateTime = 0.0f;
+float sweepTime = 0.0f;
+float sweepResolveTime = 0.0f;
+int sweepCount = 0;
+int batchedQueryCount = 0;
+int reusedQueryCount = 0;
+int batchedTraversalCount = 0;
+int invalidatedQueryCount = 0;
 int canMoveCount = 0;
 float canMoveTime = 0.0f;
 float maxCanMoveTime = 0.0f;
@@ -336,6 +388,98 @@ bool CollisionWorldNamespace::testFloorCollision(FloorLocator const &startFloorL
 
 // ----------------------------------------------------------------------
 
+CollisionWorldNamespace::Sweep::Sweep() :
+	collider(nullptr),
+	capsule_w(Vector::zero, Vector::zero, 0.0f),
+	collidedWith()
+{
+}
+
+// ----------------------------------------------------------------------
+
+void CollisionWorldNamespace::startSweepThreads()
+{
+	ms_stopSweepThreads = false;
+
+	int const numberOfThreads = ConfigSharedCollision::getSweepThreads();
+	for (int i = 0; i < numberOfThreads; ++i)
+	{
+		ThreadHandle threadHandle;
+		threadHandle = runNamedThread("CollisionSweep", sweepThread);
+		ms_sweepThreads.push_back(threadHandle);
+	}
+}
+
+// ----------------------------------------------------------------------
+
+void CollisionWorldNamespace::stopSweepThreads()
+{
+	ms_sweepMutex.enter();
+		ms_stopSweepThreads = true;
+	ms_sweepMutex.leave();
+
+	ms_sweepStart.signal(static_cast<int>(ms_sweepThreads.size()));
+
+	for (std::vector<ThreadHandle>::iterator i = ms_sweepThreads.begin(); i != ms_sweepThreads.end(); ++i)
+		(*i)->wait();
+	ms_sweepThreads.clear();
+
+	ms_sweeps.clear();
+	ms_numberOfSweeps = 0;
+}
+
+// ----------------------------------------------------------------------
+
+void CollisionWorldNamespace::sweepThread()
+{
+	for (;;)
+	{
+		ms_sweepStart.wait();
+
+		ms_sweepMutex.enter();
+			bool const stop = ms_stopSweepThreads;
+		ms_sweepMutex.leave();
+
+		if (stop)
+			return;
+
+		runSweeps();
+
+		ms_sweepDone.signal();
+	}
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Query sweeps in batches until none are left.  Run by the sweep threads
+ * and the main thread together.
+ */
+
+void CollisionWorldNamespace::runSweeps()
+{
+	CellProperty const * const cell_w = CellProperty::getWorldCellProperty();
+
+	for (;;)
+	{
+		ms_sweepMutex.enter();
+			int const begin = ms_nextSweep;
+			ms_nextSweep += cs_sweepBatchSize;
+		ms_sweepMutex.leave();
+
+		int const end = std::min(begin + cs_sweepBatchSize, ms_numberOfSweeps);
+		if (begin >= end)
+			return;
+
+		for (int i = begin; i < end; ++i)
+		{
+			Sweep & sweep = ms_sweeps[static_cast<size_t>(i)];
+			ms_database->queryFor(ms_sweepQueryMask, cell_w, true, sweep.capsule_w, sweep.collidedWith);
+		}
+	}
+}
+
+// ----------------------------------------------------------------------
+
 void CollisionWorld::registerCanTestCollisionDetectionOnObjectThisFrame(CanTestCollisionDetectionOnObjectThisFrameFunction function)
 {
 	ms_canTestCollisionDetectionOnObjectThisFrameFunction = function;
@@ -431,6 +575,9 @@ void CollisionWorld::install(bool serverSide)
 	}
 
 	ms_database = new SpatialDatabase();
+	ms_queryBatch = new SpatialQueryBatch(*ms_database);
+
+	startSweepThreads();
 
 	ExitChain::add(CollisionWorld::remove, "CollisionWorld::remove()");
 }
@@ -441,12 +588,17 @@ void CollisionWorld::remove(void)
 {
 	DEBUG_REPORT_LOG(true, ("CollisionWorld::remove()\n"));
 
+	stopSweepThreads();
+
 	CollisionResolve::remove();
 	FloorMesh::remove();
 
 	s_nearWarpWarningCallback = nullptr;
 	s_farWarpWarningCallback = nullptr;
 
+	delete ms_queryBatch;
+	ms_queryBatch = nullptr;
+
 	delete ms_database;
 	ms_database = nullptr;
 }
@@ -467,6 +619,18 @@ void CollisionWorld::update(float time)
 	resolveCollisionsTime = 0.0f;
 	postUpdateTime = 0.0f;
 	terrainHeightTime = 0.0f;
+	sweepTime = 0.0f;
+	sweepResolveTime = 0.0f;
+	sweepCount = 0;
+
+	// queries answered last frame are stale now that things are about to move
+
+	batchedQueryCount = ms_queryBatch->getQueryCount();
+	reusedQueryCount = ms_queryBatch->getReusedQueryCount();
+	batchedTraversalCount = ms_queryBatch->getTraversalCount();
+	invalidatedQueryCount = ms_queryBatch->getInvalidatedQueryCount();
+
+	ms_queryBatch->clear();
 
 	PerformanceTimer timer;
 	timer.start();
@@ -503,9 +667,18 @@ void CollisionWorld::update(float time)
 		WARNING(true, ("CollisionWorld::update - Updating more than 3000 objects this frame - something's probably wrong\n"));
 	}
 
-	for (CollisionPropertyVector::size_type i = 0; i < count; i++)
+	bool const parallelSweeps = !ms_sweepThreads.empty() && static_cast<int>(count) >= ConfigSharedCollision::getSweepThreadsMinimumColliders();
+
+	if (parallelSweeps)
 	{
-		update(active[i], time);
+		updateWithParallelSweeps(active, time);
+	}
+	else
+	{
+		for (CollisionPropertyVector::size_type i = 0; i < count; i++)
+		{
+			update(active[i], time);
+		}
 	}
 
 	footprintUpdateCounter = static_cast<int>(count);
@@ -521,6 +694,19 @@ void CollisionWorld::update(float time)
 	timer.stop();
 	totalCollisionTime = timer.getElapsedTime();
 
+	ms_lastUpdateTimings.activeColliders = static_cast<int>(count);
+	ms_lastUpdateTimings.sweptColliders = sweepCount;
+	ms_lastUpdateTimings.sweepThreads = parallelSweeps ? static_cast<int>(ms_sweepThreads.size()) : 0;
+	ms_lastUpdateTimings.total = totalCollisionTime;
+	ms_lastUpdateTimings.sweep = sweepTime;
+	ms_lastUpdateTimings.sweepResolve = sweepResolveTime;
+	ms_lastUpdateTimings.floorUpdate = floorUpdateTime;
+	ms_lastUpdateTimings.footprintUpdate = footprintUpdateTime;
+	ms_lastUpdateTimings.collisionDetect = collisionDetectTime;
+	ms_lastUpdateTimings.resolveCollisions = resolveCollisionsTime;
+	ms_lastUpdateTimings.terrainHeight = terrainHeightTime;
+	ms_lastUpdateTimings.postUpdate = postUpdateTime;
+
 	// ----------
 	// Post-update, where test code goes
 
@@ -547,6 +733,9 @@ bool CollisionWorld::spatialSweepAndResolve(CollisionProperty * collider)
 
 	if (canTestCollisionDetectionOnObjectThisFrame(object))
 	{
+		PerformanceTimer timer;
+		timer.start();
+
 		CellProperty const * const cell_w = CellProperty::getWorldCellProperty();
 		Capsule const capsule_w(collider->getQueryCapsule_w());
 		ColliderList collidedWith;
@@ -555,36 +744,151 @@ bool CollisionWorld::spatialSweepAndResolve(CollisionProperty * collider)
 
 		ms_database->queryFor(queryMask, cell_w, true, capsule_w, collidedWith);
 
-		int const potentialCount = static_cast<int>(collidedWith.size());
+		timer.stop();
+		sweepTime += timer.getElapsedTime();
+		++sweepCount;
+
+		timer.start();
+
+		hadACollisionThisFrame = resolveSpatialSweep(collider, collidedWith);
+
+		timer.stop();
+		sweepResolveTime += timer.getElapsedTime();
+	}
+
+	return(hadACollisionThisFrame);
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Hand the results of a spatial sweep to the game's collision callbacks.
+ *
+ * @return  true if the collider hit anything, including terrain.
+ */
 
-		for (int i = 0; i < potentialCount; ++i)
+bool CollisionWorld::resolveSpatialSweep(CollisionProperty * collider, ColliderList const & collidedWith)
+{
+	Object * object = &collider->getOwner();
+	NOT_NULL(object);
+
+	bool hadACollisionThisFrame = false;
+
+	int const potentialCount = static_cast<int>(collidedWith.size());
+
+	for (int i = 0; i < potentialCount; ++i)
+	{
+		CollisionProperty * const wasHitByThisCollision = collidedWith[static_cast<size_t>(i)];
+
+		if ((wasHitByThisCollision) && (wasHitByThisCollision != collider))
 		{
-			CollisionProperty * const toTestCollision = collidedWith.at(static_cast<unsigned int>(i));
+			Object * const wasHitByThisObject = &wasHitByThisCollision->getOwner();
 
-			if ((toTestCollision) && (toTestCollision != collider))
+			if (doCollisionDetectionOnHit(object, wasHitByThisObject))
 			{
-				CollisionProperty * const wasHitByThisCollision = collidedWith.at(i);
-				Object * const wasHitByThisObject = &wasHitByThisCollision->getOwner();
-
-				if (doCollisionDetectionOnHit(object, wasHitByThisObject))
-				{
-					hadACollisionThisFrame = true;
-				}
+				hadACollisionThisFrame = true;
 			}
 		}
+	}
+
+	if (doCollisionWithTerrain(object))
+	{
+		hadACollisionThisFrame = true;
+	}
+
+	if (!hadACollisionThisFrame)
+	{
+		noCollisionDetectionThisFrame(object);
+	}
+
+	return(hadACollisionThisFrame);
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Update the active colliders, querying the spatial sweeps of colliders
+ * without footprints on the sweep threads.
+ *
+ * All the sweeps are queried up front against the positions at the start
+ * of the update.  The main thread then walks the colliders in their usual
+ * order, updating colliders with footprints as before and handing each
+ * sweep's hits to the collision callbacks, so the outcome does not depend
+ * on how the sweeps were divided between threads.
+ */
+
+void CollisionWorld::updateWithParallelSweeps(ColliderList const & active, float time)
+{
+	PerformanceTimer timer;
+	timer.start();
+
+	ms_numberOfSweeps = 0;
+
+	for (ColliderList::const_iterator i = active.begin(); i != active.end(); ++i)
+	{
+		CollisionProperty * const collider = *i;
+
+		if (collider->getFootprint() || !canTestCollisionDetectionOnObjectThisFrame(&collider->getOwner()))
+			continue;
+
+		if (ms_numberOfSweeps == static_cast<int>(ms_sweeps.size()))
+			ms_sweeps.push_back(Sweep());
+
+		Sweep & sweep = ms_sweeps[static_cast<size_t>(ms_numberOfSweeps++)];
+		sweep.collider = collider;
+		sweep.capsule_w = collider->getQueryCapsule_w();
+		sweep.collidedWith.clear();
+	}
+
+	ms_sweepQueryMask = ConfigSharedCollision::getSpatialSweepAndResolveDefaultMask();
+	ms_database->prepareForConcurrentQueries(ms_sweepQueryMask);
+
+	ms_sweepMutex.enter();
+		ms_nextSweep = 0;
+	ms_sweepMutex.leave();
+
+	int const numberOfThreads = static_cast<int>(ms_sweepThreads.size());
+
+	ms_sweepStart.signal(numberOfThreads);
+
+	runSweeps();
+
+	for (int i = 0; i < numberOfThreads; ++i)
+		ms_sweepDone.wait();
+
+	timer.stop();
+	sweepTime += timer.getElapsedTime();
+	sweepCount += ms_numberOfSweeps;
+
+	// ----------
+
+	int nextSweep = 0;
+
+	for (ColliderList::const_iterator i = active.begin(); i != active.end(); ++i)
+	{
+		CollisionProperty * const collider = *i;
 
-		if (doCollisionWithTerrain(object))
+		if (collider->getFootprint())
 		{
-			hadACollisionThisFrame = true;
+			update(collider, time);
+			continue;
 		}
 
-		if (!hadACollisionThisFrame)
+		PROFILER_AUTO_BLOCK_DEFINE("CollisionWorld::update: foot == nullptr");
+
+		if (nextSweep < ms_numberOfSweeps && ms_sweeps[static_cast<size_t>(nextSweep)].collider == collider)
 		{
-			noCollisionDetectionThisFrame(object);
+			timer.start();
+
+			IGNORE_RETURN(resolveSpatialSweep(collider, ms_sweeps[static_cast<size_t>(nextSweep)].collidedWith));
+
+			timer.stop();
+			sweepResolveTime += timer.getElapsedTime();
+
+			++nextSweep;
 		}
-	}
 
-	return(hadACollisionThisFrame);
+		collider->storePosition();
+		collider->updateIdle();
+	}
 }
 
 // ----------------------------------------------------------------------
@@ -927,6 +1231,13 @@ bool CollisionWorld::isUpdating(void)
 
 // ----------------------------------------------------------------------
 
+CollisionWorld::UpdateTimings const & CollisionWorld::getLastUpdateTimings()
+{
+	return ms_lastUpdateTimings;
+}
+
+// ----------------------------------------------------------------------
+
 void CollisionWorld::updateReportString(void)
 {
 	ms_reportString.clear();
@@ -1016,6 +1327,15 @@ void CollisionWorld::updateReportString(void)
 	sprintf(buffer, "Post-update          : %1.3f msec\n", postUpdateTime * 1000.0f);
 	ms_reportString += buffer;
 
+	sprintf(buffer, "Spatial sweep        : %1.3f msec, %d sweeps on %d threads\n", sweepTime * 1000.0f, ms_lastUpdateTimings.sweptColliders, ms_lastUpdateTimings.sweepThreads);
+	ms_reportString += buffer;
+
+	sprintf(buffer, "Batched queries      : %d queries, %d reused, %d traversals, %d invalidated\n", batchedQueryCount, reusedQueryCount, batchedTraversalCount, invalidatedQueryCount);
+	ms_reportString += buffer;
+
+	sprintf(buffer, "Sweep resolution     : %1.3f msec\n", sweepResolveTime * 1000.0f);
+	ms_reportString += buffer;
+
 	extentUpdateCount = 0;
 
 	behaviorAlterCount = 0;
@@ -1115,6 +1435,10 @@ void CollisionWorld::addObject(Object * object)
 		environmentChanged(MultiShape(collision->getBoundingSphere_w()));
 	}
 
+	// only the batched answers the new object may belong in are stale
+
+	ms_queryBatch->onObjectAdded(*collision);
+
 	if (added)
 	{
 		char const * name = object->getObjectTemplateName();
@@ -1166,6 +1490,10 @@ void CollisionWorld::removeObject(Object * object)
 
 	// ----------
 
+	// only the batched answers that hold the object are stale
+
+	ms_queryBatch->onObjectRemoved(*collision);
+
 	bool removed = false;
 
 	if (collision->isMobile())
@@ -1234,6 +1562,11 @@ void CollisionWorld::moveObject(Object * object)
 
 	if (!collision->isMobile())
 	{
+		// batched line of sight answers assume statics stay put
+
+		ms_queryBatch->onObjectRemoved(*collision);
+		ms_queryBatch->onObjectAdded(*collision);
+
 		environmentChanged(MultiShape(collision->getBoundingSphere_w()));
 	}
 }
@@ -1274,6 +1607,9 @@ void CollisionWorld::appearanceChanged(Object * object)
 	{
 		IGNORE_RETURN(ms_database->moveObject(collision));
 
+		ms_queryBatch->onObjectRemoved(*collision);
+		ms_queryBatch->onObjectAdded(*collision);
+
 		collision->initFloor();
 	}
 }
@@ -1323,6 +1659,18 @@ SpatialDatabase * CollisionWorld::getDatabase(void)
 	return ms_database;
 }
 
+// ----------------------------------------------------------------------
+/**
+ * The query batch for the current frame.  It is cleared at the start of
+ * each update().
+ */
+
+SpatialQueryBatch & CollisionWorld::getQueryBatch(void)
+{
+	NOT_NULL(ms_queryBatch);
+	return *ms_queryBatch;
+}
+
 // ----------------------------------------------------------------------
 
 void CollisionWorld::objectWarped(Object * object)
@@ -1395,7 +1743,18 @@ QueryInteractionResult CollisionWorld::queryInteraction(CellProperty const * cel
 	Object const * hitObject;
 	float hitTime = 0.0f;
 
-	if (ms_database->queryInteraction(cellA, inSeg, ignoreObject, hitObject, hitTime))
+	// The candidates along the segment come through the query batch, so a
+	// line of sight checked back from its target reuses the check out to it
+
+	static ColliderList results;
+	static ColliderList barrierResults;
+
+	results.clear();
+	barrierResults.clear();
+
+	ms_queryBatch->findOnSegment(CollisionUtils::transformToWorld(cellA, inSeg.getBegin()), CollisionUtils::transformToWorld(cellA, inSeg.getEnd()), results, barrierResults);
+
+	if (ms_database->testInteraction(cellA, inSeg, ignoreObject, results, barrierResults, hitObject, hitTime))
 	{
 		if (hitTime < hitPortalTime)
 		{
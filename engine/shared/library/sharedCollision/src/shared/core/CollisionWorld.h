@@ -25,6 +25,7 @@ class Line3d;
 class Object;
 class Segment3d;
 class SpatialDatabase;
+class SpatialQueryBatch;
 class Sphere;
 class MultiShape;
 
@@ -52,6 +53,25 @@ public:
 	static void registerDoCollisionDetectionOnHit(CollisionDetectionOnHitFunction);
 	static void registerDoCollisionWithTerrain(DoCollisionWithTerrainFunction);
 
+	// where the last update's time went, in seconds
+	struct UpdateTimings
+	{
+		int   activeColliders;
+		int   sweptColliders;
+		int   sweepThreads;
+		float total;
+		float sweep;
+		float sweepResolve;
+		float floorUpdate;
+		float footprintUpdate;
+		float collisionDetect;
+		float resolveCollisions;
+		float terrainHeight;
+		float postUpdate;
+	};
+
+	static UpdateTimings const & getLastUpdateTimings();
+
 public:
 	
 	// ----------
@@ -82,6 +102,7 @@ public:
 	static void    objectWarped    ( Object * object );
 	
 	static SpatialDatabase * getDatabase ( void );
+	static SpatialQueryBatch & getQueryBatch ( void );
 	
 	// ----------
 	// Queries
@@ -147,6 +168,8 @@ protected:
 	static ResolutionResult updateStep    ( CollisionProperty * collision, float time );
 
 	static bool spatialSweepAndResolve(CollisionProperty * collider);
+	static bool resolveSpatialSweep(CollisionProperty * collider, ColliderList const & collidedWith);
+	static void updateWithParallelSweeps(ColliderList const & active, float time);
 
 	// ----------
 	
@@ -73,6 +73,9 @@ IsPlayerHouseHook ms_isPlayerHouseHook = nullptr;
 
 	int ms_spatialSweepAndResolveDefaultMask = static_cast<int>(SpatialDatabase::Q_Static);
 
+	int ms_sweepThreads = 0;
+	int ms_sweepThreadsMinimumColliders = 256;
+
 	bool ms_spaceAiLoggingEnabled = false;
 	bool ms_useOriginalAvoidanceAlgorithm = false;
 }
@@ -134,6 +137,9 @@ void ConfigSharedCollision::install ( void )
 	ms_hopHeight             = ConfigFile::getKeyFloat("SharedCollision", "hopHeight",             ms_hopHeight);
 	ms_terrainLOSMinDistance = ConfigFile::getKeyFloat("SharedCollision", "terrainLOSMinDistance", ms_terrainLOSMinDistance);
 	ms_terrainLOSMaxDistance = ConfigFile::getKeyFloat("SharedCollision", "terrainLOSMaxDistance", ms_terrainLOSMaxDistance);
+
+	ms_sweepThreads                 = ConfigFile::getKeyInt("SharedCollision", "sweepThreads",                 ms_sweepThreads);
+	ms_sweepThreadsMinimumColliders = ConfigFile::getKeyInt("SharedCollision", "sweepThreadsMinimumColliders", ms_sweepThreadsMinimumColliders);
 }
 
 // ----------------------------------------------------------------------
@@ -199,6 +205,9 @@ float ConfigSharedCollision::getTerrainLOSMaxDistance   ( void ) { return ms_ter
 float ConfigSharedCollision::getLosUprightScale         ( void ) { return ms_losUprightScale; }
 float ConfigSharedCollision::getLosProneScale           ( void ) { return ms_losProneScale; }
 
+int ConfigSharedCollision::getSweepThreads() { return ms_sweepThreads; }
+int ConfigSharedCollision::getSweepThreadsMinimumColliders() { return ms_sweepThreadsMinimumColliders; }
+
 bool ConfigSharedCollision::isSpaceAiLoggingEnabled() { return ms_spaceAiLoggingEnabled; }
 bool ConfigSharedCollision::useOriginalAvoidanceAlgorithm() { return ms_useOriginalAvoidanceAlgorithm; }
 
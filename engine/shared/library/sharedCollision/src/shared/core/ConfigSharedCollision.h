@@ -91,6 +91,11 @@ public:
 	static int getSpatialSweepAndResolveDefaultMask();
 	static void setSpatialSweepAndResolveDefaultMask(int queryMask);
 
+	// spatial sweeps for colliders without footprints run on this many extra
+	// threads once at least the minimum number of colliders is being swept
+	static int getSweepThreads();
+	static int getSweepThreadsMinimumColliders();
+
 	static bool isSpaceAiLoggingEnabled();
 	static bool useOriginalAvoidanceAlgorithm();
 
@@ -30,6 +30,7 @@
 #include "sharedCollision/BoxExtent.h"
 
 #include "sharedDebug/DataLint.h"
+#include "sharedDebug/PerformanceTimer.h"
 
 #include "sharedMath/Triangle3d.h"
 #include "sharedMath/Line3d.h"
@@ -46,6 +47,7 @@
 #include "sharedFoundation/DataResourceList.h"
 
 #include "sharedFile/Iff.h"
+#include "sharedFile/IffView.h"
 
 #include "sharedMath/IndexedTriangleList.h"
 #include "sharedMath/Transform.h"
@@ -795,11 +797,21 @@ void FloorMesh::compile(void)
 }
 
 // ----------------------------------------------------------------------
+// Floors are written as version 0006 unless the baked 0007 format is asked
+// for. A baked floor has its normals facing up, its height functions and
+// its sorted boundary edge lists already in the file, so loading one is a
+// straight copy of the file data with no post-processing. Only builds that
+// can read 0007 should be handed baked floors.
 
-void FloorMesh::write(Iff & iff)
+void FloorMesh::write(Iff & iff, bool baked)
 {
+	Tag const versionTag = baked ? TAG_0007 : TAG_0006;
+
+	if (baked)
+		calcHeightFuncs();
+
 	iff.insertForm(TAG_FLOR);
-	iff.insertForm(TAG_0006);
+	iff.insertForm(versionTag);
 
 	// ----------
 
@@ -826,7 +838,7 @@ void FloorMesh::write(Iff & iff)
 
 		for (int i = 0; i < triCount; i++)
 		{
-			getFloorTri(i).write(iff);
+			getFloorTri(i).write(iff, baked);
 		}
 	}
 	iff.exitChunk(TAG_TRIS);
@@ -840,50 +852,44 @@ void FloorMesh::write(Iff & iff)
 
 	// ----------
 
-	if (!m_crossableEdges->empty() || !m_uncrossableEdges->empty() || !m_wallBaseEdges->empty())
+	FloorEdgeIdVec const * const edgeLists[] = { m_crossableEdges, m_uncrossableEdges, m_wallBaseEdges };
+
+	if (baked)
 	{
 		iff.insertChunk(TAG_BEDG);
 		{
-			int totalEdgeCount = m_crossableEdges->size() + m_uncrossableEdges->size() + m_wallBaseEdges->size();
-
-			iff.insertChunkData(totalEdgeCount);
-
+			for (int list = 0; list < 3; list++)
 			{
-				int edgeCount = m_crossableEdges->size();
-
-				for (int i = 0; i < edgeCount; i++)
-				{
-					FloorEdgeId & id = m_crossableEdges->at(i);
-
-					bool crossable = getFloorTri(id.triId).isCrossable(id.edgeId);
-
-					iff.insertChunkData(id.triId);
-					iff.insertChunkData(id.edgeId);
-					iff.insertChunkData(crossable);
-				}
-			}
+				int edgeCount = edgeLists[list]->size();
 
-			{
-				int edgeCount = m_uncrossableEdges->size();
+				iff.insertChunkData(edgeCount);
 
 				for (int i = 0; i < edgeCount; i++)
 				{
-					FloorEdgeId & id = m_uncrossableEdges->at(i);
-
-					bool crossable = getFloorTri(id.triId).isCrossable(id.edgeId);
+					FloorEdgeId const & id = edgeLists[list]->at(i);
 
 					iff.insertChunkData(id.triId);
 					iff.insertChunkData(id.edgeId);
-					iff.insertChunkData(crossable);
 				}
 			}
+		}
+		iff.exitChunk(TAG_BEDG);
+	}
+	else if (!m_crossableEdges->empty() || !m_uncrossableEdges->empty() || !m_wallBaseEdges->empty())
+	{
+		iff.insertChunk(TAG_BEDG);
+		{
+			int totalEdgeCount = m_crossableEdges->size() + m_uncrossableEdges->size() + m_wallBaseEdges->size();
 
+			iff.insertChunkData(totalEdgeCount);
+
+			for (int list = 0; list < 3; list++)
 			{
-				int edgeCount = m_wallBaseEdges->size();
+				int edgeCount = edgeLists[list]->size();
 
 				for (int i = 0; i < edgeCount; i++)
 				{
-					FloorEdgeId & id = m_wallBaseEdges->at(i);
+					FloorEdgeId const & id = edgeLists[list]->at(i);
 
 					bool crossable = getFloorTri(id.triId).isCrossable(id.edgeId);
 
@@ -907,7 +913,7 @@ void FloorMesh::write(Iff & iff)
 
 	// ----------
 
-	iff.exitForm(TAG_0006);
+	iff.exitForm(versionTag);
 	iff.exitForm(TAG_FLOR);
 }
 
@@ -960,6 +966,11 @@ void FloorMesh::read(Iff & iff)
 		read_0006(iff);
 		break;
 
+	case TAG_0007:
+		version = 7;
+		read_0007(iff);
+		break;
+
 	default:
 		version = -1;
 		FATAL(true, ("FloorMesh::Invalid version"));
@@ -1005,7 +1016,7 @@ void FloorMesh::read(Iff & iff)
 
 	calcBounds();
 
-	calcHeightFuncs();
+	if (version < 7) calcHeightFuncs();
 
 	if (version < 5) buildBoundaryEdgeList();
 
@@ -1195,14 +1206,18 @@ void FloorMesh::read_0003(Iff & iff)
 
 	iff.enterChunk(TAG_TRIS);
 	{
+		IffView view(iff);
+
 		FloorTri F;
 
-		while (iff.getChunkLengthLeft())
+		while (view.getChunkLengthLeft())
 		{
-			F.read_0001(iff);
+			F.read_0001(view);
 
 			m_floorTris->push_back(F);
 		}
+
+		view.advance(iff);
 	}
 	iff.exitChunk(TAG_TRIS);
 
@@ -1234,14 +1249,18 @@ void FloorMesh::read_0004(Iff & iff)
 
 	iff.enterChunk(TAG_TRIS);
 	{
+		IffView view(iff);
+
 		FloorTri F;
 
-		while (iff.getChunkLengthLeft())
+		while (view.getChunkLengthLeft())
 		{
-			F.read_0001(iff);
+			F.read_0001(view);
 
 			m_floorTris->push_back(F);
 		}
+
+		view.advance(iff);
 	}
 	iff.exitChunk(TAG_TRIS);
 
@@ -1287,17 +1306,16 @@ void FloorMesh::read_0005(Iff & iff)
 
 	iff.enterChunk(TAG_VERT);
 	{
-		int vertexCount = iff.getChunkLengthTotal() / sizeof(Vector);
+		IffView view(iff);
 
-		m_vertices->clear();
-		m_vertices->reserve(vertexCount);
+		int vertexCount = view.getChunkLengthLeft(3 * isizeof(float));
 
-		while (iff.getChunkLengthLeft())
-		{
-			Vector V = iff.read_floatVector();
+		m_vertices->resize(vertexCount);
 
-			m_vertices->push_back(V);
-		}
+		if (vertexCount)
+			view.read_floatVector(vertexCount, &(*m_vertices)[0]);
+
+		view.advance(iff);
 	}
 	iff.exitChunk(TAG_VERT);
 
@@ -1305,19 +1323,23 @@ void FloorMesh::read_0005(Iff & iff)
 
 	iff.enterChunk(TAG_TRIS);
 	{
-		int triCount = iff.getChunkLengthTotal() / FloorTri::getOnDiskSize_0001();
+		IffView view(iff);
+
+		int triCount = view.getChunkLengthTotal() / FloorTri::getOnDiskSize_0001();
 
 		m_floorTris->clear();
 		m_floorTris->reserve(triCount);
 
 		FloorTri F;
 
-		while (iff.getChunkLengthLeft())
+		while (view.getChunkLengthLeft())
 		{
-			F.read_0001(iff);
+			F.read_0001(view);
 
 			m_floorTris->push_back(F);
 		}
+
+		view.advance(iff);
 	}
 	iff.exitChunk(TAG_TRIS);
 
@@ -1398,17 +1420,16 @@ void FloorMesh::read_0006(Iff & iff)
 
 	iff.enterChunk(TAG_VERT);
 	{
-		int vertexCount = iff.read_int32();
+		IffView view(iff);
 
-		m_vertices->clear();
-		m_vertices->reserve(vertexCount);
+		int vertexCount = view.read_int32();
 
-		for (int i = 0; i < vertexCount; i++)
-		{
-			Vector V = iff.read_floatVector();
+		m_vertices->resize(vertexCount);
 
-			m_vertices->push_back(V);
-		}
+		if (vertexCount)
+			view.read_floatVector(vertexCount, &(*m_vertices)[0]);
+
+		view.advance(iff);
 	}
 	iff.exitChunk(TAG_VERT);
 
@@ -1416,7 +1437,9 @@ void FloorMesh::read_0006(Iff & iff)
 
 	iff.enterChunk(TAG_TRIS);
 	{
-		int triCount = iff.read_int32();
+		IffView view(iff);
+
+		int triCount = view.read_int32();
 
 		m_floorTris->clear();
 		m_floorTris->reserve(triCount);
@@ -1425,10 +1448,12 @@ void FloorMesh::read_0006(Iff & iff)
 
 		for (int i = 0; i < triCount; i++)
 		{
-			F.read_0002(iff);
+			F.read_0002(view);
 
 			m_floorTris->push_back(F);
 		}
+
+		view.advance(iff);
 	}
 	iff.exitChunk(TAG_TRIS);
 
@@ -1499,6 +1524,120 @@ void FloorMesh::read_0006(Iff & iff)
 	iff.exitForm(TAG_0006);
 }
 
+// ----------------------------------------------------------------------
+// Version 0007 is the baked format written by write(). Every chunk is
+// read in place with no per-element fixup beyond the box tree's child
+// links, and the normal flip and height function pass are skipped.
+
+void FloorMesh::read_0007(Iff & iff)
+{
+	iff.enterForm(TAG_0007);
+
+	// ----------
+
+	iff.enterChunk(TAG_VERT);
+	{
+		IffView view(iff);
+
+		int vertexCount = view.read_int32();
+
+		m_vertices->resize(vertexCount);
+
+		if (vertexCount)
+			view.read_floatVector(vertexCount, &(*m_vertices)[0]);
+
+		view.advance(iff);
+	}
+	iff.exitChunk(TAG_VERT);
+
+	// ----------
+
+	iff.enterChunk(TAG_TRIS);
+	{
+		IffView view(iff);
+
+		int triCount = view.read_int32();
+
+		m_floorTris->resize(triCount);
+
+		for (int i = 0; i < triCount; i++)
+		{
+			(*m_floorTris)[i].read_0003(view);
+		}
+
+		view.advance(iff);
+	}
+	iff.exitChunk(TAG_TRIS);
+
+	// ----------
+
+	if (iff.getCurrentName() == TAG_BTRE)
+	{
+		m_boxTree = new BoxTree();
+
+		m_boxTree->read(iff);
+	}
+
+	// ----------
+
+	iff.enterChunk(TAG_BEDG);
+	{
+		IffView view(iff);
+
+		FloorEdgeIdVec * const edgeLists[] = { m_crossableEdges, m_uncrossableEdges, m_wallBaseEdges };
+
+		int const triCount = getTriCount();
+
+		for (int list = 0; list < 3; list++)
+		{
+			int edgeCount = view.read_int32();
+
+			IffView::Span<int32> const ids = view.read_span<int32>(edgeCount * 2);
+
+			edgeLists[list]->resize(edgeCount);
+
+			for (int i = 0; i < edgeCount; i++)
+			{
+				int const triId = ids[i * 2];
+				int const edgeId = ids[i * 2 + 1];
+
+				// The baked lists are used as-is, so a bad entry here would index past the tris later on
+
+				FATAL((triId < 0) || (triId >= triCount), ("FloorMesh::read_0007 - %s has a boundary edge on tri %d, but the floor only has %d tris", iff.getFileName(), triId, triCount));
+				FATAL((edgeId < 0) || (edgeId > 2), ("FloorMesh::read_0007 - %s has a boundary edge with invalid edge id %d on tri %d", iff.getFileName(), edgeId, triId));
+
+				(*edgeLists[list])[i] = FloorEdgeId(triId, edgeId);
+			}
+		}
+
+		view.advance(iff);
+	}
+	iff.exitChunk(TAG_BEDG);
+
+	// ----------
+
+	if (!iff.atEndOfForm() && iff.getCurrentName() == TAG_PGRF)
+	{
+		ObjectFactory pathGraphFactory = FloorManager::getPathGraphFactory();
+
+		if (pathGraphFactory && CollisionWorld::isServerSide())
+		{
+			BaseClass * pathGraph = pathGraphFactory(iff);
+
+			attachPathGraph(pathGraph);
+		}
+		else
+		{
+			iff.enterForm();
+			iff.exitForm(true);
+		}
+	}
+
+	// ----------
+
+	iff.exitForm(TAG_0007);
+}
+
 // ======================================================================
 // DataResource implementation
 
@@ -1540,6 +1679,194 @@ void FloorMesh::remove(void)
 	FloorMeshList::remove();
 }
 
+// ----------------------------------------------------------------------
+/**
+ * Rewrite a floor as a baked 0007 floor.  The input may be any version
+ * FloorMesh can read.  A path graph in the input is only carried over
+ * where the pathfinding library is installed, as on the game server.
+ *
+ * @return false if the input could not be opened or the output written
+ */
+
+bool FloorMesh::bake(char const * const inputFileName, char const * const outputFileName)
+{
+	Iff inputIff;
+	if (!inputIff.open(inputFileName, true))
+		return false;
+
+	FloorMesh mesh(inputFileName);
+	mesh.read(inputIff);
+
+	Iff outputIff(1024 * 1024);
+	mesh.write(outputIff, true);
+
+	return outputIff.write(outputFileName, true);
+}
+
+// ----------------------------------------------------------------------
+
+namespace FloorMeshNamespace
+{
+	/**
+	 * Drop queryCount vertical lines and floor locators on a gridSize x gridSize
+	 * floor, at points spread over it by a fixed low discrepancy sequence, and
+	 * time the line and the contact queries separately.  The tri each query
+	 * found, or -1, is appended to results.
+	 */
+	void timeQueries(FloorMesh const & mesh, int const gridSize, int const queryCount, float & lineTime, float & contactTime, std::vector<int> & results)
+	{
+		std::vector<Vector> points;
+		points.reserve(static_cast<size_t>(queryCount));
+		for (int i = 0; i < queryCount; ++i)
+		{
+			float const u = static_cast<float>(i) * 0.7548776662f;
+			float const v = static_cast<float>(i) * 0.5698402910f;
+			points.push_back(Vector((u - floorf(u)) * static_cast<float>(gridSize), 0.0f, (v - floorf(v)) * static_cast<float>(gridSize)));
+		}
+
+		PerformanceTimer timer;
+		timer.start();
+		for (std::vector<Vector>::const_iterator i = points.begin(); i != points.end(); ++i)
+		{
+			ContactPoint contact;
+			bool const hit = mesh.intersectClosest(Segment3d(*i + Vector(0.0f, 10.0f, 0.0f), *i - Vector(0.0f, 10.0f, 0.0f)), contact);
+			results.push_back(hit ? contact.getId() : -1);
+		}
+		timer.stop();
+		lineTime = timer.getElapsedTime();
+
+		timer.start();
+		for (std::vector<Vector>::const_iterator i = points.begin(); i != points.end(); ++i)
+		{
+			FloorLocator result;
+			bool const found = mesh.findFloorTri(FloorLocator(&mesh, *i + Vector(0.0f, 0.5f, 0.0f)), false, result);
+			results.push_back(found ? result.getTriId() : -1);
+		}
+		timer.stop();
+		contactTime = timer.getElapsedTime();
+	}
+}
+
+using namespace FloorMeshNamespace;
+
+// ----------------------------------------------------------------------
+/**
+ * Build a rolling gridSize x gridSize floor, write it as an unbaked 0006
+ * and a baked 0007 floor, and load each loadCount times.  Then run
+ * queryCount line and contact queries against each load.
+ *
+ * @return the number of tris, boundary edges and query results on which the
+ * two loads disagree
+ */
+
+int FloorMesh::verifyBakedLoad(int const gridSize, int const loadCount, int const queryCount, BakedLoadTimes & unbakedTimes, BakedLoadTimes & bakedTimes)
+{
+	VectorVector vertices;
+	IntVector indices;
+
+	for (int z = 0; z <= gridSize; ++z)
+		for (int x = 0; x <= gridSize; ++x)
+			vertices.push_back(Vector(static_cast<float>(x), 0.25f * sinf(0.3f * static_cast<float>(x)) * cosf(0.2f * static_cast<float>(z)), static_cast<float>(z)));
+
+	for (int z = 0; z < gridSize; ++z)
+	{
+		for (int x = 0; x < gridSize; ++x)
+		{
+			int const corner = z * (gridSize + 1) + x;
+
+			indices.push_back(corner);
+			indices.push_back(corner + gridSize + 1);
+			indices.push_back(corner + 1);
+
+			indices.push_back(corner + 1);
+			indices.push_back(corner + gridSize + 1);
+			indices.push_back(corner + gridSize + 2);
+		}
+	}
+
+	Iff unbakedIff(1024 * 1024);
+	Iff bakedIff(1024 * 1024);
+	{
+		FloorMesh source(vertices, indices);
+		source.write(unbakedIff);
+		source.write(bakedIff, true);
+	}
+
+	// ----------
+
+	FloorMesh unbakedMesh("");
+	FloorMesh bakedMesh("");
+
+	PerformanceTimer timer;
+	timer.start();
+	for (int i = 0; i < loadCount; ++i)
+	{
+		Iff iff(unbakedIff.getRawDataSize(), unbakedIff.getRawData(), false);
+		unbakedMesh.read(iff);
+	}
+	timer.stop();
+	unbakedTimes.load = timer.getElapsedTime();
+
+	timer.start();
+	for (int i = 0; i < loadCount; ++i)
+	{
+		Iff iff(bakedIff.getRawDataSize(), bakedIff.getRawData(), false);
+		bakedMesh.read(iff);
+	}
+	timer.stop();
+	bakedTimes.load = timer.getElapsedTime();
+
+	std::vector<int> unbakedResults;
+	std::vector<int> bakedResults;
+	timeQueries(unbakedMesh, gridSize, queryCount, unbakedTimes.lineQueries, unbakedTimes.contactQueries, unbakedResults);
+	timeQueries(bakedMesh, gridSize, queryCount, bakedTimes.lineQueries, bakedTimes.contactQueries, bakedResults);
+
+	// ----------
+
+	int mismatches = 0;
+
+	if (unbakedMesh.getTriCount() != bakedMesh.getTriCount())
+		++mismatches;
+	else
+	{
+		for (int i = 0; i < bakedMesh.getTriCount(); ++i)
+		{
+			FloorTri const & unbakedTri = unbakedMesh.getFloorTri(i);
+			FloorTri const & bakedTri = bakedMesh.getFloorTri(i);
+			Vector const center = (bakedMesh.getVertex(bakedTri.getCornerIndex(0)) + bakedMesh.getVertex(bakedTri.getCornerIndex(1)) + bakedMesh.getVertex(bakedTri.getCornerIndex(2))) / 3.0f;
+
+			if (   unbakedTri.getCornerIndex(0) != bakedTri.getCornerIndex(0)
+			    || unbakedTri.getCornerIndex(1) != bakedTri.getCornerIndex(1)
+			    || unbakedTri.getCornerIndex(2) != bakedTri.getCornerIndex(2)
+			    || unbakedTri.getNormal().magnitudeBetweenSquared(bakedTri.getNormal()) > 0.000001f
+			    || std::abs(unbakedTri.getHeightAt(center.x, center.z) - bakedTri.getHeightAt(center.x, center.z)) > 0.001f)
+				++mismatches;
+		}
+	}
+
+	for (int edgeType = FET_Uncrossable; edgeType <= FET_WallTop; ++edgeType)
+	{
+		FloorEdgeIdVec unbakedEdges(unbakedMesh.getEdgeList(static_cast<FloorEdgeType>(edgeType)));
+		FloorEdgeIdVec bakedEdges(bakedMesh.getEdgeList(static_cast<FloorEdgeType>(edgeType)));
+
+		if (unbakedEdges.size() != bakedEdges.size())
+		{
+			++mismatches;
+			continue;
+		}
+
+		for (FloorEdgeIdVec::size_type i = 0; i < bakedEdges.size(); ++i)
+			if (unbakedEdges[i].triId != bakedEdges[i].triId || unbakedEdges[i].edgeId != bakedEdges[i].edgeId)
+				++mismatches;
+	}
+
+	for (std::vector<int>::size_type i = 0; i < bakedResults.size(); ++i)
+		if (unbakedResults[i] != bakedResults[i])
+			++mismatches;
+
+	return mismatches;
+}
+
 // ----------------------------------------------------------------------
 
 bool FloorMesh::findFloorTri(FloorLocator const & testLoc,
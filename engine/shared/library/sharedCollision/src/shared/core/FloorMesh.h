@@ -57,6 +57,13 @@ class FloorMesh : public CollisionMesh, public DataResource
 {
 public:
 
+	struct BakedLoadTimes
+	{
+		float load;
+		float lineQueries;
+		float contactQueries;
+	};
+
 	explicit FloorMesh(const std::string & filename);
 	FloorMesh( VectorVector const & vertices, IntVector const & indices );
 
@@ -66,6 +73,8 @@ public:
 
 	static void                 install         ( void );
 	static void                 remove          ( void );
+	static bool                 bake            ( char const * inputFileName, char const * outputFileName );
+	static int                  verifyBakedLoad ( int gridSize, int loadCount, int queryCount, BakedLoadTimes & unbakedTimes, BakedLoadTimes & bakedTimes );
 
 	static FloorMesh *          create          ( const std::string & filename );
 
@@ -134,7 +143,7 @@ public:
 
 	// ----------
 
-	void    write           ( Iff & iff );
+	void    write           ( Iff & iff, bool baked = false );
 	void    read            ( Iff & iff );
 	void    read_0000       ( Iff & iff );
 	void    read_0001       ( Iff & iff );
@@ -143,6 +152,7 @@ public:
 	void    read_0004       ( Iff & iff );
 	void    read_0005       ( Iff & iff );
 	void    read_0006       ( Iff & iff );
+	void    read_0007       ( Iff & iff );
 
 	// ----------
 
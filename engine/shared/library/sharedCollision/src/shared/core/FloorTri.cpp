@@ -9,6 +9,7 @@
 #include "sharedCollision/FloorTri.h"
 
 #include "sharedFile/Iff.h"
+#include "sharedFile/IffView.h"
 
 IndexedTri::IndexedTri()
 {
@@ -26,6 +27,13 @@ void	IndexedTri::read_0000	( Iff & iff )
 	setCornerIndex( 2, iff.read_int32() );
 }
 
+void	IndexedTri::read_0000	( IffView & iff )
+{
+	setCornerIndex( 0, iff.read_int32() );
+	setCornerIndex( 1, iff.read_int32() );
+	setCornerIndex( 2, iff.read_int32() );
+}
+
 void	IndexedTri::write		( Iff & iff ) const
 {
 	iff.insertChunkData( getCornerIndex(0) );
@@ -55,6 +63,17 @@ void	ConnectedTri::read_0000	( Iff & iff )
 	setNeighborIndex( 2, iff.read_int32() );
 }
 
+void	ConnectedTri::read_0000	( IffView & iff )
+{
+	IndexedTri::read_0000(iff);
+
+	setIndex( iff.read_int32() );
+
+	setNeighborIndex( 0, iff.read_int32() );
+	setNeighborIndex( 1, iff.read_int32() );
+	setNeighborIndex( 2, iff.read_int32() );
+}
+
 void	ConnectedTri::write	( Iff & iff ) const
 {
 	IndexedTri::write(iff);
@@ -109,7 +128,7 @@ void	FloorTri::read_0000		( Iff & iff )
 
 // ----------
 
-void    FloorTri::read_0001     ( Iff & iff )
+void    FloorTri::read_0001     ( IffView & iff )
 {
 	ConnectedTri::read_0000(iff);
 
@@ -130,7 +149,7 @@ void    FloorTri::read_0001     ( Iff & iff )
 
 // ----------
 
-void    FloorTri::read_0002     ( Iff & iff )
+void    FloorTri::read_0002     ( IffView & iff )
 {
 	ConnectedTri::read_0000(iff);
 
@@ -149,9 +168,20 @@ void    FloorTri::read_0002     ( Iff & iff )
     setPortalId( 2, iff.read_int32() );
 }
 
+// ----------
+// Version 0003 adds the height function, so it doesn't have to be
+// recalculated from the normal at load time.
+
+void    FloorTri::read_0003     ( IffView & iff )
+{
+	read_0002(iff);
+
+	setHeightFunc( iff.read_floatVector() );
+}
+
 // ----------------------------------------------------------------------
 
-void	FloorTri::write			( Iff & iff ) const
+void	FloorTri::write			( Iff & iff, bool withHeightFunc ) const
 {
 	ConnectedTri::write(iff);
 
@@ -168,10 +198,20 @@ void	FloorTri::write			( Iff & iff ) const
     iff.insertChunkData( getPortalId(0) );
     iff.insertChunkData( getPortalId(1) );
     iff.insertChunkData( getPortalId(2) );
+
+	// Baked (0007) floors carry the height function, see read_0003
+
+	if (withHeightFunc)
+		iff.insertChunkFloatVector( getHeightFunc() );
 }
 
 // ----------------------------------------------------------------------
 
+Vector const & FloorTri::getHeightFunc ( void ) const
+{
+	return m_heightFunc;
+}
+
 void FloorTri::setHeightFunc ( Vector const & heightFunc )
 {
 	m_heightFunc = heightFunc;
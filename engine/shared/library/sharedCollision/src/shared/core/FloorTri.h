@@ -14,6 +14,7 @@
 #include "sharedCollision/CollisionEnums.h"
 
 class Iff;
+class IffView;
 
 // ======================================================================
 // Dumb Data
@@ -30,6 +31,7 @@ public:
     void    setCornerIndex  ( int whichCorner, int newIndex );
 
     void    read_0000       ( Iff & iff );
+    void    read_0000       ( IffView & iff );
     void    write           ( Iff & iff ) const;
 
     // ----------
@@ -67,6 +69,7 @@ public:
     void    setNeighborIndex    ( int whichEdge, int newIndex );
 
     void    read_0000           ( Iff & iff );
+    void    read_0000           ( IffView & iff );
     void    write               ( Iff & iff ) const;
 
     // ----------
@@ -134,10 +137,12 @@ public:
     void            setPortalId    ( int whichEdge, int newId );
 
     void            read_0000      ( Iff & iff );
-    void            read_0001      ( Iff & iff );
-    void            read_0002      ( Iff & iff );
-    void            write          ( Iff & iff ) const;
+    void            read_0001      ( IffView & iff );
+    void            read_0002      ( IffView & iff );
+    void            read_0003      ( IffView & iff );
+    void            write          ( Iff & iff, bool withHeightFunc = false ) const;
 
+	Vector const &  getHeightFunc  ( void ) const;
 	void            setHeightFunc  ( Vector const & func );
 	float           getHeightAt    ( float x, float z ) const;
 
@@ -15,6 +15,7 @@
 #include "sharedCollision/ConfigSharedCollision.h"
 #include "sharedCollision/Intersect3d.h"
 #include "sharedCollision/SpatialDatabase.h"
+#include "sharedMath/Capsule.h"
 #include "sharedMath/Range.h"
 #include "sharedObject/CellProperty.h"
 #include "sharedObject/Object.h"
@@ -68,8 +69,6 @@ bool SpaceAvoidanceManager::getAvoidancePosition(Object const & unit, Vector con
 
 bool SpaceAvoidanceManager::getAvoidancePosition(Transform const & objectTransform_o2w, float const collisionRadius, Vector const & velocity, Vector const & targetPosition_w, Vector & avoidancePosition_w, const Object * const excludeObject, bool const collideWithDynamicObjects)
 {
-	bool hasValidCollision = false;
-
 	float const currentSpeed = velocity.approximateMagnitude();
 
 	if (currentSpeed > FLT_MIN)
@@ -78,12 +77,48 @@ bool SpaceAvoidanceManager::getAvoidancePosition(Transform const & objectTransfo
 		ColliderList colliderList;
 
 		// Sweep the collision representation.
+		Capsule const queryCapsule_w(getQueryCapsule(objectTransform_o2w.getPosition_p(), collisionRadius, targetPosition_w));
+		CellProperty const * const queryCell_w = CellProperty::getWorldCellProperty();
+		CollisionWorld::getDatabase()->queryFor(getQueryMask(collideWithDynamicObjects), queryCell_w, false, queryCapsule_w, colliderList);
+
+		return getAvoidancePosition(objectTransform_o2w, collisionRadius, velocity, targetPosition_w, colliderList, avoidancePosition_w, excludeObject);
+	}
+
+	return false;
+}
+
+// ----------------------------------------------------------------------
+
+int SpaceAvoidanceManager::getQueryMask(bool const collideWithDynamicObjects)
+{
+	return collideWithDynamicObjects ? cs_queryDynamicObjectFlags : cs_queryStaticObjectFlags;
+}
+
+// ----------------------------------------------------------------------
+
+Capsule SpaceAvoidanceManager::getQueryCapsule(Vector const & objectPosition_w, float const collisionRadius, Vector const & targetPosition_w)
+{
+	Sphere const querySphere_w(objectPosition_w, collisionRadius * cs_shipBoundSphereRadiusGain);
+	return Capsule(querySphere_w, targetPosition_w - objectPosition_w);
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Find where to steer around the closest obstacle in colliderList, which
+ * should hold the results of a query made with getQueryMask() and
+ * getQueryCapsule().
+ */
+
+bool SpaceAvoidanceManager::getAvoidancePosition(Transform const & objectTransform_o2w, float const collisionRadius, Vector const & velocity, Vector const & targetPosition_w, ColliderList const & colliderList, Vector & avoidancePosition_w, const Object * const excludeObject)
+{
+	bool hasValidCollision = false;
+
+	float const currentSpeed = velocity.approximateMagnitude();
+
+	if (currentSpeed > FLT_MIN)
+	{
 		Vector const & objectPosition_w = objectTransform_o2w.getPosition_p();
-		Sphere const querySphere_w(objectPosition_w, collisionRadius * cs_shipBoundSphereRadiusGain);
 		Vector const & intersectVector = targetPosition_w - objectPosition_w;
-		Capsule const queryCapsule_w(querySphere_w, intersectVector);
-		CellProperty const * const queryCell_w = CellProperty::getWorldCellProperty();
-		CollisionWorld::getDatabase()->queryFor(collideWithDynamicObjects ? cs_queryDynamicObjectFlags : cs_queryStaticObjectFlags, queryCell_w, false, queryCapsule_w, colliderList);
 
 		if (!colliderList.empty())
 		{
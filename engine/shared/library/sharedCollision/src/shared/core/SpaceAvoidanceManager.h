@@ -8,10 +8,16 @@
 #ifndef INCLUDED_SpaceAvoidanceManager_H
 #define INCLUDED_SpaceAvoidanceManager_H
 
+#include <vector>
+
+class Capsule;
+class CollisionProperty;
 class Object;
 class Transform;
 class Vector;
 
+typedef std::vector<CollisionProperty*>  ColliderList;
+
 // ----------------------------------------------------------------------
 class SpaceAvoidanceManager
 {
@@ -21,6 +27,11 @@ public:
 	static bool getAvoidancePosition(Object const & object, Vector const & sweepVector, Vector const & targetPosition, Vector & avoidancePosition_w, bool collideWithDynamicObjects = false);
 	static bool getAvoidancePosition(Transform const & transform_o2w, float const collisionRadius, Vector const & sweepVector, Vector const & targetPosition, Vector & avoidancePosition_w, const Object * const excludeObject, bool useDynamics = false);
 
+	// For callers that gather the query themselves, e.g. through a SpatialQueryBatch
+	static int getQueryMask(bool useDynamics);
+	static Capsule getQueryCapsule(Vector const & position_w, float const collisionRadius, Vector const & targetPosition);
+	static bool getAvoidancePosition(Transform const & transform_o2w, float const collisionRadius, Vector const & sweepVector, Vector const & targetPosition, ColliderList const & colliderList, Vector & avoidancePosition_w, const Object * const excludeObject);
+
 private:
 
 	static void remove();
@@ -44,6 +44,8 @@
 namespace SpatialDatabaseNamespace
 {
 	SpatialDatabase::ShouldTriggerDoorHitCallback  s_shouldTriggerDoorHitCallback;
+
+	ColliderList s_preparedColliders;
 }
 
 using namespace SpatialDatabaseNamespace;
@@ -576,23 +578,44 @@ void SpatialDatabase::queryFor(int queryMask, CellProperty const * const cell_p,
 
 	ColliderList temporaryCollidedWith;
 
+	findInRange(queryMask, capsule_w, temporaryCollidedWith);
+	filterCollisions(cell_p, restrictToSameCell, capsule_w, temporaryCollidedWith, collidedWith);
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Find everything in the queried trees whose bounding sphere touches the
+ * capsule.
+ */
+
+void SpatialDatabase::findInRange(int queryMask, Capsule const & range_w, ColliderList & candidates) const
+{
 	if (queryMask & Q_Static)
-		m_staticTree->findInRange(capsule_w, temporaryCollidedWith);
+		m_staticTree->findInRange(range_w, candidates);
 
 	if (queryMask & Q_Dynamic)
-		m_dynamicTree->findInRange(capsule_w, temporaryCollidedWith);
+		m_dynamicTree->findInRange(range_w, candidates);
 
 	if (queryMask & Q_Barriers)
-		m_barrierTree->findInRange(capsule_w, temporaryCollidedWith);
+		m_barrierTree->findInRange(range_w, candidates);
 
 	if (queryMask & Q_Doors)
-		m_doorTree->findInRange(capsule_w, temporaryCollidedWith);
+		m_doorTree->findInRange(range_w, candidates);
+}
 
-	int const potentialCount = static_cast<int>(temporaryCollidedWith.size());
+// ----------------------------------------------------------------------
+/**
+ * Test the capsule against the extents of the candidates, adding the ones
+ * it collides with.
+ */
+
+void SpatialDatabase::filterCollisions(CellProperty const * const cell_p, bool restrictToSameCell, Capsule const & capsule_w, ColliderList const & candidates, ColliderList & collidedWith) const
+{
+	int const potentialCount = static_cast<int>(candidates.size());
 
 	for(int i = 0; i < potentialCount; ++i)
 	{
-		CollisionProperty * const toTestCollision = temporaryCollidedWith.at(static_cast<unsigned int>(i));
+		CollisionProperty * const toTestCollision = candidates.at(static_cast<unsigned int>(i));
 
 		Object const * const toTestObject = &toTestCollision->getOwner();
 
@@ -612,6 +635,44 @@ void SpatialDatabase::queryFor(int queryMask, CellProperty const * const cell_p,
 	}
 }
 
+// ----------------------------------------------------------------------
+/**
+ * Bring the cached world extents and transforms of everything in the
+ * queried trees up to date.
+ *
+ * Collision properties and objects compute these lazily on first use, which
+ * writes to them; once they are current, queryFor() only reads and can be
+ * run from worker threads while the main thread waits.
+ */
+
+void SpatialDatabase::prepareForConcurrentQueries(int queryMask) const
+{
+	s_preparedColliders.clear();
+
+	if (queryMask & Q_Static)
+		m_staticTree->dumpSphereTreeObjects(s_preparedColliders);
+
+	if (queryMask & Q_Dynamic)
+		m_dynamicTree->dumpSphereTreeObjects(s_preparedColliders);
+
+	if (queryMask & Q_Barriers)
+		m_barrierTree->dumpSphereTreeObjects(s_preparedColliders);
+
+	if (queryMask & Q_Doors)
+		m_doorTree->dumpSphereTreeObjects(s_preparedColliders);
+
+	for (ColliderList::const_iterator i = s_preparedColliders.begin(); i != s_preparedColliders.end(); ++i)
+	{
+		CollisionProperty const * const collision = *i;
+
+		IGNORE_RETURN(collision->getBoundingSphere_w());
+		IGNORE_RETURN(collision->getExtent_l());
+		IGNORE_RETURN(collision->getOwner().getTransform_o2w());
+	}
+
+	s_preparedColliders.clear();
+}
+
 // ----------------------------------------------------------------------
 // The ignore stack is used for temporarily "hiding" objects during
 // a queryInteraction or queryMaterial test
@@ -1021,9 +1082,6 @@ bool SpatialDatabase::queryInteraction ( CellProperty const * cell,
 										 Object const * & outHitObject,
 										 float & outHitTime) const
 {
-	// NOTE -- this returns the first object tested against and not
-	// the closest as is implied;
-
 	static ColliderList results;
 	static ColliderList barrierResults;
 
@@ -1033,8 +1091,43 @@ bool SpatialDatabase::queryInteraction ( CellProperty const * cell,
 	Vector begin_w = CollisionUtils::transformToWorld(cell,seg_p.getBegin());
 	Vector end_w = CollisionUtils::transformToWorld(cell,seg_p.getEnd());
 
+	findOnSegment(begin_w,end_w,results,barrierResults);
+
+	return testInteraction(cell,seg_p,ignoreObject,results,barrierResults,outHitObject,outHitTime);
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Find the static objects and barriers whose trees say they may lie on
+ * the segment.
+ */
+
+void SpatialDatabase::findOnSegment ( Vector const & begin_w, Vector const & end_w, ColliderList & results, ColliderList & barrierResults ) const
+{
 	m_staticTree->findOnSegment(begin_w,end_w,results);
 	m_barrierTree->findOnSegment(begin_w,end_w,barrierResults);
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Test the segment against the extents of the candidates findOnSegment()
+ * found for it.
+ */
+
+bool SpatialDatabase::testInteraction ( CellProperty const * cell,
+										Segment3d const & seg_p,
+										Object const * ignoreObject,
+										ColliderList const & results,
+										ColliderList const & barrierResults,
+										Object const * & outHitObject,
+										float & outHitTime) const
+{
+	// NOTE -- this returns the first object tested against and not
+	// the closest as is implied;
+
+	static ColliderList candidates;
+
+	candidates.assign(results.begin(), results.end());
 
 	ColliderList::const_iterator ii = barrierResults.begin();
 	ColliderList::const_iterator iiEnd = barrierResults.end();
@@ -1045,11 +1138,11 @@ bool SpatialDatabase::queryInteraction ( CellProperty const * cell,
 		BarrierObject const * const barrier = safe_cast<BarrierObject const * const>(&collision->getOwner());
 
 		if (barrier && barrier->isActive())
-			results.push_back(collision);
+			candidates.push_back(collision);
 	}
 
-	ii = results.begin();
-	iiEnd = results.end();
+	ii = candidates.begin();
+	iiEnd = candidates.end();
 
 	for(; ii != iiEnd; ++ii)
 	{
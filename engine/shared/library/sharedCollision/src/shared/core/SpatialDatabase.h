@@ -93,6 +93,20 @@ public:
 
 	void queryFor(int queryMask, CellProperty const * cell_p, bool restrictToSameCell, Capsule const & capsule_p, ColliderList & collidedWith) const;
 
+	// queryFor() may be called from several threads at once after this, until
+	// anything in the database moves or changes
+	void prepareForConcurrentQueries(int queryMask) const;
+
+	// The two halves of queryFor(), for SpatialQueryBatch to answer several
+	// nearby queries from one traversal of the trees
+	void findInRange(int queryMask, Capsule const & range_w, ColliderList & candidates) const;
+	void filterCollisions(CellProperty const * cell_p, bool restrictToSameCell, Capsule const & capsule_w, ColliderList const & candidates, ColliderList & collidedWith) const;
+
+	// The two halves of queryInteraction(), so the candidates along a line
+	// of sight can be found once for both directions
+	void findOnSegment(Vector const & begin_w, Vector const & end_w, ColliderList & results, ColliderList & barrierResults) const;
+	bool testInteraction(CellProperty const * cell, Segment3d const & seg_p, Object const * ignoreObject, ColliderList const & results, ColliderList const & barrierResults, Object const * & outHitObject, float & outHitTime) const;
+
 	// ----------------------------------------------------------------------
 
 	bool        addFloor                ( Floor * floor );
@@ -0,0 +1,617 @@
+// ======================================================================
+//
+// SpatialQueryBatch.cpp
+// Copyright Sony Online Entertainment, Inc.
+//
+// ======================================================================
+
+#include "sharedCollision/FirstSharedCollision.h"
+#include "sharedCollision/SpatialQueryBatch.h"
+
+#include "sharedCollision/CollisionProperty.h"
+#include "sharedCollision/CollisionUtils.h"
+#include "sharedCollision/Containment3d.h"
+#include "sharedCollision/SpatialDatabase.h"
+#include "sharedMath/Segment3d.h"
+#include "sharedMath/Sphere.h"
+#include "sharedObject/CellProperty.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// ======================================================================
+
+namespace SpatialQueryBatchNamespace
+{
+	// Deferred queries are answered in groups of up to cs_maxGroupSize that
+	// fit in a sphere of cs_maxGroupRadius, each group from one traversal.
+	// Queries are sorted along a Morton curve over cells of the same size so
+	// that neighbours in the sort are usually neighbours in the world.
+
+	int const   cs_maxGroupSize = 16;
+	float const cs_maxGroupRadius = 32.0f;
+
+	// query mask of the entries holding findOnSegment() candidates, which
+	// are answered on the spot and never by execute()
+
+	int const   cs_segmentQueryMask = -1;
+
+	bool   isMemoized(int queryMask);
+	uint32 spreadBits(uint32 value);
+	uint32 getSortKey(Vector const & position_w);
+	uint32 hashFloat(float value);
+}
+
+using namespace SpatialQueryBatchNamespace;
+
+SpatialQueryBatch::QueryId const SpatialQueryBatch::cms_invalidQueryId = -1;
+
+// ======================================================================
+/**
+ * Only queries against objects that hold still for the frame, statics,
+ * barriers and doors, and line of sight candidates, are grouped and reused.
+ * Anything that sees dynamic objects is answered by queryFor() as asked.
+ */
+
+bool SpatialQueryBatchNamespace::isMemoized(int const queryMask)
+{
+	return queryMask == cs_segmentQueryMask || (queryMask & SpatialDatabase::Q_Dynamic) == 0;
+}
+
+// ----------------------------------------------------------------------
+
+uint32 SpatialQueryBatchNamespace::spreadBits(uint32 value)
+{
+	value &= 0x3ff;
+	value = (value | (value << 16)) & 0x030000ff;
+	value = (value | (value << 8)) & 0x0300f00f;
+	value = (value | (value << 4)) & 0x030c30c3;
+	value = (value | (value << 2)) & 0x09249249;
+	return value;
+}
+
+// ----------------------------------------------------------------------
+
+uint32 SpatialQueryBatchNamespace::getSortKey(Vector const & position_w)
+{
+	uint32 const x = static_cast<uint32>(static_cast<int>(floorf(position_w.x / cs_maxGroupRadius)) + 512);
+	uint32 const y = static_cast<uint32>(static_cast<int>(floorf(position_w.y / cs_maxGroupRadius)) + 512);
+	uint32 const z = static_cast<uint32>(static_cast<int>(floorf(position_w.z / cs_maxGroupRadius)) + 512);
+
+	return spreadBits(x) | (spreadBits(y) << 1) | (spreadBits(z) << 2);
+}
+
+// ----------------------------------------------------------------------
+
+uint32 SpatialQueryBatchNamespace::hashFloat(float value)
+{
+	uint32 bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+// ======================================================================
+
+class SpatialQueryBatch::IsAnswered
+{
+public:
+
+	explicit IsAnswered(Entries const & entries) :
+		m_entries(entries)
+	{
+	}
+
+	bool operator ()(QueryId const queryId) const
+	{
+		return m_entries[static_cast<size_t>(queryId)].m_answered;
+	}
+
+private:
+
+	Entries const & m_entries;
+};
+
+// ----------------------------------------------------------------------
+
+class SpatialQueryBatch::SortByLocation
+{
+public:
+
+	explicit SortByLocation(Entries const & entries) :
+		m_entries(entries)
+	{
+	}
+
+	bool operator ()(QueryId const lhs, QueryId const rhs) const
+	{
+		Entry const & a = m_entries[static_cast<size_t>(lhs)];
+		Entry const & b = m_entries[static_cast<size_t>(rhs)];
+
+		if (a.m_key.m_queryMask != b.m_key.m_queryMask)
+			return a.m_key.m_queryMask < b.m_key.m_queryMask;
+
+		return a.m_sortKey < b.m_sortKey;
+	}
+
+private:
+
+	Entries const & m_entries;
+};
+
+// ======================================================================
+
+bool SpatialQueryBatch::Key::operator ==(Key const & rhs) const
+{
+	return m_queryMask == rhs.m_queryMask
+		&& m_cell == rhs.m_cell
+		&& m_restrictToSameCell == rhs.m_restrictToSameCell
+		&& m_pointA == rhs.m_pointA
+		&& m_pointB == rhs.m_pointB
+		&& m_radius == rhs.m_radius; //lint !e777 // testing floats for equality
+}
+
+// ----------------------------------------------------------------------
+
+size_t SpatialQueryBatch::KeyHash::operator ()(Key const & key) const
+{
+	size_t hash = static_cast<size_t>(key.m_queryMask) * 2 + (key.m_restrictToSameCell ? 1 : 0);
+
+	hash = hash * 31 + reinterpret_cast<size_t>(key.m_cell);
+	hash = hash * 31 + hashFloat(key.m_pointA.x);
+	hash = hash * 31 + hashFloat(key.m_pointA.y);
+	hash = hash * 31 + hashFloat(key.m_pointA.z);
+	hash = hash * 31 + hashFloat(key.m_pointB.x);
+	hash = hash * 31 + hashFloat(key.m_pointB.y);
+	hash = hash * 31 + hashFloat(key.m_pointB.z);
+	hash = hash * 31 + hashFloat(key.m_radius);
+
+	return hash;
+}
+
+// ----------------------------------------------------------------------
+
+SpatialQueryBatch::Entry::Entry(Key const & key, Capsule const & capsule_w) :
+	m_key(key),
+	m_capsule_w(capsule_w),
+	m_sortKey(getSortKey(capsule_w.getBoundingSphere().getCenter())),
+	m_firstResult(0),
+	m_resultCount(0),
+	m_barrierResultCount(0),
+	m_answered(false)
+{
+}
+
+// ======================================================================
+
+SpatialQueryBatch::SpatialQueryBatch(SpatialDatabase const & database) :
+	m_database(database),
+	m_entries(),
+	m_entryMap(),
+	m_pending(),
+	m_results(),
+	m_references(),
+	m_candidates(),
+	m_entryCandidates(),
+	m_queryCount(0),
+	m_reusedQueryCount(0),
+	m_traversalCount(0),
+	m_invalidatedQueryCount(0)
+{
+}
+
+// ----------------------------------------------------------------------
+
+SpatialQueryBatch::~SpatialQueryBatch()
+{
+}
+
+// ----------------------------------------------------------------------
+
+SpatialQueryBatch::QueryId SpatialQueryBatch::addSphere(int queryMask, CellProperty const * const cell_p, bool restrictToSameCell, Sphere const & sphere_p)
+{
+	return findOrAdd(queryMask, cell_p, restrictToSameCell, Capsule(sphere_p, Vector::zero));
+}
+
+// ----------------------------------------------------------------------
+
+SpatialQueryBatch::QueryId SpatialQueryBatch::addSegment(int queryMask, CellProperty const * const cell_p, bool restrictToSameCell, Segment3d const & segment_p)
+{
+	return findOrAdd(queryMask, cell_p, restrictToSameCell, Capsule(segment_p.getBegin(), segment_p.getEnd(), 0.0f));
+}
+
+// ----------------------------------------------------------------------
+
+SpatialQueryBatch::QueryId SpatialQueryBatch::addCapsule(int queryMask, CellProperty const * const cell_p, bool restrictToSameCell, Capsule const & capsule_p)
+{
+	return findOrAdd(queryMask, cell_p, restrictToSameCell, capsule_p);
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Answer every query added since the last execute().
+ */
+
+void SpatialQueryBatch::execute()
+{
+	// queries answered through query() in the meantime are already done
+
+	QueryIds::iterator const end = std::remove_if(m_pending.begin(), m_pending.end(), IsAnswered(m_entries));
+	m_pending.erase(end, m_pending.end());
+
+	std::sort(m_pending.begin(), m_pending.end(), SortByLocation(m_entries));
+
+	int const pendingCount = static_cast<int>(m_pending.size());
+	int first = 0;
+
+	while (first < pendingCount)
+	{
+		Entry const & firstEntry = m_entries[static_cast<size_t>(m_pending[static_cast<size_t>(first)])];
+
+		if (!isMemoized(firstEntry.m_key.m_queryMask))
+		{
+			answerDirectly(m_pending[static_cast<size_t>(first)]);
+			++first;
+			continue;
+		}
+
+		Sphere bounds_w(firstEntry.m_capsule_w.getBoundingSphere());
+		int last = first + 1;
+
+		while ((last < pendingCount) && (last - first < cs_maxGroupSize))
+		{
+			Entry const & entry = m_entries[static_cast<size_t>(m_pending[static_cast<size_t>(last)])];
+
+			if (entry.m_key.m_queryMask != firstEntry.m_key.m_queryMask)
+				break;
+
+			Sphere const merged_w(Containment3d::EncloseSphere(bounds_w, entry.m_capsule_w.getBoundingSphere()));
+
+			if (merged_w.getRadius() > cs_maxGroupRadius)
+				break;
+
+			bounds_w = merged_w;
+			++last;
+		}
+
+		answer(&m_pending[static_cast<size_t>(first)], last - first, bounds_w);
+
+		first = last;
+	}
+
+	m_pending.clear();
+}
+
+// ----------------------------------------------------------------------
+
+bool SpatialQueryBatch::isAnswered(QueryId const queryId) const
+{
+	VALIDATE_RANGE_INCLUSIVE_EXCLUSIVE(0, queryId, static_cast<int>(m_entries.size()));
+
+	return m_entries[static_cast<size_t>(queryId)].m_answered;
+}
+
+// ----------------------------------------------------------------------
+
+int SpatialQueryBatch::getResultCount(QueryId const queryId) const
+{
+	VALIDATE_RANGE_INCLUSIVE_EXCLUSIVE(0, queryId, static_cast<int>(m_entries.size()));
+
+	Entry const & entry = m_entries[static_cast<size_t>(queryId)];
+	DEBUG_FATAL(!entry.m_answered, ("SpatialQueryBatch::getResultCount: query %d has not been answered", queryId));
+
+	return entry.m_resultCount;
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Append the answer to a query, as queryFor() would have.
+ */
+
+void SpatialQueryBatch::getResults(QueryId const queryId, ColliderList & collidedWith) const
+{
+	VALIDATE_RANGE_INCLUSIVE_EXCLUSIVE(0, queryId, static_cast<int>(m_entries.size()));
+
+	Entry const & entry = m_entries[static_cast<size_t>(queryId)];
+	DEBUG_FATAL(!entry.m_answered, ("SpatialQueryBatch::getResults: query %d has not been answered", queryId));
+
+	ColliderList::const_iterator const begin = m_results.begin() + entry.m_firstResult;
+	collidedWith.insert(collidedWith.end(), begin, begin + entry.m_resultCount);
+}
+
+// ----------------------------------------------------------------------
+/**
+ * A drop-in for SpatialDatabase::queryFor() that answers at once, reusing
+ * the answer to an identical query made earlier in the frame.  Queries
+ * that see dynamic objects go straight to queryFor().
+ */
+
+void SpatialQueryBatch::query(int queryMask, CellProperty const * const cell_p, bool restrictToSameCell, Capsule const & capsule_p, ColliderList & collidedWith)
+{
+	if (!isMemoized(queryMask))
+	{
+		m_database.queryFor(queryMask, cell_p, restrictToSameCell, capsule_p, collidedWith);
+		return;
+	}
+
+	QueryId const queryId = findOrAdd(queryMask, cell_p, restrictToSameCell, capsule_p);
+
+	Entry const & entry = m_entries[static_cast<size_t>(queryId)];
+
+	if (!entry.m_answered)
+		answer(&queryId, 1, entry.m_capsule_w.getBoundingSphere());
+
+	getResults(queryId, collidedWith);
+}
+
+// ----------------------------------------------------------------------
+/**
+ * A caching front end for SpatialDatabase::findOnSegment().  Checking a
+ * line of sight both ways looks along the same segment twice, so the
+ * segment is keyed by its end points in a fixed order and the second look
+ * reuses the first one's candidates.
+ */
+
+void SpatialQueryBatch::findOnSegment(Vector const & begin_w, Vector const & end_w, ColliderList & results, ColliderList & barrierResults)
+{
+	bool const reversed = (end_w.x < begin_w.x) || ((end_w.x == begin_w.x) && ((end_w.y < begin_w.y) || ((end_w.y == begin_w.y) && (end_w.z < begin_w.z)))); //lint !e777 // testing floats for equality
+
+	Vector const & pointA_w = reversed ? end_w : begin_w;
+	Vector const & pointB_w = reversed ? begin_w : end_w;
+
+	QueryId const queryId = findOrAdd(cs_segmentQueryMask, CellProperty::getWorldCellProperty(), false, Capsule(pointA_w, pointB_w, 0.0f));
+
+	Entry & entry = m_entries[static_cast<size_t>(queryId)];
+
+	if (!entry.m_answered)
+	{
+		m_candidates.clear();
+		m_entryCandidates.clear();
+
+		m_database.findOnSegment(pointA_w, pointB_w, m_candidates, m_entryCandidates);
+
+		++m_traversalCount;
+
+		entry.m_firstResult = static_cast<int>(m_results.size());
+		entry.m_resultCount = static_cast<int>(m_candidates.size());
+		entry.m_barrierResultCount = static_cast<int>(m_entryCandidates.size());
+		entry.m_answered = true;
+
+		m_results.insert(m_results.end(), m_candidates.begin(), m_candidates.end());
+		m_results.insert(m_results.end(), m_entryCandidates.begin(), m_entryCandidates.end());
+
+		addReferences(queryId);
+	}
+
+	ColliderList::const_iterator const begin = m_results.begin() + entry.m_firstResult;
+	ColliderList::const_iterator const barrierBegin = begin + entry.m_resultCount;
+
+	results.insert(results.end(), begin, barrierBegin);
+	barrierResults.insert(barrierResults.end(), barrierBegin, barrierBegin + entry.m_barrierResultCount);
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Throw away the answers that the new object may belong in.  The queries
+ * stay valid, and are answered again when next asked for.
+ */
+
+void SpatialQueryBatch::onObjectAdded(CollisionProperty const & collision)
+{
+	if (m_results.empty())
+		return;
+
+	Sphere const & sphere_w = collision.getBoundingSphere_w();
+
+	int const entryCount = static_cast<int>(m_entries.size());
+
+	for (int i = 0; i < entryCount; ++i)
+	{
+		Entry const & entry = m_entries[static_cast<size_t>(i)];
+
+		if (entry.m_answered && entry.m_capsule_w.intersectsSphere(sphere_w))
+			invalidate(i);
+	}
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Throw away the answers that hold an object about to leave the database.
+ */
+
+void SpatialQueryBatch::onObjectRemoved(CollisionProperty const & collision)
+{
+	std::pair<ReferenceMap::iterator, ReferenceMap::iterator> const range = m_references.equal_range(&collision);
+
+	for (ReferenceMap::const_iterator i = range.first; i != range.second; ++i)
+		invalidate(i->second);
+
+	m_references.erase(range.first, range.second);
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Forget every query and answer, at the start of a frame.
+ */
+
+void SpatialQueryBatch::clear()
+{
+	m_entries.clear();
+	m_entryMap.clear();
+	m_pending.clear();
+	m_results.clear();
+	m_references.clear();
+
+	m_queryCount = 0;
+	m_reusedQueryCount = 0;
+	m_traversalCount = 0;
+	m_invalidatedQueryCount = 0;
+}
+
+// ----------------------------------------------------------------------
+
+int SpatialQueryBatch::getQueryCount() const
+{
+	return m_queryCount;
+}
+
+// ----------------------------------------------------------------------
+
+int SpatialQueryBatch::getReusedQueryCount() const
+{
+	return m_reusedQueryCount;
+}
+
+// ----------------------------------------------------------------------
+
+int SpatialQueryBatch::getTraversalCount() const
+{
+	return m_traversalCount;
+}
+
+// ----------------------------------------------------------------------
+
+int SpatialQueryBatch::getInvalidatedQueryCount() const
+{
+	return m_invalidatedQueryCount;
+}
+
+// ----------------------------------------------------------------------
+
+SpatialQueryBatch::QueryId SpatialQueryBatch::findOrAdd(int queryMask, CellProperty const * const cell_p, bool restrictToSameCell, Capsule const & capsule_p)
+{
+	++m_queryCount;
+
+	Key key;
+	key.m_queryMask = queryMask;
+	key.m_cell = cell_p;
+	key.m_restrictToSameCell = restrictToSameCell;
+	key.m_pointA = capsule_p.getPointA();
+	key.m_pointB = capsule_p.getPointB();
+	key.m_radius = capsule_p.getRadius();
+
+	QueryId const queryId = static_cast<QueryId>(m_entries.size());
+
+	if (isMemoized(queryMask))
+	{
+		std::pair<EntryMap::iterator, bool> const result = m_entryMap.insert(EntryMap::value_type(key, queryId));
+
+		if (!result.second)
+		{
+			++m_reusedQueryCount;
+			return result.first->second;
+		}
+	}
+
+	m_entries.push_back(Entry(key, CollisionUtils::transformToWorld(cell_p, capsule_p)));
+
+	if (queryMask != cs_segmentQueryMask)
+		m_pending.push_back(queryId);
+
+	return queryId;
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Answer a group of queries from one traversal of the trees.
+ *
+ * The traversal gathers everything touching the bounds of the whole group;
+ * each query then keeps the candidates its own capsule touches, as the
+ * trees would have for it alone, before the exact tests.
+ */
+
+void SpatialQueryBatch::answer(QueryId const * const queryIds, int count, Sphere const & bounds_w)
+{
+	DEBUG_FATAL(count < 1, ("SpatialQueryBatch::answer: empty group"));
+
+	Entry const & firstEntry = m_entries[static_cast<size_t>(queryIds[0])];
+
+	m_candidates.clear();
+
+	if (count == 1)
+		m_database.findInRange(firstEntry.m_key.m_queryMask, firstEntry.m_capsule_w, m_candidates);
+	else
+		m_database.findInRange(firstEntry.m_key.m_queryMask, Capsule(bounds_w, Vector::zero), m_candidates);
+
+	++m_traversalCount;
+
+	for (int i = 0; i < count; ++i)
+	{
+		Entry & entry = m_entries[static_cast<size_t>(queryIds[i])];
+
+		ColliderList const * candidates = &m_candidates;
+
+		if (count > 1)
+		{
+			m_entryCandidates.clear();
+
+			for (ColliderList::const_iterator j = m_candidates.begin(); j != m_candidates.end(); ++j)
+				if (entry.m_capsule_w.intersectsSphere((*j)->getBoundingSphere_w()))
+					m_entryCandidates.push_back(*j);
+
+			candidates = &m_entryCandidates;
+		}
+
+		entry.m_firstResult = static_cast<int>(m_results.size());
+		m_database.filterCollisions(entry.m_key.m_cell, entry.m_key.m_restrictToSameCell, entry.m_capsule_w, *candidates, m_results);
+		entry.m_resultCount = static_cast<int>(m_results.size()) - entry.m_firstResult;
+		entry.m_answered = true;
+
+		addReferences(queryIds[i]);
+	}
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Answer one query that sees dynamic objects with queryFor(), neither
+ * grouped with its neighbours nor shared.
+ */
+
+void SpatialQueryBatch::answerDirectly(QueryId const queryId)
+{
+	Entry & entry = m_entries[static_cast<size_t>(queryId)];
+
+	entry.m_firstResult = static_cast<int>(m_results.size());
+	m_database.queryFor(entry.m_key.m_queryMask, entry.m_key.m_cell, entry.m_key.m_restrictToSameCell, Capsule(entry.m_key.m_pointA, entry.m_key.m_pointB, entry.m_key.m_radius), m_results);
+	entry.m_resultCount = static_cast<int>(m_results.size()) - entry.m_firstResult;
+	entry.m_answered = true;
+
+	++m_traversalCount;
+
+	addReferences(queryId);
+}
+
+// ----------------------------------------------------------------------
+
+void SpatialQueryBatch::addReferences(QueryId const queryId)
+{
+	Entry const & entry = m_entries[static_cast<size_t>(queryId)];
+
+	ColliderList::const_iterator const begin = m_results.begin() + entry.m_firstResult;
+	ColliderList::const_iterator const end = begin + entry.m_resultCount + entry.m_barrierResultCount;
+
+	for (ColliderList::const_iterator i = begin; i != end; ++i)
+		m_references.insert(ReferenceMap::value_type(*i, queryId));
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Mark one answer stale.  Its run in the results list is left unused
+ * until the next clear().
+ */
+
+void SpatialQueryBatch::invalidate(QueryId const queryId)
+{
+	Entry & entry = m_entries[static_cast<size_t>(queryId)];
+
+	if (!entry.m_answered)
+		return;
+
+	entry.m_answered = false;
+	++m_invalidatedQueryCount;
+
+	if (entry.m_key.m_queryMask != cs_segmentQueryMask)
+		m_pending.push_back(queryId);
+}
+
+// ======================================================================
@@ -0,0 +1,161 @@
+// ======================================================================
+//
+// SpatialQueryBatch.h
+// Copyright Sony Online Entertainment, Inc.
+//
+// ======================================================================
+
+#ifndef INCLUDED_SpatialQueryBatch_H
+#define INCLUDED_SpatialQueryBatch_H
+
+#include "sharedMath/Capsule.h"
+
+#include <unordered_map>
+#include <vector>
+
+class CellProperty;
+class CollisionProperty;
+class Segment3d;
+class SpatialDatabase;
+class Sphere;
+
+typedef std::vector<CollisionProperty*>  ColliderList;
+
+// ======================================================================
+
+/**
+ * Answers SpatialDatabase::queryFor() style queries for a frame.
+ *
+ * Queries may be added and answered later in one go with execute(), or
+ * answered on the spot with query().  Deferred queries are sorted so that
+ * nearby ones are answered together from a single traversal of the
+ * database's trees, and every answer is kept in one shared list for the
+ * rest of the frame, so a query identical to one already answered costs a
+ * lookup.
+ *
+ * The candidates along a line of sight are kept the same way, keyed so
+ * that the check back from the target reuses the check out to it.
+ *
+ * Only queries that cannot see dynamic objects are grouped and reused.
+ * A query whose mask includes SpatialDatabase::Q_Dynamic is answered by
+ * queryFor() on its own, because mobile objects move during the frame.
+ *
+ * Answers are a snapshot of the database at the time they were made.
+ * The collision world reports every object added to or removed from the
+ * database, and only the answers that could hold that object are thrown
+ * away; callers that must see objects that moved since should use
+ * queryFor().
+ */
+
+class SpatialQueryBatch
+{
+public:
+
+	typedef int QueryId;
+
+	static QueryId const cms_invalidQueryId;
+
+public:
+
+	explicit SpatialQueryBatch(SpatialDatabase const & database);
+	~SpatialQueryBatch();
+
+	QueryId addSphere(int queryMask, CellProperty const * cell_p, bool restrictToSameCell, Sphere const & sphere_p);
+	QueryId addSegment(int queryMask, CellProperty const * cell_p, bool restrictToSameCell, Segment3d const & segment_p);
+	QueryId addCapsule(int queryMask, CellProperty const * cell_p, bool restrictToSameCell, Capsule const & capsule_p);
+
+	void    execute();
+
+	bool    isAnswered(QueryId queryId) const;
+	int     getResultCount(QueryId queryId) const;
+	void    getResults(QueryId queryId, ColliderList & collidedWith) const;
+
+	void    query(int queryMask, CellProperty const * cell_p, bool restrictToSameCell, Capsule const & capsule_p, ColliderList & collidedWith);
+	void    findOnSegment(Vector const & begin_w, Vector const & end_w, ColliderList & results, ColliderList & barrierResults);
+
+	void    onObjectAdded(CollisionProperty const & collision);
+	void    onObjectRemoved(CollisionProperty const & collision);
+	void    clear();
+
+	int     getQueryCount() const;
+	int     getReusedQueryCount() const;
+	int     getTraversalCount() const;
+	int     getInvalidatedQueryCount() const;
+
+private:
+
+	struct Key
+	{
+		bool operator ==(Key const & rhs) const;
+
+		int                   m_queryMask;
+		CellProperty const *  m_cell;
+		bool                  m_restrictToSameCell;
+		Vector                m_pointA;
+		Vector                m_pointB;
+		float                 m_radius;
+	};
+
+	struct KeyHash
+	{
+		size_t operator ()(Key const & key) const;
+	};
+
+	struct Entry
+	{
+		Entry(Key const & key, Capsule const & capsule_w);
+
+		Key      m_key;
+		Capsule  m_capsule_w;
+		uint32   m_sortKey;
+		int      m_firstResult;
+		int      m_resultCount;
+		int      m_barrierResultCount;
+		bool     m_answered;
+	};
+
+	typedef std::vector<Entry>                        Entries;
+	typedef std::unordered_map<Key, QueryId, KeyHash> EntryMap;
+	typedef std::vector<QueryId>                      QueryIds;
+	typedef std::unordered_multimap<CollisionProperty const *, QueryId> ReferenceMap;
+
+	class IsAnswered;
+	class SortByLocation;
+
+private:
+
+	SpatialQueryBatch(SpatialQueryBatch const &);
+	SpatialQueryBatch & operator =(SpatialQueryBatch const &);
+
+	QueryId findOrAdd(int queryMask, CellProperty const * cell_p, bool restrictToSameCell, Capsule const & capsule_p);
+	void    answer(QueryId const * queryIds, int count, Sphere const & bounds_w);
+	void    answerDirectly(QueryId queryId);
+	void    addReferences(QueryId queryId);
+	void    invalidate(QueryId queryId);
+
+private:
+
+	SpatialDatabase const &  m_database;
+
+	Entries                  m_entries;
+	EntryMap                 m_entryMap;
+	QueryIds                 m_pending;
+
+	// answers for every entry, each entry owning a contiguous run
+	ColliderList             m_results;
+
+	// the entries whose answers hold each collision property
+	ReferenceMap             m_references;
+
+	ColliderList             m_candidates;
+	ColliderList             m_entryCandidates;
+
+	int                      m_queryCount;
+	int                      m_reusedQueryCount;
+	int                      m_traversalCount;
+	int                      m_invalidatedQueryCount;
+};
+
+// ======================================================================
+
+#endif // INCLUDED_SpatialQueryBatch_H
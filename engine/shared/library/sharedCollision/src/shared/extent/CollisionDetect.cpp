@@ -30,8 +30,10 @@
 
 //#include <typeinfo.h>
 #include <algorithm>
+#include <atomic>
 
-static int gs_testCounter;
+// CollisionWorld runs sweep queries on several threads at once
+static std::atomic<int> gs_testCounter;
 
 // ----------------------------------------------------------------------
 
@@ -32,13 +32,15 @@ namespace DB
 
 // ----------------------------------------------------------------------
 
-	void Profiler::addQueryProfileData(const std::string &queryName, int execTime, int fetchTime, int execCount, int fetchCount)
+	void Profiler::addQueryProfileData(const std::string &queryName, int execTime, int fetchTime, int execCount, int fetchCount, int roundTripCount, int statementCacheHitCount)
 	{
 		QueryData &data = (*m_queryDataMap)[queryName];
 		data.m_execTime   += execTime;
 		data.m_fetchTime  += fetchTime;
 		data.m_execCount  += execCount;
 		data.m_fetchCount += fetchCount;
+		data.m_roundTripCount += roundTripCount;
+		data.m_statementCacheHitCount += statementCacheHitCount;
 	}
 
 // ----------------------------------------------------------------------
@@ -48,9 +50,10 @@ namespace DB
 //		DEBUG_REPORT_LOG(true,("Query profile:\n"));
 		for (QueryDataMapType::const_iterator i=m_queryDataMap->begin(); i!=m_queryDataMap->end(); ++i)
 		{
-			LOG("QueryProfile",("\t%s\t%i ms/exec (%i execs in %i ms, %i fetches in %i ms)\n",
+			LOG("QueryProfile",("\t%s\t%i ms/exec (%i execs in %i ms, %i fetches in %i ms, %i round trips, %i statement cache hits)\n",
 								i->first.c_str(), (i->second.m_execTime / i->second.m_execCount), i->second.m_execCount,
-								i->second.m_execTime, i->second.m_fetchCount, i->second.m_fetchTime));
+								i->second.m_execTime, i->second.m_fetchCount, i->second.m_fetchTime,
+								i->second.m_roundTripCount, i->second.m_statementCacheHitCount));
 		}
 //		DEBUG_REPORT_LOG(true,("End query profile\n"));
 	}
@@ -61,7 +64,9 @@ namespace DB
 			m_execTime(0),
 			m_fetchTime(0),
 			m_execCount(0),
-			m_fetchCount(0)
+			m_fetchCount(0),
+			m_roundTripCount(0),
+			m_statementCacheHitCount(0)
 	{
 	}
 
@@ -17,7 +17,7 @@ namespace DB
 	  public:
 		Profiler();
 		~Profiler();
-		void addQueryProfileData(const std::string &queryName, int execTime, int fetchTime, int execCount, int fetchCount);
+		void addQueryProfileData(const std::string &queryName, int execTime, int fetchTime, int execCount, int fetchCount, int roundTripCount, int statementCacheHitCount);
 		void debugOutput();
 
 	  private:
@@ -31,6 +31,8 @@ namespace DB
 			int m_fetchTime;
 			int m_execCount;
 			int m_fetchCount;
+			int m_roundTripCount;
+			int m_statementCacheHitCount;
 		};
 
 		typedef std::map<std::string, QueryData> QueryDataMapType;
@@ -74,10 +74,11 @@ void Query::done()
 		impl->done();
 		m_session->queryDone();
 		m_session->addQueryCount(m_execCount, m_fetchCount);
+		m_session->addStatementCacheCount(impl->getStatementCacheHitCount(), impl->getStatementCacheMissCount(), impl->getRoundTripCount());
 		if (Server::isProfilingEnabled())
 		{
 			NOT_NULL(m_debugName); // should have been set by setup()
-			Server::addQueryProfileData(*m_debugName, m_execTime, m_fetchTime, m_execCount, m_fetchCount);
+			Server::addQueryProfileData(*m_debugName, m_execTime, m_fetchTime, m_execCount, m_fetchCount, impl->getRoundTripCount(), impl->getStatementCacheHitCount());
 			
 			// reset the profiler data in case we run this query again:
 			m_execTime=0;
@@ -85,6 +86,7 @@ void Query::done()
 			m_execCount=0;
 			m_fetchCount=0;
 		}
+		impl->resetStatistics();
 		inUse=false;
 		m_session=0;
 	}
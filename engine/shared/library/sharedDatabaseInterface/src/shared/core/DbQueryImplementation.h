@@ -38,6 +38,12 @@ namespace DB
 	{
 	  protected:
 		Query *m_query;
+
+		/** Statistics gathered by the implementation, collected by Query::done()
+		 */
+		int m_roundTripCount;
+		int m_statementCacheHitCount;
+		int m_statementCacheMissCount;
 		
 	  public:
 		explicit QueryImpl(Query *query);
@@ -67,6 +73,11 @@ namespace DB
 		virtual bool bindParameter(BindableVarray &buffer) =0;
 
 		virtual std::string outputDataValues() const =0;
+
+		int  getRoundTripCount         () const;
+		int  getStatementCacheHitCount () const;
+		int  getStatementCacheMissCount() const;
+		void resetStatistics           ();
 			
 	  private:
 		QueryImpl(); // disable
@@ -79,8 +90,41 @@ namespace DB
 // ======================================================================
 
 inline DB::QueryImpl::QueryImpl(DB::Query *query) :
-		m_query(query)
+		m_query(query),
+		m_roundTripCount(0),
+		m_statementCacheHitCount(0),
+		m_statementCacheMissCount(0)
+{
+}
+
+// ----------------------------------------------------------------------
+
+inline int DB::QueryImpl::getRoundTripCount() const
+{
+	return m_roundTripCount;
+}
+
+// ----------------------------------------------------------------------
+
+inline int DB::QueryImpl::getStatementCacheHitCount() const
+{
+	return m_statementCacheHitCount;
+}
+
+// ----------------------------------------------------------------------
+
+inline int DB::QueryImpl::getStatementCacheMissCount() const
+{
+	return m_statementCacheMissCount;
+}
+
+// ----------------------------------------------------------------------
+
+inline void DB::QueryImpl::resetStatistics()
 {
+	m_roundTripCount = 0;
+	m_statementCacheHitCount = 0;
+	m_statementCacheMissCount = 0;
 }
 
 // ======================================================================
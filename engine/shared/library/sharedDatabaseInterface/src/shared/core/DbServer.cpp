@@ -37,6 +37,10 @@ int Server::ms_errorSleepTime=5000;
 int Server::ms_disconnectSleepTime=45000;
 int Server::ms_execCount=0;
 int Server::ms_fetchCount=0;
+int Server::ms_statementCacheHitCount=0;
+int Server::ms_statementCacheMissCount=0;
+int Server::ms_roundTripCount=0;
+int Server::ms_statementCacheSize=0;
 int Server::ms_prefetchNumRows=0;
 int Server::ms_prefetchMemory=0;
 bool Server::ms_fatalOnError=false;
@@ -259,7 +263,7 @@ Protocol Server::getProtocolByName(const std::string &name)
 
 // ----------------------------------------------------------------------
 
-void Server::addQueryProfileData(const std::string &queryName, int execTime, int fetchTime, int execCount, int fetchCount)
+void Server::addQueryProfileData(const std::string &queryName, int execTime, int fetchTime, int execCount, int fetchCount, int roundTripCount, int statementCacheHitCount)
 {
 	ms_profileMutex.enter();
 	
@@ -269,7 +273,7 @@ void Server::addQueryProfileData(const std::string &queryName, int execTime, int
 		ms_profiler = new DB::Profiler;
 	}
 
-	ms_profiler->addQueryProfileData(queryName,execTime,fetchTime,execCount,fetchCount);
+	ms_profiler->addQueryProfileData(queryName,execTime,fetchTime,execCount,fetchCount,roundTripCount,statementCacheHitCount);
 	ms_profileMutex.leave();
 }
 
@@ -330,6 +334,66 @@ void Server::addQueryCount(int execCount, int fetchCount)
 
 // ----------------------------------------------------------------------
 
+/**
+ * Count statement cache lookups and round trips to the database server.
+ * Like the query counts, this is always enabled.
+ */
+void Server::addStatementCacheCount(int hitCount, int missCount, int roundTripCount)
+{
+	ms_profileMutex.enter();
+
+	ms_statementCacheHitCount+=hitCount;
+	ms_statementCacheMissCount+=missCount;
+	ms_roundTripCount+=roundTripCount;
+
+	ms_profileMutex.leave();
+}
+
+// ----------------------------------------------------------------------
+
+void Server::getAndResetStatementCacheCount(int &hitCount, int &missCount, int &roundTripCount)
+{
+	ms_profileMutex.enter();
+
+	hitCount=ms_statementCacheHitCount;
+	missCount=ms_statementCacheMissCount;
+	roundTripCount=ms_roundTripCount;
+
+	ms_statementCacheHitCount=0;
+	ms_statementCacheMissCount=0;
+	ms_roundTripCount=0;
+
+	ms_profileMutex.leave();
+}
+
+// ----------------------------------------------------------------------
+
+/**
+ * Keep up to numStatements parsed statements per session, keyed by their
+ * SQL text, so that running the same SQL again on that session skips the
+ * parse.  Must be called before sessions are connected.
+ */
+void Server::enableStatementCache(int numStatements)
+{
+	ms_statementCacheSize = numStatements;
+}
+
+// ----------------------------------------------------------------------
+
+bool Server::isStatementCacheEnabled()
+{
+	return (ms_statementCacheSize > 0);
+}
+
+// ----------------------------------------------------------------------
+
+int Server::getStatementCacheSize()
+{
+	return ms_statementCacheSize;
+}
+
+// ----------------------------------------------------------------------
+
 void Server::enablePrefetch(int numRows, int memory)
 {
 	ms_prefetchNumRows = numRows;
@@ -73,6 +73,11 @@ namespace DB {
 
 	static int ms_execCount;
 	static int ms_fetchCount;
+	static int ms_statementCacheHitCount;
+	static int ms_statementCacheMissCount;
+	static int ms_roundTripCount;
+
+	static int ms_statementCacheSize;
 
 	static bool ms_fatalOnError;
 	static bool ms_fatalOnDataError;
@@ -106,11 +111,16 @@ namespace DB {
 	static bool isPrefetchEnabled();
 	static int  getPrefetchRows();
 	static int  getPrefetchMemory();
-	static void addQueryProfileData(const std::string &queryName, int execTime, int fetchTime, int execCount, int fetchCount);
+	static void enableStatementCache(int numStatements);
+	static bool isStatementCacheEnabled();
+	static int  getStatementCacheSize();
+	static void addQueryProfileData(const std::string &queryName, int execTime, int fetchTime, int execCount, int fetchCount, int roundTripCount, int statementCacheHitCount);
 	static void debugOutputProfile();
 	
 	static void addQueryCount(int execCount, int fetchCount);
 	static void getAndResetQueryCount(int &execCount, int &fetchCount);
+	static void addStatementCacheCount(int hitCount, int missCount, int roundTripCount);
+	static void getAndResetStatementCacheCount(int &hitCount, int &missCount, int &roundTripCount);
 
 	static void setReconnectTime(int reconnectTime);
 	static int  getReconnectTime();	
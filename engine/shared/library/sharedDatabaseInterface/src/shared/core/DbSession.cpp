@@ -24,7 +24,7 @@ using namespace DB;
  * Do not create session objects directly.
  * Instead, use DB::Server::GetSession().
  */
-Session::Session() : inUse(false), connected(false), lastQuery(0), lastQueryStatement(), m_execCount(0), m_fetchCount(0), m_fatalOnError(false)
+Session::Session() : inUse(false), connected(false), lastQuery(0), lastQueryStatement(), m_execCount(0), m_fetchCount(0), m_statementCacheHitCount(0), m_statementCacheMissCount(0), m_roundTripCount(0), m_fatalOnError(false)
 {
 }
 
@@ -90,11 +90,24 @@ void Session::addQueryCount(int execCount, int fetchCount)
 
 // ----------------------------------------------------------------------
 
+void Session::addStatementCacheCount(int hitCount, int missCount, int roundTripCount)
+{
+	m_statementCacheHitCount += hitCount;
+	m_statementCacheMissCount += missCount;
+	m_roundTripCount += roundTripCount;
+}
+
+// ----------------------------------------------------------------------
+
 void Session::updateServerQueryCount()
 {
 	Server::addQueryCount(m_execCount, m_fetchCount);
+	Server::addStatementCacheCount(m_statementCacheHitCount, m_statementCacheMissCount, m_roundTripCount);
 	m_execCount=0;
 	m_fetchCount=0;
+	m_statementCacheHitCount=0;
+	m_statementCacheMissCount=0;
+	m_roundTripCount=0;
 }
 
 // ----------------------------------------------------------------------
@@ -55,6 +55,9 @@ private:
 	std::string lastQueryStatement;
 	int m_execCount;
 	int m_fetchCount;
+	int m_statementCacheHitCount;
+	int m_statementCacheMissCount;
+	int m_roundTripCount;
 	bool m_fatalOnError;
 
 public:
@@ -122,6 +125,12 @@ public:
  */
 	void addQueryCount(int execCount, int fetchCount);
 
+/** Add to the count of statement cache lookups and of round trips to the database server.
+
+	Each query adds to this count as it finishes.
+ */
+	void addStatementCacheCount(int hitCount, int missCount, int roundTripCount);
+
 /** Update the total count of fetches and executes in the Server object
  */
 	void updateServerQueryCount();
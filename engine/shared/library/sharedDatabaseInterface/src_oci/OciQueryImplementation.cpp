@@ -23,6 +23,7 @@
 DB::OCIQueryImpl::OCIQueryImpl(Query *query, bool autocommit) :
 		QueryImpl(query), m_stmthp(0), m_cursorhp(0), m_procBind(0), m_session(0), m_server(0), m_inUse(false), numRowsFetched(0),
 		nextColumn(1), nextParameter(1), m_endOfData(false), m_dataReady(false), m_autocommit(autocommit),
+		m_useStatementCache(false),
 		m_skipSize(0),
 		m_numElements(1),
 		m_sql()
@@ -33,7 +34,7 @@ DB::OCIQueryImpl::OCIQueryImpl(Query *query, bool autocommit) :
 
 DB::OCIQueryImpl::~OCIQueryImpl()
 {
-	if (m_stmthp)
+	if (m_stmthp || (m_useStatementCache && m_session))
 		done();
 	
 	for (BindRecListType::iterator i=bindRecList.begin(); i!=bindRecList.end(); ++i)
@@ -59,6 +60,11 @@ bool DB::OCIQueryImpl::setup(Session *session)
 
 	m_server=m_session->m_server;
 	NOT_NULL(m_server);
+
+	// With the statement cache on, the handle is obtained in prepare(), once the SQL is known
+	m_useStatementCache=m_session->isStatementCacheEnabled();
+	if (m_useStatementCache)
+		return true;
 	
 	if (!m_server->checkerr(*m_session, OCIHandleAlloc( m_session->envhp,
 															  reinterpret_cast<void**>(&m_stmthp),
@@ -76,19 +82,27 @@ bool DB::OCIQueryImpl::setup(Session *session)
 bool DB::OCIQueryImpl::prepare()
 {
 	NOT_NULL(m_server);
-	NOT_NULL(m_stmthp);
 
 	m_query->getSQL(m_sql); // note: do not change m_sql until done() is called, because Oracle keeps a pointer to it
 	DEBUG_FATAL(m_sql.size()==0,("Query did not set a SQL statement.\n"));
 
-	if (!m_server->checkerr(*m_session,
-							OCIStmtPrepare(m_stmthp,
-										   m_session->errhp,
-										   reinterpret_cast<OraText*>(const_cast<char*>(m_sql.c_str())),
-										   m_sql.length(),
-										   (ub4) OCI_NTV_SYNTAX,
-										   (ub4) OCI_DEFAULT)))
-		return false;
+	if (m_useStatementCache)
+	{
+		if (!prepareFromStatementCache())
+			return false;
+	}
+	else
+	{
+		NOT_NULL(m_stmthp);
+		if (!m_server->checkerr(*m_session,
+								OCIStmtPrepare(m_stmthp,
+											   m_session->errhp,
+											   reinterpret_cast<OraText*>(const_cast<char*>(m_sql.c_str())),
+											   m_sql.length(),
+											   (ub4) OCI_NTV_SYNTAX,
+											   (ub4) OCI_DEFAULT)))
+			return false;
+	}
 	if (m_query->getMode()==Query::MODE_PLSQL_REFCURSOR)
 	{
 		m_cursorhp=0; // may not be necessary -- OCI docs unclear
@@ -118,6 +132,44 @@ bool DB::OCIQueryImpl::prepare()
 
 // ----------------------------------------------------------------------
 
+/**
+ * Get a prepared statement handle for m_sql from the session's statement
+ * cache.  The cache is searched first so that hits and misses can be
+ * counted; on a miss the statement is parsed and will be kept in the cache
+ * when done() releases it.
+ */
+bool DB::OCIQueryImpl::prepareFromStatementCache()
+{
+	DEBUG_FATAL(m_stmthp!=0,("m_stmthp was not 0"));
+
+	OraText * const sqlText = reinterpret_cast<OraText*>(const_cast<char*>(m_sql.c_str()));
+
+	sword status = OCIStmtPrepare2(m_session->svchp, &m_stmthp, m_session->errhp,
+								   sqlText, m_sql.length(), nullptr, 0,
+								   (ub4) OCI_NTV_SYNTAX, (ub4) OCI_PREP2_CACHE_SEARCHONLY);
+	if (status == OCI_SUCCESS || status == OCI_SUCCESS_WITH_INFO)
+		++m_statementCacheHitCount;
+	else
+	{
+		++m_statementCacheMissCount;
+		m_stmthp=0;
+		if (!m_server->checkerr(*m_session,
+								OCIStmtPrepare2(m_session->svchp, &m_stmthp, m_session->errhp,
+												sqlText, m_sql.length(), nullptr, 0,
+												(ub4) OCI_NTV_SYNTAX, (ub4) OCI_DEFAULT)))
+		{
+			m_stmthp=0;
+			return false;
+		}
+	}
+
+	NOT_NULL(m_stmthp);
+	m_cursorhp=m_stmthp;
+	return true;
+}
+
+// ----------------------------------------------------------------------
+
 void DB::OCIQueryImpl::preprocessBinds()
 {
 	//Preprocess binds & defines
@@ -179,6 +231,7 @@ bool DB::OCIQueryImpl::exec()
 
 	m_session->setOkToFetch();
 	m_session->setLastQueryStatement(m_sql);
+	++m_roundTripCount;
 	sword status=OCIStmtExecute(m_session->svchp, m_stmthp, m_session->errhp, 1, 0,
 								nullptr, nullptr, OCI_DEFAULT);
 	
@@ -187,6 +240,7 @@ bool DB::OCIQueryImpl::exec()
 		if (mode==Query::MODE_PLSQL_REFCURSOR)
 		{
 			WARNING_STRICT_FATAL(!m_session->isOkToFetch(),("Calling fetch after commit, without an execute in between (may cause Oracle to crash)."));
+			++m_roundTripCount;
 			sword status=OCIStmtFetch (m_cursorhp, m_session->errhp, 0, OCI_FETCH_NEXT, OCI_DEFAULT);
 			if (!m_server->checkerr(*m_session,status))
 				return false;
@@ -236,6 +290,7 @@ int DB::OCIQueryImpl::fetch()
 	if (m_endOfData) return 0;
 
 	WARNING_STRICT_FATAL(!m_session->isOkToFetch(),("Calling fetch after commit, without an execute in between (may cause Oracle to crash)."));
+	++m_roundTripCount;
 	sword status=OCIStmtFetch (m_cursorhp, m_session->errhp, m_numElements, OCI_FETCH_NEXT, OCI_DEFAULT);
 
 	if (status == OCI_NO_DATA)
@@ -245,6 +300,7 @@ int DB::OCIQueryImpl::fetch()
 		OCIAttrGet((dvoid *) m_cursorhp, (ub4) OCI_HTYPE_STMT,
 				   (dvoid *)& rows, (ub4 *) &sizep, OCI_ATTR_ROWS_FETCHED, m_session->errhp);
 
+		++m_roundTripCount;
 		sword status=OCIStmtFetch (m_cursorhp, m_session->errhp, 0, OCI_FETCH_NEXT, OCI_DEFAULT); // cancel the cursor
 		if (!m_server->checkerr(*m_session,status))
 			return -1;
@@ -321,14 +377,26 @@ void DB::OCIQueryImpl::postProcessResults()
 
 void DB::OCIQueryImpl::done()
 {
-	NOT_NULL(m_stmthp);
+	// a cached statement may have failed to prepare, so it is allowed to have no handle here
+	DEBUG_FATAL(!m_useStatementCache && !m_stmthp,("m_stmthp was 0"));
+	NOT_NULL(m_session);
 
-	if (m_autocommit)	
+	if (m_autocommit)
+	{
+		++m_roundTripCount;
 		m_server->checkerr(*m_session, OCITransCommit(m_session->svchp, m_session->errhp, 0));
+	}
 
-	OCIHandleFree(m_stmthp, OCI_HTYPE_STMT);
-	if (m_cursorhp!=m_stmthp)
+	if (m_cursorhp && m_cursorhp!=m_stmthp)
 		OCIHandleFree(m_cursorhp, OCI_HTYPE_STMT);
+	if (m_useStatementCache)
+	{
+		// hand the parsed statement back to the session's cache
+		if (m_stmthp)
+			OCIStmtRelease(m_stmthp, m_session->errhp, nullptr, 0, OCI_DEFAULT);
+	}
+	else
+		OCIHandleFree(m_stmthp, OCI_HTYPE_STMT);
 	
 	for (BindRecListType::iterator i=bindRecList.begin(); i!=bindRecList.end(); ++i)
 	{
@@ -344,6 +412,7 @@ void DB::OCIQueryImpl::done()
 	nextParameter=1;
 	m_endOfData=true;
 	m_inUse=false;
+	m_useStatementCache=false;
 }
 
 // ----------------------------------------------------------------------
@@ -92,6 +92,7 @@ namespace DB
 	  protected:
 
 		BindRec *addBindRec(Bindable &owner);
+		bool prepareFromStatementCache();
 		void preprocessBinds();
 		void postProcessResults();
 		
@@ -116,6 +117,7 @@ namespace DB
 		bool m_dataReady;
 		BindRecListType bindRecList;
 		bool m_autocommit;
+		bool m_useStatementCache;
 		size_t m_skipSize;
 		size_t m_numElements;
 
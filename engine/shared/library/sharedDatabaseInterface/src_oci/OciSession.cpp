@@ -63,7 +63,8 @@ DB::OCISession::OCISession(DB::OCIServer *server) :
 		svchp(nullptr),
 		autoCommitMode(true),
 		m_resetTime(server->getReconnectTime()==0 ?	0 : time(0) + server->getReconnectTime()),
-		m_okToFetch(true)
+		m_okToFetch(true),
+		m_statementCacheEnabled(false)
 {
 }
 
@@ -159,6 +160,19 @@ bool DB::OCISession::connect()
 	if (DB::OCIServer::checkerr(*this, OCISessionBegin ( svchp, errhp, sesp, OCI_CRED_RDBMS, (ub4) OCI_DEFAULT)))
 	{
 		connected=true;
+
+		// Turn on the client-side statement cache.  Queries then get their
+		// statement handles from OCIStmtPrepare2(), which reuses the parsed
+		// statement (and its define/bind metadata) when the SQL text matches.
+		if (DB::Server::isStatementCacheEnabled())
+		{
+			ub4 cacheSize = static_cast<ub4>(DB::Server::getStatementCacheSize());
+			m_statementCacheEnabled = DB::OCIServer::checkerr(*this, OCIAttrSet((dvoid *) svchp, (ub4) OCI_HTYPE_SVCCTX,
+																				&cacheSize, (ub4) 0,
+																				(ub4) OCI_ATTR_STMTCACHESIZE, errhp));
+			if (!m_statementCacheEnabled)
+				LOG("DatabaseError", ("Unable to set OCI_ATTR_STMTCACHESIZE to %u, statement caching disabled for this session", cacheSize));
+		}
 	}
 	else
 	{
@@ -177,6 +191,7 @@ bool DB::OCISession::disconnect()
 	bool success = true;
 
 	connected=false;
+	m_statementCacheEnabled=false; // the cache goes away with the service context
 
 	if (srvhp && errhp && !DB::OCIServer::checkerr(*this,OCIServerDetach( srvhp, errhp, OCI_DEFAULT)))
 	{
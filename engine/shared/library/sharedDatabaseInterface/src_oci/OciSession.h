@@ -34,6 +34,7 @@ namespace DB {
 		bool autoCommitMode;
 		time_t  m_resetTime;
 		bool m_okToFetch;
+		bool m_statementCacheEnabled;
 	
 			// following are disallowed:
 		OCISession(const OCISession& rhs);        
@@ -52,6 +53,7 @@ namespace DB {
 		virtual QueryImpl *createQueryImpl(Query *owner) const;
 		void setOkToFetch();
 		bool isOkToFetch() const;
+		bool isStatementCacheEnabled() const;
 		
         // OCI requires sharing so many handles at different levels that it's easiest to just make everybody friends.
 		friend class OCIQueryImpl;
@@ -70,6 +72,13 @@ inline bool DB::OCISession::isOkToFetch() const
 	return m_okToFetch;
 }
 
+// ----------------------------------------------------------------------
+
+inline bool DB::OCISession::isStatementCacheEnabled() const
+{
+	return m_statementCacheEnabled;
+}
+
 // ======================================================================
 
 #endif
@@ -0,0 +1,7 @@
+#if defined(PLATFORM_WIN32)
+#include "../../src/win32/MemoryMappedFile.h"
+#elif defined(PLATFORM_LINUX)
+#include "../../src/linux/MemoryMappedFile.h"
+#else
+#error unsupported platform
+#endif
@@ -0,0 +1,57 @@
+// ======================================================================
+//
+// MemoryMappedFile.cpp
+// Copyright 2002, Sony Online Entertainment Inc.
+// All Rights Reserved.
+//
+// ======================================================================
+
+#include "sharedFile/FirstSharedFile.h"
+#include "sharedFile/MemoryMappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// ======================================================================
+
+MemoryMappedFile *MemoryMappedFile::open(const char *fileName)
+{
+	NOT_NULL(fileName);
+
+	int const handle = ::open(fileName, O_RDONLY);
+	if (handle < 0)
+		return nullptr;
+
+	struct stat statBuffer;
+	void *data = MAP_FAILED;
+	if (fstat(handle, &statBuffer) == 0 && statBuffer.st_size > 0)
+		data = mmap(nullptr, static_cast<size_t>(statBuffer.st_size), PROT_READ, MAP_SHARED, handle, 0);
+
+	// the mapping stays valid after the descriptor is closed
+	IGNORE_RETURN(close(handle));
+
+	if (data == MAP_FAILED)
+		return nullptr;
+
+	return new MemoryMappedFile(static_cast<byte const *>(data), static_cast<int>(statBuffer.st_size));
+}
+
+// ======================================================================
+
+MemoryMappedFile::MemoryMappedFile(byte const *data, int length)
+:
+	m_data(data),
+	m_length(length)
+{
+}
+
+// ----------------------------------------------------------------------
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+	IGNORE_RETURN(munmap(const_cast<byte *>(m_data), static_cast<size_t>(m_length)));
+}
+
+// ======================================================================
@@ -18,7 +18,7 @@
 #define KEY_INT(a,b)     (ms_ ## a = ConfigFile::getKeyInt("SharedFile", #a, b))
 #define KEY_BOOL(a,b)    (ms_ ## a = ConfigFile::getKeyBool("SharedFile", #a, b))
 //#define KEY_FLOAT(a,b)   (ms_ ## a = ConfigFile::getKeyFloat("SharedFile", #a, b))
-//#define KEY_STRING(a,b)  (ms_ ## a = ConfigFile::getKeyString("SharedFile", #a, b))
+#define KEY_STRING(a,b)  (ms_ ## a = ConfigFile::getKeyString("SharedFile", #a, b))
 
 // ======================================================================
 
@@ -30,6 +30,11 @@ namespace ConfigSharedFileNamespace
 	int            ms_asynchronousLoaderCallbacksPerFrame;
 	bool		   ms_validateIff;
 	StringPtrArray ms_preloads; // ConfigFile owns the pointer
+	bool           ms_mapTreeFiles;
+	char const *   ms_decompressedCacheDirectory;
+	int            ms_decompressedCacheMinimumSize;
+	int            ms_maximumMappedSize;
+	bool           ms_cacheMissingFiles;
 }
 
 using namespace ConfigSharedFileNamespace;
@@ -42,6 +47,11 @@ void ConfigSharedFile::install()
 	KEY_INT(asynchronousLoaderPriority, 0);
 	KEY_INT(asynchronousLoaderCallbacksPerFrame, 0);
 	KEY_BOOL(validateIff, false);
+	KEY_BOOL(mapTreeFiles, false);                    // read uncompressed tree file entries straight from a mapping of the file
+	KEY_STRING(decompressedCacheDirectory, "");       // share decompressed tree file entries between processes through files here (e.g. /dev/shm/treeCache)
+	KEY_INT(decompressedCacheMinimumSize, 16 * 1024); // smaller entries are decompressed by each process
+	KEY_INT(maximumMappedSize, 512);                  // megabytes of tree files and shared entries mapped at once, the rest are read
+	KEY_BOOL(cacheMissingFiles, false);               // remember names no search node had until the search list changes
 
 	int index = 0;
 	char const * result = 0;
@@ -97,5 +107,40 @@ char const * ConfigSharedFile::getTreeFilePreload(int const index)
 	return ms_preloads[static_cast<size_t>(index)];
 }
 
+// ----------------------------------------------------------------------
+
+bool ConfigSharedFile::getMapTreeFiles()
+{
+	return ms_mapTreeFiles;
+}
+
+// ----------------------------------------------------------------------
+
+char const * ConfigSharedFile::getDecompressedCacheDirectory()
+{
+	return ms_decompressedCacheDirectory;
+}
+
+// ----------------------------------------------------------------------
+
+int ConfigSharedFile::getDecompressedCacheMinimumSize()
+{
+	return ms_decompressedCacheMinimumSize;
+}
+
+// ----------------------------------------------------------------------
+
+int ConfigSharedFile::getMaximumMappedSize()
+{
+	return ms_maximumMappedSize;
+}
+
+// ----------------------------------------------------------------------
+
+bool ConfigSharedFile::getCacheMissingFiles()
+{
+	return ms_cacheMissingFiles;
+}
+
 // ======================================================================
 
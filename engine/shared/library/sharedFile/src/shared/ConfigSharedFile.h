@@ -22,6 +22,11 @@ public:
 	static bool        getValidateIff();
 	static int         getNumberOfTreeFilePreloads();
 	static char const * getTreeFilePreload(int index);
+	static bool        getMapTreeFiles();
+	static char const * getDecompressedCacheDirectory();
+	static int         getDecompressedCacheMinimumSize();
+	static int         getMaximumMappedSize();
+	static bool        getCacheMissingFiles();
 };
 
 // ======================================================================
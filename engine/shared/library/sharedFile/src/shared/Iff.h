@@ -24,6 +24,8 @@ class VectorArgb;
 
 class Iff
 {
+	friend class IffView;
+
 public:
 
 	enum SeekType
@@ -0,0 +1,441 @@
+// ======================================================================
+//
+// IffView.cpp
+// copyright 2002 Sony Online Entertainment
+//
+// ======================================================================
+
+#include "sharedFile/FirstSharedFile.h"
+#include "sharedFile/IffView.h"
+
+#include "sharedFile/Iff.h"
+#include "sharedFile/MemoryFile.h"
+#include "sharedFile/TreeFile.h"
+#include "sharedFoundation/ByteOrder.h"
+#include "sharedMath/Vector.h"
+
+// ======================================================================
+
+namespace IffViewNamespace
+{
+	int const cs_chunkHeaderSize = isizeof(Tag) + isizeof(uint32);
+	int const cs_formHeaderSize  = isizeof(Tag) + isizeof(uint32) + isizeof(Tag);
+}
+
+using namespace IffViewNamespace;
+
+// ======================================================================
+
+IffView::IffView() :
+	m_data(nullptr),
+	m_fileName(nullptr),
+	m_file(nullptr),
+	m_ownedData(nullptr),
+	m_ownedFileName(),
+	m_stackDepth(0),
+	m_inChunk(false)
+{
+	reset(nullptr, 0, nullptr);
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Construct a view over a buffer of Iff data.
+ *
+ * The buffer is not copied, and must not change or go away while the view
+ * (or anything read from it) is in use.
+ */
+
+IffView::IffView(byte const *data, int length, char const *fileName) :
+	m_data(nullptr),
+	m_fileName(nullptr),
+	m_file(nullptr),
+	m_ownedData(nullptr),
+	m_ownedFileName(),
+	m_stackDepth(0),
+	m_inChunk(false)
+{
+	reset(data, length, fileName);
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Construct a view over the unread part of the Iff's current block.
+ *
+ * Outside of a chunk the view starts at the Iff's next block, as if that
+ * were the start of a file.  Inside a chunk the view is positioned inside
+ * a chunk holding the rest of the chunk's data.
+ *
+ * Reading from the view does not move the Iff; callers skip what was read
+ * with the Iff afterwards.
+ */
+
+IffView::IffView(Iff &iff) :
+	m_data(nullptr),
+	m_fileName(nullptr),
+	m_file(nullptr),
+	m_ownedData(nullptr),
+	m_ownedFileName(),
+	m_stackDepth(0),
+	m_inChunk(false)
+{
+	Iff::Stack const &s = iff.stack[iff.stackDepth];
+
+	reset(iff.data, s.start + s.length, iff.fileName);
+
+	m_stack[0].start  = s.start + s.used;
+	m_stack[0].length = s.length - s.used;
+	m_stack[0].used   = 0;
+	m_inChunk         = iff.inChunk;
+}
+
+// ----------------------------------------------------------------------
+
+IffView::~IffView()
+{
+	close();
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Move the Iff this view was made from, inside a chunk, past the data read
+ * through the view, so the Iff can then exit the chunk strictly.
+ */
+
+void IffView::advance(Iff &iff) const
+{
+	DEBUG_FATAL(!m_inChunk || !iff.inChunk, ("not in chunk"));
+	DEBUG_FATAL(m_stackDepth != 0, ("view is inside a block of its own"));
+
+	Iff::Stack &s = iff.stack[iff.stackDepth];
+	DEBUG_FATAL(m_data != iff.data || m_stack[0].start != s.start + s.used, ("view was not made from the Iff at its current position"));
+
+	s.used += m_stack[0].used;
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Open a file for viewing.
+ *
+ * Files served from a memory mapped tree file are viewed where they are
+ * mapped; anything else (compressed entries, loose files) is read into a
+ * buffer the view owns.
+ *
+ * @return True if the file was opened, false otherwise
+ */
+
+bool IffView::open(char const *fileName, bool optional)
+{
+	close();
+
+	AbstractFile * const file = TreeFile::open(fileName, AbstractFile::PriorityData, optional);
+	if (!file)
+	{
+		DEBUG_FATAL(!optional, ("could not open file '%s'", fileName));
+		return false;
+	}
+
+	m_ownedFileName = fileName;
+
+	int const length = file->length();
+	MemoryFile const * const memoryFile = dynamic_cast<MemoryFile const *>(file);
+	if (memoryFile && !memoryFile->ownsBuffer())
+	{
+		m_file = file;
+		reset(memoryFile->getBuffer(), length, m_ownedFileName.c_str());
+	}
+	else
+	{
+		m_ownedData = file->readEntireFileAndClose();
+		delete file;
+		reset(m_ownedData, length, m_ownedFileName.c_str());
+	}
+
+	return true;
+}
+
+// ----------------------------------------------------------------------
+
+void IffView::close()
+{
+	delete m_file;
+	m_file = nullptr;
+
+	delete [] m_ownedData;
+	m_ownedData = nullptr;
+
+	m_ownedFileName.clear();
+	reset(nullptr, 0, nullptr);
+}
+
+// ----------------------------------------------------------------------
+
+void IffView::reset(byte const *data, int length, char const *fileName)
+{
+	m_data = data;
+	m_fileName = fileName;
+
+	m_stackDepth = 0;
+	m_inChunk = false;
+	m_stack[0].start  = 0;
+	m_stack[0].length = length;
+	m_stack[0].used   = 0;
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Print the file name and the names of all enclosing blocks into the
+ * buffer, as Iff::formatLocation() does.
+ */
+
+void IffView::formatLocation(char *buffer, int bufferLength) const
+{
+	NOT_NULL(buffer);
+	DEBUG_FATAL(bufferLength < 1, ("format buffer too small"));
+
+	int used = snprintf(buffer, static_cast<size_t>(bufferLength), "%s", m_fileName ? m_fileName : "");
+
+	for (int i = 0; i < m_stackDepth && used >= 0 && used < bufferLength; ++i)
+	{
+		Tag tag = peekHeader(i, 0);
+		if (tag == TAG_FORM)
+			tag = peekHeader(i, cs_chunkHeaderSize);
+
+		char name[5];
+		ConvertTagToString(tag, name);
+		used += snprintf(buffer + used, static_cast<size_t>(bufferLength - used), "/%s", name);
+	}
+}
+
+// ----------------------------------------------------------------------
+
+void IffView::fatal(char const *message) const
+{
+	char buffer[1024];
+
+	formatLocation(buffer, sizeof(buffer));
+	FATAL(true, ("%s: %s", buffer, message));
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Read a big endian word from the block header at the current position of
+ * the specified depth.
+ *
+ * Block headers are always checked against the enclosing block, so a
+ * corrupt file stops here rather than walking off the end of the buffer.
+ */
+
+uint32 IffView::peekHeader(int depth, int offset) const
+{
+	NOT_NULL(m_data);
+
+	Stack const &s = m_stack[depth];
+	if (s.length - s.used < offset + isizeof(uint32))
+	{
+		char buffer[256];
+		snprintf(buffer, sizeof(buffer), "read overflow depth=[%d] length=[%d] used=[%d] want=[%d]", depth, s.length, s.used, offset + isizeof(uint32));
+		fatal(buffer);
+	}
+
+	uint32 value;
+	memcpy(&value, m_data + s.start + s.used + offset, sizeof(value));
+	return ntohl(value);
+}
+
+// ----------------------------------------------------------------------
+
+Tag IffView::getFirstTag() const
+{
+	return peekHeader(m_stackDepth, 0);
+}
+
+// ----------------------------------------------------------------------
+
+Tag IffView::getSecondTag() const
+{
+	return peekHeader(m_stackDepth, cs_chunkHeaderSize);
+}
+
+// ----------------------------------------------------------------------
+
+bool IffView::enterBlock(Tag name, bool validateName, bool form, bool optional)
+{
+	if (!m_inChunk && !atEndOfForm())
+	{
+		Tag const firstTag = getFirstTag();
+		bool const isForm = (firstTag == TAG_FORM);
+
+		if (isForm == form && (!validateName || (form ? getSecondTag() : firstTag) == name))
+		{
+			Stack const &parent = m_stack[m_stackDepth];
+			int const blockLength = static_cast<int>(peekHeader(m_stackDepth, isizeof(Tag)));
+
+			if (blockLength < (form ? isizeof(Tag) : 0) || blockLength > parent.length - parent.used - cs_chunkHeaderSize)
+			{
+				char buffer[256];
+				snprintf(buffer, sizeof(buffer), "bad block length %d with %d left", blockLength, parent.length - parent.used - cs_chunkHeaderSize);
+				fatal(buffer);
+			}
+
+			if (m_stackDepth + 1 >= MAX_STACK_DEPTH)
+				fatal("blocks nested too deeply");
+
+			Stack &s = m_stack[m_stackDepth + 1];
+			s.start  = parent.start + parent.used + (form ? cs_formHeaderSize : cs_chunkHeaderSize);
+			s.length = form ? blockLength - isizeof(Tag) : blockLength;
+			s.used   = 0;
+
+			++m_stackDepth;
+			m_inChunk = !form;
+
+			return true;
+		}
+	}
+
+	if (!optional)
+	{
+		char tagName[5];
+		ConvertTagToString(name, tagName);
+
+		char buffer[256];
+		snprintf(buffer, sizeof(buffer), "enter %s [%s] failed", form ? "form" : "chunk", validateName ? tagName : "any");
+		fatal(buffer);
+	}
+
+	return false;
+}
+
+// ----------------------------------------------------------------------
+
+void IffView::exitBlock(bool form, bool mayNotBeAtEnd)
+{
+	UNREF(mayNotBeAtEnd);
+
+	DEBUG_FATAL(m_stackDepth == 0, ("exiting root"));
+	DEBUG_FATAL(form && m_inChunk, ("exitForm called within a chunk"));
+	DEBUG_FATAL(!form && !m_inChunk, ("not in chunk"));
+	DEBUG_FATAL(!mayNotBeAtEnd && m_stack[m_stackDepth].used != m_stack[m_stackDepth].length, ("exiting block but not at the end of it"));
+
+	m_stack[m_stackDepth - 1].used += m_stack[m_stackDepth].length + (form ? cs_formHeaderSize : cs_chunkHeaderSize);
+	--m_stackDepth;
+	m_inChunk = false;
+}
+
+// ----------------------------------------------------------------------
+
+void IffView::exitForm(Tag name, bool mayNotBeAtEndOfForm)
+{
+	if (m_stackDepth == 0 || peekHeader(m_stackDepth - 1, cs_chunkHeaderSize) != name)
+		fatal("exit form with incorrect name");
+
+	exitBlock(true, mayNotBeAtEndOfForm);
+}
+
+// ----------------------------------------------------------------------
+
+void IffView::exitChunk(Tag name, bool mayNotBeAtEndOfChunk)
+{
+	if (m_stackDepth == 0 || peekHeader(m_stackDepth - 1, 0) != name)
+		fatal("exit with incorrect name");
+
+	exitBlock(false, mayNotBeAtEndOfChunk);
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Skip forward past the specified number of blocks.
+ *
+ * @return True if all the blocks were skipped, false if the form ran out
+ * of blocks and optional was set
+ */
+
+bool IffView::goForward(int count, bool optional)
+{
+	DEBUG_FATAL(m_inChunk, ("in chunk"));
+
+	for (int i = 0; i < count; ++i)
+	{
+		if (atEndOfForm())
+		{
+			if (optional)
+				return false;
+
+			fatal("goForward past end of form");
+		}
+
+		Stack &s = m_stack[m_stackDepth];
+		int const blockLength = static_cast<int>(peekHeader(m_stackDepth, isizeof(Tag)));
+		if (blockLength < 0 || blockLength > s.length - s.used - cs_chunkHeaderSize)
+			fatal("bad block length");
+
+		s.used += blockLength + cs_chunkHeaderSize;
+	}
+
+	return true;
+}
+
+// ----------------------------------------------------------------------
+
+Vector IffView::read_floatVector()
+{
+	float xyz[3];
+	memcpy(xyz, consume(isizeof(xyz)), sizeof(xyz));
+	return Vector(xyz[0], xyz[1], xyz[2]);
+}
+
+// ----------------------------------------------------------------------
+
+void IffView::read_floatVector(int count, Vector *array)
+{
+	NOT_NULL(array);
+
+	byte const *source = consume(count * 3 * isizeof(float));
+	for (int i = 0; i < count; ++i, source += 3 * sizeof(float))
+	{
+		float xyz[3];
+		memcpy(xyz, source, sizeof(xyz));
+		array[i].set(xyz[0], xyz[1], xyz[2]);
+	}
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Read a nullptr terminated string in place.
+ *
+ * @return A view of the string within the buffer, without its terminator
+ */
+
+std::string_view IffView::read_stringView()
+{
+	DEBUG_FATAL(!m_inChunk, ("not in chunk"));
+
+	Stack &s = m_stack[m_stackDepth];
+	char const * const source = reinterpret_cast<char const *>(m_data + s.start + s.used);
+	char const * const terminator = static_cast<char const *>(memchr(source, 0, static_cast<size_t>(s.length - s.used)));
+	if (!terminator)
+		fatal("hit end of chunk before string terminator");
+
+	int const length = static_cast<int>(terminator - source);
+	s.used += length + 1;
+
+	return std::string_view(source, static_cast<size_t>(length));
+}
+
+// ----------------------------------------------------------------------
+
+void IffView::read_string(std::string &string)
+{
+	std::string_view const source = read_stringView();
+	string.assign(source.data(), source.size());
+}
+
+// ----------------------------------------------------------------------
+
+std::string IffView::read_stdstring()
+{
+	std::string_view const source = read_stringView();
+	return std::string(source.data(), source.size());
+}
+
+// ======================================================================
@@ -0,0 +1,497 @@
+// ======================================================================
+//
+// IffView.h
+// copyright 2002 Sony Online Entertainment
+//
+// ======================================================================
+
+#ifndef INCLUDED_IffView_H
+#define INCLUDED_IffView_H
+
+// ======================================================================
+
+#include "sharedFoundation/Tag.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+class AbstractFile;
+class Iff;
+class Vector;
+
+// ======================================================================
+
+/**
+ * A read-only walker over Iff data that is already in memory.
+ *
+ * Unlike Iff, an IffView never copies the data it reads: forms and chunks
+ * are walked in place over the buffer, strings come back as views of the
+ * buffer and arrays as spans over it.  Files opened from a memory mapped
+ * tree file are walked directly over the mapping, and the stack of enclosing
+ * blocks is kept inside the view, so walking a file does not allocate.
+ *
+ * Views and spans are only valid while the IffView (and, for views built
+ * over another buffer, that buffer) is alive.
+ *
+ * Navigation and reads follow the Iff interface so loaders can move between
+ * the two with few changes.
+ */
+
+class IffView
+{
+public:
+
+	template <typename T>
+	class Span
+	{
+	public:
+
+		Span();
+		Span(byte const *data, int count);
+
+		int          size() const;
+		byte const * getData() const;
+		T            operator [](int index) const;
+		void         copy(T *destination) const;
+
+	private:
+
+		byte const * m_data;
+		int          m_count;
+	};
+
+public:
+
+	IffView();
+	IffView(byte const *data, int length, char const *fileName = nullptr);
+	explicit IffView(Iff &iff);
+	~IffView();
+
+	void         advance(Iff &iff) const;
+
+	bool         open(char const *fileName, bool optional = false);
+	void         close();
+
+	char const * getFileName() const;
+	void         formatLocation(char *buffer, int bufferLength) const;
+
+	// get information on current block
+	Tag          getCurrentName() const;
+	bool         isCurrentChunk() const;
+	bool         isCurrentForm() const;
+	bool         atEndOfForm() const;
+
+	// get information about the number of bytes in the current chunk
+	int          getChunkLengthTotal(int elementSize = 1) const;
+	int          getChunkLengthLeft(int elementSize = 1) const;
+
+	// enter/exit forms and chunks
+	void         enterForm();
+	void         enterForm(Tag name);
+	bool         enterForm(bool optional);
+	bool         enterForm(Tag name, bool optional);
+	void         exitForm(Tag name, bool mayNotBeAtEndOfForm = false);
+	void         exitForm(bool mayNotBeAtEndOfForm = false);
+
+	void         enterChunk();
+	void         enterChunk(Tag name);
+	bool         enterChunk(bool optional);
+	bool         enterChunk(Tag name, bool optional);
+	void         exitChunk(Tag name, bool mayNotBeAtEndOfChunk = false);
+	void         exitChunk(bool mayNotBeAtEndOfChunk = false);
+
+	bool         goForward(int count = 1, bool optional = false);
+
+	// read single entities
+	bool         read_bool8();
+	int8         read_int8();
+	int16        read_int16();
+	int32        read_int32();
+	uint8        read_uint8();
+	uint16       read_uint16();
+	uint32       read_uint32();
+	float        read_float();
+	Vector       read_floatVector();
+
+	// read arrays
+	void         read_int32(int count, int32 *array);
+	void         read_uint32(int count, uint32 *array);
+	void         read_char(int count, char *array);
+	void         read_floatVector(int count, Vector *array);
+
+	template <typename T>
+	Span<T>      read_span(int count);
+	byte const * read_bytes(int length);
+
+	// read strings; the view excludes the terminator
+	std::string_view read_stringView();
+	void             read_string(std::string &string);
+	std::string      read_stdstring();
+
+private:
+
+	enum
+	{
+		MAX_STACK_DEPTH = 64
+	};
+
+	struct Stack
+	{
+		int start;
+		int length;
+		int used;
+	};
+
+private:
+
+	IffView(IffView const &);
+	IffView &operator =(IffView const &);
+
+	void         reset(byte const *data, int length, char const *fileName);
+	void         fatal(char const *message) const;
+	uint32       peekHeader(int depth, int offset) const;
+	Tag          getFirstTag() const;
+	Tag          getSecondTag() const;
+	bool         enterBlock(Tag name, bool validateName, bool form, bool optional);
+	void         exitBlock(bool form, bool mayNotBeAtEnd);
+	byte const * consume(int length);
+
+private:
+
+	byte const *   m_data;
+	char const *   m_fileName;
+
+	// set when the view read the file itself
+	AbstractFile * m_file;
+	byte *         m_ownedData;
+	std::string    m_ownedFileName;
+
+	int            m_stackDepth;
+	bool           m_inChunk;
+	Stack          m_stack[MAX_STACK_DEPTH];
+};
+
+// ======================================================================
+
+template <typename T>
+inline IffView::Span<T>::Span() :
+	m_data(nullptr),
+	m_count(0)
+{
+}
+
+// ----------------------------------------------------------------------
+
+template <typename T>
+inline IffView::Span<T>::Span(byte const *data, int count) :
+	m_data(data),
+	m_count(count)
+{
+}
+
+// ----------------------------------------------------------------------
+
+template <typename T>
+inline int IffView::Span<T>::size() const
+{
+	return m_count;
+}
+
+// ----------------------------------------------------------------------
+
+template <typename T>
+inline byte const *IffView::Span<T>::getData() const
+{
+	return m_data;
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Get an element of the span.
+ *
+ * Iff data carries no alignment, so elements are copied out rather than
+ * referenced in place.
+ */
+
+template <typename T>
+inline T IffView::Span<T>::operator [](int index) const
+{
+	DEBUG_FATAL(index < 0 || index >= m_count, ("span index %d out of range %d", index, m_count));
+
+	T result;
+	memcpy(&result, m_data + index * static_cast<int>(sizeof(T)), sizeof(T));
+	return result;
+}
+
+// ----------------------------------------------------------------------
+
+template <typename T>
+inline void IffView::Span<T>::copy(T *destination) const
+{
+	if (m_count)
+		memcpy(destination, m_data, static_cast<size_t>(m_count) * sizeof(T));
+}
+
+// ======================================================================
+
+inline char const *IffView::getFileName() const
+{
+	return m_fileName;
+}
+
+// ----------------------------------------------------------------------
+
+inline bool IffView::atEndOfForm() const
+{
+	Stack const &s = m_stack[m_stackDepth];
+	return s.used == s.length;
+}
+
+// ----------------------------------------------------------------------
+
+inline bool IffView::isCurrentForm() const
+{
+	return !m_inChunk && !atEndOfForm() && getFirstTag() == TAG_FORM;
+}
+
+// ----------------------------------------------------------------------
+
+inline bool IffView::isCurrentChunk() const
+{
+	return !m_inChunk && !atEndOfForm() && getFirstTag() != TAG_FORM;
+}
+
+// ----------------------------------------------------------------------
+
+inline Tag IffView::getCurrentName() const
+{
+	Tag const tag = getFirstTag();
+	return tag == TAG_FORM ? getSecondTag() : tag;
+}
+
+// ----------------------------------------------------------------------
+
+inline int IffView::getChunkLengthTotal(int elementSize) const
+{
+	DEBUG_FATAL(!m_inChunk, ("not in chunk"));
+	DEBUG_FATAL(m_stack[m_stackDepth].length % elementSize != 0, ("%d not a multiple of %d", m_stack[m_stackDepth].length, elementSize));
+	return m_stack[m_stackDepth].length / elementSize;
+}
+
+// ----------------------------------------------------------------------
+
+inline int IffView::getChunkLengthLeft(int elementSize) const
+{
+	DEBUG_FATAL(!m_inChunk, ("not in chunk"));
+	int const left = m_stack[m_stackDepth].length - m_stack[m_stackDepth].used;
+	DEBUG_FATAL(left % elementSize != 0, ("%d not a multiple of %d", left, elementSize));
+	return left / elementSize;
+}
+
+// ----------------------------------------------------------------------
+
+inline void IffView::enterForm()
+{
+	IGNORE_RETURN(enterBlock(0, false, true, false));
+}
+
+// ----------------------------------------------------------------------
+
+inline void IffView::enterForm(Tag name)
+{
+	IGNORE_RETURN(enterBlock(name, true, true, false));
+}
+
+// ----------------------------------------------------------------------
+
+inline bool IffView::enterForm(bool optional)
+{
+	return enterBlock(0, false, true, optional);
+}
+
+// ----------------------------------------------------------------------
+
+inline bool IffView::enterForm(Tag name, bool optional)
+{
+	return enterBlock(name, true, true, optional);
+}
+
+// ----------------------------------------------------------------------
+
+inline void IffView::exitForm(bool mayNotBeAtEndOfForm)
+{
+	exitBlock(true, mayNotBeAtEndOfForm);
+}
+
+// ----------------------------------------------------------------------
+
+inline void IffView::enterChunk()
+{
+	IGNORE_RETURN(enterBlock(0, false, false, false));
+}
+
+// ----------------------------------------------------------------------
+
+inline void IffView::enterChunk(Tag name)
+{
+	IGNORE_RETURN(enterBlock(name, true, false, false));
+}
+
+// ----------------------------------------------------------------------
+
+inline bool IffView::enterChunk(bool optional)
+{
+	return enterBlock(0, false, false, optional);
+}
+
+// ----------------------------------------------------------------------
+
+inline bool IffView::enterChunk(Tag name, bool optional)
+{
+	return enterBlock(name, true, false, optional);
+}
+
+// ----------------------------------------------------------------------
+
+inline void IffView::exitChunk(bool mayNotBeAtEndOfChunk)
+{
+	exitBlock(false, mayNotBeAtEndOfChunk);
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Claim the next bytes of the current chunk.
+ *
+ * @return A pointer to the bytes within the viewed buffer
+ */
+
+inline byte const *IffView::consume(int length)
+{
+	DEBUG_FATAL(!m_inChunk, ("not in chunk"));
+
+	Stack &s = m_stack[m_stackDepth];
+	if (length < 0 || length > s.length - s.used)
+	{
+		char buffer[256];
+		snprintf(buffer, sizeof(buffer), "read overflow %d/%d", s.used + length, s.length);
+		fatal(buffer);
+	}
+
+	byte const * const result = m_data + s.start + s.used;
+	s.used += length;
+	return result;
+}
+
+// ----------------------------------------------------------------------
+
+inline bool IffView::read_bool8()
+{
+	return *consume(1) != 0;
+}
+
+// ----------------------------------------------------------------------
+
+inline int8 IffView::read_int8()
+{
+	return static_cast<int8>(*consume(1));
+}
+
+// ----------------------------------------------------------------------
+
+inline uint8 IffView::read_uint8()
+{
+	return *consume(1);
+}
+
+// ----------------------------------------------------------------------
+
+inline int16 IffView::read_int16()
+{
+	int16 result;
+	memcpy(&result, consume(isizeof(result)), sizeof(result));
+	return result;
+}
+
+// ----------------------------------------------------------------------
+
+inline uint16 IffView::read_uint16()
+{
+	uint16 result;
+	memcpy(&result, consume(isizeof(result)), sizeof(result));
+	return result;
+}
+
+// ----------------------------------------------------------------------
+
+inline int32 IffView::read_int32()
+{
+	int32 result;
+	memcpy(&result, consume(isizeof(result)), sizeof(result));
+	return result;
+}
+
+// ----------------------------------------------------------------------
+
+inline uint32 IffView::read_uint32()
+{
+	uint32 result;
+	memcpy(&result, consume(isizeof(result)), sizeof(result));
+	return result;
+}
+
+// ----------------------------------------------------------------------
+
+inline float IffView::read_float()
+{
+	float result;
+	memcpy(&result, consume(isizeof(result)), sizeof(result));
+	return result;
+}
+
+// ----------------------------------------------------------------------
+
+inline void IffView::read_int32(int count, int32 *array)
+{
+	byte const * const source = consume(count * isizeof(int32));
+	if (count)
+		memcpy(array, source, static_cast<size_t>(count) * sizeof(int32));
+}
+
+// ----------------------------------------------------------------------
+
+inline void IffView::read_uint32(int count, uint32 *array)
+{
+	byte const * const source = consume(count * isizeof(uint32));
+	if (count)
+		memcpy(array, source, static_cast<size_t>(count) * sizeof(uint32));
+}
+
+// ----------------------------------------------------------------------
+
+inline void IffView::read_char(int count, char *array)
+{
+	byte const * const source = consume(count);
+	if (count)
+		memcpy(array, source, static_cast<size_t>(count));
+}
+
+// ----------------------------------------------------------------------
+
+inline byte const *IffView::read_bytes(int length)
+{
+	return consume(length);
+}
+
+// ----------------------------------------------------------------------
+
+template <typename T>
+inline IffView::Span<T> IffView::read_span(int count)
+{
+	return Span<T>(consume(count * static_cast<int>(sizeof(T))), count);
+}
+
+// ======================================================================
+
+#endif
@@ -62,7 +62,25 @@ MemoryFile::MemoryFile(byte *buffer, int length)
 : AbstractFile(PriorityData),
 	m_buffer(buffer),
 	m_length(length),
-	m_offset(0)
+	m_offset(0),
+	m_ownsBuffer(true)
+{
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Create a memory file over a buffer.
+ *
+ * If ownsBuffer is false the buffer must outlive the file, and is never
+ * written to or deleted.
+ */
+
+MemoryFile::MemoryFile(byte *buffer, int length, bool ownsBuffer)
+: AbstractFile(PriorityData),
+	m_buffer(buffer),
+	m_length(length),
+	m_offset(0),
+	m_ownsBuffer(ownsBuffer)
 {
 }
 
@@ -72,7 +90,8 @@ MemoryFile::MemoryFile(AbstractFile *file)
 : AbstractFile(PriorityData),
 	m_buffer(nullptr),
 	m_length(file->length()),
-	m_offset(0)
+	m_offset(0),
+	m_ownsBuffer(true)
 {
 	m_buffer = file->readEntireFileAndClose();
 }
@@ -161,7 +180,8 @@ int MemoryFile::write(int, const void *)
 
 void MemoryFile::close()
 {
-	delete [] m_buffer;
+	if (m_ownsBuffer)
+		delete [] m_buffer;
 	m_buffer = nullptr;
 }
 
@@ -170,6 +190,11 @@ void MemoryFile::close()
 byte *MemoryFile::readEntireFileAndClose()
 {
 	byte *result = m_buffer;
+	if (!m_ownsBuffer)
+	{
+		result = new byte[m_length];
+		memcpy(result, m_buffer, m_length);
+	}
 	m_buffer = nullptr;
 	return result;
 }
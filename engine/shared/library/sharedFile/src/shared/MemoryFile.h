@@ -28,6 +28,7 @@ public:
 public:
 
 	MemoryFile(byte *buffer, int length);
+	MemoryFile(byte *buffer, int length, bool ownsBuffer);
 	MemoryFile(AbstractFile *file);
 	virtual ~MemoryFile();
 
@@ -41,6 +42,9 @@ public:
 
 	virtual byte *readEntireFileAndClose();
 
+	byte const   *getBuffer() const;
+	bool          ownsBuffer() const;
+
 private:
 
 	MemoryFile();
@@ -58,8 +62,29 @@ private:
 	byte                 *m_buffer;
 	const int             m_length;
 	int                   m_offset;
+	const bool            m_ownsBuffer;
 };
 
+// ======================================================================
+/**
+ * Get the memory the file reads from.
+ *
+ * When the file does not own its buffer (e.g. a view of a memory mapped
+ * tree file), the buffer stays valid after the file is closed.
+ */
+
+inline byte const *MemoryFile::getBuffer() const
+{
+	return m_buffer;
+}
+
+// ----------------------------------------------------------------------
+
+inline bool MemoryFile::ownsBuffer() const
+{
+	return m_ownsBuffer;
+}
+
 // ======================================================================
 
 #endif
@@ -12,11 +12,13 @@
 #include "sharedFile/TreeFile_SearchNode.h"
 
 #include "sharedDebug/DebugFlags.h"
+#include "sharedDebug/PerformanceTimer.h"
 #include "sharedDebug/PixCounter.h"
 #include "sharedFile/ConfigSharedFile.h"
 #include "sharedFile/FileManifest.h"
 #include "sharedFile/FileStreamer.h"
 #include "sharedFoundation/ConfigFile.h"
+#include "sharedFoundation/Crc.h"
 #include "sharedFoundation/ExitChain.h"
 #include "sharedFoundation/Os.h"
 #include "sharedFoundation/Production.h"
@@ -28,6 +30,7 @@
 #include <stdio.h>
 #include <vector>
 #include <map>
+#include <set>
 
 // ======================================================================
 
@@ -36,9 +39,14 @@ bool                   TreeFile::ms_haveCachedFiles;
 Mutex                  TreeFile::ms_criticalSection;
 TreeFile::SearchNodes  TreeFile::ms_searchNodes;
 TreeFile::SearchCache * TreeFile::ms_searchCache;
+TreeFile::ArchiveIndex * TreeFile::ms_archiveIndex;
+bool                   TreeFile::ms_archiveIndexDirty = true;
+bool                   TreeFile::ms_useArchiveIndex = true;
 
 int                    TreeFile::ms_numberOfFilesOpenedTotal;
 int                    TreeFile::ms_sizeOfFilesOpenedTotal;
+int                    TreeFile::ms_numberOfLookupsTotal;
+int                    TreeFile::ms_numberOfKnownMissingLookupsTotal;
 #if PRODUCTION == 0
 bool                   TreeFile::ms_debugReportFlagShowMetrics;
 bool                   TreeFile::ms_debugReportFlagShowSearchPaths;
@@ -67,6 +75,10 @@ namespace TreeFileNamespace
 	typedef std::map<const char *, AbstractFile *, CachedFilesComparator> CachedFilesMap;
 	static CachedFilesMap cachedFilesMap;
 
+	// fixed up names no search node had, when SharedFile/cacheMissingFiles is set
+	typedef std::set<std::string> KnownMissingFiles;
+	static KnownMissingFiles ms_knownMissingFiles;
+
 #if PRODUCTION == 0
 	bool ms_debugLogSynchronousOnly;
 	bool ms_warnTreeFileOpens;
@@ -209,6 +221,7 @@ void TreeFile::remove(void)
 		for (SearchNodes::iterator i = ms_searchNodes.begin(); i != iEnd; ++i)
 			delete *i;
 		ms_searchNodes.clear();
+		invalidateSearchNodes();
 
 		ms_searchCache = 0;
 
@@ -251,7 +264,7 @@ void TreeFile::setLogTreeFileOpens(bool const logTreeFileOpens)
 
 void TreeFile::debugReportMetrics()
 {
-	REPORT_LOG_PRINT(true, ("TreeFile: %d,%d,%d=opened %d,%d,%d=bytes %d=oTotal %d=bTotal %d=cacheMiss\n", ms_numberOfFilesOpened[0].getLastFrameValue(), ms_numberOfFilesOpened[1].getLastFrameValue(), ms_numberOfFilesOpened[2].getLastFrameValue(), ms_sizeOfFilesOpened[0].getLastFrameValue(), ms_sizeOfFilesOpened[1].getLastFrameValue(), ms_sizeOfFilesOpened[2].getLastFrameValue(), ms_numberOfFilesOpenedTotal, ms_sizeOfFilesOpenedTotal, ms_unexpectedCacheMisses));
+	REPORT_LOG_PRINT(true, ("TreeFile: %d,%d,%d=opened %d,%d,%d=bytes %d=oTotal %d=bTotal %d=cacheMiss %d=lookups %d=knownMissing\n", ms_numberOfFilesOpened[0].getLastFrameValue(), ms_numberOfFilesOpened[1].getLastFrameValue(), ms_numberOfFilesOpened[2].getLastFrameValue(), ms_sizeOfFilesOpened[0].getLastFrameValue(), ms_sizeOfFilesOpened[1].getLastFrameValue(), ms_sizeOfFilesOpened[2].getLastFrameValue(), ms_numberOfFilesOpenedTotal, ms_sizeOfFilesOpenedTotal, ms_unexpectedCacheMisses, ms_numberOfLookupsTotal, ms_numberOfKnownMissingLookupsTotal));
 }
 
 #endif
@@ -303,10 +316,27 @@ void TreeFile::addSearchNode(SearchNode *newNode)
 
 		SearchNodes::iterator insertionPoint = std::lower_bound(ms_searchNodes.begin(), ms_searchNodes.end(), newNode, searchNodePriorityOrder);
 		IGNORE_RETURN(ms_searchNodes.insert(insertionPoint, newNode));
+		invalidateSearchNodes();
 
 	ms_criticalSection.leave();
 }
 
+// ----------------------------------------------------------------------
+/**
+ * Forget everything derived from the search list.  The archive index is
+ * rebuilt the next time a file is looked up.
+ *
+ * The caller must hold ms_criticalSection.
+ */
+
+void TreeFile::invalidateSearchNodes()
+{
+	delete ms_archiveIndex;
+	ms_archiveIndex = nullptr;
+	ms_archiveIndexDirty = true;
+	ms_knownMissingFiles.clear();
+}
+
 // ----------------------------------------------------------------------
 /**
  * Add a SearchAbsolute to the node list.
@@ -421,6 +451,7 @@ void TreeFile::removeAllSearches(void)
 		for (SearchNodes::iterator i = ms_searchNodes.begin(); i != iEnd; ++i)
 			delete *i;
 		ms_searchNodes.clear();
+		invalidateSearchNodes();
 
 	ms_criticalSection.leave();
 }
@@ -450,16 +481,109 @@ TreeFile::SearchNode *TreeFile::find(const char *fileName)
 		return nullptr;
 	}
 
+	++ms_numberOfLookupsTotal;
+	if (isKnownMissing(fileName))
+		return nullptr;
+
+	SearchNode *archive = nullptr;
+	int index = -1;
+	bool const indexed = findInArchives(fileName, archive, index);
+
 	// search the list of nodes looking to see if the specified file exists
 	bool deleted = false;
 	const SearchNodes::iterator iEnd = ms_searchNodes.end();
 	for (SearchNodes::iterator i = ms_searchNodes.begin(); !deleted && i != iEnd; ++i)
+	{
+		if (indexed && (*i)->isArchive())
+		{
+			if (*i != archive)
+				continue;
+
+			if (index < 0)
+				return nullptr;
+
+			return *i;
+		}
+
 		if ((*i)->exists(fileName, deleted))
 			return *i;
+	}
+
+	if (!deleted)
+		addKnownMissing(fileName);
 
 	return nullptr;
 }
 
+// ----------------------------------------------------------------------
+/**
+ * Look a fixed up file name up in the archive index, building the index
+ * first if the search list has changed.
+ *
+ * @param node   Set to the archive the file resolves to, or nullptr if no archive holds it.
+ * @param index  Set to the file's table of contents index in node, or -1 if node deletes it.
+ * @return false if there is no index, in which case the archives must be searched one by one.
+ */
+
+bool TreeFile::findInArchives(const char *fileName, SearchNode *&node, int &index)
+{
+	node = nullptr;
+	index = -1;
+
+	if (!ms_useArchiveIndex)
+		return false;
+
+	uint32 const crc = Crc::calculate(fileName);
+
+	ms_criticalSection.enter();
+
+		if (ms_archiveIndexDirty)
+		{
+			ms_archiveIndex = new ArchiveIndex(ms_searchNodes);
+			ms_archiveIndexDirty = false;
+			DEBUG_REPORT_LOG(true, ("TreeFile: indexed %d archived files\n", ms_archiveIndex->getNumberOfEntries()));
+		}
+
+		if (!ms_archiveIndex->find(fileName, crc, node, index))
+			node = nullptr;
+
+	ms_criticalSection.leave();
+
+	return true;
+}
+
+// ----------------------------------------------------------------------
+
+bool TreeFile::isKnownMissing(const char *fileName)
+{
+	if (!ConfigSharedFile::getCacheMissingFiles())
+		return false;
+
+	ms_criticalSection.enter();
+
+		bool const result = ms_knownMissingFiles.find(fileName) != ms_knownMissingFiles.end();
+		if (result)
+			++ms_numberOfKnownMissingLookupsTotal;
+
+	ms_criticalSection.leave();
+
+	return result;
+}
+
+// ----------------------------------------------------------------------
+
+void TreeFile::addKnownMissing(const char *fileName)
+{
+	if (!ConfigSharedFile::getCacheMissingFiles())
+		return;
+
+	ms_criticalSection.enter();
+
+		IGNORE_RETURN(ms_knownMissingFiles.insert(fileName));
+
+	ms_criticalSection.leave();
+}
+
 // ----------------------------------------------------------------------
 /**
  * Check if a specified file can be found.
@@ -489,16 +613,35 @@ int TreeFile::getFileSize(const char *fileName)
 	char fixedFileName[Os::MAX_PATH_LENGTH];
 	fixUpFileName(fixedFileName, fileName, true);
 
+	++ms_numberOfLookupsTotal;
+	if (isKnownMissing(fixedFileName))
+		return -1;
+
+	SearchNode *archive = nullptr;
+	int index = -1;
+	bool const indexed = findInArchives(fixedFileName, archive, index);
+
 	// search the list of nodes looking to see if the specified file exists
 	bool deleted = false;
 	const SearchNodes::iterator iEnd = ms_searchNodes.end();
 	for (SearchNodes::iterator i = ms_searchNodes.begin(); !deleted && i != iEnd; ++i)
 	{
+		if (indexed && (*i)->isArchive())
+		{
+			if (*i != archive)
+				continue;
+
+			return index < 0 ? -1 : (*i)->getFileSizeByIndex(index);
+		}
+
 		int size = (*i)->getFileSize(fixedFileName, deleted);
 		if (size >= 0)
 			return size;
 	}
 
+	if (!deleted)
+		addKnownMissing(fixedFileName);
+
 	return -1;
 }
 
@@ -708,11 +851,29 @@ AbstractFile* TreeFile::open(const char *fileName, AbstractFile::PriorityType pr
 	bool first = true;
 #endif
 
-	bool deleted = false;
+	++ms_numberOfLookupsTotal;
+	bool const knownMissing = isKnownMissing(fixedFileName);
+
+	SearchNode *archive = nullptr;
+	int index = -1;
+	bool const indexed = !knownMissing && findInArchives(fixedFileName, archive, index);
+
+	bool deleted = knownMissing;
 	const SearchNodes::iterator iEnd = ms_searchNodes.end();
 	for (SearchNodes::iterator i = ms_searchNodes.begin(); !file && !deleted && i != iEnd; ++i)
 	{
-		file = (*i)->open(fixedFileName, priority, deleted);
+		if (indexed && (*i)->isArchive())
+		{
+			if (*i != archive)
+				continue;
+
+			if (index < 0)
+				deleted = true;
+			else
+				file = (*i)->openByIndex(index, priority);
+		}
+		else
+			file = (*i)->open(fixedFileName, priority, deleted);
 
 #if PRODUCTION == 0
 		if (file)
@@ -741,6 +902,9 @@ AbstractFile* TreeFile::open(const char *fileName, AbstractFile::PriorityType pr
 
 	if (!file)
 	{
+		if (!deleted)
+			addKnownMissing(fixedFileName);
+
 		FATAL(!allowFail, ("open '%s' not found", fixedFileName));
 
 #if PRODUCTION == 0
@@ -937,6 +1101,49 @@ void TreeFile::clearCachedFiles()
 	ms_criticalSection.leave();
 }
 
+// ----------------------------------------------------------------------
+/**
+ * Remove one file added with addCachedFile, deleting it if it was never
+ * opened.  Other cached files, such as the SharedFile/preload ones, stay.
+ */
+
+void TreeFile::removeCachedFile(const char *fileName)
+{
+	NOT_NULL(fileName);
+
+	ms_criticalSection.enter();
+
+		CachedFilesMap::iterator i = cachedFilesMap.find(fileName);
+		if (i != cachedFilesMap.end())
+		{
+			delete i->second;
+			cachedFilesMap.erase(i);
+			ms_haveCachedFiles = !cachedFilesMap.empty();
+		}
+
+	ms_criticalSection.leave();
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Check whether a file was added with addCachedFile, whether or not it has
+ * been opened since.  Adding it again would fail.
+ */
+
+bool TreeFile::hasCachedFile(const char *fileName)
+{
+	NOT_NULL(fileName);
+
+	char fixedFileName[Os::MAX_PATH_LENGTH];
+	fixUpFileName(fixedFileName, fileName, false);
+
+	ms_criticalSection.enter();
+		bool const result = cachedFilesMap.find(fixedFileName) != cachedFilesMap.end();
+	ms_criticalSection.leave();
+
+	return result;
+}
+
 // ----------------------------------------------------------------------
 
 int TreeFile::getNumberOfFilesOpenedTotal()
@@ -959,6 +1166,76 @@ int TreeFile::cacheFile(char const * const fileName)
 	return ms_searchCache->addCachedFile(fileName);
 }
 
+// ----------------------------------------------------------------------
+/**
+ * Time looking up every archived file, and as many missing ones, with and
+ * without the archive index.
+ *
+ * @return the number of archived files looked up on each pass
+ */
+
+int TreeFile::benchmarkLookups(int & indexFound, float & indexHitTime, float & indexMissTime, int & nodeFound, float & nodeHitTime, float & nodeMissTime)
+{
+	std::vector<const char *> fileNames;
+	{
+		SearchNode *archive = nullptr;
+		int index = -1;
+		IGNORE_RETURN(findInArchives("", archive, index));
+
+		ms_criticalSection.enter();
+			if (ms_archiveIndex)
+				ms_archiveIndex->getFileNames(fileNames);
+		ms_criticalSection.leave();
+	}
+
+	if (fileNames.empty())
+		return 0;
+
+	std::vector<std::string> missingFileNames;
+	missingFileNames.reserve(fileNames.size());
+	for (std::vector<const char *>::const_iterator i = fileNames.begin(); i != fileNames.end(); ++i)
+		missingFileNames.push_back(std::string(*i) + ".missing");
+
+	int const numberOfLookups = static_cast<int>(fileNames.size());
+	bool const useArchiveIndex = ms_useArchiveIndex;
+
+	for (int pass = 0; pass < 2; ++pass)
+	{
+		ms_useArchiveIndex = (pass == 0);
+
+		ms_criticalSection.enter();
+			ms_knownMissingFiles.clear();
+		ms_criticalSection.leave();
+
+		PerformanceTimer timer;
+		timer.start();
+		int found = 0;
+		for (std::vector<const char *>::const_iterator i = fileNames.begin(); i != fileNames.end(); ++i)
+			if (find(*i))
+				++found;
+		timer.stop();
+		float const hitTime = timer.getElapsedTime();
+
+		timer.start();
+		for (std::vector<std::string>::const_iterator j = missingFileNames.begin(); j != missingFileNames.end(); ++j)
+			IGNORE_RETURN(find(j->c_str()));
+		timer.stop();
+		float const missTime = timer.getElapsedTime();
+
+		(ms_useArchiveIndex ? indexFound : nodeFound) = found;
+		(ms_useArchiveIndex ? indexHitTime : nodeHitTime) = hitTime;
+		(ms_useArchiveIndex ? indexMissTime : nodeMissTime) = missTime;
+	}
+
+	ms_useArchiveIndex = useArchiveIndex;
+
+	ms_criticalSection.enter();
+		ms_knownMissingFiles.clear();
+	ms_criticalSection.leave();
+
+	return numberOfLookups;
+}
+
 // ======================================================================
 
 AbstractFile* TreeFile::TreeFileFactory::createFile(const char *filename, const char *open_type)
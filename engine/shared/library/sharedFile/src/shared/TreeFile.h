@@ -44,6 +44,8 @@ private:
 	class SearchTree;
 	class SearchTOC;
 	class SearchCache;
+	class DecompressedCache;
+	class ArchiveIndex;
 
 	friend class SearchNode;
 	friend class TreeFileBuilder;
@@ -96,12 +98,16 @@ public:
 
 	static void          addCachedFile(const char *fileName, AbstractFile *file);
 	static void          clearCachedFiles();
+	static void          removeCachedFile(const char *fileName);
+	static bool          hasCachedFile(const char *fileName);
 
 	static int           getNumberOfFilesOpenedTotal();
 	static int           getSizeOfFilesOpenedTotal();
 
 	static int           cacheFile(char const * fileName);
 
+	static int           benchmarkLookups(int & indexFound, float & indexHitTime, float & indexMissTime, int & nodeFound, float & nodeHitTime, float & nodeMissTime);
+
 private:
 
 	typedef std::vector<SearchNode *>  SearchNodes;
@@ -118,7 +124,11 @@ private:
 	static void        addSearchCache(int priority);
 	static bool        searchNodePriorityOrder(const SearchNode *a, const SearchNode *b);
 	static void        addSearchNode(SearchNode *newNode);
+	static void        invalidateSearchNodes();
 	static SearchNode *find(const char *fileName);
+	static bool        findInArchives(const char *fileName, SearchNode *&node, int &index);
+	static bool        isKnownMissing(const char *fileName);
+	static void        addKnownMissing(const char *fileName);
 
 	static void        fixUpFileName(char *output, const char *filename, bool warning);
 
@@ -129,12 +139,17 @@ private:
 	static Mutex         ms_criticalSection;
 	static SearchNodes   ms_searchNodes;
 	static SearchCache * ms_searchCache;
+	static ArchiveIndex *ms_archiveIndex;
+	static bool          ms_archiveIndexDirty;
+	static bool          ms_useArchiveIndex;
 
 	static bool          ms_debugReportFlagShowMetrics;
 	static bool          ms_debugReportFlagShowSearchPaths;
 	static bool          ms_debugLogFlag;
 	static int           ms_numberOfFilesOpenedTotal;
 	static int           ms_sizeOfFilesOpenedTotal;
+	static int           ms_numberOfLookupsTotal;
+	static int           ms_numberOfKnownMissingLookupsTotal;
 	static int           ms_unexpectedCacheMisses;
 };
 
@@ -13,9 +13,11 @@
 #include "sharedCompression/Compressor.h"
 #include "sharedCompression/ZlibCompressor.h"
 #include "sharedDebug/DebugFlags.h"
+#include "sharedFile/ConfigSharedFile.h"
 #include "sharedFile/FileStreamerFile.h"
 #include "sharedFile/FileStreamer.h"
 #include "sharedFile/MemoryFile.h"
+#include "sharedFile/MemoryMappedFile.h"
 #include "sharedFile/ZlibFile.h"
 #include "sharedFoundation/ConfigFile.h"
 #include "sharedFoundation/Crc.h"
@@ -28,7 +30,10 @@
 #include "sharedSynchronization/Mutex.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstdio>
 #include <map>
+#include <sys/stat.h>
 #include <vector>
 
 // ======================================================================
@@ -38,6 +43,123 @@ const Tag TAG_TOC  = TAG3(T,O,C);
 
 // ======================================================================
 
+namespace TreeFileSearchNodeNamespace
+{
+	// guards the mapping budget and the lazily mapped tree files
+	Mutex ms_mappingLock;
+	int64 ms_mappedSize;
+	bool  ms_mappingLimitReported;
+
+	// keeps decompressed cache temporary file names unique between threads of this process
+	std::atomic<int> ms_nextTemporaryFileNumber(0);
+
+	MemoryMappedFile *mapFileLocked(const char *fileName, int length);
+	MemoryMappedFile *mapFile(const char *fileName, int length);
+	void              unmapFile(MemoryMappedFile *mappedFile);
+	MemoryMappedFile const *mapTreeFile(const char *fileName, int length, MemoryMappedFile *&mappedFile, bool &mapAttempted);
+	uint32            calculateFileStamp(const char *fileName);
+}
+
+using namespace TreeFileSearchNodeNamespace;
+
+// ----------------------------------------------------------------------
+/**
+ * Map a file if it has the expected length and fits in maximumMappedSize.
+ * The caller must hold ms_mappingLock.
+ */
+
+MemoryMappedFile *TreeFileSearchNodeNamespace::mapFileLocked(const char *fileName, int length)
+{
+	int64 const limit = static_cast<int64>(ConfigSharedFile::getMaximumMappedSize()) * 1024 * 1024;
+	if (ms_mappedSize + length > limit)
+	{
+		if (!ms_mappingLimitReported)
+		{
+			WARNING(true, ("maximumMappedSize of %d MB reached mapping %s, reading files instead", ConfigSharedFile::getMaximumMappedSize(), fileName));
+			ms_mappingLimitReported = true;
+		}
+		return nullptr;
+	}
+
+	MemoryMappedFile * const mappedFile = MemoryMappedFile::open(fileName);
+	if (!mappedFile)
+		return nullptr;
+
+	// a short file is one still being written by a process that died
+	if (mappedFile->length() != length)
+	{
+		delete mappedFile;
+		return nullptr;
+	}
+
+	ms_mappedSize += length;
+	return mappedFile;
+}
+
+// ----------------------------------------------------------------------
+
+MemoryMappedFile *TreeFileSearchNodeNamespace::mapFile(const char *fileName, int length)
+{
+	ms_mappingLock.enter();
+		MemoryMappedFile * const mappedFile = mapFileLocked(fileName, length);
+	ms_mappingLock.leave();
+
+	return mappedFile;
+}
+
+// ----------------------------------------------------------------------
+
+void TreeFileSearchNodeNamespace::unmapFile(MemoryMappedFile *mappedFile)
+{
+	if (!mappedFile)
+		return;
+
+	ms_mappingLock.enter();
+		ms_mappedSize -= mappedFile->length();
+	ms_mappingLock.leave();
+
+	delete mappedFile;
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Map a tree file the first time an entry is opened from it, so only the
+ * tree files actually in use take address space.
+ */
+
+MemoryMappedFile const *TreeFileSearchNodeNamespace::mapTreeFile(const char *fileName, int length, MemoryMappedFile *&mappedFile, bool &mapAttempted)
+{
+	if (!ConfigSharedFile::getMapTreeFiles())
+		return nullptr;
+
+	ms_mappingLock.enter();
+
+		if (!mapAttempted)
+		{
+			mappedFile = mapFileLocked(fileName, length);
+			mapAttempted = true;
+		}
+
+		MemoryMappedFile const * const result = mappedFile;
+
+	ms_mappingLock.leave();
+
+	return result;
+}
+
+// ----------------------------------------------------------------------
+
+uint32 TreeFileSearchNodeNamespace::calculateFileStamp(const char *fileName)
+{
+	struct stat status;
+	if (stat(fileName, &status) != 0)
+		return 0;
+
+	return static_cast<uint32>(status.st_mtime);
+}
+
+// ======================================================================
+
 TreeFile::SearchNode::SearchNode(int priority)
 :
 	m_priority(priority)
@@ -49,6 +171,134 @@ TreeFile::SearchNode::SearchNode(int priority)
 TreeFile::SearchNode::~SearchNode(void)
 {
 }
+
+// ----------------------------------------------------------------------
+
+bool TreeFile::SearchNode::isArchive() const
+{
+	return false;
+}
+
+// ----------------------------------------------------------------------
+
+int TreeFile::SearchNode::getNumberOfEntries() const
+{
+	return 0;
+}
+
+// ----------------------------------------------------------------------
+
+uint32 TreeFile::SearchNode::getEntryCrc(int) const
+{
+	DEBUG_FATAL(true, ("not an archive"));
+	return 0;
+}
+
+// ----------------------------------------------------------------------
+
+const char *TreeFile::SearchNode::getEntryFileName(int) const
+{
+	DEBUG_FATAL(true, ("not an archive"));
+	return nullptr;
+}
+
+// ----------------------------------------------------------------------
+
+bool TreeFile::SearchNode::isEntryDeleted(int) const
+{
+	DEBUG_FATAL(true, ("not an archive"));
+	return false;
+}
+
+// ----------------------------------------------------------------------
+
+bool TreeFile::SearchNode::isEntryValid(int) const
+{
+	DEBUG_FATAL(true, ("not an archive"));
+	return false;
+}
+
+// ----------------------------------------------------------------------
+
+int TreeFile::SearchNode::getFileSizeByIndex(int) const
+{
+	DEBUG_FATAL(true, ("not an archive"));
+	return -1;
+}
+
+// ----------------------------------------------------------------------
+
+AbstractFile *TreeFile::SearchNode::openByIndex(int, AbstractFile::PriorityType)
+{
+	DEBUG_FATAL(true, ("not an archive"));
+	return nullptr;
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Open an entry of a tree file.
+ *
+ * Uncompressed entries of a mapped tree file are returned as views of the
+ * mapping.  Compressed entries come from the decompressed cache when there
+ * is one and the entry is big enough to be worth sharing, otherwise they
+ * are inflated by the returned ZlibFile.
+ */
+
+AbstractFile *TreeFile::SearchNode::openEntry(FileStreamer::File &file, MemoryMappedFile const *mappedFile, DecompressedCache *decompressedCache, int index, bool compressed, int offset, int length, int compressedLength, AbstractFile::PriorityType priority)
+{
+	int const storedLength = compressed ? compressedLength : length;
+	if (mappedFile && offset + storedLength > mappedFile->length())
+	{
+		DEBUG_WARNING(true, ("tree file entry %d at %d+%d is past the end of the mapping", index, offset, storedLength));
+		mappedFile = nullptr;
+	}
+
+	if (!compressed)
+	{
+		if (mappedFile)
+			return new MemoryFile(const_cast<byte *>(mappedFile->getData() + offset), length, false);
+
+		return new FileStreamerFile(priority, file, offset, length);
+	}
+
+	byte * compressedBuffer = nullptr;
+	if (mappedFile)
+		compressedBuffer = const_cast<byte *>(mappedFile->getData() + offset);
+	else
+	{
+		compressedBuffer = new byte[compressedLength];
+
+		const int bytesRead = file.read(offset, compressedBuffer, compressedLength, priority);
+		DEBUG_FATAL(bytesRead != compressedLength, ("error reading compressed data into buffer"));
+		UNREF(bytesRead);
+	}
+
+	if (decompressedCache && length >= ConfigSharedFile::getDecompressedCacheMinimumSize())
+	{
+		byte const * data = decompressedCache->find(index, length);
+		if (!data)
+		{
+			byte * const uncompressedBuffer = new byte[length];
+			static_cast<void>(ZlibCompressor().expand(compressedBuffer, compressedLength, uncompressedBuffer, length));
+			data = decompressedCache->insert(index, uncompressedBuffer, length);
+
+			if (!data)
+			{
+				if (!mappedFile)
+					delete [] compressedBuffer;
+				return new MemoryFile(uncompressedBuffer, length);
+			}
+
+			delete [] uncompressedBuffer;
+		}
+
+		if (!mappedFile)
+			delete [] compressedBuffer;
+		return new MemoryFile(const_cast<byte *>(data), length, false);
+	}
+
+	return new ZlibFile(length, compressedBuffer, compressedLength, !mappedFile);
+}
 // ======================================================================
 
 TreeFile::SearchPath::SearchPath(int priority, const char *path)
@@ -250,6 +500,9 @@ TreeFile::SearchTree::SearchTree(int priority, const char *fileName)
 : SearchNode(priority),
 	m_treeFileName(nullptr),
 	m_treeFile(nullptr),
+	m_mappedTreeFile(nullptr),
+	m_mapAttempted(false),
+	m_decompressedCache(nullptr),
 	m_version(0),
 	m_numberOfFiles(0),
 	m_fileNames(nullptr),
@@ -330,6 +583,8 @@ TreeFile::SearchTree::SearchTree(int priority, const char *fileName)
 					UNREF(bytesRead);
 					DEBUG_FATAL(bytesRead != static_cast<int>(header.uncompSizeOfNameBlock), ("failed to read tree file name block"));
 				}
+
+				m_decompressedCache = DecompressedCache::create(m_treeFileName, m_treeFile->length(), m_tableOfContents, tableOfContentsSize);
 			}
 			break;
 
@@ -414,6 +669,8 @@ TreeFile::SearchTree::~SearchTree(void)
 	delete [] m_treeFileName;
 	delete [] m_tableOfContents;
 	delete [] m_fileNames;
+	delete m_decompressedCache;
+	unmapFile(m_mappedTreeFile);
 	delete m_treeFile;
 }
 
@@ -482,22 +739,73 @@ AbstractFile *TreeFile::SearchTree::open(const char *fileName, AbstractFile::Pri
 
 	int tableOfContentsIndex = -1;
 	if (localExists(fileName, &tableOfContentsIndex, deleted))
-	{
-		const TableOfContentsEntry &entry = m_tableOfContents[tableOfContentsIndex];
+		return openByIndex(tableOfContentsIndex, priority);
 
-		if (!TreeFile::SearchTree::isCompressed(entry.compressor))
-			return new FileStreamerFile(priority, *m_treeFile, entry.offset, entry.length);
+	return nullptr;
+}
 
-		byte * compressedBuffer = new byte[entry.compressedLength];
+// ----------------------------------------------------------------------
 
-		const int bytesRead = m_treeFile->read(entry.offset, compressedBuffer, entry.compressedLength, priority);
-		DEBUG_FATAL(bytesRead != entry.compressedLength, ("error reading compressed data into buffer"));
-		UNREF(bytesRead);
+bool TreeFile::SearchTree::isArchive() const
+{
+	return true;
+}
 
-		return new ZlibFile(entry.length, compressedBuffer, entry.compressedLength, true);
-	}
+// ----------------------------------------------------------------------
 
-	return nullptr;
+int TreeFile::SearchTree::getNumberOfEntries() const
+{
+	return m_numberOfFiles;
+}
+
+// ----------------------------------------------------------------------
+
+uint32 TreeFile::SearchTree::getEntryCrc(int index) const
+{
+	VALIDATE_RANGE_INCLUSIVE_EXCLUSIVE(0, index, m_numberOfFiles);
+	return m_tableOfContents[index].crc;
+}
+
+// ----------------------------------------------------------------------
+
+const char *TreeFile::SearchTree::getEntryFileName(int index) const
+{
+	VALIDATE_RANGE_INCLUSIVE_EXCLUSIVE(0, index, m_numberOfFiles);
+	return m_fileNames + m_tableOfContents[index].fileNameOffset;
+}
+
+// ----------------------------------------------------------------------
+
+bool TreeFile::SearchTree::isEntryDeleted(int index) const
+{
+	VALIDATE_RANGE_INCLUSIVE_EXCLUSIVE(0, index, m_numberOfFiles);
+	return m_tableOfContents[index].length == 0;
+}
+
+// ----------------------------------------------------------------------
+
+bool TreeFile::SearchTree::isEntryValid(int) const
+{
+	return true;
+}
+
+// ----------------------------------------------------------------------
+
+int TreeFile::SearchTree::getFileSizeByIndex(int index) const
+{
+	VALIDATE_RANGE_INCLUSIVE_EXCLUSIVE(0, index, m_numberOfFiles);
+	return m_tableOfContents[index].length;
+}
+
+// ----------------------------------------------------------------------
+
+AbstractFile *TreeFile::SearchTree::openByIndex(int index, AbstractFile::PriorityType priority)
+{
+	VALIDATE_RANGE_INCLUSIVE_EXCLUSIVE(0, index, m_numberOfFiles);
+	const TableOfContentsEntry &entry = m_tableOfContents[index];
+
+	MemoryMappedFile const * const mappedFile = mapTreeFile(m_treeFileName, m_treeFile->length(), m_mappedTreeFile, m_mapAttempted);
+	return openEntry(*m_treeFile, mappedFile, m_decompressedCache, index, isCompressed(entry.compressor), entry.offset, entry.length, entry.compressedLength, priority);
 }
 
 // ======================================================================
@@ -538,6 +846,11 @@ TreeFile::SearchTOC::SearchTOC(int priority, const char *fileName)
 	m_TOCFileName(nullptr),
 	m_TOCFile(nullptr),
 	m_treeFiles(nullptr),
+	m_treeFilePaths(nullptr),
+	m_mappedTreeFiles(nullptr),
+	m_mapAttempted(nullptr),
+	m_decompressedCache(nullptr),
+	m_numberOfTreeFiles(0),
 	m_numberOfFiles(0),
 	m_treeFileNames(nullptr),
 	m_treeFileNamePointers(nullptr),
@@ -574,6 +887,9 @@ TreeFile::SearchTOC::SearchTOC(int priority, const char *fileName)
 				m_fileNames = new char [header.uncompSizeOfNameBlock];
 				m_treeFileNames = new char [header.sizeOfTreeFileNameBlock];
 				m_treeFiles = new FileStreamer::File* [header.numberOfTreeFiles];
+				m_treeFilePaths = new char* [header.numberOfTreeFiles];
+				m_mappedTreeFiles = new MemoryMappedFile* [header.numberOfTreeFiles];
+				m_mapAttempted = new bool [header.numberOfTreeFiles];
 				m_treeFileNamePointers = new char* [header.numberOfTreeFiles];
 
 				{
@@ -599,6 +915,9 @@ TreeFile::SearchTOC::SearchTOC(int priority, const char *fileName)
 					{
 						m_treeFileNamePointers[treeFileNameIndex] = (m_treeFileNames + treeFileNameReadPosition);
 						m_treeFiles[treeFileNameIndex] = nullptr;						
+						m_treeFilePaths[treeFileNameIndex] = nullptr;
+						m_mappedTreeFiles[treeFileNameIndex] = nullptr;
+						m_mapAttempted[treeFileNameIndex] = false;
 
 						// try to open the tree file in each of the relative paths 
 						for (std::vector<const char *>::const_iterator pathIter = treePaths.begin(); pathIter != treePaths.end(); ++pathIter)
@@ -609,6 +928,7 @@ TreeFile::SearchTOC::SearchTOC(int priority, const char *fileName)
 							if (FileStreamer::exists (treePathBuffer))
 							{
 								m_treeFiles[treeFileNameIndex] = FileStreamer::open(treePathBuffer, true);
+								m_treeFilePaths[treeFileNameIndex] = DuplicateString(treePathBuffer);
 								break;
 							}
 						}
@@ -684,6 +1004,7 @@ TreeFile::SearchTOC::SearchTOC(int priority, const char *fileName)
 					DEBUG_FATAL(bytesRead != static_cast<int>(header.sizeOfNameBlock), ("failed to read file name block"));
 				}
 
+				m_decompressedCache = DecompressedCache::create(m_TOCFileName, m_TOCFile->length(), m_tableOfContents, tableOfContentsSize);
 			}
 			break;
 
@@ -713,9 +1034,18 @@ TreeFile::SearchTOC::~SearchTOC(void)
 	delete [] m_fileNames;
 	delete [] m_treeFileNamePointers;
 
+	delete m_decompressedCache;
+
 	// clear out FileStreamer::File pointers
 	for (uint32 i = 0; i < m_numberOfTreeFiles; i++)
+	{
+		unmapFile(m_mappedTreeFiles[i]);
+		delete [] m_treeFilePaths[i];
 		delete m_treeFiles[i];
+	}
+	delete [] m_mappedTreeFiles;
+	delete [] m_mapAttempted;
+	delete [] m_treeFilePaths;
 	delete [] m_treeFiles;
 
 	delete m_TOCFile;
@@ -847,22 +1177,353 @@ AbstractFile *TreeFile::SearchTOC::open(const char *fileName, AbstractFile::Prio
 
 	int tableOfContentsIndex = -1;
 	if (localExists(fileName, &tableOfContentsIndex))
+		return openByIndex(tableOfContentsIndex, priority);
+
+	return nullptr;
+}
+
+// ----------------------------------------------------------------------
+
+bool TreeFile::SearchTOC::isArchive() const
+{
+	return true;
+}
+
+// ----------------------------------------------------------------------
+
+int TreeFile::SearchTOC::getNumberOfEntries() const
+{
+	return static_cast<int>(m_numberOfFiles);
+}
+
+// ----------------------------------------------------------------------
+
+uint32 TreeFile::SearchTOC::getEntryCrc(int index) const
+{
+	VALIDATE_RANGE_INCLUSIVE_EXCLUSIVE(0, index, static_cast<int>(m_numberOfFiles));
+	return m_tableOfContents[index].crc;
+}
+
+// ----------------------------------------------------------------------
+
+const char *TreeFile::SearchTOC::getEntryFileName(int index) const
+{
+	VALIDATE_RANGE_INCLUSIVE_EXCLUSIVE(0, index, static_cast<int>(m_numberOfFiles));
+	return m_fileNames + m_tableOfContents[index].fileNameOffset;
+}
+
+// ----------------------------------------------------------------------
+
+bool TreeFile::SearchTOC::isEntryDeleted(int) const
+{
+	return false;
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Entries with no length, or a length but no offset, are skipped just like
+ * localExists() skips them.
+ */
+
+bool TreeFile::SearchTOC::isEntryValid(int index) const
+{
+	VALIDATE_RANGE_INCLUSIVE_EXCLUSIVE(0, index, static_cast<int>(m_numberOfFiles));
+	return m_tableOfContents[index].length != 0 && m_tableOfContents[index].offset != 0;
+}
+
+// ----------------------------------------------------------------------
+
+int TreeFile::SearchTOC::getFileSizeByIndex(int index) const
+{
+	VALIDATE_RANGE_INCLUSIVE_EXCLUSIVE(0, index, static_cast<int>(m_numberOfFiles));
+	return static_cast<int>(m_tableOfContents[index].length);
+}
+
+// ----------------------------------------------------------------------
+
+AbstractFile *TreeFile::SearchTOC::openByIndex(int index, AbstractFile::PriorityType priority)
+{
+	VALIDATE_RANGE_INCLUSIVE_EXCLUSIVE(0, index, static_cast<int>(m_numberOfFiles));
+	const TableOfContentsEntry &entry = m_tableOfContents[index];
+
+	int const treeFileIndex = static_cast<int>(entry.treeFileIndex);
+	FileStreamer::File &treeFile = *m_treeFiles[treeFileIndex];
+	MemoryMappedFile const * const mappedFile = mapTreeFile(m_treeFilePaths[treeFileIndex], treeFile.length(), m_mappedTreeFiles[treeFileIndex], m_mapAttempted[treeFileIndex]);
+	return openEntry(treeFile, mappedFile, m_decompressedCache, index, isCompressed(entry.compressor), static_cast<int>(entry.offset), static_cast<int>(entry.length), static_cast<int>(entry.compressedLength), priority);
+}
+
+// ======================================================================
+/**
+ * Create the decompressed cache for a tree or TOC file.
+ *
+ * @return nullptr if decompressedCacheDirectory is not set or can not be created.
+ */
+
+TreeFile::DecompressedCache *TreeFile::DecompressedCache::create(const char *fileName, int fileLength, void const *tableOfContents, int tableOfContentsLength)
+{
+	NOT_NULL(fileName);
+
+	char const * const directory = ConfigSharedFile::getDecompressedCacheDirectory();
+	if (!directory || !*directory)
+		return nullptr;
+
+	if (!Os::createDirectories(directory))
 	{
-		const TableOfContentsEntry &entry = m_tableOfContents[tableOfContentsIndex];
+		WARNING(true, ("could not create decompressed cache directory %s", directory));
+		return nullptr;
+	}
 
-		if (!isCompressed(entry.compressor))
-			return new FileStreamerFile(priority, *m_treeFiles[entry.treeFileIndex], entry.offset, entry.length);
+	// key on the file name without its path, since processes may find the same tree through different paths
+	char const * baseName = fileName;
+	for (char const * c = fileName; *c; ++c)
+		if (*c == '/' || *c == '\\')
+			baseName = c + 1;
 
-		byte * compressedBuffer = new byte[entry.compressedLength];
+	char prefix[Os::MAX_PATH_LENGTH];
+	// the modification time and table of contents tell apart rebuilt trees of the same name and size
+	IGNORE_RETURN(snprintf(prefix, sizeof(prefix), "%s/%08lx_%08lx_%08lx_%08lx_", directory, Crc::calculate(baseName), static_cast<uint32>(fileLength), calculateFileStamp(fileName), Crc::calculate(tableOfContents, tableOfContentsLength)));
+	return new DecompressedCache(prefix);
+}
 
-		const uint32 bytesRead = m_treeFiles[entry.treeFileIndex]->read(entry.offset, compressedBuffer, entry.compressedLength, priority);
-		DEBUG_FATAL(bytesRead != entry.compressedLength, ("error reading compressed data into buffer"));
-		UNREF(bytesRead);
+// ----------------------------------------------------------------------
+
+TreeFile::DecompressedCache::DecompressedCache(const char *entryFileNamePrefix)
+:
+	m_entryFileNamePrefix(DuplicateString(entryFileNamePrefix)),
+	m_entries(new EntryMap),
+	m_lock(new Mutex)
+{
+}
+
+// ----------------------------------------------------------------------
+
+TreeFile::DecompressedCache::~DecompressedCache()
+{
+	for (EntryMap::iterator i = m_entries->begin(); i != m_entries->end(); ++i)
+		unmapFile(i->second);
+	delete m_entries;
+	delete m_lock;
+	delete [] m_entryFileNamePrefix;
+}
+
+// ----------------------------------------------------------------------
+
+void TreeFile::DecompressedCache::makeEntryFileName(int index, char *buffer, int bufferLength) const
+{
+	IGNORE_RETURN(snprintf(buffer, static_cast<size_t>(bufferLength), "%s%d", m_entryFileNamePrefix, index));
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Map an entry file, if it exists, is the right length and fits in
+ * maximumMappedSize.  The caller must hold m_lock.
+ */
+
+byte const *TreeFile::DecompressedCache::map(int index, int length, const char *entryFileName)
+{
+	MemoryMappedFile * const mappedFile = mapFile(entryFileName, length);
+	if (!mappedFile)
+		return nullptr;
 
-		return new ZlibFile(entry.length, compressedBuffer, entry.compressedLength, true);
+	(*m_entries)[index] = mappedFile;
+	return mappedFile->getData();
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Find the decompressed data for a table of contents entry, if this or
+ * any other process has already decompressed it.
+ */
+
+byte const *TreeFile::DecompressedCache::find(int index, int length)
+{
+	byte const * result = nullptr;
+
+	m_lock->enter();
+
+		EntryMap::const_iterator const i = m_entries->find(index);
+		if (i != m_entries->end())
+			result = i->second->getData();
+		else
+		{
+			char entryFileName[Os::MAX_PATH_LENGTH];
+			makeEntryFileName(index, entryFileName, sizeof(entryFileName));
+			result = map(index, length, entryFileName);
+		}
+
+	m_lock->leave();
+
+	return result;
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Publish the decompressed data for a table of contents entry.
+ *
+ * The data is written to a file private to this process and thread and
+ * renamed into place, so other processes never map a partially written
+ * entry.
+ *
+ * @return the shared copy of the data, or nullptr if it could not be written.
+ */
+
+byte const *TreeFile::DecompressedCache::insert(int index, byte const *data, int length)
+{
+	char entryFileName[Os::MAX_PATH_LENGTH];
+	makeEntryFileName(index, entryFileName, sizeof(entryFileName));
+
+	char temporaryFileName[Os::MAX_PATH_LENGTH];
+	IGNORE_RETURN(snprintf(temporaryFileName, sizeof(temporaryFileName), "%s.%d.%d", entryFileName, static_cast<int>(Os::getProcessId()), ms_nextTemporaryFileNumber++));
+
+	FILE * const file = fopen(temporaryFileName, "wb");
+	if (!file)
+		return nullptr;
+
+	bool const written = fwrite(data, 1, static_cast<size_t>(length), file) == static_cast<size_t>(length);
+	IGNORE_RETURN(fclose(file));
+
+	// if another process got there first, this replaces its file with an identical one
+	if (!written || rename(temporaryFileName, entryFileName) != 0)
+	{
+		IGNORE_RETURN(::remove(temporaryFileName));
+		return nullptr;
 	}
 
-	return nullptr;
+	m_lock->enter();
+
+		byte const * result = nullptr;
+		EntryMap::const_iterator const i = m_entries->find(index);
+		if (i != m_entries->end())
+			result = i->second->getData();
+		else
+			result = map(index, length, entryFileName);
+
+	m_lock->leave();
+
+	return result;
+}
+
+// ======================================================================
+/**
+ * Index the archives in the search list.
+ *
+ * Archives are visited in priority order and a name is only added the
+ * first time it is seen, so each name resolves to the archive TreeFile
+ * would have found it in by asking every node.  Deleted entries are added
+ * too, so they still hide the same name in lower priority archives.
+ */
+
+TreeFile::ArchiveIndex::ArchiveIndex(SearchNodes const &searchNodes)
+:
+	m_archives(),
+	m_slots(nullptr),
+	m_slotMask(0),
+	m_numberOfEntries(0)
+{
+	int maximumEntries = 0;
+	for (SearchNodes::const_iterator i = searchNodes.begin(); i != searchNodes.end(); ++i)
+		if ((*i)->isArchive())
+		{
+			m_archives.push_back(*i);
+			maximumEntries += (*i)->getNumberOfEntries();
+		}
+
+	// keep the table at most half full so misses end quickly
+	uint32 numberOfSlots = 16;
+	while (numberOfSlots < static_cast<uint32>(maximumEntries) * 2)
+		numberOfSlots *= 2;
+
+	m_slotMask = numberOfSlots - 1;
+	m_slots = new Slot[numberOfSlots];
+	for (uint32 i = 0; i < numberOfSlots; ++i)
+	{
+		m_slots[i].crc = 0;
+		m_slots[i].archive = -1;
+		m_slots[i].index = 0;
+	}
+
+	for (int archive = 0; archive < static_cast<int>(m_archives.size()); ++archive)
+	{
+		SearchNode const * const node = m_archives[static_cast<size_t>(archive)];
+		int const numberOfEntries = node->getNumberOfEntries();
+		for (int index = 0; index < numberOfEntries; ++index)
+		{
+			if (!node->isEntryValid(index))
+				continue;
+
+			uint32 const crc = node->getEntryCrc(index);
+			const char * const fileName = node->getEntryFileName(index);
+
+			uint32 slot = getFirstSlot(crc);
+			bool duplicate = false;
+			for ( ; m_slots[slot].archive >= 0; slot = (slot + 1) & m_slotMask)
+				if (m_slots[slot].crc == crc && _stricmp(m_archives[static_cast<size_t>(m_slots[slot].archive)]->getEntryFileName(m_slots[slot].index), fileName) == 0)
+				{
+					duplicate = true;
+					break;
+				}
+
+			if (!duplicate)
+			{
+				m_slots[slot].crc = crc;
+				m_slots[slot].archive = archive;
+				m_slots[slot].index = index;
+				++m_numberOfEntries;
+			}
+		}
+	}
+}
+
+// ----------------------------------------------------------------------
+
+TreeFile::ArchiveIndex::~ArchiveIndex()
+{
+	delete [] m_slots;
+}
+
+// ----------------------------------------------------------------------
+
+uint32 TreeFile::ArchiveIndex::getFirstSlot(uint32 const crc) const
+{
+	// the low bits of similar names' crcs are well mixed already
+	return crc & m_slotMask;
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Find the archive a file name resolves to.
+ *
+ * @param index  Set to the table of contents index of the file in node, or -1 if node deletes the file.
+ * @return false if no archive holds the file.
+ */
+
+bool TreeFile::ArchiveIndex::find(const char *fileName, uint32 const crc, SearchNode *&node, int &index) const
+{
+	for (uint32 slot = getFirstSlot(crc); m_slots[slot].archive >= 0; slot = (slot + 1) & m_slotMask)
+	{
+		Slot const &s = m_slots[slot];
+		if (s.crc != crc)
+			continue;
+
+		SearchNode * const archive = m_archives[static_cast<size_t>(s.archive)];
+		if (_stricmp(archive->getEntryFileName(s.index), fileName) == 0)
+		{
+			node = archive;
+			index = archive->isEntryDeleted(s.index) ? -1 : s.index;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// ----------------------------------------------------------------------
+
+void TreeFile::ArchiveIndex::getFileNames(std::vector<const char *> &fileNames) const
+{
+	for (uint32 slot = 0; slot <= m_slotMask; ++slot)
+		if (m_slots[slot].archive >= 0)
+			fileNames.push_back(m_archives[static_cast<size_t>(m_slots[slot].archive)]->getEntryFileName(m_slots[slot].index));
 }
 
 // ======================================================================
@@ -14,6 +14,7 @@
 
 class CrcString;
 class MemoryBlockManager;
+class MemoryMappedFile;
 
 #include "sharedFile/TreeFile.h"
 #include "sharedFile/FileStreamer.h"
@@ -42,6 +43,21 @@ public:
 	virtual void          getPathName(const char *fileName, char *pathName, int pathNameLength) const = 0;
 	virtual AbstractFile *open(const char *fileName, AbstractFile::PriorityType priority, bool &deleted) = 0;
 
+	// archives (SearchTree, SearchTOC) expose their table of contents so TreeFile can index them all at once
+	virtual bool          isArchive() const;
+	virtual int           getNumberOfEntries() const;
+	virtual uint32        getEntryCrc(int index) const;
+	virtual const char   *getEntryFileName(int index) const;
+	virtual bool          isEntryDeleted(int index) const;
+	virtual bool          isEntryValid(int index) const;
+	virtual int           getFileSizeByIndex(int index) const;
+	virtual AbstractFile *openByIndex(int index, AbstractFile::PriorityType priority);
+
+protected:
+
+	// shared by SearchTree and SearchTOC
+	static AbstractFile  *openEntry(FileStreamer::File &file, MemoryMappedFile const *mappedFile, DecompressedCache *decompressedCache, int index, bool compressed, int offset, int length, int compressedLength, AbstractFile::PriorityType priority);
+
 private:
 
 	SearchNode();
@@ -146,6 +162,15 @@ public:
 	virtual void          getPathName(const char *fileName, char *pathName, int pathNameLength) const;
 	virtual AbstractFile *open(const char *fileName, AbstractFile::PriorityType priority, bool &deleted);
 
+	virtual bool          isArchive() const;
+	virtual int           getNumberOfEntries() const;
+	virtual uint32        getEntryCrc(int index) const;
+	virtual const char   *getEntryFileName(int index) const;
+	virtual bool          isEntryDeleted(int index) const;
+	virtual bool          isEntryValid(int index) const;
+	virtual int           getFileSizeByIndex(int index) const;
+	virtual AbstractFile *openByIndex(int index, AbstractFile::PriorityType priority);
+
 private:
 
 	// disabled
@@ -200,6 +225,9 @@ private:
 
 	char                   *m_treeFileName;
 	FileStreamer::File     *m_treeFile;
+	MemoryMappedFile       *m_mappedTreeFile;
+	bool                    m_mapAttempted;
+	DecompressedCache      *m_decompressedCache;
 	uint32                  m_version;
 	int                     m_numberOfFiles;
 	char                   *m_fileNames;
@@ -234,6 +262,15 @@ public:
 	virtual void          getPathName(const char *fileName, char *pathName, int pathNameLength) const;
 	virtual AbstractFile *open(const char *fileName, AbstractFile::PriorityType priority, bool &deleted);
 
+	virtual bool          isArchive() const;
+	virtual int           getNumberOfEntries() const;
+	virtual uint32        getEntryCrc(int index) const;
+	virtual const char   *getEntryFileName(int index) const;
+	virtual bool          isEntryDeleted(int index) const;
+	virtual bool          isEntryValid(int index) const;
+	virtual int           getFileSizeByIndex(int index) const;
+	virtual AbstractFile *openByIndex(int index, AbstractFile::PriorityType priority);
+
 private:
 
 	// disabled
@@ -295,6 +332,10 @@ private:
 	char                   *m_TOCFileName;
 	FileStreamer::File     *m_TOCFile;
 	FileStreamer::File     **m_treeFiles;
+	char                   **m_treeFilePaths;
+	MemoryMappedFile       **m_mappedTreeFiles;
+	bool                   *m_mapAttempted;
+	DecompressedCache      *m_decompressedCache;
 	uint32                 m_numberOfTreeFiles;
 	uint32                 m_numberOfFiles;
 	char                   *m_treeFileNames;
@@ -313,6 +354,107 @@ inline bool TreeFile::SearchTOC::isCompressed(int compressorIndex)
 
 // ======================================================================
 
+/**
+ * Decompressed entries of one tree or TOC file, shared by every process on
+ * the host configured with the same decompressedCacheDirectory.
+ *
+ * The first process to open an entry inflates it into a file of its own in
+ * that directory, and every process then maps the file, so the host keeps
+ * one copy of it in memory.  The files are named after the tree file's name,
+ * size and modification time, a crc of its table of contents, and the
+ * entry's table of contents index, so a replaced tree file never picks up
+ * entries decompressed from the old one.  Stale entry files are left behind
+ * and can be removed whenever no server is running.
+ *
+ * Mapped entries count against maximumMappedSize.  Once it is reached,
+ * entries are inflated privately instead.
+ */
+class TreeFile::DecompressedCache
+{
+public:
+
+	static DecompressedCache *create(const char *fileName, int fileLength, void const *tableOfContents, int tableOfContentsLength);
+
+public:
+
+	explicit DecompressedCache(const char *entryFileNamePrefix);
+	~DecompressedCache();
+
+	byte const *find(int index, int length);
+	byte const *insert(int index, byte const *data, int length);
+
+private:
+
+	DecompressedCache();
+	DecompressedCache(const DecompressedCache &);
+	DecompressedCache &operator =(const DecompressedCache &);
+
+	byte const *map(int index, int length, const char *entryFileName);
+	void        makeEntryFileName(int index, char *buffer, int bufferLength) const;
+
+private:
+
+	typedef std::map<int, MemoryMappedFile *> EntryMap;
+
+	char           *m_entryFileNamePrefix;
+	EntryMap *const m_entries;
+	Mutex    *const m_lock;
+};
+
+// ======================================================================
+
+/**
+ * One hash table over the table of contents of every archive in the search
+ * list, built once the search list stops changing.
+ *
+ * Each file name is resolved to the highest priority archive holding (or
+ * deleting) it, so looking a name up costs one hash probe instead of a
+ * binary search of every archive.  Non-archive search nodes are not
+ * indexed; TreeFile still asks them in priority order.
+ */
+class TreeFile::ArchiveIndex
+{
+public:
+
+	explicit ArchiveIndex(SearchNodes const &searchNodes);
+	~ArchiveIndex();
+
+	bool find(const char *fileName, uint32 crc, SearchNode *&node, int &index) const;
+	int  getNumberOfEntries() const;
+	void getFileNames(std::vector<const char *> &fileNames) const;
+
+private:
+
+	ArchiveIndex();
+	ArchiveIndex(const ArchiveIndex &);
+	ArchiveIndex &operator =(const ArchiveIndex &);
+
+	uint32 getFirstSlot(uint32 crc) const;
+
+private:
+
+	struct Slot
+	{
+		uint32 crc;
+		int    archive;  // -1 for an empty slot
+		int    index;
+	};
+
+	std::vector<SearchNode *>  m_archives;
+	Slot                      *m_slots;
+	uint32                     m_slotMask;
+	int                        m_numberOfEntries;
+};
+
+// ----------------------------------------------------------------------
+
+inline int TreeFile::ArchiveIndex::getNumberOfEntries() const
+{
+	return m_numberOfEntries;
+}
+
+// ======================================================================
+
 class TreeFile::SearchCache : public TreeFile::SearchNode
 {
 public:
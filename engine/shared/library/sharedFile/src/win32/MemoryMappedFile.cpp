@@ -0,0 +1,60 @@
+// ======================================================================
+//
+// MemoryMappedFile.cpp
+// Copyright 2002, Sony Online Entertainment Inc.
+// All Rights Reserved.
+//
+// ======================================================================
+
+#include "sharedFile/FirstSharedFile.h"
+#include "sharedFile/MemoryMappedFile.h"
+
+// ======================================================================
+
+MemoryMappedFile *MemoryMappedFile::open(const char *fileName)
+{
+	NOT_NULL(fileName);
+
+	HANDLE const handle = CreateFile(fileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (handle == INVALID_HANDLE_VALUE)
+		return nullptr;
+
+	DWORD const length = GetFileSize(handle, nullptr);
+	void *data = nullptr;
+	if (length != INVALID_FILE_SIZE && length != 0)
+	{
+		HANDLE const mapping = CreateFileMapping(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping)
+		{
+			data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+			// the view stays valid after the handles are closed
+			IGNORE_RETURN(CloseHandle(mapping));
+		}
+	}
+
+	IGNORE_RETURN(CloseHandle(handle));
+
+	if (!data)
+		return nullptr;
+
+	return new MemoryMappedFile(static_cast<byte const *>(data), static_cast<int>(length));
+}
+
+// ======================================================================
+
+MemoryMappedFile::MemoryMappedFile(byte const *data, int length)
+:
+	m_data(data),
+	m_length(length)
+{
+}
+
+// ----------------------------------------------------------------------
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+	IGNORE_RETURN(UnmapViewOfFile(m_data));
+}
+
+// ======================================================================
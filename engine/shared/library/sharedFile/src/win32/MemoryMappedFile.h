@@ -0,0 +1,62 @@
+// ======================================================================
+//
+// MemoryMappedFile.h
+// Copyright 2002, Sony Online Entertainment Inc.
+// All Rights Reserved.
+//
+// ======================================================================
+
+#ifndef INCLUDED_MemoryMappedFile_H
+#define INCLUDED_MemoryMappedFile_H
+
+// ======================================================================
+
+/**
+ * A read-only view of an entire file.
+ *
+ * Pages are shared with every other process mapping the same file.
+ */
+class MemoryMappedFile
+{
+public:
+
+	static MemoryMappedFile *open(const char *fileName);
+
+public:
+
+	~MemoryMappedFile();
+
+	byte const *getData() const;
+	int         length() const;
+
+private:
+
+	MemoryMappedFile(byte const *data, int length);
+
+	MemoryMappedFile();
+	MemoryMappedFile(const MemoryMappedFile &);
+	MemoryMappedFile &operator =(const MemoryMappedFile &);
+
+private:
+
+	byte const * const m_data;
+	int const          m_length;
+};
+
+// ======================================================================
+
+inline byte const *MemoryMappedFile::getData() const
+{
+	return m_data;
+}
+
+// ----------------------------------------------------------------------
+
+inline int MemoryMappedFile::length() const
+{
+	return m_length;
+}
+
+// ======================================================================
+
+#endif
@@ -65,5 +65,48 @@ constexpr const uint32 constcrc(const char *string)
 	return (crc ^ CRC_INIT);
 }
 
+// ----------------------------------------------------------------------
+// The crc of a file name as TemporaryCrcString(name, true) computes it, i.e.
+// after CrcString::normalize(), for literal names that may not already be
+// normalized.
+
+constexpr const uint32 constcrcNormalized(const char *string)
+{
+	if (!string)
+		return 0;
+
+	uint32 crc = CRC_INIT;
+	bool previousIsSlash = true;
+
+	for ( ; *string; ++string)
+	{
+		char c = *string;
+
+		if (c == '\\' || c == '/')
+		{
+			if (previousIsSlash)
+				continue;
+
+			c = '/';
+			previousIsSlash = true;
+		}
+		else if (c == '.')
+		{
+			if (previousIsSlash)
+				continue;
+		}
+		else
+		{
+			if (c >= 'A' && c <= 'Z')
+				c = static_cast<char>(c - 'A' + 'a');
+			previousIsSlash = false;
+		}
+
+		crc = crctable[((crc>>24) ^ static_cast<byte>(c)) & 0xFF] ^ (crc << 8);
+	}
+
+	return (crc ^ CRC_INIT);
+}
+
 // ======================================================================
 
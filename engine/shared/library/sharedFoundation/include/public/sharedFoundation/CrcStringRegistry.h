@@ -0,0 +1 @@
+#include "../../src/shared/CrcStringRegistry.h"
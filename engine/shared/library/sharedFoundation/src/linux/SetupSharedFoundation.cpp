@@ -17,6 +17,7 @@
 #include "sharedFoundation/ConfigFile.h"
 #include "sharedFoundation/ConfigSharedFoundation.h"
 #include "sharedFoundation/CrcLowerString.h"
+#include "sharedFoundation/CrcStringRegistry.h"
 #include "sharedFoundation/ExitChain.h"
 #include "sharedFoundation/Os.h"
 #include "sharedFoundation/PerThreadData.h"
@@ -69,6 +70,7 @@ void SetupSharedFoundation::install(const Data &data)
 
 	PersistentCrcString::install();
 	CrcLowerString::install();
+	CrcStringRegistry::install();
 	StaticCallbackEntry::install();
 }
 
@@ -0,0 +1,192 @@
+// ======================================================================
+//
+// CrcStringRegistry.cpp
+// Copyright 2002, Sony Online Entertainment Inc.
+// All Rights Reserved.
+//
+// ======================================================================
+
+#include "sharedFoundation/FirstSharedFoundation.h"
+#include "sharedFoundation/CrcStringRegistry.h"
+
+#include "sharedFoundation/ExitChain.h"
+#include "sharedFoundation/PersistentCrcString.h"
+#include "sharedFoundation/TemporaryCrcString.h"
+#include "sharedSynchronization/Mutex.h"
+
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+// ======================================================================
+
+namespace CrcStringRegistryNamespace
+{
+	typedef std::vector<PersistentCrcString *>  Strings;
+	typedef std::vector<int>                    NextIds;
+	typedef std::unordered_map<uint32, int>     FirstIdMap;
+
+	int findLocked(CrcString const & string);
+
+	bool       ms_installed;
+	Mutex      ms_criticalSection;
+
+	// strings sharing a crc are chained through ms_nextIds from the first one interned
+	Strings    ms_strings;
+	NextIds    ms_nextIds;
+	FirstIdMap ms_firstIds;
+}
+
+using namespace CrcStringRegistryNamespace;
+
+int const CrcStringRegistry::cms_invalidId = -1;
+
+// ======================================================================
+
+int CrcStringRegistryNamespace::findLocked(CrcString const & string)
+{
+	FirstIdMap::const_iterator const i = ms_firstIds.find(string.getCrc());
+	if (i == ms_firstIds.end())
+		return CrcStringRegistry::cms_invalidId;
+
+	for (int id = i->second; id != CrcStringRegistry::cms_invalidId; id = ms_nextIds[static_cast<size_t>(id)])
+		if (strcmp(ms_strings[static_cast<size_t>(id)]->getString(), string.getString()) == 0)
+			return id;
+
+	return CrcStringRegistry::cms_invalidId;
+}
+
+// ======================================================================
+
+void CrcStringRegistry::install()
+{
+	DEBUG_FATAL(ms_installed, ("CrcStringRegistry already installed"));
+	ms_installed = true;
+	ExitChain::add(CrcStringRegistry::remove, "CrcStringRegistry::remove");
+}
+
+// ----------------------------------------------------------------------
+
+void CrcStringRegistry::remove()
+{
+	DEBUG_FATAL(!ms_installed, ("CrcStringRegistry not installed"));
+
+	ms_criticalSection.enter();
+
+	for (Strings::iterator i = ms_strings.begin(); i != ms_strings.end(); ++i)
+		delete *i;
+	ms_strings.clear();
+	ms_nextIds.clear();
+	ms_firstIds.clear();
+
+	ms_criticalSection.leave();
+
+	ms_installed = false;
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Add a string to the registry.
+ *
+ * @param string  A normalized string, as used to key data resources
+ * @return The id of the string, or cms_invalidId for the empty string
+ */
+
+int CrcStringRegistry::intern(CrcString const & string)
+{
+	DEBUG_FATAL(!ms_installed, ("CrcStringRegistry not installed"));
+
+	if (string.isEmpty())
+		return cms_invalidId;
+
+	ms_criticalSection.enter();
+
+	int id = findLocked(string);
+	if (id == cms_invalidId)
+	{
+		id = static_cast<int>(ms_strings.size());
+		ms_strings.push_back(new PersistentCrcString(string));
+		ms_nextIds.push_back(cms_invalidId);
+
+		std::pair<FirstIdMap::iterator, bool> const result = ms_firstIds.insert(FirstIdMap::value_type(string.getCrc(), id));
+		if (!result.second)
+		{
+			int last = result.first->second;
+			while (ms_nextIds[static_cast<size_t>(last)] != cms_invalidId)
+				last = ms_nextIds[static_cast<size_t>(last)];
+			ms_nextIds[static_cast<size_t>(last)] = id;
+		}
+	}
+
+	ms_criticalSection.leave();
+
+	return id;
+}
+
+// ----------------------------------------------------------------------
+
+int CrcStringRegistry::intern(char const * string)
+{
+	return intern(TemporaryCrcString(string, true));
+}
+
+// ----------------------------------------------------------------------
+
+int CrcStringRegistry::find(CrcString const & string)
+{
+	ms_criticalSection.enter();
+	int const id = findLocked(string);
+	ms_criticalSection.leave();
+
+	return id;
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Find a string by crc alone.
+ *
+ * @return The id of the first string interned with the crc, or
+ * cms_invalidId if there is none
+ */
+
+int CrcStringRegistry::find(uint32 crc)
+{
+	ms_criticalSection.enter();
+	FirstIdMap::const_iterator const i = ms_firstIds.find(crc);
+	int const id = (i != ms_firstIds.end()) ? i->second : cms_invalidId;
+	ms_criticalSection.leave();
+
+	return id;
+}
+
+// ----------------------------------------------------------------------
+
+CrcString const & CrcStringRegistry::getString(int id)
+{
+	ms_criticalSection.enter();
+	VALIDATE_RANGE_INCLUSIVE_EXCLUSIVE(0, id, static_cast<int>(ms_strings.size()));
+	CrcString const * const result = ms_strings[static_cast<size_t>(id)];
+	ms_criticalSection.leave();
+
+	return *result;
+}
+
+// ----------------------------------------------------------------------
+
+uint32 CrcStringRegistry::getCrc(int id)
+{
+	return getString(id).getCrc();
+}
+
+// ----------------------------------------------------------------------
+
+int CrcStringRegistry::getNumberOfStrings()
+{
+	ms_criticalSection.enter();
+	int const result = static_cast<int>(ms_strings.size());
+	ms_criticalSection.leave();
+
+	return result;
+}
+
+// ======================================================================
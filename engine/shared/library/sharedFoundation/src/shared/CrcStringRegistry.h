@@ -0,0 +1,63 @@
+// ======================================================================
+//
+// CrcStringRegistry.h
+// Copyright 2002, Sony Online Entertainment Inc.
+// All Rights Reserved.
+//
+// ======================================================================
+
+#ifndef INCLUDED_CrcStringRegistry_H
+#define INCLUDED_CrcStringRegistry_H
+
+// ======================================================================
+
+class CrcString;
+
+// ======================================================================
+
+/**
+ * A process-wide set of interned, normalized CrcStrings.
+ *
+ * Each string interned gets a small integer id that stays the same for the
+ * life of the process, so systems that repeatedly look up the same names
+ * (object templates, for instance) can keep per-id tables and compare ids
+ * instead of hashing and comparing strings.  Interned strings are never
+ * freed before the registry is removed.
+ *
+ * The registry may be used from any thread.
+ */
+
+class CrcStringRegistry
+{
+public:
+
+	static int const cms_invalidId;
+
+public:
+
+	static void install();
+
+	static int  intern(CrcString const & string);
+	static int  intern(char const * string);
+
+	static int  find(CrcString const & string);
+	static int  find(uint32 crc);
+
+	static CrcString const & getString(int id);
+	static uint32            getCrc(int id);
+	static int               getNumberOfStrings();
+
+private:
+
+	static void remove();
+
+private:
+
+	CrcStringRegistry();
+	CrcStringRegistry(CrcStringRegistry const &);
+	CrcStringRegistry & operator =(CrcStringRegistry const &);
+};
+
+// ======================================================================
+
+#endif
@@ -24,6 +24,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 //========================================================================
 
@@ -59,6 +60,7 @@ public:
 	static void release(const T & dataResource);
 
 	static void logLoadedResources(char const * classType);
+	static void getLoadedResourceNames(std::vector<std::string> & names);
 
 	static void garbageCollect ();
 
@@ -412,6 +414,20 @@ void DataResourceList<T>::logLoadedResources(char const * classType)
 
 //----------------------------------------------------------------------
 
+template<typename T>
+void DataResourceList<T>::getLoadedResourceNames(std::vector<std::string> & names)
+{
+	NOT_NULL(ms_loaded);
+
+	names.reserve(names.size() + ms_loaded->size());
+
+	typename LoadedDataResourceMap::const_iterator const iterEnd = ms_loaded->end();
+	for (typename LoadedDataResourceMap::const_iterator iter = ms_loaded->begin(); iter != iterEnd; ++iter)
+		names.push_back(iter->second->getName());
+}
+
+//----------------------------------------------------------------------
+
 template<typename T>
 void DataResourceList<T>::garbageCollect ()
 {
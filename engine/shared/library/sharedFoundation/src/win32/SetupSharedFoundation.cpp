@@ -20,6 +20,7 @@
 #include "sharedFoundation/ConfigSharedFoundation.h"
 #include "sharedFoundation/CrashReportInformation.h"
 #include "sharedFoundation/CrcLowerString.h"
+#include "sharedFoundation/CrcStringRegistry.h"
 #include "sharedFoundation/ExitChain.h"
 #include "sharedFoundation/Os.h"
 #include "sharedFoundation/Production.h"
@@ -246,6 +247,7 @@ void SetupSharedFoundation::install(const Data &data)
 
 	PersistentCrcString::install();
 	CrcLowerString::install();
+	CrcStringRegistry::install();
 
 	WatchedByList::install();
 
@@ -10,7 +10,18 @@
 #include "sharedFractal/FirstSharedFractal.h"
 #include "sharedFractal/MultiFractal.h"
 
+#include "sharedDebug/PerformanceTimer.h"
+
+#include <algorithm>
 #include <cmath>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MULTIFRACTAL_USE_SSE2 1
+#include <emmintrin.h>
+#else
+#define MULTIFRACTAL_USE_SSE2 0
+#endif
 
 //-------------------------------------------------------------------
 
@@ -160,6 +171,119 @@ float MultiFractal::NoiseGenerator::getValue (float x, float y) const
 	return result;
 }
 
+//-------------------------------------------------------------------
+
+#if MULTIFRACTAL_USE_SSE2
+
+/**
+ * Noise for four points, the operations matching getValue one for one.
+ * Every point of a row goes through here, so a point's value never depends on
+ * where in the row it falls.
+ */
+void MultiFractal::NoiseGenerator::getValues4 (const float* const x, const float* const y, float* const results) const
+{
+	const __m128  n     = _mm_set1_ps (static_cast<float> (N));
+	const __m128  zero  = _mm_setzero_ps ();
+	const __m128  one   = _mm_set1_ps (1.f);
+	const __m128  two   = _mm_set1_ps (2.f);
+	const __m128  three = _mm_set1_ps (3.f);
+	const __m128i mask  = _mm_set1_epi32 (BM);
+	const __m128i inc   = _mm_set1_epi32 (1);
+
+	//-- PERLIN_setup for x and y
+	const __m128  tx   = _mm_add_ps (_mm_loadu_ps (x), n);
+	const __m128  ty   = _mm_add_ps (_mm_loadu_ps (y), n);
+	const __m128i itx  = _mm_cvttps_epi32 (tx);
+	const __m128i ity  = _mm_cvttps_epi32 (ty);
+	const __m128i ftx  = _mm_add_epi32 (itx, _mm_castps_si128 (_mm_and_ps (_mm_cmplt_ps (tx, zero), _mm_cmpneq_ps (tx, _mm_cvtepi32_ps (itx)))));
+	const __m128i fty  = _mm_add_epi32 (ity, _mm_castps_si128 (_mm_and_ps (_mm_cmplt_ps (ty, zero), _mm_cmpneq_ps (ty, _mm_cvtepi32_ps (ity)))));
+	const __m128i bx0  = _mm_and_si128 (ftx, mask);
+	const __m128i by0  = _mm_and_si128 (fty, mask);
+	const __m128i bx1  = _mm_and_si128 (_mm_add_epi32 (bx0, inc), mask);
+	const __m128i by1  = _mm_and_si128 (_mm_add_epi32 (by0, inc), mask);
+	const __m128  rx0  = _mm_sub_ps (tx, _mm_cvtepi32_ps (ftx));
+	const __m128  ry0  = _mm_sub_ps (ty, _mm_cvtepi32_ps (fty));
+	const __m128  rx1  = _mm_sub_ps (rx0, one);
+	const __m128  ry1  = _mm_sub_ps (ry0, one);
+
+	//-- PERLIN_scurve
+	const __m128  sx   = _mm_mul_ps (_mm_mul_ps (_mm_sub_ps (three, _mm_mul_ps (two, rx0)), rx0), rx0);
+	const __m128  sy   = _mm_mul_ps (_mm_mul_ps (_mm_sub_ps (three, _mm_mul_ps (two, ry0)), ry0), ry0);
+
+	//-- the permutation and gradient lookups have no vector form in SSE2
+	int bx0s [4], bx1s [4], by0s [4], by1s [4];
+	_mm_storeu_si128 (reinterpret_cast<__m128i*> (bx0s), bx0);
+	_mm_storeu_si128 (reinterpret_cast<__m128i*> (bx1s), bx1);
+	_mm_storeu_si128 (reinterpret_cast<__m128i*> (by0s), by0);
+	_mm_storeu_si128 (reinterpret_cast<__m128i*> (by1s), by1);
+
+	float q00x [4], q00y [4], q10x [4], q10y [4], q01x [4], q01y [4], q11x [4], q11y [4];
+	for (int lane = 0; lane < 4; ++lane)
+	{
+		const float* const q00 = m_g2 [m_p [m_p [bx0s [lane]] + by0s [lane]]];
+		const float* const q10 = m_g2 [m_p [m_p [bx1s [lane]] + by0s [lane]]];
+		const float* const q01 = m_g2 [m_p [m_p [bx0s [lane]] + by1s [lane]]];
+		const float* const q11 = m_g2 [m_p [m_p [bx1s [lane]] + by1s [lane]]];
+
+		q00x [lane] = q00 [0];
+		q00y [lane] = q00 [1];
+		q10x [lane] = q10 [0];
+		q10y [lane] = q10 [1];
+		q01x [lane] = q01 [0];
+		q01y [lane] = q01 [1];
+		q11x [lane] = q11 [0];
+		q11y [lane] = q11 [1];
+	}
+
+	//-- PERLIN_dot2 and PERLIN_lerp
+	__m128 u = _mm_add_ps (_mm_mul_ps (rx0, _mm_loadu_ps (q00x)), _mm_mul_ps (ry0, _mm_loadu_ps (q00y)));
+	__m128 v = _mm_add_ps (_mm_mul_ps (rx1, _mm_loadu_ps (q10x)), _mm_mul_ps (ry0, _mm_loadu_ps (q10y)));
+	const __m128 a = _mm_add_ps (u, _mm_mul_ps (sx, _mm_sub_ps (v, u)));
+
+	u = _mm_add_ps (_mm_mul_ps (rx0, _mm_loadu_ps (q01x)), _mm_mul_ps (ry1, _mm_loadu_ps (q01y)));
+	v = _mm_add_ps (_mm_mul_ps (rx1, _mm_loadu_ps (q11x)), _mm_mul_ps (ry1, _mm_loadu_ps (q11y)));
+	const __m128 b = _mm_add_ps (u, _mm_mul_ps (sx, _mm_sub_ps (v, u)));
+
+	_mm_storeu_ps (results, _mm_add_ps (a, _mm_mul_ps (sy, _mm_sub_ps (b, a))));
+}
+
+#endif
+
+//-------------------------------------------------------------------
+
+void MultiFractal::NoiseGenerator::getValues (const float* const x, const float* const y, const int count, float* const results) const
+{
+#if MULTIFRACTAL_USE_SSE2
+	int i = 0;
+	for (; i + 4 <= count; i += 4)
+		getValues4 (x + i, y + i, results + i);
+
+	//-- pad the last few points out to four lanes rather than finishing them with scalar code
+	if (i < count)
+	{
+		float paddedX [4];
+		float paddedY [4];
+		float paddedResults [4];
+
+		int lane;
+		for (lane = 0; lane < 4; ++lane)
+		{
+			const int index = std::min (i + lane, count - 1);
+			paddedX [lane] = x [index];
+			paddedY [lane] = y [index];
+		}
+
+		getValues4 (paddedX, paddedY, paddedResults);
+
+		for (lane = 0; i < count; ++i, ++lane)
+			results [i] = paddedResults [lane];
+	}
+#else
+	for (int i = 0; i < count; ++i)
+		results [i] = getValue (x [i], y [i]);
+#endif
+}
+
 //-------------------------------------------------------------------
 //
 // MultiFractal
@@ -1043,6 +1167,227 @@ float MultiFractal::getValueCache (float x, float y, int cx, int cy) const
 	return result;
 }
 
+//-------------------------------------------------------------------
+/**
+ * Row form of getValueCache: results [i] = getValueCache (x [i], y, cx [i], cy).
+ *
+ * Cache misses are collected and their noise evaluated together, a block of
+ * points per octave, so the noise generator can work on several points at once.
+ * The results are identical to calling getValueCache for each point.
+ */
+void MultiFractal::getValueCacheRow (const int count, const float* const x, const int* const cx, const float y, const int cy, float* const results) const
+{
+	NOT_NULL (m_cache);
+	DEBUG_FATAL (m_numberOfOctaves == 0, ("m_numberOfOctaves == 0"));
+	VALIDATE_RANGE_INCLUSIVE_EXCLUSIVE (0, cy, m_cacheY);
+
+	const int blockSize = 64;
+
+	int   missIndex [blockSize];
+	float scaledX [blockSize];
+	float noiseX [blockSize];
+	float noiseY [blockSize];
+	float noise [blockSize];
+	float sum [blockSize];
+
+	const float scaledY = y * m_scaleY;
+	CachedNode* const cacheRow = m_cache + m_cacheX * cy;
+
+	int i = 0;
+	while (i < count)
+	{
+		//-- gather a block of cache misses, answering hits as we go
+		int numberOfMisses = 0;
+		for (; i < count && numberOfMisses < blockSize; ++i)
+		{
+#ifdef _DEBUG
+			++ms_numberOfMultiFractalGetValueCalls;
+#endif
+
+			VALIDATE_RANGE_INCLUSIVE_EXCLUSIVE (0, cx [i], m_cacheX);
+
+			CachedNode& cachedNode = cacheRow [cx [i]];
+			if (cachedNode.cached && FloatsEqual (cachedNode.x, x [i]) && FloatsEqual (cachedNode.y, y))
+			{
+#ifdef _DEBUG
+				++ms_numberOfMultiFractalGetValueCacheHits;
+#endif
+
+				results [i] = cachedNode.value;
+				continue;
+			}
+
+			cachedNode.cached = true;
+			cachedNode.x      = x [i];
+			cachedNode.y      = y;
+
+			missIndex [numberOfMisses] = i;
+			scaledX [numberOfMisses]   = x [i] * m_scaleX;
+			sum [numberOfMisses]       = 0.0f;
+			++numberOfMisses;
+		}
+
+		if (numberOfMisses == 0)
+			continue;
+
+		//-- accumulate the octaves
+		float frequency = 1.0f;
+		float amplitude = 1.0f;
+
+		int octave;
+		for (octave = 0; octave < m_numberOfOctaves; ++octave, frequency *= m_frequency, amplitude *= m_amplitude)
+		{
+			int j;
+			for (j = 0; j < numberOfMisses; ++j)
+			{
+				noiseX [j] = scaledX [j] * frequency + m_offsetX * frequency;
+				noiseY [j] = scaledY * frequency + m_offsetY * frequency;
+			}
+
+			m_noiseGenerator.getValues (noiseX, noiseY, numberOfMisses, noise);
+
+			switch (m_combinationRule)
+			{
+			case CR_add:
+			case CR_multiply:
+				for (j = 0; j < numberOfMisses; ++j)
+					sum [j] += amplitude * noise [j];
+				break;
+
+			case CR_crest:
+				for (j = 0; j < numberOfMisses; ++j)
+					sum [j] += amplitude * static_cast<float> (1.0f - fabsf (noise [j]));
+				break;
+
+			case CR_turbulence:
+				for (j = 0; j < numberOfMisses; ++j)
+					sum [j] += amplitude * static_cast<float> (fabsf (noise [j]));
+				break;
+
+			case CR_crestClamp:
+				for (j = 0; j < numberOfMisses; ++j)
+					sum [j] += amplitude * static_cast<float> (1.0f - clamp (0.f, noise [j], 1.f));
+				break;
+
+			case CR_turbulenceClamp:
+				for (j = 0; j < numberOfMisses; ++j)
+					sum [j] += amplitude * static_cast<float> (clamp (0.f, noise [j], 1.f));
+				break;
+
+			case CR_COUNT:
+			default:
+				DEBUG_FATAL (true, ("invalid combination rule"));
+				break;
+			}
+		}
+
+		//-- finish each point the same way getValueCache does
+		int j;
+		for (j = 0; j < numberOfMisses; ++j)
+		{
+			float value = sum [j];
+
+			if (m_useSin)
+				value = sinf (scaledX [j] + value);
+
+			float result;
+			if (m_combinationRule == CR_add || m_combinationRule == CR_multiply)
+				result = ((value * m_ooTotalAmplitude) + 1.0f) * 0.5f;
+			else
+				result = value * m_ooTotalAmplitude;
+
+			if (m_useBias)
+				result = NG_bias (result, m_bias);
+
+			if (m_useGain)
+				result = NG_gain (result, m_gain);
+
+			const int index = missIndex [j];
+			cacheRow [cx [index]].value = result;
+			results [index] = result;
+		}
+	}
+}
+
+//-------------------------------------------------------------------
+/**
+ * Checks getValueCacheRow against getValueCache for every combination rule,
+ * over rows whose length is not a multiple of four, and times both.
+ *
+ * With SSE math the two agree exactly; a non-zero error means the scalar
+ * float math was built without the sharedFractal compile options.
+ *
+ * @param numberOfPoints  the number of points evaluated by each path, over all rules
+ * @param rowTime         the time spent in getValueCacheRow
+ * @param pointTime       the time spent in getValueCache
+ *
+ * @return the largest difference between a row value and its single point value
+ */
+float MultiFractal::verifyRowEvaluation (int& numberOfPoints, float& rowTime, float& pointTime)
+{
+	const int numberOfPoles = 253;
+	const int numberOfRows  = 64;
+	const int numberOfRulePoints = numberOfPoles * numberOfRows;
+
+	std::vector<float> x (numberOfPoles);
+	std::vector<int>   cx (numberOfPoles);
+	std::vector<float> rowValues (numberOfRulePoints);
+	std::vector<float> pointValues (numberOfRulePoints);
+
+	int i;
+	for (i = 0; i < numberOfPoles; ++i)
+	{
+		x [i]  = -3000.37f + static_cast<float> (i) * 2.f;
+		cx [i] = i;
+	}
+
+	numberOfPoints = 0;
+	rowTime = 0.f;
+	pointTime = 0.f;
+	float maximumError = 0.f;
+
+	for (int rule = 0; rule < CR_COUNT; ++rule)
+	{
+		MultiFractal rowFractal;
+		rowFractal.setSeed (static_cast<uint32> (1234 + rule));
+		rowFractal.setCombinationRule (static_cast<CombinationRule> (rule));
+		rowFractal.setUseSin (rule == CR_add);
+		rowFractal.setBias (rule == CR_crest, 0.3f);
+		rowFractal.setGain (rule == CR_turbulence, 0.7f);
+
+		MultiFractal pointFractal (rowFractal);
+
+		rowFractal.allocateCache (numberOfPoles, numberOfRows);
+		pointFractal.allocateCache (numberOfPoles, numberOfRows);
+
+		PerformanceTimer timer;
+		timer.start ();
+
+		int z;
+		for (z = 0; z < numberOfRows; ++z)
+			rowFractal.getValueCacheRow (numberOfPoles, &x [0], &cx [0], -1500.61f + static_cast<float> (z) * 2.f, z, &rowValues [static_cast<size_t> (z * numberOfPoles)]);
+
+		timer.stop ();
+		rowTime += timer.getElapsedTime ();
+
+		timer.start ();
+
+		for (z = 0; z < numberOfRows; ++z)
+			for (i = 0; i < numberOfPoles; ++i)
+				pointValues [static_cast<size_t> (z * numberOfPoles + i)] = pointFractal.getValueCache (x [i], -1500.61f + static_cast<float> (z) * 2.f, cx [i], z);
+
+		timer.stop ();
+		pointTime += timer.getElapsedTime ();
+
+		for (i = 0; i < numberOfRulePoints; ++i)
+			maximumError = std::max (maximumError, fabsf (rowValues [static_cast<size_t> (i)] - pointValues [static_cast<size_t> (i)]));
+
+		numberOfPoints += numberOfRulePoints;
+	}
+
+	return maximumError;
+}
+
 //-------------------------------------------------------------------
 
 bool MultiFractal::operator== (const MultiFractal& rhs) const
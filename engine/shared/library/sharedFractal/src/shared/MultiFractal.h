@@ -39,6 +39,8 @@ public:
 	static void debugDump ();
 #endif
 
+	static float verifyRowEvaluation (int& numberOfPoints, float& rowTime, float& pointTime);
+
 public:
 
 	enum CombinationRule
@@ -70,6 +72,7 @@ public:
 	float   getValueCache (float x, float y, int cx, int cy) const;
 	float   getValue2 (float x, float y) const;
 	float   getValueCache2 (float x, float y, int cx, int cy) const;
+	void    getValueCacheRow (int count, const float* x, const int* cx, float y, int cy, float* results) const;
 
 	//-- parameters
 	uint32 getSeed (void) const;
@@ -157,11 +160,13 @@ private:
 
 		float getValue (float x) const;
 		float getValue (float x, float y) const;
+		void  getValues (const float* x, const float* y, int count, float* results) const;
 
 	private:
 
 		float realGetValue (float x) const;
 		float realGetValue (float x, float y) const;
+		void  getValues4 (const float* x, const float* y, float* results) const;
 
 	private:
 
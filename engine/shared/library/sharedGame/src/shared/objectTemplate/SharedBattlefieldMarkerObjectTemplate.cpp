@@ -112,6 +112,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_numberOfPoles.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedBattlefieldMarkerObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -132,7 +137,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter numberOfPoles has not been defined in template %s!", DataResource::getName()));
-			return base->getNumberOfPoles();
+			return m_numberOfPoles.storeResolvedValue(0, randomDrawCount, base->getNumberOfPoles());
 		}
 	}
 
@@ -165,7 +170,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_numberOfPoles.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedBattlefieldMarkerObjectTemplate::getNumberOfPoles
 
 int SharedBattlefieldMarkerObjectTemplate::getNumberOfPolesMin(bool testData) const
@@ -176,6 +181,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_numberOfPoles.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedBattlefieldMarkerObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -196,7 +206,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter numberOfPoles has not been defined in template %s!", DataResource::getName()));
-			return base->getNumberOfPolesMin();
+			return m_numberOfPoles.storeResolvedValue(1, randomDrawCount, base->getNumberOfPolesMin());
 		}
 	}
 
@@ -229,7 +239,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_numberOfPoles.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedBattlefieldMarkerObjectTemplate::getNumberOfPolesMin
 
 int SharedBattlefieldMarkerObjectTemplate::getNumberOfPolesMax(bool testData) const
@@ -240,6 +250,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_numberOfPoles.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedBattlefieldMarkerObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -260,7 +275,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter numberOfPoles has not been defined in template %s!", DataResource::getName()));
-			return base->getNumberOfPolesMax();
+			return m_numberOfPoles.storeResolvedValue(2, randomDrawCount, base->getNumberOfPolesMax());
 		}
 	}
 
@@ -293,7 +308,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_numberOfPoles.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedBattlefieldMarkerObjectTemplate::getNumberOfPolesMax
 
 float SharedBattlefieldMarkerObjectTemplate::getRadius(bool testData) const
@@ -304,6 +319,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_radius.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedBattlefieldMarkerObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -324,7 +344,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter radius has not been defined in template %s!", DataResource::getName()));
-			return base->getRadius();
+			return m_radius.storeResolvedValue(0, randomDrawCount, base->getRadius());
 		}
 	}
 
@@ -357,7 +377,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_radius.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedBattlefieldMarkerObjectTemplate::getRadius
 
 float SharedBattlefieldMarkerObjectTemplate::getRadiusMin(bool testData) const
@@ -368,6 +388,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_radius.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedBattlefieldMarkerObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -388,7 +413,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter radius has not been defined in template %s!", DataResource::getName()));
-			return base->getRadiusMin();
+			return m_radius.storeResolvedValue(1, randomDrawCount, base->getRadiusMin());
 		}
 	}
 
@@ -421,7 +446,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_radius.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedBattlefieldMarkerObjectTemplate::getRadiusMin
 
 float SharedBattlefieldMarkerObjectTemplate::getRadiusMax(bool testData) const
@@ -432,6 +457,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_radius.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedBattlefieldMarkerObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -452,7 +482,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter radius has not been defined in template %s!", DataResource::getName()));
-			return base->getRadiusMax();
+			return m_radius.storeResolvedValue(2, randomDrawCount, base->getRadiusMax());
 		}
 	}
 
@@ -485,7 +515,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_radius.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedBattlefieldMarkerObjectTemplate::getRadiusMax
 
 #ifdef _DEBUG
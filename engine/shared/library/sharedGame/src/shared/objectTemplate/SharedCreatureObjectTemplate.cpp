@@ -826,6 +826,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_slopeModAngle.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -846,7 +851,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter slopeModAngle has not been defined in template %s!", DataResource::getName()));
-			return base->getSlopeModAngle();
+			return m_slopeModAngle.storeResolvedValue(0, randomDrawCount, base->getSlopeModAngle());
 		}
 	}
 
@@ -879,7 +884,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_slopeModAngle.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getSlopeModAngle
 
 float SharedCreatureObjectTemplate::getSlopeModAngleMin(bool testData) const
@@ -890,6 +895,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_slopeModAngle.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -910,7 +920,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter slopeModAngle has not been defined in template %s!", DataResource::getName()));
-			return base->getSlopeModAngleMin();
+			return m_slopeModAngle.storeResolvedValue(1, randomDrawCount, base->getSlopeModAngleMin());
 		}
 	}
 
@@ -943,7 +953,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_slopeModAngle.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getSlopeModAngleMin
 
 float SharedCreatureObjectTemplate::getSlopeModAngleMax(bool testData) const
@@ -954,6 +964,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_slopeModAngle.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -974,7 +989,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter slopeModAngle has not been defined in template %s!", DataResource::getName()));
-			return base->getSlopeModAngleMax();
+			return m_slopeModAngle.storeResolvedValue(2, randomDrawCount, base->getSlopeModAngleMax());
 		}
 	}
 
@@ -1007,7 +1022,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_slopeModAngle.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getSlopeModAngleMax
 
 float SharedCreatureObjectTemplate::getSlopeModPercent(bool testData) const
@@ -1018,6 +1033,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_slopeModPercent.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1038,7 +1058,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter slopeModPercent has not been defined in template %s!", DataResource::getName()));
-			return base->getSlopeModPercent();
+			return m_slopeModPercent.storeResolvedValue(0, randomDrawCount, base->getSlopeModPercent());
 		}
 	}
 
@@ -1071,7 +1091,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_slopeModPercent.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getSlopeModPercent
 
 float SharedCreatureObjectTemplate::getSlopeModPercentMin(bool testData) const
@@ -1082,6 +1102,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_slopeModPercent.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1102,7 +1127,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter slopeModPercent has not been defined in template %s!", DataResource::getName()));
-			return base->getSlopeModPercentMin();
+			return m_slopeModPercent.storeResolvedValue(1, randomDrawCount, base->getSlopeModPercentMin());
 		}
 	}
 
@@ -1135,7 +1160,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_slopeModPercent.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getSlopeModPercentMin
 
 float SharedCreatureObjectTemplate::getSlopeModPercentMax(bool testData) const
@@ -1146,6 +1171,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_slopeModPercent.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1166,7 +1196,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter slopeModPercent has not been defined in template %s!", DataResource::getName()));
-			return base->getSlopeModPercentMax();
+			return m_slopeModPercent.storeResolvedValue(2, randomDrawCount, base->getSlopeModPercentMax());
 		}
 	}
 
@@ -1199,7 +1229,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_slopeModPercent.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getSlopeModPercentMax
 
 float SharedCreatureObjectTemplate::getWaterModPercent(bool testData) const
@@ -1210,6 +1240,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_waterModPercent.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1230,7 +1265,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter waterModPercent has not been defined in template %s!", DataResource::getName()));
-			return base->getWaterModPercent();
+			return m_waterModPercent.storeResolvedValue(0, randomDrawCount, base->getWaterModPercent());
 		}
 	}
 
@@ -1263,7 +1298,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_waterModPercent.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getWaterModPercent
 
 float SharedCreatureObjectTemplate::getWaterModPercentMin(bool testData) const
@@ -1274,6 +1309,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_waterModPercent.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1294,7 +1334,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter waterModPercent has not been defined in template %s!", DataResource::getName()));
-			return base->getWaterModPercentMin();
+			return m_waterModPercent.storeResolvedValue(1, randomDrawCount, base->getWaterModPercentMin());
 		}
 	}
 
@@ -1327,7 +1367,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_waterModPercent.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getWaterModPercentMin
 
 float SharedCreatureObjectTemplate::getWaterModPercentMax(bool testData) const
@@ -1338,6 +1378,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_waterModPercent.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1358,7 +1403,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter waterModPercent has not been defined in template %s!", DataResource::getName()));
-			return base->getWaterModPercentMax();
+			return m_waterModPercent.storeResolvedValue(2, randomDrawCount, base->getWaterModPercentMax());
 		}
 	}
 
@@ -1391,7 +1436,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_waterModPercent.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getWaterModPercentMax
 
 float SharedCreatureObjectTemplate::getStepHeight(bool testData) const
@@ -1402,6 +1447,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_stepHeight.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1422,7 +1472,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter stepHeight has not been defined in template %s!", DataResource::getName()));
-			return base->getStepHeight();
+			return m_stepHeight.storeResolvedValue(0, randomDrawCount, base->getStepHeight());
 		}
 	}
 
@@ -1455,7 +1505,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_stepHeight.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getStepHeight
 
 float SharedCreatureObjectTemplate::getStepHeightMin(bool testData) const
@@ -1466,6 +1516,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_stepHeight.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1486,7 +1541,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter stepHeight has not been defined in template %s!", DataResource::getName()));
-			return base->getStepHeightMin();
+			return m_stepHeight.storeResolvedValue(1, randomDrawCount, base->getStepHeightMin());
 		}
 	}
 
@@ -1519,7 +1574,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_stepHeight.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getStepHeightMin
 
 float SharedCreatureObjectTemplate::getStepHeightMax(bool testData) const
@@ -1530,6 +1585,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_stepHeight.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1550,7 +1610,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter stepHeight has not been defined in template %s!", DataResource::getName()));
-			return base->getStepHeightMax();
+			return m_stepHeight.storeResolvedValue(2, randomDrawCount, base->getStepHeightMax());
 		}
 	}
 
@@ -1583,7 +1643,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_stepHeight.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getStepHeightMax
 
 float SharedCreatureObjectTemplate::getCollisionHeight(bool testData) const
@@ -1594,6 +1654,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_collisionHeight.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1614,7 +1679,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter collisionHeight has not been defined in template %s!", DataResource::getName()));
-			return base->getCollisionHeight();
+			return m_collisionHeight.storeResolvedValue(0, randomDrawCount, base->getCollisionHeight());
 		}
 	}
 
@@ -1647,7 +1712,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_collisionHeight.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getCollisionHeight
 
 float SharedCreatureObjectTemplate::getCollisionHeightMin(bool testData) const
@@ -1658,6 +1723,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_collisionHeight.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1678,7 +1748,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter collisionHeight has not been defined in template %s!", DataResource::getName()));
-			return base->getCollisionHeightMin();
+			return m_collisionHeight.storeResolvedValue(1, randomDrawCount, base->getCollisionHeightMin());
 		}
 	}
 
@@ -1711,7 +1781,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_collisionHeight.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getCollisionHeightMin
 
 float SharedCreatureObjectTemplate::getCollisionHeightMax(bool testData) const
@@ -1722,6 +1792,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_collisionHeight.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1742,7 +1817,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter collisionHeight has not been defined in template %s!", DataResource::getName()));
-			return base->getCollisionHeightMax();
+			return m_collisionHeight.storeResolvedValue(2, randomDrawCount, base->getCollisionHeightMax());
 		}
 	}
 
@@ -1775,7 +1850,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_collisionHeight.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getCollisionHeightMax
 
 float SharedCreatureObjectTemplate::getCollisionRadius(bool testData) const
@@ -1786,6 +1861,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_collisionRadius.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1806,7 +1886,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter collisionRadius has not been defined in template %s!", DataResource::getName()));
-			return base->getCollisionRadius();
+			return m_collisionRadius.storeResolvedValue(0, randomDrawCount, base->getCollisionRadius());
 		}
 	}
 
@@ -1839,7 +1919,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_collisionRadius.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getCollisionRadius
 
 float SharedCreatureObjectTemplate::getCollisionRadiusMin(bool testData) const
@@ -1850,6 +1930,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_collisionRadius.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1870,7 +1955,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter collisionRadius has not been defined in template %s!", DataResource::getName()));
-			return base->getCollisionRadiusMin();
+			return m_collisionRadius.storeResolvedValue(1, randomDrawCount, base->getCollisionRadiusMin());
 		}
 	}
 
@@ -1903,7 +1988,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_collisionRadius.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getCollisionRadiusMin
 
 float SharedCreatureObjectTemplate::getCollisionRadiusMax(bool testData) const
@@ -1914,6 +1999,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_collisionRadius.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1934,7 +2024,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter collisionRadius has not been defined in template %s!", DataResource::getName()));
-			return base->getCollisionRadiusMax();
+			return m_collisionRadius.storeResolvedValue(2, randomDrawCount, base->getCollisionRadiusMax());
 		}
 	}
 
@@ -1967,7 +2057,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_collisionRadius.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getCollisionRadiusMax
 
 const std::string & SharedCreatureObjectTemplate::getMovementDatatable(bool testData) const
@@ -2047,6 +2137,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_swimHeight.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -2067,7 +2162,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter swimHeight has not been defined in template %s!", DataResource::getName()));
-			return base->getSwimHeight();
+			return m_swimHeight.storeResolvedValue(0, randomDrawCount, base->getSwimHeight());
 		}
 	}
 
@@ -2100,7 +2195,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_swimHeight.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getSwimHeight
 
 float SharedCreatureObjectTemplate::getSwimHeightMin(bool testData) const
@@ -2111,6 +2206,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_swimHeight.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -2131,7 +2231,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter swimHeight has not been defined in template %s!", DataResource::getName()));
-			return base->getSwimHeightMin();
+			return m_swimHeight.storeResolvedValue(1, randomDrawCount, base->getSwimHeightMin());
 		}
 	}
 
@@ -2164,7 +2264,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_swimHeight.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getSwimHeightMin
 
 float SharedCreatureObjectTemplate::getSwimHeightMax(bool testData) const
@@ -2175,6 +2275,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_swimHeight.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -2195,7 +2300,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter swimHeight has not been defined in template %s!", DataResource::getName()));
-			return base->getSwimHeightMax();
+			return m_swimHeight.storeResolvedValue(2, randomDrawCount, base->getSwimHeightMax());
 		}
 	}
 
@@ -2228,7 +2333,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_swimHeight.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getSwimHeightMax
 
 float SharedCreatureObjectTemplate::getWarpTolerance(bool testData) const
@@ -2239,6 +2344,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_warpTolerance.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -2259,7 +2369,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter warpTolerance has not been defined in template %s!", DataResource::getName()));
-			return base->getWarpTolerance();
+			return m_warpTolerance.storeResolvedValue(0, randomDrawCount, base->getWarpTolerance());
 		}
 	}
 
@@ -2292,7 +2402,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_warpTolerance.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getWarpTolerance
 
 float SharedCreatureObjectTemplate::getWarpToleranceMin(bool testData) const
@@ -2303,6 +2413,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_warpTolerance.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -2323,7 +2438,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter warpTolerance has not been defined in template %s!", DataResource::getName()));
-			return base->getWarpToleranceMin();
+			return m_warpTolerance.storeResolvedValue(1, randomDrawCount, base->getWarpToleranceMin());
 		}
 	}
 
@@ -2356,7 +2471,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_warpTolerance.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getWarpToleranceMin
 
 float SharedCreatureObjectTemplate::getWarpToleranceMax(bool testData) const
@@ -2367,6 +2482,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_warpTolerance.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -2387,7 +2507,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter warpTolerance has not been defined in template %s!", DataResource::getName()));
-			return base->getWarpToleranceMax();
+			return m_warpTolerance.storeResolvedValue(2, randomDrawCount, base->getWarpToleranceMax());
 		}
 	}
 
@@ -2420,7 +2540,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_warpTolerance.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getWarpToleranceMax
 
 float SharedCreatureObjectTemplate::getCollisionOffsetX(bool testData) const
@@ -2431,6 +2551,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_collisionOffsetX.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -2451,7 +2576,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter collisionOffsetX has not been defined in template %s!", DataResource::getName()));
-			return base->getCollisionOffsetX();
+			return m_collisionOffsetX.storeResolvedValue(0, randomDrawCount, base->getCollisionOffsetX());
 		}
 	}
 
@@ -2484,7 +2609,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_collisionOffsetX.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getCollisionOffsetX
 
 float SharedCreatureObjectTemplate::getCollisionOffsetXMin(bool testData) const
@@ -2495,6 +2620,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_collisionOffsetX.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -2515,7 +2645,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter collisionOffsetX has not been defined in template %s!", DataResource::getName()));
-			return base->getCollisionOffsetXMin();
+			return m_collisionOffsetX.storeResolvedValue(1, randomDrawCount, base->getCollisionOffsetXMin());
 		}
 	}
 
@@ -2548,7 +2678,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_collisionOffsetX.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getCollisionOffsetXMin
 
 float SharedCreatureObjectTemplate::getCollisionOffsetXMax(bool testData) const
@@ -2559,6 +2689,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_collisionOffsetX.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -2579,7 +2714,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter collisionOffsetX has not been defined in template %s!", DataResource::getName()));
-			return base->getCollisionOffsetXMax();
+			return m_collisionOffsetX.storeResolvedValue(2, randomDrawCount, base->getCollisionOffsetXMax());
 		}
 	}
 
@@ -2612,7 +2747,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_collisionOffsetX.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getCollisionOffsetXMax
 
 float SharedCreatureObjectTemplate::getCollisionOffsetZ(bool testData) const
@@ -2623,6 +2758,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_collisionOffsetZ.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -2643,7 +2783,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter collisionOffsetZ has not been defined in template %s!", DataResource::getName()));
-			return base->getCollisionOffsetZ();
+			return m_collisionOffsetZ.storeResolvedValue(0, randomDrawCount, base->getCollisionOffsetZ());
 		}
 	}
 
@@ -2676,7 +2816,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_collisionOffsetZ.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getCollisionOffsetZ
 
 float SharedCreatureObjectTemplate::getCollisionOffsetZMin(bool testData) const
@@ -2687,6 +2827,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_collisionOffsetZ.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -2707,7 +2852,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter collisionOffsetZ has not been defined in template %s!", DataResource::getName()));
-			return base->getCollisionOffsetZMin();
+			return m_collisionOffsetZ.storeResolvedValue(1, randomDrawCount, base->getCollisionOffsetZMin());
 		}
 	}
 
@@ -2740,7 +2885,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_collisionOffsetZ.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getCollisionOffsetZMin
 
 float SharedCreatureObjectTemplate::getCollisionOffsetZMax(bool testData) const
@@ -2751,6 +2896,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_collisionOffsetZ.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -2771,7 +2921,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter collisionOffsetZ has not been defined in template %s!", DataResource::getName()));
-			return base->getCollisionOffsetZMax();
+			return m_collisionOffsetZ.storeResolvedValue(2, randomDrawCount, base->getCollisionOffsetZMax());
 		}
 	}
 
@@ -2804,7 +2954,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_collisionOffsetZ.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getCollisionOffsetZMax
 
 float SharedCreatureObjectTemplate::getCollisionLength(bool testData) const
@@ -2815,6 +2965,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_collisionLength.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -2835,7 +2990,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter collisionLength has not been defined in template %s!", DataResource::getName()));
-			return base->getCollisionLength();
+			return m_collisionLength.storeResolvedValue(0, randomDrawCount, base->getCollisionLength());
 		}
 	}
 
@@ -2868,7 +3023,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_collisionLength.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getCollisionLength
 
 float SharedCreatureObjectTemplate::getCollisionLengthMin(bool testData) const
@@ -2879,6 +3034,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_collisionLength.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -2899,7 +3059,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter collisionLength has not been defined in template %s!", DataResource::getName()));
-			return base->getCollisionLengthMin();
+			return m_collisionLength.storeResolvedValue(1, randomDrawCount, base->getCollisionLengthMin());
 		}
 	}
 
@@ -2932,7 +3092,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_collisionLength.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getCollisionLengthMin
 
 float SharedCreatureObjectTemplate::getCollisionLengthMax(bool testData) const
@@ -2943,6 +3103,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_collisionLength.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -2963,7 +3128,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter collisionLength has not been defined in template %s!", DataResource::getName()));
-			return base->getCollisionLengthMax();
+			return m_collisionLength.storeResolvedValue(2, randomDrawCount, base->getCollisionLengthMax());
 		}
 	}
 
@@ -2996,7 +3161,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_collisionLength.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getCollisionLengthMax
 
 float SharedCreatureObjectTemplate::getCameraHeight(bool testData) const
@@ -3007,6 +3172,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_cameraHeight.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -3027,7 +3197,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter cameraHeight has not been defined in template %s!", DataResource::getName()));
-			return base->getCameraHeight();
+			return m_cameraHeight.storeResolvedValue(0, randomDrawCount, base->getCameraHeight());
 		}
 	}
 
@@ -3060,7 +3230,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_cameraHeight.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getCameraHeight
 
 float SharedCreatureObjectTemplate::getCameraHeightMin(bool testData) const
@@ -3071,6 +3241,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_cameraHeight.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -3091,7 +3266,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter cameraHeight has not been defined in template %s!", DataResource::getName()));
-			return base->getCameraHeightMin();
+			return m_cameraHeight.storeResolvedValue(1, randomDrawCount, base->getCameraHeightMin());
 		}
 	}
 
@@ -3124,7 +3299,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_cameraHeight.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getCameraHeightMin
 
 float SharedCreatureObjectTemplate::getCameraHeightMax(bool testData) const
@@ -3135,6 +3310,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_cameraHeight.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedCreatureObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -3155,7 +3335,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter cameraHeight has not been defined in template %s!", DataResource::getName()));
-			return base->getCameraHeightMax();
+			return m_cameraHeight.storeResolvedValue(2, randomDrawCount, base->getCameraHeightMax());
 		}
 	}
 
@@ -3188,7 +3368,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_cameraHeight.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedCreatureObjectTemplate::getCameraHeightMax
 
 #ifdef _DEBUG
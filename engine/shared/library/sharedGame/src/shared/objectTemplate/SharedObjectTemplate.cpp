@@ -484,6 +484,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_containerVolumeLimit.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -504,7 +509,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter containerVolumeLimit has not been defined in template %s!", DataResource::getName()));
-			return base->getContainerVolumeLimit();
+			return m_containerVolumeLimit.storeResolvedValue(0, randomDrawCount, base->getContainerVolumeLimit());
 		}
 	}
 
@@ -537,7 +542,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_containerVolumeLimit.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedObjectTemplate::getContainerVolumeLimit
 
 int SharedObjectTemplate::getContainerVolumeLimitMin(bool testData) const
@@ -548,6 +553,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_containerVolumeLimit.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -568,7 +578,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter containerVolumeLimit has not been defined in template %s!", DataResource::getName()));
-			return base->getContainerVolumeLimitMin();
+			return m_containerVolumeLimit.storeResolvedValue(1, randomDrawCount, base->getContainerVolumeLimitMin());
 		}
 	}
 
@@ -601,7 +611,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_containerVolumeLimit.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedObjectTemplate::getContainerVolumeLimitMin
 
 int SharedObjectTemplate::getContainerVolumeLimitMax(bool testData) const
@@ -612,6 +622,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_containerVolumeLimit.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -632,7 +647,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter containerVolumeLimit has not been defined in template %s!", DataResource::getName()));
-			return base->getContainerVolumeLimitMax();
+			return m_containerVolumeLimit.storeResolvedValue(2, randomDrawCount, base->getContainerVolumeLimitMax());
 		}
 	}
 
@@ -665,7 +680,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_containerVolumeLimit.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedObjectTemplate::getContainerVolumeLimitMax
 
 const std::string & SharedObjectTemplate::getTintPalette(bool testData) const
@@ -928,6 +943,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_scale.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -948,7 +968,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter scale has not been defined in template %s!", DataResource::getName()));
-			return base->getScale();
+			return m_scale.storeResolvedValue(0, randomDrawCount, base->getScale());
 		}
 	}
 
@@ -981,7 +1001,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_scale.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedObjectTemplate::getScale
 
 float SharedObjectTemplate::getScaleMin(bool testData) const
@@ -992,6 +1012,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_scale.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1012,7 +1037,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter scale has not been defined in template %s!", DataResource::getName()));
-			return base->getScaleMin();
+			return m_scale.storeResolvedValue(1, randomDrawCount, base->getScaleMin());
 		}
 	}
 
@@ -1045,7 +1070,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_scale.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedObjectTemplate::getScaleMin
 
 float SharedObjectTemplate::getScaleMax(bool testData) const
@@ -1056,6 +1081,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_scale.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1076,7 +1106,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter scale has not been defined in template %s!", DataResource::getName()));
-			return base->getScaleMax();
+			return m_scale.storeResolvedValue(2, randomDrawCount, base->getScaleMax());
 		}
 	}
 
@@ -1109,7 +1139,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_scale.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedObjectTemplate::getScaleMax
 
 SharedObjectTemplate::GameObjectType SharedObjectTemplate::getGameObjectType(bool testData) const
@@ -1204,6 +1234,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_scaleThresholdBeforeExtentTest.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1224,7 +1259,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter scaleThresholdBeforeExtentTest has not been defined in template %s!", DataResource::getName()));
-			return base->getScaleThresholdBeforeExtentTest();
+			return m_scaleThresholdBeforeExtentTest.storeResolvedValue(0, randomDrawCount, base->getScaleThresholdBeforeExtentTest());
 		}
 	}
 
@@ -1257,7 +1292,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_scaleThresholdBeforeExtentTest.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedObjectTemplate::getScaleThresholdBeforeExtentTest
 
 float SharedObjectTemplate::getScaleThresholdBeforeExtentTestMin(bool testData) const
@@ -1268,6 +1303,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_scaleThresholdBeforeExtentTest.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1288,7 +1328,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter scaleThresholdBeforeExtentTest has not been defined in template %s!", DataResource::getName()));
-			return base->getScaleThresholdBeforeExtentTestMin();
+			return m_scaleThresholdBeforeExtentTest.storeResolvedValue(1, randomDrawCount, base->getScaleThresholdBeforeExtentTestMin());
 		}
 	}
 
@@ -1321,7 +1361,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_scaleThresholdBeforeExtentTest.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedObjectTemplate::getScaleThresholdBeforeExtentTestMin
 
 float SharedObjectTemplate::getScaleThresholdBeforeExtentTestMax(bool testData) const
@@ -1332,6 +1372,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_scaleThresholdBeforeExtentTest.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1352,7 +1397,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter scaleThresholdBeforeExtentTest has not been defined in template %s!", DataResource::getName()));
-			return base->getScaleThresholdBeforeExtentTestMax();
+			return m_scaleThresholdBeforeExtentTest.storeResolvedValue(2, randomDrawCount, base->getScaleThresholdBeforeExtentTestMax());
 		}
 	}
 
@@ -1385,7 +1430,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_scaleThresholdBeforeExtentTest.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedObjectTemplate::getScaleThresholdBeforeExtentTestMax
 
 float SharedObjectTemplate::getClearFloraRadius(bool testData) const
@@ -1396,6 +1441,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_clearFloraRadius.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1416,7 +1466,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter clearFloraRadius has not been defined in template %s!", DataResource::getName()));
-			return base->getClearFloraRadius();
+			return m_clearFloraRadius.storeResolvedValue(0, randomDrawCount, base->getClearFloraRadius());
 		}
 	}
 
@@ -1449,7 +1499,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_clearFloraRadius.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedObjectTemplate::getClearFloraRadius
 
 float SharedObjectTemplate::getClearFloraRadiusMin(bool testData) const
@@ -1460,6 +1510,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_clearFloraRadius.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1480,7 +1535,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter clearFloraRadius has not been defined in template %s!", DataResource::getName()));
-			return base->getClearFloraRadiusMin();
+			return m_clearFloraRadius.storeResolvedValue(1, randomDrawCount, base->getClearFloraRadiusMin());
 		}
 	}
 
@@ -1513,7 +1568,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_clearFloraRadius.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedObjectTemplate::getClearFloraRadiusMin
 
 float SharedObjectTemplate::getClearFloraRadiusMax(bool testData) const
@@ -1524,6 +1579,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_clearFloraRadius.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1544,7 +1604,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter clearFloraRadius has not been defined in template %s!", DataResource::getName()));
-			return base->getClearFloraRadiusMax();
+			return m_clearFloraRadius.storeResolvedValue(2, randomDrawCount, base->getClearFloraRadiusMax());
 		}
 	}
 
@@ -1577,7 +1637,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_clearFloraRadius.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedObjectTemplate::getClearFloraRadiusMax
 
 SharedObjectTemplate::SurfaceType SharedObjectTemplate::getSurfaceType(bool testData) const
@@ -1630,6 +1690,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_noBuildRadius.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1650,7 +1715,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter noBuildRadius has not been defined in template %s!", DataResource::getName()));
-			return base->getNoBuildRadius();
+			return m_noBuildRadius.storeResolvedValue(0, randomDrawCount, base->getNoBuildRadius());
 		}
 	}
 
@@ -1683,7 +1748,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_noBuildRadius.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedObjectTemplate::getNoBuildRadius
 
 float SharedObjectTemplate::getNoBuildRadiusMin(bool testData) const
@@ -1694,6 +1759,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_noBuildRadius.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1714,7 +1784,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter noBuildRadius has not been defined in template %s!", DataResource::getName()));
-			return base->getNoBuildRadiusMin();
+			return m_noBuildRadius.storeResolvedValue(1, randomDrawCount, base->getNoBuildRadiusMin());
 		}
 	}
 
@@ -1747,7 +1817,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_noBuildRadius.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedObjectTemplate::getNoBuildRadiusMin
 
 float SharedObjectTemplate::getNoBuildRadiusMax(bool testData) const
@@ -1758,6 +1828,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_noBuildRadius.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1778,7 +1853,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter noBuildRadius has not been defined in template %s!", DataResource::getName()));
-			return base->getNoBuildRadiusMax();
+			return m_noBuildRadius.storeResolvedValue(2, randomDrawCount, base->getNoBuildRadiusMax());
 		}
 	}
 
@@ -1811,7 +1886,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_noBuildRadius.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedObjectTemplate::getNoBuildRadiusMax
 
 bool SharedObjectTemplate::getOnlyVisibleInTools(bool testData) const
@@ -1864,6 +1939,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_locationReservationRadius.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1884,7 +1964,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter locationReservationRadius has not been defined in template %s!", DataResource::getName()));
-			return base->getLocationReservationRadius();
+			return m_locationReservationRadius.storeResolvedValue(0, randomDrawCount, base->getLocationReservationRadius());
 		}
 	}
 
@@ -1917,7 +1997,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_locationReservationRadius.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedObjectTemplate::getLocationReservationRadius
 
 float SharedObjectTemplate::getLocationReservationRadiusMin(bool testData) const
@@ -1928,6 +2008,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_locationReservationRadius.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1948,7 +2033,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter locationReservationRadius has not been defined in template %s!", DataResource::getName()));
-			return base->getLocationReservationRadiusMin();
+			return m_locationReservationRadius.storeResolvedValue(1, randomDrawCount, base->getLocationReservationRadiusMin());
 		}
 	}
 
@@ -1981,7 +2066,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_locationReservationRadius.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedObjectTemplate::getLocationReservationRadiusMin
 
 float SharedObjectTemplate::getLocationReservationRadiusMax(bool testData) const
@@ -1992,6 +2077,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_locationReservationRadius.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -2012,7 +2102,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter locationReservationRadius has not been defined in template %s!", DataResource::getName()));
-			return base->getLocationReservationRadiusMax();
+			return m_locationReservationRadius.storeResolvedValue(2, randomDrawCount, base->getLocationReservationRadiusMax());
 		}
 	}
 
@@ -2045,7 +2135,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_locationReservationRadius.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedObjectTemplate::getLocationReservationRadiusMax
 
 bool SharedObjectTemplate::getForceNoCollision(bool testData) const
@@ -111,6 +111,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_cover.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedTerrainSurfaceObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -131,7 +136,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter cover has not been defined in template %s!", DataResource::getName()));
-			return base->getCover();
+			return m_cover.storeResolvedValue(0, randomDrawCount, base->getCover());
 		}
 	}
 
@@ -164,7 +169,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_cover.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedTerrainSurfaceObjectTemplate::getCover
 
 float SharedTerrainSurfaceObjectTemplate::getCoverMin(bool testData) const
@@ -175,6 +180,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_cover.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedTerrainSurfaceObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -195,7 +205,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter cover has not been defined in template %s!", DataResource::getName()));
-			return base->getCoverMin();
+			return m_cover.storeResolvedValue(1, randomDrawCount, base->getCoverMin());
 		}
 	}
 
@@ -228,7 +238,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_cover.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedTerrainSurfaceObjectTemplate::getCoverMin
 
 float SharedTerrainSurfaceObjectTemplate::getCoverMax(bool testData) const
@@ -239,6 +249,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_cover.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedTerrainSurfaceObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -259,7 +274,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter cover has not been defined in template %s!", DataResource::getName()));
-			return base->getCoverMax();
+			return m_cover.storeResolvedValue(2, randomDrawCount, base->getCoverMax());
 		}
 	}
 
@@ -292,7 +307,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_cover.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedTerrainSurfaceObjectTemplate::getCoverMax
 
 const std::string & SharedTerrainSurfaceObjectTemplate::getSurfaceType(bool testData) const
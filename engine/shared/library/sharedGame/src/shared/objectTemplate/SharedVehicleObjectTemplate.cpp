@@ -258,6 +258,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_slopeAversion.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -278,7 +283,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter slopeAversion has not been defined in template %s!", DataResource::getName()));
-			return base->getSlopeAversion();
+			return m_slopeAversion.storeResolvedValue(0, randomDrawCount, base->getSlopeAversion());
 		}
 	}
 
@@ -311,7 +316,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_slopeAversion.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedVehicleObjectTemplate::getSlopeAversion
 
 float SharedVehicleObjectTemplate::getSlopeAversionMin(bool testData) const
@@ -322,6 +327,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_slopeAversion.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -342,7 +352,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter slopeAversion has not been defined in template %s!", DataResource::getName()));
-			return base->getSlopeAversionMin();
+			return m_slopeAversion.storeResolvedValue(1, randomDrawCount, base->getSlopeAversionMin());
 		}
 	}
 
@@ -375,7 +385,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_slopeAversion.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedVehicleObjectTemplate::getSlopeAversionMin
 
 float SharedVehicleObjectTemplate::getSlopeAversionMax(bool testData) const
@@ -386,6 +396,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_slopeAversion.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -406,7 +421,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter slopeAversion has not been defined in template %s!", DataResource::getName()));
-			return base->getSlopeAversionMax();
+			return m_slopeAversion.storeResolvedValue(2, randomDrawCount, base->getSlopeAversionMax());
 		}
 	}
 
@@ -439,7 +454,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_slopeAversion.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedVehicleObjectTemplate::getSlopeAversionMax
 
 float SharedVehicleObjectTemplate::getHoverValue(bool testData) const
@@ -450,6 +465,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_hoverValue.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -470,7 +490,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter hoverValue has not been defined in template %s!", DataResource::getName()));
-			return base->getHoverValue();
+			return m_hoverValue.storeResolvedValue(0, randomDrawCount, base->getHoverValue());
 		}
 	}
 
@@ -503,7 +523,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_hoverValue.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedVehicleObjectTemplate::getHoverValue
 
 float SharedVehicleObjectTemplate::getHoverValueMin(bool testData) const
@@ -514,6 +534,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_hoverValue.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -534,7 +559,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter hoverValue has not been defined in template %s!", DataResource::getName()));
-			return base->getHoverValueMin();
+			return m_hoverValue.storeResolvedValue(1, randomDrawCount, base->getHoverValueMin());
 		}
 	}
 
@@ -567,7 +592,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_hoverValue.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedVehicleObjectTemplate::getHoverValueMin
 
 float SharedVehicleObjectTemplate::getHoverValueMax(bool testData) const
@@ -578,6 +603,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_hoverValue.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -598,7 +628,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter hoverValue has not been defined in template %s!", DataResource::getName()));
-			return base->getHoverValueMax();
+			return m_hoverValue.storeResolvedValue(2, randomDrawCount, base->getHoverValueMax());
 		}
 	}
 
@@ -631,7 +661,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_hoverValue.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedVehicleObjectTemplate::getHoverValueMax
 
 float SharedVehicleObjectTemplate::getTurnRate(bool testData) const
@@ -642,6 +672,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_turnRate.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -662,7 +697,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter turnRate has not been defined in template %s!", DataResource::getName()));
-			return base->getTurnRate();
+			return m_turnRate.storeResolvedValue(0, randomDrawCount, base->getTurnRate());
 		}
 	}
 
@@ -695,7 +730,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_turnRate.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedVehicleObjectTemplate::getTurnRate
 
 float SharedVehicleObjectTemplate::getTurnRateMin(bool testData) const
@@ -706,6 +741,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_turnRate.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -726,7 +766,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter turnRate has not been defined in template %s!", DataResource::getName()));
-			return base->getTurnRateMin();
+			return m_turnRate.storeResolvedValue(1, randomDrawCount, base->getTurnRateMin());
 		}
 	}
 
@@ -759,7 +799,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_turnRate.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedVehicleObjectTemplate::getTurnRateMin
 
 float SharedVehicleObjectTemplate::getTurnRateMax(bool testData) const
@@ -770,6 +810,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_turnRate.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -790,7 +835,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter turnRate has not been defined in template %s!", DataResource::getName()));
-			return base->getTurnRateMax();
+			return m_turnRate.storeResolvedValue(2, randomDrawCount, base->getTurnRateMax());
 		}
 	}
 
@@ -823,7 +868,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_turnRate.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedVehicleObjectTemplate::getTurnRateMax
 
 float SharedVehicleObjectTemplate::getMaxVelocity(bool testData) const
@@ -834,6 +879,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_maxVelocity.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -854,7 +904,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxVelocity has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxVelocity();
+			return m_maxVelocity.storeResolvedValue(0, randomDrawCount, base->getMaxVelocity());
 		}
 	}
 
@@ -887,7 +937,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxVelocity.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedVehicleObjectTemplate::getMaxVelocity
 
 float SharedVehicleObjectTemplate::getMaxVelocityMin(bool testData) const
@@ -898,6 +948,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_maxVelocity.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -918,7 +973,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxVelocity has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxVelocityMin();
+			return m_maxVelocity.storeResolvedValue(1, randomDrawCount, base->getMaxVelocityMin());
 		}
 	}
 
@@ -951,7 +1006,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxVelocity.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedVehicleObjectTemplate::getMaxVelocityMin
 
 float SharedVehicleObjectTemplate::getMaxVelocityMax(bool testData) const
@@ -962,6 +1017,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_maxVelocity.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -982,7 +1042,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter maxVelocity has not been defined in template %s!", DataResource::getName()));
-			return base->getMaxVelocityMax();
+			return m_maxVelocity.storeResolvedValue(2, randomDrawCount, base->getMaxVelocityMax());
 		}
 	}
 
@@ -1015,7 +1075,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_maxVelocity.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedVehicleObjectTemplate::getMaxVelocityMax
 
 float SharedVehicleObjectTemplate::getAcceleration(bool testData) const
@@ -1026,6 +1086,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_acceleration.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1046,7 +1111,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter acceleration has not been defined in template %s!", DataResource::getName()));
-			return base->getAcceleration();
+			return m_acceleration.storeResolvedValue(0, randomDrawCount, base->getAcceleration());
 		}
 	}
 
@@ -1079,7 +1144,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_acceleration.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedVehicleObjectTemplate::getAcceleration
 
 float SharedVehicleObjectTemplate::getAccelerationMin(bool testData) const
@@ -1090,6 +1155,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_acceleration.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1110,7 +1180,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter acceleration has not been defined in template %s!", DataResource::getName()));
-			return base->getAccelerationMin();
+			return m_acceleration.storeResolvedValue(1, randomDrawCount, base->getAccelerationMin());
 		}
 	}
 
@@ -1143,7 +1213,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_acceleration.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedVehicleObjectTemplate::getAccelerationMin
 
 float SharedVehicleObjectTemplate::getAccelerationMax(bool testData) const
@@ -1154,6 +1224,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_acceleration.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1174,7 +1249,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter acceleration has not been defined in template %s!", DataResource::getName()));
-			return base->getAccelerationMax();
+			return m_acceleration.storeResolvedValue(2, randomDrawCount, base->getAccelerationMax());
 		}
 	}
 
@@ -1207,7 +1282,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_acceleration.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedVehicleObjectTemplate::getAccelerationMax
 
 float SharedVehicleObjectTemplate::getBraking(bool testData) const
@@ -1218,6 +1293,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_braking.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1238,7 +1318,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter braking has not been defined in template %s!", DataResource::getName()));
-			return base->getBraking();
+			return m_braking.storeResolvedValue(0, randomDrawCount, base->getBraking());
 		}
 	}
 
@@ -1271,7 +1351,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_braking.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedVehicleObjectTemplate::getBraking
 
 float SharedVehicleObjectTemplate::getBrakingMin(bool testData) const
@@ -1282,6 +1362,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_braking.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1302,7 +1387,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter braking has not been defined in template %s!", DataResource::getName()));
-			return base->getBrakingMin();
+			return m_braking.storeResolvedValue(1, randomDrawCount, base->getBrakingMin());
 		}
 	}
 
@@ -1335,7 +1420,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_braking.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedVehicleObjectTemplate::getBrakingMin
 
 float SharedVehicleObjectTemplate::getBrakingMax(bool testData) const
@@ -1346,6 +1431,11 @@ float testDataValue = 0.0f;
 UNREF(testData);
 #endif
 
+	float cachedValue;
+	if (!testData && m_braking.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedVehicleObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -1366,7 +1456,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter braking has not been defined in template %s!", DataResource::getName()));
-			return base->getBrakingMax();
+			return m_braking.storeResolvedValue(2, randomDrawCount, base->getBrakingMax());
 		}
 	}
 
@@ -1399,7 +1489,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_braking.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedVehicleObjectTemplate::getBrakingMax
 
 #ifdef _DEBUG
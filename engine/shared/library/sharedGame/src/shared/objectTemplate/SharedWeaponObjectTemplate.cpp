@@ -153,6 +153,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_weaponEffectIndex.getResolvedValue(0, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -173,7 +178,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter weaponEffectIndex has not been defined in template %s!", DataResource::getName()));
-			return base->getWeaponEffectIndex();
+			return m_weaponEffectIndex.storeResolvedValue(0, randomDrawCount, base->getWeaponEffectIndex());
 		}
 	}
 
@@ -206,7 +211,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_weaponEffectIndex.storeResolvedValue(0, randomDrawCount, value);
 }	// SharedWeaponObjectTemplate::getWeaponEffectIndex
 
 int SharedWeaponObjectTemplate::getWeaponEffectIndexMin(bool testData) const
@@ -217,6 +222,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_weaponEffectIndex.getResolvedValue(1, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -237,7 +247,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter weaponEffectIndex has not been defined in template %s!", DataResource::getName()));
-			return base->getWeaponEffectIndexMin();
+			return m_weaponEffectIndex.storeResolvedValue(1, randomDrawCount, base->getWeaponEffectIndexMin());
 		}
 	}
 
@@ -270,7 +280,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_weaponEffectIndex.storeResolvedValue(1, randomDrawCount, value);
 }	// SharedWeaponObjectTemplate::getWeaponEffectIndexMin
 
 int SharedWeaponObjectTemplate::getWeaponEffectIndexMax(bool testData) const
@@ -281,6 +291,11 @@ int testDataValue = 0;
 UNREF(testData);
 #endif
 
+	int cachedValue;
+	if (!testData && m_weaponEffectIndex.getResolvedValue(2, cachedValue))
+		return cachedValue;
+	const int randomDrawCount = TemplateParamResolution::getRandomDrawCount();
+
 	const SharedWeaponObjectTemplate * base = nullptr;
 	if (m_baseData != nullptr)
 	{
@@ -301,7 +316,7 @@ UNREF(testData);
 		else
 		{
 			DEBUG_FATAL(base == nullptr, ("Template parameter weaponEffectIndex has not been defined in template %s!", DataResource::getName()));
-			return base->getWeaponEffectIndexMax();
+			return m_weaponEffectIndex.storeResolvedValue(2, randomDrawCount, base->getWeaponEffectIndexMax());
 		}
 	}
 
@@ -334,7 +349,7 @@ UNREF(testData);
 	}
 #endif
 
-	return value;
+	return m_weaponEffectIndex.storeResolvedValue(2, randomDrawCount, value);
 }	// SharedWeaponObjectTemplate::getWeaponEffectIndexMax
 
 SharedWeaponObjectTemplate::AttackType SharedWeaponObjectTemplate::getAttackType(bool testData) const
@@ -15,9 +15,12 @@
 #include "sharedObject/ObjectTemplate.h"
 #include "sharedObject/Object.h"
 #include "sharedFoundation/ConstCharCrcString.h"
+#include "sharedFoundation/CrcStringRegistry.h"
 #include "sharedFoundation/CrcStringTable.h"
 #include "sharedFoundation/DataResourceList.h"
+#include "sharedUtility/TemplateParameter.h"
 
+#include <unordered_map>
 #include <vector>
 
 // ======================================================================
@@ -32,6 +35,10 @@ namespace ObjectTemplateListNamespace
 	bool           ms_logLoadedObjectTemplates;
 	bool ms_logFetch;
 	CrcStringTable ms_crcStringTable;
+
+	// loaded templates by template id; entries are cleared when the template is released
+	std::vector<ObjectTemplate const *> ms_templatesById;
+	std::unordered_map<uint32, int>     ms_templateIdsByCrc;
 }
 using namespace ObjectTemplateListNamespace;
 
@@ -57,6 +64,9 @@ void ObjectTemplateList::remove()
 	DebugFlags::unregisterFlag(ms_logLoadedObjectTemplates);
 	DebugFlags::unregisterFlag(ms_logFetch);
 
+	ms_templatesById.clear();
+	ms_templateIdsByCrc.clear();
+
 	ObjectTemplateListDataResourceList::remove();
 }	
 
@@ -91,6 +101,13 @@ void ObjectTemplateList::logLoadedObjectTemplates()
 
 // ----------------------------------------------------------------------
 
+void ObjectTemplateList::getLoadedObjectTemplateNames(std::vector<std::string> & names)
+{
+	ObjectTemplateListDataResourceList::getLoadedResourceNames(names);
+}
+
+// ----------------------------------------------------------------------
+
 const ObjectTemplate *ObjectTemplateList::fetch(const std::string &filename)
 {
 	DEBUG_REPORT_LOG(ms_logFetch, ("[fetch] ObjectTemplateList::fetch: %s\n", filename.c_str()));
@@ -124,7 +141,72 @@ const ObjectTemplate *ObjectTemplateList::fetch(const CrcString &filename)
 
 const ObjectTemplate *ObjectTemplateList::fetch(uint32 crc)
 {
-	return ObjectTemplateListDataResourceList::fetch(lookUp(crc));
+	return fetchById(getTemplateId(crc));
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Fetch a template by the id returned from getTemplateId().
+ *
+ * A template that is already loaded is found by indexing rather than by
+ * hashing and comparing its name.
+ */
+
+const ObjectTemplate *ObjectTemplateList::fetchById(int const templateId)
+{
+	if (templateId == CrcStringRegistry::cms_invalidId)
+		return nullptr;
+
+	size_t const index = static_cast<size_t>(templateId);
+	if (index < ms_templatesById.size() && ms_templatesById[index] != nullptr)
+	{
+		ObjectTemplate const * const objectTemplate = ms_templatesById[index];
+		objectTemplate->addReference();
+		return objectTemplate;
+	}
+
+	CrcString const & filename = CrcStringRegistry::getString(templateId);
+	DEBUG_REPORT_LOG(ms_logFetch, ("[fetch] ObjectTemplateList::fetchById: %s\n", filename.getString()));
+
+	ObjectTemplate const * const objectTemplate = ObjectTemplateListDataResourceList::fetch(filename);
+	if (objectTemplate != nullptr)
+	{
+		if (index >= ms_templatesById.size())
+			ms_templatesById.resize(index + 1, nullptr);
+		ms_templatesById[index] = objectTemplate;
+	}
+
+	return objectTemplate;
+}
+
+// ----------------------------------------------------------------------
+
+int ObjectTemplateList::getTemplateId(const CrcString &filename)
+{
+	return CrcStringRegistry::intern(filename);
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Get the id of the template named in the object template crc string table.
+ *
+ * @return The template id, or CrcStringRegistry::cms_invalidId if the crc is
+ * not in the table
+ */
+
+int ObjectTemplateList::getTemplateId(uint32 const crc)
+{
+	std::unordered_map<uint32, int>::const_iterator const i = ms_templateIdsByCrc.find(crc);
+	if (i != ms_templateIdsByCrc.end())
+		return i->second;
+
+	ConstCharCrcString const filename = lookUp(crc);
+	if (filename.isEmpty())
+		return CrcStringRegistry::cms_invalidId;
+
+	int const templateId = CrcStringRegistry::intern(filename);
+	ms_templateIdsByCrc[crc] = templateId;
+	return templateId;
 }
 
 // ----------------------------------------------------------------------
@@ -145,6 +227,13 @@ Object *ObjectTemplateList::createObject (const CrcString &fileName)
 
 void ObjectTemplateList::release(const ObjectTemplate &dataResource)
 {
+	if (dataResource.getReferenceCount() == 0)
+	{
+		int const templateId = CrcStringRegistry::find(dataResource.getCrcName());
+		if (templateId != CrcStringRegistry::cms_invalidId && static_cast<size_t>(templateId) < ms_templatesById.size() && ms_templatesById[static_cast<size_t>(templateId)] == &dataResource)
+			ms_templatesById[static_cast<size_t>(templateId)] = nullptr;
+	}
+
 	ObjectTemplateListDataResourceList::release(dataResource);
 }	
 
@@ -152,7 +241,13 @@ void ObjectTemplateList::release(const ObjectTemplate &dataResource)
 
 ObjectTemplate *ObjectTemplateList::reload(Iff &source)
 {
-	return ObjectTemplateListDataResourceList::reload(source);
+	ObjectTemplate * const objectTemplate = ObjectTemplateListDataResourceList::reload(source);
+
+	//-- templates deriving from this one may have cached values resolved through it
+	if (objectTemplate)
+		TemplateParamResolution::invalidate();
+
+	return objectTemplate;
 }	
 
 //-----------------------------------------------------------------------
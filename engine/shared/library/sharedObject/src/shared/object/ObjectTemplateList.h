@@ -36,6 +36,7 @@ public:
 	static void remove();
 
 	static void logLoadedObjectTemplates();
+	static void getLoadedObjectTemplateNames(std::vector<std::string> & names);
 
 	// functions to create a new DataResource
 	static const ObjectTemplate  *fetch(Iff &source);
@@ -43,6 +44,7 @@ public:
 	static const ObjectTemplate  *fetch(uint32 crc);
 	static const ObjectTemplate  *fetch(const std::string &filename);
 	static const ObjectTemplate  *fetch(const char *filename);
+	static const ObjectTemplate  *fetchById(int templateId);
 	static Object                *createObject (const CrcString &fileName);
 	static bool                   isLoaded(const std::string &fileName);
 
@@ -58,6 +60,10 @@ public:
 	static ConstCharCrcString const  lookUp(const char * string);
 	static ConstCharCrcString const  lookUp(uint32 crc);
 
+	// ids are CrcStringRegistry ids; fetching by id skips hashing and comparing the name
+	static int                       getTemplateId(const CrcString &filename);
+	static int                       getTemplateId(uint32 crc);
+
 	static void garbageCollect ();
 
 	static void getAllTemplateNamesFromCrcStringTable(std::vector<const char *> & objectTemplateNames);
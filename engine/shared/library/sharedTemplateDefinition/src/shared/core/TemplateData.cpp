@@ -2295,9 +2295,10 @@ void TemplateData::writeCompilerSourceMethods(File &fp) const
  * @param fp				the file to write to
  * @param param				the parameter to get
  * @param minMaxString		string to use for min/max getters
+ * @param resolvedSlot		if >= 0, the base value is cached in this slot of the param
  */
 void TemplateData::writeSourceReturnBaseValue(File &fp, const Parameter &param,
-	const std::string & minMaxString) const
+	const std::string & minMaxString, int resolvedSlot) const
 {
 	const char * realMinMaxString;
 	if (HasMinMax[param.type])
@@ -2364,7 +2365,13 @@ void TemplateData::writeSourceReturnBaseValue(File &fp, const Parameter &param,
 		fp.print("\t\t\tDEBUG_FATAL(base == nullptr, (\"Template parameter %s has "
 			"not been defined in template %%s!\", DataResource::getName()));\n",
 			param.name.c_str());
-		if (DefaultDataReturnValue[param.type][0] != '\0')
+		if (DefaultDataReturnValue[param.type][0] != '\0' && resolvedSlot >= 0)
+		{
+			fp.print("\t\t\treturn m_%s.storeResolvedValue(%d, randomDrawCount, "
+				"base->get%s%s(%s));\n", param.name.c_str(), resolvedSlot,
+				upperName.c_str(), realMinMaxString, indexString.c_str());
+		}
+		else if (DefaultDataReturnValue[param.type][0] != '\0')
 		{
 			fp.print("\t\t\treturn base->get%s%s(%s);\n", upperName.c_str(),
 				realMinMaxString, indexString.c_str());
@@ -2394,7 +2401,13 @@ void TemplateData::writeSourceReturnBaseValue(File &fp, const Parameter &param,
 		fp.print("\t\tint baseCount = base->get%sCount();\n",
 			upperName.c_str());
 		fp.print("\t\tif (index < baseCount)\n");
-		if (DefaultDataReturnValue[param.type][0] != '\0')
+		if (DefaultDataReturnValue[param.type][0] != '\0' && resolvedSlot >= 0)
+		{
+			fp.print("\t\t\treturn m_%s.storeResolvedValue(%d, randomDrawCount, "
+				"base->get%s%s(%s));\n", param.name.c_str(), resolvedSlot,
+				upperName.c_str(), realMinMaxString, indexString.c_str());
+		}
+		else if (DefaultDataReturnValue[param.type][0] != '\0')
 		{
 			fp.print("\t\t\treturn base->get%s%s(%s);\n", upperName.c_str(),
 				realMinMaxString, indexString.c_str());
@@ -2581,6 +2594,11 @@ void TemplateData::writeSourceGetGeneric(File &fp, const Parameter &param) const
 	std::string upperName(param.name);
 	upperName[0] = static_cast<char>(toupper(upperName[0]));
 
+	// single int and float values are resolved through the base templates
+	// once and cached on the param
+	const bool cacheResolved = param.list_type == LIST_NONE &&
+		(param.type == TYPE_INTEGER || param.type == TYPE_FLOAT);
+
 	for (int i = 0; i < 3; ++i)
 	{
 		fp.print("%s %s::get%s%s(", UnpaddedDataMethodNames[param.type],
@@ -2601,6 +2619,16 @@ void TemplateData::writeSourceGetGeneric(File &fp, const Parameter &param) const
 			fp.print("#endif\n\n");
 		}
 
+		if (cacheResolved)
+		{
+			fp.print("\t%s cachedValue;\n", UnpaddedDataMethodNames[param.type]);
+			fp.print("\tif (!testData && m_%s.getResolvedValue(%d, cachedValue))\n",
+				pname, i);
+			fp.print("\t\treturn cachedValue;\n");
+			fp.print("\tconst int randomDrawCount = TemplateParamResolution::"
+				"getRandomDrawCount();\n\n");
+		}
+
 		fp.print("\tconst %s * base = nullptr;\n", templateName);
 		fp.print("\tif (m_baseData != nullptr)\n");
 		fp.print("\t{\n");
@@ -2625,7 +2653,8 @@ void TemplateData::writeSourceGetGeneric(File &fp, const Parameter &param) const
 		const char *access = ".";
 		if (param.list_type == LIST_NONE)
 		{
-			writeSourceReturnBaseValue(fp, param, MinMaxNames[i]);
+			writeSourceReturnBaseValue(fp, param, MinMaxNames[i],
+				cacheResolved ? i : -1);
 		}
 		else
 		{
@@ -2696,7 +2725,13 @@ void TemplateData::writeSourceGetGeneric(File &fp, const Parameter &param) const
 			fp.print("#endif\n\n");
 		}
 
-		fp.print("\treturn value;\n");
+		if (cacheResolved)
+		{
+			fp.print("\treturn m_%s.storeResolvedValue(%d, randomDrawCount, value);\n",
+				pname, i);
+		}
+		else
+			fp.print("\treturn value;\n");
 		fp.print("}\t// %s::get%s%s\n", templateName, upperName.c_str(), MinMaxNames[i]);
 		fp.print("\n");
 
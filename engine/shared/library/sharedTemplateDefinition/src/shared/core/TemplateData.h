@@ -192,7 +192,7 @@ private:
 	void writeStructDefinition(File &fp) const;
 	void writeSourceStructStart(File &fp) const;
 	void writeSourceStructStart(File &fp, const std::string &name) const;
-	void writeSourceReturnBaseValue(File &fp, const Parameter &param, const std::string & minMaxString) const;
+	void writeSourceReturnBaseValue(File &fp, const Parameter &param, const std::string & minMaxString, int resolvedSlot = -1) const;
 	int  writeSourceGetData(File &fp) const;
 	void writeSourceTestData(File &fp) const;
 	void writeSourceGetGeneric(File &fp, const Parameter &param) const;
@@ -0,0 +1 @@
+#include "../../src/shared/appearance/ServerProceduralTerrainAppearance_HeightCache.h"
@@ -21,11 +21,14 @@
 #include "sharedFoundation/MemoryBlockManager.h"
 #include "sharedObject/AlterResult.h"
 #include "sharedObject/Object.h"
+#include "sharedTerrain/ConfigSharedTerrain.h"
 #include "sharedTerrain/ProceduralTerrainAppearanceTemplate.h"
 #include "sharedTerrain/ServerProceduralTerrainAppearance_Cache.h"
+#include "sharedTerrain/ServerProceduralTerrainAppearance_HeightCache.h"
 
 #include <algorithm>
 #include <cstdio>
+#include <deque>
 #include <map>
 #include <vector>
 #include <set>
@@ -61,6 +64,9 @@ namespace ServerProceduralTerrainAppearanceNamespace
 		{   1,  1,  0,  1,  0,  2 }
 	};
 
+	//-- reference objects whose surroundings are checked for pregeneration each frame
+	static const int cs_referenceObjectsPregeneratedPerFrame = 8;
+
 	static int chunkIndirectionArray [16] =
 	{
 		-1,  1,
@@ -596,7 +602,10 @@ ServerProceduralTerrainAppearance::ServerProceduralTerrainAppearance (const Proc
 	m_unusedChunkList (new ServerChunkList),
 	m_invalidateChunkList (new ChunkList),
 	m_chunksCreatedThisFrame (new ChunkSet),
-	m_sphereTree ()
+	m_sphereTree (),
+	m_heightCache (HeightCache::create (*appearanceTemplate)),
+	m_pregenerateList (new PregenerateList),
+	m_pregenerateReferenceObjectIndex (0)
 {
 	// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 	//-- to ensure that memory isn't claimed on the client for server terrain (this must be first)
@@ -636,6 +645,8 @@ ServerProceduralTerrainAppearance::~ServerProceduralTerrainAppearance ()
 	delete m_unusedChunkList;
 	delete m_invalidateChunkList;
 	delete m_chunksCreatedThisFrame;
+	delete m_heightCache;
+	delete m_pregenerateList;
 
 	DEBUG_WARNING (m_sphereTree.getObjectCount () != 0, ("ServerProceduralTerrainAppearance::m_sphereTree is not empty (%i)", m_sphereTree.getObjectCount ()));
 
@@ -664,6 +675,8 @@ float ServerProceduralTerrainAppearance::alter (float time)
 			ProceduralTerrainAppearance::createChunk (getOwner ()->rotateTranslate_w2o (object->getPosition_w ()), 1);
 	}
 
+	pregenerateChunks ();
+
 	IGNORE_RETURN (ProceduralTerrainAppearance::alter (time));
 
 	// @todo figure out what this should floatly return.
@@ -679,6 +692,84 @@ void ServerProceduralTerrainAppearance::render () const
 
 //-------------------------------------------------------------------
 
+bool ServerProceduralTerrainAppearance::getHeight (const Vector& position_o, float& height) const
+{
+	bool result;
+	if (getCachedHeight (position_o, height, 0, result))
+		return result;
+
+	return ProceduralTerrainAppearance::getHeight (position_o, height);
+}
+
+//-------------------------------------------------------------------
+
+bool ServerProceduralTerrainAppearance::getHeight (const Vector& position_o, float& height, Vector& normal) const
+{
+	bool result;
+	if (getCachedHeight (position_o, height, &normal, result))
+		return result;
+
+	return ProceduralTerrainAppearance::getHeight (position_o, height, normal);
+}
+
+//-------------------------------------------------------------------
+
+bool ServerProceduralTerrainAppearance::getHeightForceChunkCreation (const Vector& position_o, float& height) const
+{
+	bool result;
+	if (getCachedHeight (position_o, height, 0, result))
+		return result;
+
+	return ProceduralTerrainAppearance::getHeightForceChunkCreation (position_o, height);
+}
+
+//-------------------------------------------------------------------
+
+bool ServerProceduralTerrainAppearance::isPassable (const Vector& position) const
+{
+	bool passable;
+	if (getCachedPassable (position, passable))
+		return passable;
+
+	return ProceduralTerrainAppearance::isPassable (position);
+}
+
+//-------------------------------------------------------------------
+
+bool ServerProceduralTerrainAppearance::isPassableForceChunkCreation (const Vector& position) const
+{
+	bool passable;
+	if (getCachedPassable (position, passable))
+		return passable;
+
+	return ProceduralTerrainAppearance::isPassableForceChunkCreation (position);
+}
+
+//-------------------------------------------------------------------
+/**
+ * Queue the chunks covering a region to be generated a few at a time from alter.
+ *
+ * Chunks the height cache already holds are skipped when their turn comes,
+ * since pregenerating them would not spare any later height query.
+ */
+void ServerProceduralTerrainAppearance::pregenerateRegion (const Rectangle2d& extent2d)
+{
+	if (ConfigSharedTerrain::getMaximumChunksPregeneratedPerFrame () <= 0)
+		return;
+
+	const int minimumChunkX = calculateChunkX (extent2d.x0);
+	const int minimumChunkZ = calculateChunkZ (extent2d.y0);
+	const int maximumChunkX = calculateChunkX (extent2d.x1);
+	const int maximumChunkZ = calculateChunkZ (extent2d.y1);
+
+	for (int z = minimumChunkZ; z <= maximumChunkZ; ++z)
+		for (int x = minimumChunkX; x <= maximumChunkX; ++x)
+			if (areValidChunkIndices (x, z))
+				m_pregenerateList->push_back (std::make_pair (x, z));
+}
+
+//-------------------------------------------------------------------
+
 bool ServerProceduralTerrainAppearance::hasHighLevelOfDetailTerrain (const Vector& position_o) const
 {
 	return ProceduralTerrainAppearance::findChunk (position_o, 1) != 0;
@@ -817,6 +908,101 @@ void ServerProceduralTerrainAppearance::generateBetween(Vector const & start_o,
 	}
 }
 
+//===================================================================
+// PRIVATE ServerProceduralTerrainAppearance
+//===================================================================
+
+/**
+ * Answer a height query from the height cache when the chunk has not been generated.
+ *
+ * @return false if the cache cannot answer and the chunk must be consulted.
+ */
+bool ServerProceduralTerrainAppearance::getCachedHeight (const Vector& position_o, float& height, Vector* const normal, bool& result) const
+{
+	//-- generated chunks answer for themselves
+	if (!m_heightCache || ConfigSharedTerrain::getDisableGetHeight () || ProceduralTerrainAppearance::findChunk (position_o, 1))
+		return false;
+
+	const HeightCache::Lookup lookup = m_heightCache->getHeightAt (calculateChunkX (position_o.x), calculateChunkZ (position_o.z), position_o, height, normal);
+	if (lookup == HeightCache::L_notCached)
+		return false;
+
+	result = lookup == HeightCache::L_found;
+	return true;
+}
+
+//-------------------------------------------------------------------
+
+bool ServerProceduralTerrainAppearance::getCachedPassable (const Vector& position, bool& passable) const
+{
+	if (!m_heightCache || !hasPassableAffectors () || ProceduralTerrainAppearance::findChunk (position, 1))
+		return false;
+
+	return m_heightCache->isPassable (calculateChunkX (position.x), calculateChunkZ (position.z), position, passable) == HeightCache::L_found;
+}
+
+//-------------------------------------------------------------------
+/**
+ * Generate a few chunks ahead of need.
+ *
+ * The terrain generator and the chunk scratch buffers are not thread safe,
+ * so chunks are generated here on the main thread within a per frame
+ * budget rather than by worker threads.  The surroundings of reference
+ * objects are filled first, then regions queued by pregenerateRegion.
+ */
+void ServerProceduralTerrainAppearance::pregenerateChunks ()
+{
+	int budget = ConfigSharedTerrain::getMaximumChunksPregeneratedPerFrame ();
+
+	//-- don't generate chunks that removeUnnecessaryChunk would have to throw away
+	if (budget <= 0 || getNumberOfChunks () >= maximumNumberOfChunksAllowed)
+		return;
+
+	const int radius = ConfigSharedTerrain::getChunkPregenerationRadius ();
+	const int numberOfReferenceObjects = getNumberOfReferenceObjects ();
+	if (radius > 1 && numberOfReferenceObjects > 0)
+	{
+		const int numberToCheck = std::min (numberOfReferenceObjects, cs_referenceObjectsPregeneratedPerFrame);
+		for (int i = 0; i < numberToCheck && budget > 0; ++i)
+		{
+			m_pregenerateReferenceObjectIndex = (m_pregenerateReferenceObjectIndex + 1) % numberOfReferenceObjects;
+
+			const Object* const object = getReferenceObject (m_pregenerateReferenceObjectIndex);
+			if (!object->isInWorldCell ())
+				continue;
+
+			const Vector position_o = getOwner ()->rotateTranslate_w2o (object->getPosition_w ());
+			const int chunkX = calculateChunkX (position_o.x);
+			const int chunkZ = calculateChunkZ (position_o.z);
+
+			for (int z = chunkZ - radius; z <= chunkZ + radius && budget > 0; ++z)
+			{
+				for (int x = chunkX - radius; x <= chunkX + radius && budget > 0; ++x)
+				{
+					if (areValidChunkIndices (x, z) && !findChunk (x, z, 1))
+					{
+						createChunk (x, z, 1, 0);
+						--budget;
+					}
+				}
+			}
+		}
+	}
+
+	while (budget > 0 && !m_pregenerateList->empty ())
+	{
+		const int x = m_pregenerateList->front ().first;
+		const int z = m_pregenerateList->front ().second;
+		m_pregenerateList->pop_front ();
+
+		if (!findChunk (x, z, 1) && !(m_heightCache && m_heightCache->contains (x, z)))
+		{
+			createChunk (x, z, 1, 0);
+			--budget;
+		}
+	}
+}
+
 //===================================================================
 // PROTECTED ServerProceduralTerrainAppearance
 //===================================================================
@@ -897,6 +1083,9 @@ void ServerProceduralTerrainAppearance::createChunk (const int x, const int z, c
 	chunk->create (createChunkData);
 	createFlora (chunk);
 
+	if (m_heightCache)
+		chunk->recordHeights (*m_heightCache);
+
 	addChunk (chunk, chunkSize);
 
 }  //lint !e429  //-- chunk has not been freed or returned
@@ -924,6 +1113,15 @@ void ServerProceduralTerrainAppearance::ServerChunk::writeChunkData (const char*
 
 //-------------------------------------------------------------------
 
+void ServerProceduralTerrainAppearance::ServerChunk::recordHeights (HeightCache& heightCache) const
+{
+	NOT_NULL (m_vertexList);
+
+	heightCache.record (chunkX, chunkZ, *m_vertexList, m_passable, m_excluded);
+}
+
+//-------------------------------------------------------------------
+
 void ServerProceduralTerrainAppearance::writeChunkData (int chunkX, int chunkZ) const
 {
 	//-- create chunk
@@ -955,6 +1153,9 @@ int ServerProceduralTerrainAppearance::getTerrainType (const Vector& position_o)
 
 void ServerProceduralTerrainAppearance::invalidateRegion (const Rectangle2d& extent2d)
 {
+	if (m_heightCache)
+		m_heightCache->invalidateChunks (calculateChunkX (extent2d.x0), calculateChunkZ (extent2d.y0), calculateChunkX (extent2d.x1), calculateChunkZ (extent2d.y1));
+
 	m_invalidateChunkList->clear ();
 
 	//-- figure out which chunks we need to invalidate
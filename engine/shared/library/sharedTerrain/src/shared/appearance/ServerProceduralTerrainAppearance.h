@@ -16,6 +16,9 @@
 #include "sharedMath/SphereTree.h"
 #include "sharedTerrain/ProceduralTerrainAppearance.h"
 
+#include <deque>
+#include <utility>
+
 class Plane;
 class MemoryBlockManager;
 
@@ -25,6 +28,8 @@ class ServerProceduralTerrainAppearance : public ProceduralTerrainAppearance
 {
 public:
 
+	class HeightCache;
+
 	//- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 	//
 	// Chunk defines a chunk of terrain in the terrain system
@@ -77,6 +82,7 @@ public:
 		void             create (const ProceduralTerrainAppearance::CreateChunkData& newCreateChunkData);
 
 		void             writeChunkData (const char* filename) const;
+		void             recordHeights (HeightCache& heightCache) const;
 	};
 
 	//- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -92,9 +98,15 @@ public:
 
 	virtual float alter (float time);
 	virtual void  render () const;
+	virtual bool  getHeight (const Vector& position_o, float& height) const;
+	virtual bool  getHeight (const Vector& position_o, float& height, Vector& normal) const;
+	virtual bool  getHeightForceChunkCreation (const Vector& position_o, float& height) const;
+	virtual bool  isPassable (const Vector& position) const;
+	virtual bool  isPassableForceChunkCreation (const Vector& position) const;
 	virtual void  writeChunkData (int chunkX, int chunkZ) const;
 	virtual int   getTerrainType (const Vector& position_o) const;
 	virtual void  invalidateRegion (const Rectangle2d& extent2d);
+	virtual void  pregenerateRegion (const Rectangle2d& extent2d);
 	virtual bool collide(Vector const & start_o, Vector const & end_o, CollideParameters const & collideParameters, CollisionInfo & result) const;
 	virtual bool  collideForceChunkCreation (Vector const & start_o, Vector const & end_o, CollisionInfo & result);
 	virtual int   getNumberOfChunks () const;
@@ -107,6 +119,7 @@ protected:
 	typedef std::vector<Chunk const *> ChunkList;
 	typedef std::vector<ServerChunk const *> ServerChunkList;
 	typedef std::set<uint32> ChunkSet;
+	typedef std::deque<std::pair<int, int> > PregenerateList;
 
 protected:
 	
@@ -137,6 +150,12 @@ private:
 
 	class CollisionChunkSorter;
 
+private:
+
+	bool getCachedHeight (const Vector& position_o, float& height, Vector* normal, bool& result) const;
+	bool getCachedPassable (const Vector& position, bool& passable) const;
+	void pregenerateChunks ();
+
 private:
 
 	ServerProceduralTerrainAppearance ();
@@ -154,6 +173,10 @@ private:
 	ChunkSet*  const m_chunksCreatedThisFrame;
 
 	SphereTree<Chunk const *, ChunkSphereExtentAccessor> m_sphereTree;
+
+	HeightCache* const     m_heightCache;
+	PregenerateList* const m_pregenerateList;
+	int                    m_pregenerateReferenceObjectIndex;
 }; 
 
 //===================================================================
@@ -0,0 +1,411 @@
+//==================================================================
+//
+// ServerProceduralTerrainAppearance_HeightCache.cpp
+//
+// copyright 2002, sony online entertainment
+//
+//==================================================================
+
+#include "sharedTerrain/FirstSharedTerrain.h"
+#include "sharedTerrain/ServerProceduralTerrainAppearance_HeightCache.h"
+
+#include "sharedFile/MemoryMappedFile.h"
+#include "sharedFile/TreeFile.h"
+#include "sharedFoundation/Crc.h"
+#include "sharedFoundation/CrcLowerString.h"
+#include "sharedFoundation/Os.h"
+#include "sharedTerrain/ConfigSharedTerrain.h"
+#include "sharedTerrain/ProceduralTerrainAppearanceTemplate.h"
+
+#include <algorithm>
+#include <cstdio>
+
+//==================================================================
+
+namespace ServerProceduralTerrainAppearanceHeightCacheNamespace
+{
+	const uint32 cs_magic   = 0x48474854; // 'HGHT'
+	const uint32 cs_version = 1;
+}
+
+using namespace ServerProceduralTerrainAppearanceHeightCacheNamespace;
+
+//==================================================================
+// PUBLIC STATIC ServerProceduralTerrainAppearance::HeightCache
+//==================================================================
+
+/**
+ * Create the height cache for a terrain.
+ *
+ * @return nullptr if SharedTerrain/heightCacheDirectory is not set or the
+ *         terrain file could not be read.
+ */
+ServerProceduralTerrainAppearance::HeightCache* ServerProceduralTerrainAppearance::HeightCache::create (const ProceduralTerrainAppearanceTemplate& appearanceTemplate)
+{
+	const char* const directory = ConfigSharedTerrain::getHeightCacheDirectory ();
+	if (!directory || !*directory)
+		return 0;
+
+	const char* const terrainFileName = appearanceTemplate.getCrcName ().getString ();
+
+	AbstractFile* const terrainFile = TreeFile::open (terrainFileName, AbstractFile::PriorityData, true);
+	if (!terrainFile)
+	{
+		WARNING (true, ("HeightCache: could not open %s, terrain heights will not be cached", terrainFileName));
+		return 0;
+	}
+
+	const int terrainLength = terrainFile->length ();
+	byte* const terrainData = terrainFile->readEntireFileAndClose ();
+	const uint32 terrainCrc = Crc::calculate (terrainData, terrainLength);
+	delete [] terrainData;
+	delete terrainFile;
+
+	//-- terrain/tatooine.trn is cached in <directory>/terrain_tatooine.trn.heights
+	std::string fileName (directory);
+	fileName += '/';
+	for (const char* c = terrainFileName; *c; ++c)
+		fileName += (*c == '/' || *c == '\\' || *c == ':') ? '_' : *c;
+	fileName += ".heights";
+
+	HeightCache* const heightCache = new HeightCache (fileName, terrainCrc, static_cast<uint32> (terrainLength), appearanceTemplate.getNumberOfTilesPerChunk (), appearanceTemplate.getChunkWidthInMeters ());
+	IGNORE_RETURN (heightCache->open ());
+
+	return heightCache;
+}
+
+//==================================================================
+// PUBLIC ServerProceduralTerrainAppearance::HeightCache
+//==================================================================
+
+ServerProceduralTerrainAppearance::HeightCache::HeightCache (const std::string& fileName, const uint32 terrainCrc, const uint32 terrainLength, const int numberOfTilesPerChunk, const float chunkWidthInMeters) :
+	m_fileName (fileName),
+	m_terrainCrc (terrainCrc),
+	m_terrainLength (terrainLength),
+	m_numberOfTilesPerChunk (numberOfTilesPerChunk),
+	m_polesPerSide (numberOfTilesPerChunk * 2 + 1),
+	m_chunkWidthInMeters (chunkWidthInMeters),
+	m_file (0),
+	m_entries (0),
+	m_heights (0),
+	m_entryCount (0),
+	m_recordedChunks (),
+	m_modifiedChunks ()
+{
+}
+
+//-------------------------------------------------------------------
+
+ServerProceduralTerrainAppearance::HeightCache::~HeightCache ()
+{
+	save ();
+
+	delete m_file;
+	m_file = 0;
+	m_entries = 0;
+	m_heights = 0;
+}
+
+//-------------------------------------------------------------------
+
+bool ServerProceduralTerrainAppearance::HeightCache::contains (const int chunkX, const int chunkZ) const
+{
+	const Entry* entry = 0;
+	const float* heights = 0;
+	return find (chunkX, chunkZ, entry, heights);
+}
+
+//-------------------------------------------------------------------
+
+ServerProceduralTerrainAppearance::HeightCache::Lookup ServerProceduralTerrainAppearance::HeightCache::getHeightAt (const int chunkX, const int chunkZ, const Vector& position_o, float& height, Vector* const normal) const
+{
+	const Entry* entry = 0;
+	const float* heights = 0;
+	if (!find (chunkX, chunkZ, entry, heights))
+		return L_notCached;
+
+	int tileX;
+	int tileZ;
+	findTile (chunkX, chunkZ, position_o, tileX, tileZ);
+	if (entry->m_excluded & (1 << (tileZ * m_numberOfTilesPerChunk + tileX)))
+		return L_excluded;
+
+	//-- the position relative to the tile's center pole, in poles
+	const float distanceBetweenPoles = m_chunkWidthInMeters / static_cast<float> (m_numberOfTilesPerChunk * 2);
+	const int   centerX = tileX * 2 + 1;
+	const int   centerZ = tileZ * 2 + 1;
+	const float dx = clamp (-1.f, (position_o.x - static_cast<float> (chunkX) * m_chunkWidthInMeters) / distanceBetweenPoles - static_cast<float> (centerX), 1.f);
+	const float dz = clamp (-1.f, (position_o.z - static_cast<float> (chunkZ) * m_chunkWidthInMeters) / distanceBetweenPoles - static_cast<float> (centerZ), 1.f);
+	const int   stepX = dx < 0.f ? -1 : 1;
+	const int   stepZ = dz < 0.f ? -1 : 1;
+	const float ax = fabsf (dx);
+	const float az = fabsf (dz);
+
+	//-- a tile is a fan of 8 triangles around its center pole.  the triangle
+	//-- under the position joins the center, the middle of the nearer edge and
+	//-- the corner between them, matching ServerChunk's plane list
+	const bool  alongX = ax >= az;
+	const int   edgeX  = alongX ? centerX + stepX : centerX;
+	const int   edgeZ  = alongX ? centerZ : centerZ + stepZ;
+	const float center = heights [centerZ * m_polesPerSide + centerX];
+	const float edge   = heights [edgeZ * m_polesPerSide + edgeX];
+	const float corner = heights [(centerZ + stepZ) * m_polesPerSide + centerX + stepX];
+
+	const float major = alongX ? ax : az;
+	const float minor = alongX ? az : ax;
+	height = center + major * (edge - center) + minor * (corner - edge);
+
+	if (normal)
+	{
+		const Vector toEdge (static_cast<float> (edgeX - centerX) * distanceBetweenPoles, edge - center, static_cast<float> (edgeZ - centerZ) * distanceBetweenPoles);
+		const Vector toCorner (static_cast<float> (stepX) * distanceBetweenPoles, corner - center, static_cast<float> (stepZ) * distanceBetweenPoles);
+
+		Vector result = toEdge.cross (toCorner);
+		if (result.y < 0.f)
+			result = -result;
+
+		IGNORE_RETURN (result.normalize ());
+		*normal = result;
+	}
+
+	return L_found;
+}
+
+//-------------------------------------------------------------------
+
+ServerProceduralTerrainAppearance::HeightCache::Lookup ServerProceduralTerrainAppearance::HeightCache::isPassable (const int chunkX, const int chunkZ, const Vector& position_o, bool& passable) const
+{
+	const Entry* entry = 0;
+	const float* heights = 0;
+	if (!find (chunkX, chunkZ, entry, heights))
+		return L_notCached;
+
+	int tileX;
+	int tileZ;
+	findTile (chunkX, chunkZ, position_o, tileX, tileZ);
+	passable = (entry->m_passable & (1 << (tileZ * m_numberOfTilesPerChunk + tileX))) != 0;
+
+	return L_found;
+}
+
+//-------------------------------------------------------------------
+
+void ServerProceduralTerrainAppearance::HeightCache::record (const int chunkX, const int chunkZ, const ArrayList<Vector>& vertexList, const unsigned passable, const unsigned excluded)
+{
+	const ChunkIndex chunkIndex (chunkX, chunkZ);
+	if (m_modifiedChunks.find (chunkIndex) != m_modifiedChunks.end ())
+		return;
+
+	const Entry* entry = 0;
+	const float* heights = 0;
+	if (find (chunkX, chunkZ, entry, heights))
+		return;
+
+	const int numberOfHeights = sqr (m_polesPerSide);
+	DEBUG_FATAL (vertexList.getNumberOfElements () != numberOfHeights, ("HeightCache: chunk has %i poles, expected %i", vertexList.getNumberOfElements (), numberOfHeights));
+
+	RecordedChunk& recordedChunk = m_recordedChunks [chunkIndex];
+	recordedChunk.m_entry.m_chunkX   = chunkX;
+	recordedChunk.m_entry.m_chunkZ   = chunkZ;
+	recordedChunk.m_entry.m_passable = passable;
+	recordedChunk.m_entry.m_excluded = excluded;
+
+	recordedChunk.m_heights.reserve (static_cast<size_t> (numberOfHeights));
+	for (int i = 0; i < numberOfHeights; ++i)
+		recordedChunk.m_heights.push_back (vertexList [i].y);
+}
+
+//-------------------------------------------------------------------
+
+void ServerProceduralTerrainAppearance::HeightCache::invalidateChunks (const int minimumChunkX, const int minimumChunkZ, const int maximumChunkX, const int maximumChunkZ)
+{
+	//-- chunks recorded before the modification keep their unmodified heights,
+	//-- which is what the terrain file generates, so they are still saved
+	for (int z = minimumChunkZ; z <= maximumChunkZ; ++z)
+		for (int x = minimumChunkX; x <= maximumChunkX; ++x)
+			IGNORE_RETURN (m_modifiedChunks.insert (ChunkIndex (x, z)));
+}
+
+//==================================================================
+// PRIVATE ServerProceduralTerrainAppearance::HeightCache
+//==================================================================
+
+bool ServerProceduralTerrainAppearance::HeightCache::isEntryBefore (const Entry& entry, const ChunkIndex& chunkIndex)
+{
+	return entry.m_chunkX < chunkIndex.first || (entry.m_chunkX == chunkIndex.first && entry.m_chunkZ < chunkIndex.second);
+}
+
+//-------------------------------------------------------------------
+
+bool ServerProceduralTerrainAppearance::HeightCache::open ()
+{
+	m_file = MemoryMappedFile::open (m_fileName.c_str ());
+	if (!m_file)
+		return false;
+
+	const byte* const data = m_file->getData ();
+	const size_t length = static_cast<size_t> (m_file->length ());
+	const Header* const header = reinterpret_cast<const Header*> (data);
+	const size_t bytesPerEntry = sizeof (Entry) + sizeof (float) * static_cast<size_t> (sqr (m_polesPerSide));
+
+	bool valid =
+		length >= sizeof (Header) &&
+		header->m_magic == cs_magic &&
+		header->m_version == cs_version &&
+		header->m_terrainCrc == m_terrainCrc &&
+		header->m_terrainLength == m_terrainLength &&
+		header->m_numberOfTilesPerChunk == m_numberOfTilesPerChunk &&
+		header->m_chunkWidthInMeters == m_chunkWidthInMeters;
+
+	if (valid)
+		valid = (length - sizeof (Header)) / bytesPerEntry == header->m_entryCount && (length - sizeof (Header)) % bytesPerEntry == 0;
+
+	if (!valid)
+	{
+		REPORT_LOG_PRINT (true, ("HeightCache: ignoring %s, it was not written for this version of the terrain\n", m_fileName.c_str ()));
+
+		delete m_file;
+		m_file = 0;
+		return false;
+	}
+
+	m_entryCount = header->m_entryCount;
+	m_entries    = reinterpret_cast<const Entry*> (data + sizeof (Header));
+	m_heights    = reinterpret_cast<const float*> (m_entries + m_entryCount);
+
+	REPORT_LOG_PRINT (true, ("HeightCache: %s holds %u chunks\n", m_fileName.c_str (), m_entryCount));
+
+	return true;
+}
+
+//-------------------------------------------------------------------
+/**
+ * Merge the chunks recorded by this process into the cache file.
+ *
+ * The file is written under a name private to this process and renamed
+ * into place, so other servers never map a partially written cache.
+ */
+void ServerProceduralTerrainAppearance::HeightCache::save ()
+{
+	if (m_recordedChunks.empty ())
+		return;
+
+	const int numberOfHeights = sqr (m_polesPerSide);
+
+	char temporaryFileName [Os::MAX_PATH_LENGTH];
+	IGNORE_RETURN (snprintf (temporaryFileName, sizeof (temporaryFileName), "%s.%d", m_fileName.c_str (), static_cast<int> (Os::getProcessId ())));
+
+	FILE* const file = fopen (temporaryFileName, "wb");
+	if (!file)
+	{
+		WARNING (true, ("HeightCache: could not write %s", temporaryFileName));
+		return;
+	}
+
+	Header header;
+	header.m_magic                 = cs_magic;
+	header.m_version               = cs_version;
+	header.m_terrainCrc            = m_terrainCrc;
+	header.m_terrainLength         = m_terrainLength;
+	header.m_numberOfTilesPerChunk = m_numberOfTilesPerChunk;
+	header.m_chunkWidthInMeters    = m_chunkWidthInMeters;
+	header.m_entryCount            = m_entryCount + static_cast<uint32> (m_recordedChunks.size ());
+
+	//-- both lists are sorted by chunk index and never share a chunk, so merge them in order
+	typedef std::vector<std::pair<const Entry*, const float*> > ChunkList;
+	ChunkList chunks;
+	chunks.reserve (header.m_entryCount);
+	{
+		uint32 i = 0;
+		RecordedChunkMap::const_iterator iter = m_recordedChunks.begin ();
+		while (i < m_entryCount || iter != m_recordedChunks.end ())
+		{
+			if (iter == m_recordedChunks.end () || (i < m_entryCount && isEntryBefore (m_entries [i], iter->first)))
+			{
+				chunks.push_back (std::make_pair (m_entries + i, m_heights + i * numberOfHeights));
+				++i;
+			}
+			else
+			{
+				chunks.push_back (std::make_pair (&iter->second.m_entry, &iter->second.m_heights [0]));
+				++iter;
+			}
+		}
+	}
+
+	bool written = fwrite (&header, sizeof (header), 1, file) == 1;
+
+	for (ChunkList::const_iterator iter = chunks.begin (); written && iter != chunks.end (); ++iter)
+		written = fwrite (iter->first, sizeof (Entry), 1, file) == 1;
+
+	for (ChunkList::const_iterator iter = chunks.begin (); written && iter != chunks.end (); ++iter)
+		written = fwrite (iter->second, sizeof (float), static_cast<size_t> (numberOfHeights), file) == static_cast<size_t> (numberOfHeights);
+
+	IGNORE_RETURN (fclose (file));
+
+	//-- the old mapping must be released before the file can be replaced on win32
+	delete m_file;
+	m_file = 0;
+	m_entries = 0;
+	m_heights = 0;
+	m_entryCount = 0;
+
+	if (written && rename (temporaryFileName, m_fileName.c_str ()) != 0)
+	{
+		IGNORE_RETURN (::remove (m_fileName.c_str ()));
+		written = rename (temporaryFileName, m_fileName.c_str ()) == 0;
+	}
+
+	if (!written)
+	{
+		WARNING (true, ("HeightCache: could not write %s", m_fileName.c_str ()));
+		IGNORE_RETURN (::remove (temporaryFileName));
+		return;
+	}
+
+	REPORT_LOG_PRINT (true, ("HeightCache: wrote %u chunks (%i new) to %s\n", header.m_entryCount, static_cast<int> (m_recordedChunks.size ()), m_fileName.c_str ()));
+	m_recordedChunks.clear ();
+}
+
+//-------------------------------------------------------------------
+
+bool ServerProceduralTerrainAppearance::HeightCache::find (const int chunkX, const int chunkZ, const Entry*& entry, const float*& heights) const
+{
+	const ChunkIndex chunkIndex (chunkX, chunkZ);
+	if (m_modifiedChunks.find (chunkIndex) != m_modifiedChunks.end ())
+		return false;
+
+	if (m_entryCount)
+	{
+		const Entry* const end = m_entries + m_entryCount;
+		const Entry* const result = std::lower_bound (m_entries, end, chunkIndex, isEntryBefore);
+		if (result != end && result->m_chunkX == chunkX && result->m_chunkZ == chunkZ)
+		{
+			entry   = result;
+			heights = m_heights + (result - m_entries) * sqr (m_polesPerSide);
+			return true;
+		}
+	}
+
+	const RecordedChunkMap::const_iterator iter = m_recordedChunks.find (chunkIndex);
+	if (iter != m_recordedChunks.end ())
+	{
+		entry   = &iter->second.m_entry;
+		heights = &iter->second.m_heights [0];
+		return true;
+	}
+
+	return false;
+}
+
+//-------------------------------------------------------------------
+
+void ServerProceduralTerrainAppearance::HeightCache::findTile (const int chunkX, const int chunkZ, const Vector& position_o, int& tileX, int& tileZ) const
+{
+	const float tileWidthInMeters = m_chunkWidthInMeters / static_cast<float> (m_numberOfTilesPerChunk);
+
+	tileX = clamp (0, static_cast<int> ((position_o.x - static_cast<float> (chunkX) * m_chunkWidthInMeters) / tileWidthInMeters), m_numberOfTilesPerChunk - 1);
+	tileZ = clamp (0, static_cast<int> ((position_o.z - static_cast<float> (chunkZ) * m_chunkWidthInMeters) / tileWidthInMeters), m_numberOfTilesPerChunk - 1);
+}
+
+//==================================================================
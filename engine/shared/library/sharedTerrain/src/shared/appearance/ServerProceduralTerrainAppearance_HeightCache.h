@@ -0,0 +1,140 @@
+//==================================================================
+//
+// ServerProceduralTerrainAppearance_HeightCache.h
+//
+// copyright 2002, sony online entertainment
+//
+//==================================================================
+
+#ifndef INCLUDED_ServerProceduralTerrainAppearance_HeightCache_H
+#define INCLUDED_ServerProceduralTerrainAppearance_HeightCache_H
+
+//==================================================================
+
+#include "sharedTerrain/ServerProceduralTerrainAppearance.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+class MemoryMappedFile;
+class ProceduralTerrainAppearanceTemplate;
+
+//==================================================================
+
+/**
+ * The heights and passability of generated server chunks, kept on disk so
+ * that a later server for the same terrain can answer height and
+ * passability queries without running the terrain generator.
+ *
+ * The file is named after the terrain and stamped with the crc and length
+ * of the terrain file; a file stamped for a different version of the
+ * terrain is ignored and replaced.  Chunks generated by this process are
+ * merged into the file when the appearance is destroyed.
+ *
+ * Chunks passed to invalidateChunks are neither answered from nor written
+ * to the cache, because their heights depend on the objects modifying the
+ * terrain rather than on the terrain file.
+ *
+ * File layout (native byte order):
+ *   Header
+ *   Entry[entryCount], sorted by (chunkX, chunkZ)
+ *   float heights[entryCount][polesPerSide * polesPerSide]
+ */
+class ServerProceduralTerrainAppearance::HeightCache
+{
+public:
+
+	enum Lookup
+	{
+		L_notCached,
+		L_excluded,
+		L_found
+	};
+
+public:
+
+	static HeightCache* create (const ProceduralTerrainAppearanceTemplate& appearanceTemplate);
+
+public:
+
+	~HeightCache ();
+
+	bool               contains (int chunkX, int chunkZ) const;
+	Lookup             getHeightAt (int chunkX, int chunkZ, const Vector& position_o, float& height, Vector* normal) const;
+	Lookup             isPassable (int chunkX, int chunkZ, const Vector& position_o, bool& passable) const;
+
+	void               record (int chunkX, int chunkZ, const ArrayList<Vector>& vertexList, unsigned passable, unsigned excluded);
+	void               invalidateChunks (int minimumChunkX, int minimumChunkZ, int maximumChunkX, int maximumChunkZ);
+
+private:
+
+	struct Header
+	{
+		uint32 m_magic;
+		uint32 m_version;
+		uint32 m_terrainCrc;
+		uint32 m_terrainLength;
+		int32  m_numberOfTilesPerChunk;
+		float  m_chunkWidthInMeters;
+		uint32 m_entryCount;
+	};
+
+	struct Entry
+	{
+		int32  m_chunkX;
+		int32  m_chunkZ;
+		uint32 m_passable;
+		uint32 m_excluded;
+	};
+
+	struct RecordedChunk
+	{
+		Entry              m_entry;
+		std::vector<float> m_heights;
+	};
+
+	typedef std::pair<int, int>                  ChunkIndex;
+	typedef std::set<ChunkIndex>                 ChunkIndexSet;
+	typedef std::map<ChunkIndex, RecordedChunk>  RecordedChunkMap;
+
+private:
+
+	HeightCache (const std::string& fileName, uint32 terrainCrc, uint32 terrainLength, int numberOfTilesPerChunk, float chunkWidthInMeters);
+
+	static bool        isEntryBefore (const Entry& entry, const ChunkIndex& chunkIndex);
+
+	bool               open ();
+	void               save ();
+	bool               find (int chunkX, int chunkZ, const Entry*& entry, const float*& heights) const;
+	void               findTile (int chunkX, int chunkZ, const Vector& position_o, int& tileX, int& tileZ) const;
+
+private:
+
+	HeightCache ();
+	HeightCache (const HeightCache&);
+	HeightCache& operator= (const HeightCache&);
+
+private:
+
+	const std::string  m_fileName;
+	const uint32       m_terrainCrc;
+	const uint32       m_terrainLength;
+	const int          m_numberOfTilesPerChunk;
+	const int          m_polesPerSide;
+	const float        m_chunkWidthInMeters;
+
+	MemoryMappedFile*  m_file;
+	const Entry*       m_entries;
+	const float*       m_heights;
+	uint32             m_entryCount;
+
+	RecordedChunkMap   m_recordedChunks;
+	ChunkIndexSet      m_modifiedChunks;
+};
+
+//==================================================================
+
+#endif
@@ -379,6 +379,12 @@ void TerrainAppearance::invalidateRegion (const Rectangle2d& /*extent2d*/)
 
 //-------------------------------------------------------------------
 
+void TerrainAppearance::pregenerateRegion (const Rectangle2d& /*extent2d*/)
+{
+}
+
+//-------------------------------------------------------------------
+
 void TerrainAppearance::addReferenceObject (const Object* const object)
 {
 	m_referenceObjectList->addObject (const_cast<Object*> (object));
@@ -94,6 +94,7 @@ public:
 	virtual void                  getPolygonSoup (const Rectangle2d& extent2d_o, IndexedTriangleList& indexedTriangleList) const;
 
 	virtual void                  invalidateRegion (const Rectangle2d& extent2d);
+	virtual void                  pregenerateRegion (const Rectangle2d& extent2d);
 
 	void                          addReferenceObject (const Object* object);
 	int                           getNumberOfReferenceObjects () const;
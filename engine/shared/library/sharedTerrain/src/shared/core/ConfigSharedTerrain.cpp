@@ -20,6 +20,9 @@ namespace
 	bool ms_debugReportLogPrint;
 	bool ms_disableFloraCaching;
 	float ms_maximumValidHeightInMeters;
+	const char* ms_heightCacheDirectory;
+	int  ms_chunkPregenerationRadius;
+	int  ms_maximumChunksPregeneratedPerFrame;
 }
 
 //===================================================================
@@ -64,12 +67,33 @@ float ConfigSharedTerrain::getMaximumValidHeightInMeters ()
 	return ms_maximumValidHeightInMeters;
 }
 
+//-------------------------------------------------------------------
+
+const char* ConfigSharedTerrain::getHeightCacheDirectory ()
+{
+	return ms_heightCacheDirectory;
+}
+
+//-------------------------------------------------------------------
+
+int ConfigSharedTerrain::getChunkPregenerationRadius ()
+{
+	return ms_chunkPregenerationRadius;
+}
+
+//-------------------------------------------------------------------
+
+int ConfigSharedTerrain::getMaximumChunksPregeneratedPerFrame ()
+{
+	return ms_maximumChunksPregeneratedPerFrame;
+}
+
 //===================================================================
 
 #define KEY_BOOL(a,b) (ms_ ## a = ConfigFile::getKeyBool ("SharedTerrain", #a, b))
 #define KEY_INT(a,b) (ms_ ## a = ConfigFile::getKeyInt ("SharedTerrain", #a, b))
 #define KEY_FLOAT(a,b) (ms_ ## a = ConfigFile::getKeyFloat ("SharedTerrain", #a, b))
-//#define KEY_STRING (a,b) (ms_ ## a = ConfigFile::getKeyString ("SharedTerrain", #a, b))
+#define KEY_STRING(a,b) (ms_ ## a = ConfigFile::getKeyString ("SharedTerrain", #a, b))
 
 //===================================================================
 
@@ -81,6 +105,9 @@ void ConfigSharedTerrain::install ()
 	KEY_BOOL (debugReportLogPrint, false);
 	KEY_BOOL (disableFloraCaching, false);
 	KEY_FLOAT (maximumValidHeightInMeters, 16000.0f);
+	KEY_STRING (heightCacheDirectory, "");
+	KEY_INT (chunkPregenerationRadius, 0);
+	KEY_INT (maximumChunksPregeneratedPerFrame, 4);
 
 	DEBUG_REPORT_LOG_PRINT (ms_debugReportInstall, ("ConfigSharedTerrain::install\n"));
 }
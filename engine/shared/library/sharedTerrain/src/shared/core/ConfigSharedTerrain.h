@@ -24,6 +24,10 @@ public:
 
 	static float getMaximumValidHeightInMeters ();
 
+	static const char* getHeightCacheDirectory ();
+	static int  getChunkPregenerationRadius ();
+	static int  getMaximumChunksPregeneratedPerFrame ();
+
 private:
 
 	ConfigSharedTerrain ();
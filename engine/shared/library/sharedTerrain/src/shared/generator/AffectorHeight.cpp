@@ -15,6 +15,13 @@
 #include "sharedFractal/MultiFractalReaderWriter.h"
 #include "sharedTerrain/Affector.h"
 
+#include <malloc.h>
+
+#if defined(PLATFORM_LINUX)
+#include <alloca.h>
+#define _alloca alloca
+#endif
+
 //-------------------------------------------------------------------
 //
 // AffectorHeightConstant
@@ -266,6 +273,77 @@ void AffectorHeightFractal::affect (const float worldX, const float worldZ, cons
 
 //-------------------------------------------------------------------
 
+void AffectorHeightFractal::affectRow (const float* const worldX, const float worldZ, const int z, const float* const amount, const int numberOfPoles, const TerrainGenerator::GeneratorChunkData& generatorChunkData) const
+{
+	//-- gather the poles this affector changes
+	int*   const poleX       = static_cast<int*> (_alloca (numberOfPoles * sizeof (int)));
+	float* const poleWorldX  = static_cast<float*> (_alloca (numberOfPoles * sizeof (float)));
+	float* const poleAmount  = static_cast<float*> (_alloca (numberOfPoles * sizeof (float)));
+	float* const poleHeight  = static_cast<float*> (_alloca (numberOfPoles * sizeof (float)));
+	float* const poleFractal = static_cast<float*> (_alloca (numberOfPoles * sizeof (float)));
+
+	int numberOfAffectedPoles = 0;
+	for (int x = 0; x < numberOfPoles; ++x)
+	{
+		if (amount [x] > 0.f)
+		{
+			poleX [numberOfAffectedPoles]      = x;
+			poleWorldX [numberOfAffectedPoles] = worldX [x];
+			poleAmount [numberOfAffectedPoles] = amount [x];
+			poleHeight [numberOfAffectedPoles] = generatorChunkData.heightMap->getData (x, z);
+			++numberOfAffectedPoles;
+		}
+	}
+
+	if (numberOfAffectedPoles == 0)
+		return;
+
+	if (m_cachedFamilyId != m_familyId)
+	{
+		m_cachedFamilyId = m_familyId;
+		m_multiFractal   = generatorChunkData.fractalGroup->getFamilyMultiFractal (m_familyId);
+	}
+
+	NOT_NULL (m_multiFractal);
+
+	m_multiFractal->getValueCacheRow (numberOfAffectedPoles, poleWorldX, poleX, worldZ, z, poleFractal);
+
+	//-- blend, one loop per operation so each loop is straight-line arithmetic
+	int i;
+	switch (m_operation)
+	{
+	case TGO_add:
+		for (i = 0; i < numberOfAffectedPoles; ++i)
+			poleHeight [i] += poleAmount [i] * (m_scaleY * poleFractal [i]);
+		break;
+
+	case TGO_subtract:
+		for (i = 0; i < numberOfAffectedPoles; ++i)
+			poleHeight [i] -= poleAmount [i] * (m_scaleY * poleFractal [i]);
+		break;
+
+	case TGO_multiply:
+		for (i = 0; i < numberOfAffectedPoles; ++i)
+			poleHeight [i] = linearInterpolate (poleHeight [i], poleHeight [i] * (m_scaleY * poleFractal [i]), poleAmount [i]);
+		break;
+
+	case TGO_replace:
+	default:
+		for (i = 0; i < numberOfAffectedPoles; ++i)
+			poleHeight [i] = linearInterpolate (poleHeight [i], m_scaleY * poleFractal [i], poleAmount [i]);
+		break;
+
+	case TGO_COUNT:
+		FATAL (true, ("invalid operation"));
+		break;
+	}
+
+	for (i = 0; i < numberOfAffectedPoles; ++i)
+		generatorChunkData.heightMap->setData (poleX [i], z, poleHeight [i]);
+}
+
+//-------------------------------------------------------------------
+
 bool AffectorHeightFractal::affectsHeight () const
 {
 	return true;
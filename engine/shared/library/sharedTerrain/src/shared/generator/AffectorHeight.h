@@ -98,6 +98,7 @@ public:
 	virtual ~AffectorHeightFractal ();
 
 	virtual void              affect (float worldX, float worldZ, int x, int z, float amount, const TerrainGenerator::GeneratorChunkData& generatorChunkData) const;
+	virtual void              affectRow (const float* worldX, float worldZ, int z, const float* amount, int numberOfPoles, const TerrainGenerator::GeneratorChunkData& generatorChunkData) const;
 	virtual bool              affectsHeight () const;
 	virtual void              load (Iff& iff, FractalGroup& fractalGroup);
 	virtual void              save (Iff& iff) const;
@@ -516,6 +516,19 @@ float TerrainGenerator::Affector::isWithin (float worldX, float worldZ) const
 	return 0.0f;
 }
 
+//-------------------------------------------------------------------
+
+void TerrainGenerator::Affector::affectRow (const float *worldX, const float worldZ, const int z, const float *amount, const int numberOfPoles, const GeneratorChunkData& generatorChunkData) const
+{
+	for (int x = 0; x < numberOfPoles; x++)
+	{
+		if (amount[x] >= 0.f)
+		{
+			affect (worldX[x], worldZ, x, z, amount[x], generatorChunkData);
+		}
+	}
+}
+
 //-------------------------------------------------------------------
 //
 // TerrainGenerator::Layer::ProfileData
@@ -1099,6 +1112,21 @@ void TerrainGenerator::Layer::affect (const float * previousAmountMap, const Gen
 
 		const bool invertBoundaries=m_invertBoundaries;
 		const float distanceBetweenPoles = generatorChunkData.distanceBetweenPoles;
+
+		float *const worldXRow = (float *)_alloca(numberOfPoles*sizeof(*worldXRow));
+		for (int x = 0; x < numberOfPoles; x++)
+		{
+			worldXRow[x] = generatorChunkData.start.x + static_cast<float>(x)*distanceBetweenPoles;
+		}
+
+		//-- affectors are run over a whole row at a time (see Affector::affectRow), except in legacy mode
+		//-- where they draw from one random generator and must be run in point order to draw the same numbers
+		float *affectorAmountRow=0;
+		if (m_hasUnprunedAffectors && !generatorChunkData.isLegacyMode())
+		{
+			affectorAmountRow=(float *)_alloca(numberOfPoles*sizeof(*affectorAmountRow));
+		}
+
 		for (int z = 0; z < numberOfPoles; z++)
 		{
 			const int rowIndex = z * numberOfPoles;
@@ -1106,11 +1134,18 @@ void TerrainGenerator::Layer::affect (const float * previousAmountMap, const Gen
 			const float worldZ = generatorChunkData.start.z + static_cast<float>(z)*distanceBetweenPoles;
 			const float *previousAmountRow = previousAmountMap + rowIndex;
 
+			bool rowIsAffected = false;
+
 			for (int x = 0; x < numberOfPoles; x++)
 			{
-				const float worldX         = generatorChunkData.start.x + static_cast<float>(x)*distanceBetweenPoles;
+				const float worldX         = worldXRow[x];
 				const float previousAmount = previousAmountRow[x];
 
+				if (affectorAmountRow)
+				{
+					affectorAmountRow[x] = -1.f;
+				}
+
 				float fuzzyTest;
 				//-------------------------------------------------------------------------------------
 				if (boundaryMap)
@@ -1180,7 +1215,12 @@ void TerrainGenerator::Layer::affect (const float * previousAmountMap, const Gen
 						shouldAffectSubLayers = true;
 
 						//-- run all affectors
-						if (m_hasUnprunedAffectors)
+						if (affectorAmountRow)
+						{
+							affectorAmountRow[x] = fuzzyTest * previousAmount;
+							rowIsAffected = true;
+						}
+						else if (m_hasUnprunedAffectors)
 						{
 							for (int i = 0; i < m_affectorList.getNumberOfElements (); i++)
 							{
@@ -1209,6 +1249,28 @@ void TerrainGenerator::Layer::affect (const float * previousAmountMap, const Gen
 					amountMap[rowIndex + x]=fuzzyTest * previousAmount;
 				}
 			}
+
+			if (rowIsAffected)
+			{
+				for (int i = 0; i < m_affectorList.getNumberOfElements (); i++)
+				{
+					Affector *a = m_affectorList[i];
+					if (!a->isPruned())
+					{
+						a->affectRow (worldXRow, worldZ, z, affectorAmountRow, numberOfPoles, generatorChunkData);
+
+						if (a->affectsHeight())
+						{
+							generatorChunkData.normalsDirtyIUO = true;
+						}
+
+						if (a->affectsShader())
+						{
+							generatorChunkData.shadersDirtyIUO = true;
+						}
+					}
+				}
+			}
 		}
 	}
 
@@ -315,6 +315,9 @@ public:
 		TerrainGeneratorAffectorType getType () const;
 
 		virtual void affect (float worldX, float worldZ, int x, int z, float amount, const GeneratorChunkData& generatorChunkData) const=0;
+
+		//-- affect every pole of row z; poles outside the layer have a negative amount and are skipped
+		virtual void affectRow (const float *worldX, float worldZ, int z, const float *amount, int numberOfPoles, const GeneratorChunkData& generatorChunkData) const;
 		virtual bool affectsHeight () const;
 		virtual bool affectsShader () const;
 		virtual unsigned getAffectedMaps() const=0;
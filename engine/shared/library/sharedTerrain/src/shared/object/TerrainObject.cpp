@@ -780,6 +780,13 @@ void TerrainObject::invalidateRegion (const Rectangle2d& extent2d)
 
 //-------------------------------------------------------------------
 
+void TerrainObject::pregenerateRegion (const Rectangle2d& extent2d)
+{
+	getCastedAppearance (this)->pregenerateRegion (extent2d);
+}
+
+//-------------------------------------------------------------------
+
 void TerrainObject::purgeChunks()
 {
 	getCastedAppearance(this)->purgeChunks();
@@ -117,6 +117,7 @@ public:
 	void                  getPolygonSoup (const Rectangle2d& extent2d_w, IndexedTriangleList& indexedTriangleList) const;
 
 	void                  invalidateRegion (const Rectangle2d& extent2d);
+	void                  pregenerateRegion (const Rectangle2d& extent2d);
 
 	//-- debugging
 	void                  drawExtents (const Vector& position_w) const;
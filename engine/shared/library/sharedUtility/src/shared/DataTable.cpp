@@ -10,13 +10,44 @@
 #include "sharedUtility/DataTable.h"
 
 #include "sharedFile/Iff.h"
-#include "sharedUtility/DataTableCell.h"
+#include "sharedFile/IffView.h"
+#include "sharedFoundation/Crc.h"
+#include "sharedFoundation/CrcString.h"
 
-#include <map>
+#include <cstring>
 #include <unordered_map>
 
 //----------------------------------------------------------------------------
 
+namespace DataTableNamespace
+{
+	Tag const TAG_CELL = TAG(C,E,L,L);
+	Tag const TAG_INDX = TAG(I,N,D,X);
+	Tag const TAG_STRS = TAG(S,T,R,S);
+
+	int32 const cs_emptyBucket = -1;
+
+	uint32 hashIndexKey(int32 key)
+	{
+		uint32 hash = static_cast<uint32>(key);
+		hash ^= hash >> 16;
+		hash *= 0x7feb352du;
+		hash ^= hash >> 15;
+		hash *= 0x846ca68bu;
+		hash ^= hash >> 16;
+		return hash;
+	}
+
+	bool isPowerOfTwo(int32 value)
+	{
+		return value > 0 && (value & (value - 1)) == 0;
+	}
+}
+
+using namespace DataTableNamespace;
+
+//----------------------------------------------------------------------------
+
 const Tag DataTable::m_dataTableIffId = TAG(D,T,I,I);
 
 //----------------------------------------------------------------------------
@@ -24,7 +55,10 @@ const Tag DataTable::m_dataTableIffId = TAG(D,T,I,I);
 DataTable::DataTable() :
 m_numRows(0),
 m_numCols(0),
-m_cells(0),
+m_cells(),
+m_strings(),
+m_stringOffsets(),
+m_stringCrcs(),
 m_columns(),
 m_index(),
 m_types(),
@@ -37,72 +71,10 @@ m_name()
 
 DataTable::~DataTable()
 {
-	std::vector<void *>::iterator k = m_index.begin();
-	int count = 0;
-	for (; k != m_index.end(); ++k, ++count)
+	for (std::vector<RowIndex *>::iterator k = m_index.begin(); k != m_index.end(); ++k)
 	{
-		DataTableColumnType::DataType dt = m_types[static_cast<size_t>(count)]->getBasicType();
-
-		switch (dt)
-		{
-			case DataTableColumnType::DT_Int:
-			{
-				if (*k)
-				{
-					delete static_cast<std::multimap<int, int> *>(*k);
-					*k = nullptr;
-				}
-			}
-			break;
-			case DataTableColumnType::DT_Float:
-			{
-				if (*k)
-				{
-					delete static_cast<std::multimap<float, int> *>(*k);
-					*k = nullptr;
-				}
-
-			}
-			break;
-			case DataTableColumnType::DT_String:
-			{
-				if (*k)
-				{
-					delete static_cast<std::pair<std::multimap<const std::string, int>, std::multimap<int, int> > *>(*k);
-					*k = nullptr;
-				}
-
-			}
-			break;
-			case DataTableColumnType::DT_HashString:
-			case DataTableColumnType::DT_Enum:
-			case DataTableColumnType::DT_Bool:
-			case DataTableColumnType::DT_BitVector:
-			case DataTableColumnType::DT_Unknown:
-			case DataTableColumnType::DT_Comment:
-			case DataTableColumnType::DT_PackedObjVars:
-			default:
-			{
-				WARNING_STRICT_FATAL((*k) != nullptr, ("Bad column Index %d. Unsupported datatype.  This may leak memory.", count));
-			}
-			break;
-		}
-	}
-
-	if (m_cells)
-	{
-		for (int row=0;row<m_numRows;++row)
-		{
-			const DataTableCell *rowCells = m_cells + row * m_numCols;
-			for (int col=0;col<m_numCols;++col)
-			{
-				const DataTableCell &cell = rowCells[col];
-				cell.~DataTableCell();
-			}
-		}
-
-		free((void *)m_cells);
-		m_cells=0;
+		delete *k;
+		*k = nullptr;
 	}
 
 	DataTableColumnTypeVector::iterator l = m_types.begin();
@@ -192,17 +164,9 @@ int DataTable::getIntValue(int column, int row) const
 	
 	// we can return the value of an int column or the crc value of a string column
 	if (m_types[static_cast<size_t>(column)]->getBasicType() == DataTableColumnType::DT_Int)
-	{
-		const DataTableCell *cell = getDataTableCell(column, row);
-		DEBUG_FATAL(cell->getType()!=DataTableCell::CT_int, ("Could not convert row %d column %d to int value", row, column));
-		return cell->getIntValue();
-	}
+		return getCell(column, row);
 	else if (m_types[static_cast<size_t>(column)]->getBasicType() == DataTableColumnType::DT_String)
-	{
-		const DataTableCell *cell = getDataTableCell(column, row);
-		DEBUG_FATAL(cell->getType()!=DataTableCell::CT_string, ("Could not convert row %d column %d to string value", row, column));
-		return cell->getStringValueCrc();
-	}
+		return m_stringCrcs[static_cast<size_t>(getCell(column, row))];
 
 	DEBUG_FATAL(true, ("DataTable [%s] getIntValue(): Wrong data type [%d] for col [%d].\n", m_name.c_str(), m_types[static_cast<size_t>(column)]->getBasicType(), column));
 	return 0;
@@ -245,10 +209,10 @@ float DataTable::getFloatValue(int column, int row) const
 	DEBUG_FATAL(column < 0 || column >= getNumColumns(), ("DataTable [%s] getFloatValue(): Invalid col number [%d].  Cols=[%d]\n", m_name.c_str(), column, getNumColumns()));
 	DEBUG_FATAL(m_types[static_cast<size_t>(column)]->getBasicType() != DataTableColumnType::DT_Float, ("Wrong data type for column %d.", column));
 
-	const DataTableCell *cell = getDataTableCell(column, row);
-	DEBUG_FATAL(cell->getType()!=DataTableCell::CT_float, ("Could not convert row %d column %d to float value", row, column));
-	return cell->getFloatValue();
-
+	int32 const cell = getCell(column, row);
+	float value;
+	memcpy(&value, &cell, sizeof(value));
+	return value;
 }
 
 //----------------------------------------------------------------------------
@@ -288,10 +252,7 @@ const char *DataTable::getStringValue(int column, int row) const
 	DEBUG_FATAL(column < 0 || column >= getNumColumns(), ("Column [%d] is invalid.", column));
 	DEBUG_FATAL(m_types[static_cast<size_t>(column)]->getBasicType() != DataTableColumnType::DT_String, ("Wrong data type for column %s (%d). Current data type is %s", getColumnName(column).c_str(), column, getDataTypeForColumn(column).getTypeSpecString().c_str()));
 
-	const DataTableCell * const cell = getDataTableCell(column, row);
-	DEBUG_FATAL(cell->getType()!=DataTableCell::CT_string, ("Could not convert row %d column %d to string value", row, column));
-	return cell->getStringValue();
-
+	return getString(getCell(column, row));
 }
 
 //----------------------------------------------------------------------------
@@ -355,6 +316,13 @@ void DataTable::getStringColumn(const std::string& column, std::vector<const cha
 
 void DataTable::getIntColumn(int column, std::vector<int>& returnVector) const
 {
+	if (m_numRows > 0 && m_types[static_cast<size_t>(column)]->getBasicType() == DataTableColumnType::DT_Int)
+	{
+		std::vector<int32>::const_iterator const first = m_cells.begin() + column * m_numRows;
+		returnVector.assign(first, first + m_numRows);
+		return;
+	}
+
 	returnVector.clear();
 	for (int i = 0; i < getNumRows(); ++i)
 	{
@@ -397,33 +365,26 @@ void DataTable::getStringColumn(int column, std::vector<const char *>& returnVec
 
 //----------------------------------------------------------------------------
 
-void DataTable::_readCell(Iff & iff, int column, int row)
+void DataTable::_readCell(IffView & iff, int column, int row, StringNumberMap & stringNumbers)
 {
-	DataTableCell *cell = const_cast<DataTableCell *>(getDataTableCell(column, row));
+	int32 & cell = m_cells[static_cast<size_t>(column * m_numRows + row)];
 	const DataTableColumnType &typeCol = *m_types[static_cast<size_t>(column)];
 	switch (typeCol.getBasicType())
 	{
 	case DataTableColumnType::DT_Int:
 	{
-		int tmp = iff.read_int32();
-		new (cell) DataTableCell(tmp);
-
+		cell = iff.read_int32();
 		break;
 	}
 	case DataTableColumnType::DT_Float:
 	{
 		float tmp = iff.read_float();
-		new (cell) DataTableCell(tmp);
+		memcpy(&cell, &tmp, sizeof(cell));
 		break;
 	}
 	case DataTableColumnType::DT_String:
 	{
-		const int maxLen = 16384;
-		char buffer[maxLen];
-		buffer[0]=0;
-		iff.read_string(buffer, maxLen-1);
-		buffer[maxLen-1]=0;
-		new (cell) DataTableCell(buffer);
+		cell = internString(iff.read_stringView(), stringNumbers);
 		break;
 	}
 	case DataTableColumnType::DT_Unknown:
@@ -441,7 +402,54 @@ void DataTable::_readCell(Iff & iff, int column, int row)
 
 //----------------------------------------------------------------------------
 
+/**
+ * Returns the number of a string in the table's string pool, adding the
+ * string if the table does not have it yet.  The empty string is always
+ * number 0.
+ */
+int32 DataTable::internString(std::string_view value, StringNumberMap & stringNumbers)
+{
+	if (m_stringOffsets.empty())
+	{
+		m_strings.push_back('\0');
+		m_stringOffsets.push_back(0);
+		m_stringCrcs.push_back(0);
+	}
+
+	if (value.empty())
+		return 0;
+
+	std::pair<StringNumberMap::iterator, bool> const result = stringNumbers.insert(StringNumberMap::value_type(value, static_cast<int32>(m_stringOffsets.size())));
+	if (result.second)
+	{
+		int32 const offset = static_cast<int32>(m_strings.size());
+		m_strings.insert(m_strings.end(), value.begin(), value.end());
+		m_strings.push_back('\0');
+		m_stringOffsets.push_back(offset);
+		m_stringCrcs.push_back(calculateStringCrc(&m_strings[static_cast<size_t>(offset)]));
+	}
+
+	return result.first->second;
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * Load the table at the Iff's current position, leaving the Iff just past it.
+ *
+ * The table is read through a view of the Iff's data rather than through
+ * the Iff itself.
+ */
 void DataTable::load(Iff & iff)
+{
+	IffView view(iff);
+	load(view);
+	IGNORE_RETURN(iff.goForward());
+}
+
+//----------------------------------------------------------------------------
+
+void DataTable::load(IffView & iff)
 {
 	IGNORE_RETURN ( iff.enterForm(m_dataTableIffId, false) );
 
@@ -450,6 +458,8 @@ void DataTable::load(Iff & iff)
 		load_0000(iff);
 	else if (version == TAG_0001)
 		load_0001(iff);
+	else if (version == TAG_0002)
+		load_0002(iff);
 	else
 	{
 		char buffer[5];
@@ -460,12 +470,8 @@ void DataTable::load(Iff & iff)
 
 	iff.exitForm(m_dataTableIffId, false);
 
-	int count = getNumColumns();
-	for (int i = 0; i < count; ++i)
-	{
-		//initialize the table index used for searching.
-		m_index.push_back(nullptr);
-	}
+	//initialize the table index used for searching.
+	m_index.resize(static_cast<size_t>(getNumColumns()), nullptr);
 
 	buildColumnIndexMap();
 
@@ -477,24 +483,13 @@ void DataTable::load(Iff & iff)
 
 //----------------------------------------------------------------------------
 
-void DataTable::load_0000(Iff & iff)
+void DataTable::load_0000(IffView & iff)
 {
 	IGNORE_RETURN ( iff.enterForm(TAG_0000, false) );
 
-	//load columns
-	iff.enterChunk(TAG(C,O,L,S));
-	m_numCols = iff.read_int32();	
-	int i = 0;
-	m_columns.reserve(m_numCols);
-	std::string tmpString;
-	for (i = 0; i < m_numCols; ++i)
-	{
-		iff.read_string(tmpString);
-		m_columns.push_back(tmpString);
-		tmpString.clear();
-	}
+	_loadColumns(iff);
 
-	iff.exitChunk(TAG(C,O,L,S));	
+	int i = 0;
 	//load type info
 	iff.enterChunk(TAG(T,Y,P,E));
 	for (i = 0; i < m_numCols; ++i)
@@ -535,45 +530,19 @@ void DataTable::load_0000(Iff & iff)
 	}
 	iff.exitChunk(TAG(T,Y,P,E));
 
-	//load rows
-	iff.enterChunk(TAG(R,O,W,S));
-	m_numRows = iff.read_int32();
-
-	const size_t cellSize = m_numRows * m_numCols * sizeof(DataTableCell);
-	void *cellMemory = malloc(cellSize);
-	m_cells = (DataTableCell *)cellMemory;
-	for (i = 0; i < m_numRows; ++i)
-	{
-		for (int j = 0; j < m_numCols; ++j)
-		{
-			_readCell(iff, j, i);
-		}
-	}
-
-	iff.exitChunk(TAG(R,O,W,S));
+	_loadRows(iff);
 	iff.exitForm(TAG_0000, false);
 }
 
 //----------------------------------------------------------------------------
 
-void DataTable::load_0001(Iff & iff)
+void DataTable::load_0001(IffView & iff)
 {
 	IGNORE_RETURN( iff.enterForm(TAG_0001, false) );
 
-	//load columns
-	iff.enterChunk(TAG(C,O,L,S));
-	m_numCols = iff.read_int32();	
-	int i = 0;
-	m_columns.reserve(m_numCols);
-	std::string tmpString;
-	for (i = 0; i < m_numCols; ++i)
-	{
-		iff.read_string(tmpString);
-		m_columns.push_back(tmpString);
-		tmpString.clear();
-	}
+	_loadColumns(iff);
 
-	iff.exitChunk(TAG(C,O,L,S));	
+	int i = 0;
 	//load type info
 	iff.enterChunk(TAG(T,Y,P,E));
 	for (i = 0; i < m_numCols; ++i)
@@ -583,23 +552,131 @@ void DataTable::load_0001(Iff & iff)
 	}
 	iff.exitChunk(TAG(T,Y,P,E));
 
-	//load rows
+	_loadRows(iff);
+	iff.exitForm(TAG_0001, false);
+}
+
+//----------------------------------------------------------------------------
+
+void DataTable::load_0002(IffView & iff)
+{
+	IGNORE_RETURN( iff.enterForm(TAG_0002, false) );
+
+	_loadColumns(iff);
+
+	iff.enterChunk(TAG(T,Y,P,E));
+	for (int i = 0; i < m_numCols; ++i)
+		m_types.push_back(new DataTableColumnType(iff.read_stdstring()));
+	iff.exitChunk(TAG(T,Y,P,E));
+
+	//load the string pool
+	iff.enterChunk(TAG_STRS);
+	{
+		int const numStrings = iff.read_int32();
+		int const stringBytes = iff.read_int32();
+		FATAL(numStrings < 1 || stringBytes < 1, ("DataTable [%s] has a bad string pool", iff.getFileName()));
+
+		m_stringOffsets.resize(static_cast<size_t>(numStrings));
+		iff.read_int32(numStrings, &m_stringOffsets[0]);
+		m_stringCrcs.resize(static_cast<size_t>(numStrings));
+		iff.read_int32(numStrings, &m_stringCrcs[0]);
+		m_strings.resize(static_cast<size_t>(stringBytes));
+		iff.read_char(stringBytes, &m_strings[0]);
+
+		FATAL(m_strings.back() != '\0', ("DataTable [%s] has an unterminated string pool", iff.getFileName()));
+		for (int i = 0; i < numStrings; ++i)
+			FATAL(m_stringOffsets[static_cast<size_t>(i)] < 0 || m_stringOffsets[static_cast<size_t>(i)] >= stringBytes, ("DataTable [%s] has a bad string offset", iff.getFileName()));
+	}
+	iff.exitChunk(TAG_STRS);
+
+	//load the cells, a column at a time
+	iff.enterChunk(TAG_CELL);
+	{
+		m_numRows = iff.read_int32();
+		m_cells.resize(static_cast<size_t>(m_numRows * m_numCols));
+		if (!m_cells.empty())
+			iff.read_int32(static_cast<int>(m_cells.size()), &m_cells[0]);
+
+		int32 const numStrings = static_cast<int32>(m_stringOffsets.size());
+		for (int column = 0; column < m_numCols; ++column)
+		{
+			if (m_types[static_cast<size_t>(column)]->getBasicType() != DataTableColumnType::DT_String)
+				continue;
+
+			for (int row = 0; row < m_numRows; ++row)
+			{
+				int32 const stringNumber = getCell(column, row);
+				FATAL(stringNumber < 0 || stringNumber >= numStrings, ("DataTable [%s] has a bad string in row %d column %d", iff.getFileName(), row, column));
+			}
+		}
+	}
+	iff.exitChunk(TAG_CELL);
+
+	//load the row indexes built for unique columns
+	m_index.resize(static_cast<size_t>(m_numCols), nullptr);
+	if (!iff.atEndOfForm() && iff.getCurrentName() == TAG_INDX)
+	{
+		iff.enterChunk(TAG_INDX);
+		int const numIndexes = iff.read_int32();
+		for (int i = 0; i < numIndexes; ++i)
+		{
+			int const column = iff.read_int32();
+			int const numBuckets = iff.read_int32();
+			FATAL(column < 0 || column >= m_numCols || m_index[static_cast<size_t>(column)] != nullptr, ("DataTable [%s] has a bad index for column %d", iff.getFileName(), column));
+			FATAL(!isPowerOfTwo(numBuckets) || numBuckets <= m_numRows, ("DataTable [%s] has a bad index size %d for column %d", iff.getFileName(), numBuckets, column));
+
+			RowIndex * const index = new RowIndex(static_cast<size_t>(numBuckets));
+			iff.read_int32(numBuckets, &(*index)[0]);
+			for (RowIndex::const_iterator j = index->begin(); j != index->end(); ++j)
+				FATAL(*j < cs_emptyBucket || *j >= m_numRows, ("DataTable [%s] has a bad index entry for column %d", iff.getFileName(), column));
+
+			m_index[static_cast<size_t>(column)] = index;
+		}
+		iff.exitChunk(TAG_INDX);
+	}
+
+	iff.exitForm(TAG_0002, false);
+}
+
+//----------------------------------------------------------------------------
+
+void DataTable::_loadColumns(IffView & iff)
+{
+	iff.enterChunk(TAG(C,O,L,S));
+	m_numCols = iff.read_int32();
+	m_columns.reserve(static_cast<size_t>(m_numCols));
+	for (int i = 0; i < m_numCols; ++i)
+	{
+		std::string_view const column = iff.read_stringView();
+		m_columns.push_back(std::string(column.data(), column.size()));
+	}
+
+	iff.exitChunk(TAG(C,O,L,S));
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * Loads the row-ordered cells of version 0000 and 0001 tables into the
+ * column-ordered layout, interning the strings as they are read.
+ */
+void DataTable::_loadRows(IffView & iff)
+{
 	iff.enterChunk(TAG(R,O,W,S));
 	m_numRows = iff.read_int32();
 
-	const size_t cellSize = m_numRows * m_numCols * sizeof(DataTableCell);
-	void *cellMemory = malloc(cellSize);
-	m_cells = (DataTableCell *)cellMemory;
-	for (i = 0; i < m_numRows; ++i)
+	m_cells.resize(static_cast<size_t>(m_numRows * m_numCols));
+	StringNumberMap stringNumbers;
+	IGNORE_RETURN(internString("", stringNumbers));
+	for (int i = 0; i < m_numRows; ++i)
 	{
 		for (int j = 0; j < m_numCols; ++j)
 		{
-			_readCell(iff, j, i);
+			_readCell(iff, j, i, stringNumbers);
 		}
 	}
 
 	iff.exitChunk(TAG(R,O,W,S));
-	iff.exitForm(TAG_0001, false);
 }
 
 // ----------------------------------------------------------------------
@@ -607,141 +684,167 @@ void DataTable::load_0001(Iff & iff)
 int DataTable::searchColumnString( int column, const std::string & searchValue ) const
 {
 	DEBUG_FATAL(column < 0 || column >= getNumColumns(), ("DataTable [%s] searchColumnString(): Invalid col number [%d].  Cols=[%d]\n", m_name.c_str(), column, getNumColumns()));
+	DEBUG_FATAL(m_types[static_cast<size_t>(column)]->getBasicType() != DataTableColumnType::DT_String, ("DataTable [%s] searchColumnString(): Wrong data type for column %d.", m_name.c_str(), column));
 
-	int retval = -1;
-
-	void * voidIndex = m_index[ static_cast<size_t>(column) ];
-	if (!voidIndex)
+	RowIndex const & index = getRowIndex(column);
+	uint32 const mask = static_cast<uint32>(index.size()) - 1;
+	for (uint32 bucket = hashIndexKey(calculateStringCrc(searchValue.c_str())) & mask; ; bucket = (bucket + 1) & mask)
 	{
-		std::pair<std::multimap<const std::string, int>, std::multimap<int, int> > * indexPair = new std::pair<std::multimap<const std::string, int>, std::multimap<int, int> >;
+		int32 const row = index[bucket];
+		if (row == cs_emptyBucket)
+			return -1;
+		if (searchValue == getString(getCell(column, row)))
+			return row;
+	}
+}
+
+// ----------
 
-		m_index[static_cast<size_t>(column)] = static_cast<void *>(indexPair);
+int DataTable::searchColumnFloat( int column, float searchValue ) const
+{
+	DEBUG_FATAL(column < 0 || column >= getNumColumns(), ("DataTable [%s] searchColumnFloat(): Invalid col number [%d].  Cols=[%d]\n", m_name.c_str(), column, getNumColumns()));
+	DEBUG_FATAL(m_types[static_cast<size_t>(column)]->getBasicType() != DataTableColumnType::DT_Float, ("DataTable [%s] searchColumnFloat(): Wrong data type for column %d.", m_name.c_str(), column));
 
-		//no index has been built yet for this column
-		int rowCount = getNumRows();
-		for (int i = 0; i < rowCount; ++i)
-		{
-			const std::string & valueString = getStringValue(column,i);
-			IGNORE_RETURN ( indexPair->first.insert(std::pair<const std::string, int>(valueString, i)) );
-			int valueCrc = getIntValue(column,i);
-			IGNORE_RETURN ( indexPair->second.insert(std::pair<int, int>(valueCrc, i)) );
-			if (retval == -1 && valueString == searchValue)
-				retval = i;
-		}
-	}
-	else
+	RowIndex const & index = getRowIndex(column);
+	uint32 const mask = static_cast<uint32>(index.size()) - 1;
+	for (uint32 bucket = hashIndexKey(getFloatIndexKey(searchValue)) & mask; ; bucket = (bucket + 1) & mask)
 	{
-		std::pair<std::multimap<const std::string, int>, std::multimap<int, int> > * indexPair = static_cast<std::pair<std::multimap<const std::string, int>, std::multimap<int, int> > *>(voidIndex);
-		std::multimap<const std::string, int>::iterator iter = indexPair->first.find(searchValue);
-		if (iter != indexPair->first.end())
-			retval = iter->second;	
+		int32 const row = index[bucket];
+		if (row == cs_emptyBucket)
+			return -1;
+		if (getFloatValue(column, row) == searchValue) //lint !e777 //ok to compare floats
+			return row;
 	}
-
-	return retval;
 }
 
 // ----------
 
-int DataTable::searchColumnFloat( int column, float searchValue ) const
+int DataTable::searchColumnInt( int column, int searchValue ) const
 {
-	DEBUG_FATAL(column < 0 || column >= getNumColumns(), ("DataTable [%s] searchColumnFloat(): Invalid col number [%d].  Cols=[%d]\n", m_name.c_str(), column, getNumColumns()));
+	DEBUG_FATAL(column < 0 || column >= getNumColumns(), ("DataTable [%s] searchColumnInt(): Invalid col number [%d].  Cols=[%d]\n", m_name.c_str(), column, getNumColumns()));
 
-	int retval = -1;
+	// int columns are searched by value, string columns by the crc of the string
+	DataTableColumnType::DataType const columnType = m_types[static_cast<size_t>(column)]->getBasicType();
+	if (columnType != DataTableColumnType::DT_Int && columnType != DataTableColumnType::DT_String)
+		return -1;
 
-	void * voidIndex = m_index[ static_cast<size_t>(column) ];
-	if (!voidIndex)
+	RowIndex const & index = getRowIndex(column);
+	uint32 const mask = static_cast<uint32>(index.size()) - 1;
+	for (uint32 bucket = hashIndexKey(searchValue) & mask; ; bucket = (bucket + 1) & mask)
 	{
-		std::multimap<float, int> * index = new std::multimap<float, int>;
+		int32 const row = index[bucket];
+		if (row == cs_emptyBucket)
+			return -1;
+		if (getIntValue(column, row) == searchValue)
+			return row;
+	}
+}
 
-		m_index[static_cast<size_t>(column)] = static_cast<void *>(index);
+// ----------
 
-		//no index has been built yet for this column
-		for (int i = 0; i < getNumRows(); ++i)
+/**
+ * Returns the row index for a column, building it the first time the
+ * column is searched if the table file did not carry one.
+ */
+DataTable::RowIndex const & DataTable::getRowIndex(int column) const
+{
+	RowIndex * index = m_index[static_cast<size_t>(column)];
+	if (!index)
+	{
+		DataTableColumnType::DataType const columnType = m_types[static_cast<size_t>(column)]->getBasicType();
+		std::vector<int32> keys(static_cast<size_t>(m_numRows));
+		for (int row = 0; row < m_numRows; ++row)
 		{
-			float rowValue = getFloatValue(column,i);
-			IGNORE_RETURN ( index->insert(std::pair<float, int>(rowValue, i)) );
-			if (retval == -1 && rowValue == searchValue) //lint !e777 //ok to compare floats
-				retval = i;
+			if (columnType == DataTableColumnType::DT_Float)
+				keys[static_cast<size_t>(row)] = getFloatIndexKey(getFloatValue(column, row));
+			else
+				keys[static_cast<size_t>(row)] = getIntValue(column, row);
 		}
+
+		index = new RowIndex;
+		buildRowIndex(*index, m_numRows > 0 ? &m_cells[static_cast<size_t>(column * m_numRows)] : nullptr, m_numRows > 0 ? &keys[0] : nullptr, m_numRows);
+		m_index[static_cast<size_t>(column)] = index;
 	}
-	else
+
+	return *index;
+}
+
+// ----------
+
+/**
+ * Returns the crc a string cell is indexed by.  It matches the crc
+ * getIntValue() returns for string columns.
+ */
+int32 DataTable::calculateStringCrc(char const * value)
+{
+	if (!value || !*value)
+		return 0;
+
+	// normalize into a scratch buffer to get the crc
+	size_t const length = strlen(value) + 1;
+	char buffer[256];
+	std::vector<char> longBuffer;
+	char * normalized = buffer;
+	if (length > sizeof(buffer))
 	{
-		std::multimap<float, int> * index = static_cast<std::multimap<float, int> *>(voidIndex);
-		std::multimap<float, int>::iterator iter = index->find(searchValue);
-		if (iter != index->end())
-			retval = iter->second;
+		longBuffer.resize(length);
+		normalized = &longBuffer[0];
 	}
 
-	return retval;
+	CrcString::normalize(normalized, value);
+	return static_cast<int32>(Crc::calculate(normalized));
 }
 
 // ----------
 
-int DataTable::searchColumnInt( int column, int searchValue ) const
+/**
+ * Returns the key a float cell is indexed by.  0 and -0 compare equal, so
+ * they share a key.
+ */
+int32 DataTable::getFloatIndexKey(float value)
 {
-	DEBUG_FATAL(column < 0 || column >= getNumColumns(), ("DataTable [%s] searchColumnInt(): Invalid col number [%d].  Cols=[%d]\n", m_name.c_str(), column, getNumColumns()));
+	if (value == 0.0f) //lint !e777 //ok to compare floats
+		return 0;
 
-	int retval = -1;
-	DataTableColumnType::DataType columnType = m_types[static_cast<size_t>(column)]->getBasicType();
+	int32 key;
+	memcpy(&key, &value, sizeof(key));
+	return key;
+}
+
+// ----------
 
-	void * voidIndex = m_index[ static_cast<size_t>(column) ];
-	if (!voidIndex)
+/**
+ * Builds a row index over one column.  Rows are added in order, so a
+ * search finds the first row with a value.  Rows whose cell repeats one
+ * already in the index are left out.
+ *
+ * @param index    receives the buckets
+ * @param cells    the column's cells
+ * @param keys     the key of each cell
+ * @param numRows  the number of cells
+ */
+void DataTable::buildRowIndex(RowIndex & index, int32 const * cells, int32 const * keys, int numRows)
+{
+	size_t numBuckets = 16;
+	while (numBuckets < static_cast<size_t>(numRows) * 2)
+		numBuckets *= 2;
+
+	index.assign(numBuckets, cs_emptyBucket);
+	uint32 const mask = static_cast<uint32>(numBuckets) - 1;
+	for (int row = 0; row < numRows; ++row)
 	{
-		if (columnType == DataTableColumnType::DT_Int)
+		for (uint32 bucket = hashIndexKey(keys[row]) & mask; ; bucket = (bucket + 1) & mask)
 		{
-			std::multimap<int, int> * index = new std::multimap<int, int>;
-
-			m_index[static_cast<size_t>(column)] = static_cast<void *>(index);
-
-			//no index has been built yet for this column
-			int rowCount = getNumRows();
-			for (int i = 0; i < rowCount; ++i)
+			int32 const existingRow = index[bucket];
+			if (existingRow == cs_emptyBucket)
 			{
-				int rowValue = getIntValue(column,i);
-				IGNORE_RETURN ( index->insert(std::pair<int, int>(rowValue, i)) );
-				if (retval == -1 && rowValue == searchValue)
-					retval = i;
-			}
-		}
-		else if (columnType == DataTableColumnType::DT_String)
-		{
-			std::pair<std::multimap<const std::string, int>, std::multimap<int, int> > * indexPair = new std::pair<std::multimap<const std::string, int>, std::multimap<int, int> >;
-
-			m_index[static_cast<size_t>(column)] = static_cast<void *>(indexPair);
-
-			//no index has been built yet for this column
-			int rowCount = getNumRows();
-			for (int i = 0; i < rowCount; ++i)
-			{
-				const std::string & valueString = getStringValue(column,i);
-				IGNORE_RETURN ( indexPair->first.insert(std::pair<const std::string, int>(valueString, i)) );
-				int valueCrc = getIntValue(column,i);
-				IGNORE_RETURN ( indexPair->second.insert(std::pair<int, int>(valueCrc, i)) );
-				if (retval == -1 && valueCrc == searchValue)
-					retval = i;
+				index[bucket] = row;
+				break;
 			}
+			if (cells[existingRow] == cells[row])
+				break;
 		}
 	}
-	else
-	{
-		if (columnType == DataTableColumnType::DT_Int)
-		{
-			std::multimap<int, int> * index = static_cast<std::multimap<int, int> *>(voidIndex);
-			std::multimap<int, int>::iterator iter = index->find(searchValue);
-			if (iter != index->end())
-				retval = iter->second;
-		}
-		else if (columnType == DataTableColumnType::DT_String)
-		{
-			std::pair<std::multimap<const std::string, int>, std::multimap<int, int> > * indexPair = static_cast<std::pair<std::multimap<const std::string, int>, std::multimap<int, int> > *>(voidIndex);
-			std::multimap<int, int>::iterator iter = indexPair->second.find(searchValue);
-			if (iter != indexPair->second.end())
-				retval = iter->second;
-		}
-	}
-
-	return retval;
-
 }
 
 // ----------
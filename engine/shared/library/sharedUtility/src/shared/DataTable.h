@@ -10,14 +10,15 @@
 #define INCLUDED_DataTable_H
 
 #include "sharedFoundation/Tag.h"
-#include "DataTableCell.h"
 #include "DataTableColumnType.h"
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 
 class Iff;
+class IffView;
 
 class DataTable
 {
@@ -57,6 +58,7 @@ public:
 	int                 getNumRows() const;
 
 	void                load(Iff &);
+	void                load(IffView &);
 
 	// Search a column of the table for a given value and return the index of the first
 	// matching row. Warning - this is a linear search, so it can be slow.
@@ -69,18 +71,37 @@ public:
 
 	static Tag          getDataTableIffId() { return m_dataTableIffId; }
 
+	// Row indexes are open-addressed tables of row numbers, keyed by the
+	// cell value (int value, float bits or string crc).  Empty buckets hold -1.
+	// Version 0002 files carry prebuilt indexes for unique columns.
+
+	typedef std::vector<int32> RowIndex;
+
+	static int32        calculateStringCrc(char const * value);
+	static int32        getFloatIndexKey(float value);
+	static void         buildRowIndex(RowIndex & index, int32 const * cells, int32 const * keys, int numRows);
+
 protected:
 
 	const std::vector<std::string> &_columns() const { return m_columns; }
 
 private:
 
-	const DataTableCell * getDataTableCell(int column, int row) const;
-	void _readCell(Iff & iff, int column, int row);
+	// keys view the strings in the file being loaded
+	typedef std::unordered_map<std::string_view, int32> StringNumberMap;
+
+	int32               getCell(int column, int row) const;
+	char const *        getString(int32 stringNumber) const;
+	int32               internString(std::string_view value, StringNumberMap & stringNumbers);
+	RowIndex const &    getRowIndex(int column) const;
+	void _readCell(IffView & iff, int column, int row, StringNumberMap & stringNumbers);
+	void _loadColumns(IffView & iff);
+	void _loadRows(IffView & iff);
 
 	static DataTableColumnType getDataType(const std::string &type);
-	void                load_0000(Iff &);
-	void                load_0001(Iff &);
+	void                load_0000(IffView &);
+	void                load_0001(IffView &);
+	void                load_0002(IffView &);
 	void buildColumnIndexMap();
 
 	typedef std::vector<const DataTableColumnType *> DataTableColumnTypeVector;
@@ -88,9 +109,16 @@ private:
 
 	int                           m_numRows;
 	int                           m_numCols;
-	DataTableCell const *         m_cells;
+
+	// cells are stored a column at a time; each cell is the int value, the
+	// float bits or the number of an interned string
+	std::vector<int32>            m_cells;
+	std::vector<char>             m_strings;
+	std::vector<int32>            m_stringOffsets;
+	std::vector<int32>            m_stringCrcs;
+
 	std::vector<std::string>      m_columns;
-	mutable std::vector<void *>   m_index;
+	mutable std::vector<RowIndex *> m_index;
 	DataTableColumnTypeVector     m_types;
 	ColumnIndexMap *              m_columnIndexMap;
 	std::string                   m_name;
@@ -113,9 +141,16 @@ inline int DataTable::getNumRows() const
 	return m_numRows;
 }
 
-inline const DataTableCell * DataTable::getDataTableCell(int column, int row) const
+inline int32 DataTable::getCell(int column, int row) const
+{
+	return m_cells[static_cast<size_t>(column * m_numRows + row)];
+}
+
+//----------------------------------------------------------------------
+
+inline char const * DataTable::getString(int32 stringNumber) const
 {
-	return m_cells + (row * m_numCols + column);
+	return &m_strings[static_cast<size_t>(m_stringOffsets[static_cast<size_t>(stringNumber)])];
 }
 
 //----------------------------------------------------------------------
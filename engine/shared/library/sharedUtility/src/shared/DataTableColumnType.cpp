@@ -12,6 +12,7 @@
 #include "UnicodeUtils.h"
 #include "sharedFoundation/Crc.h"
 #include "sharedUtility/DataTable.h"
+#include "sharedUtility/DataTableCell.h"
 #include "sharedUtility/DataTableManager.h"
 #include <cstdio>
 #include <map>
@@ -10,7 +10,9 @@
 #include "sharedUtility/FirstSharedUtility.h"
 #include "sharedUtility/DataTableManager.h"
 
+#include "sharedDebug/PerformanceTimer.h"
 #include "sharedFile/Iff.h"
+#include "sharedFile/IffView.h"
 #include "sharedFile/TreeFile.h"
 #include "sharedFoundation/ExitChain.h"
 #include "sharedUtility/DataTable.h"
@@ -22,7 +24,7 @@
 DataTable * DataTableManager::m_cachedTable = 0;
 std::string DataTableManager::m_cachedTableName = "";
 bool DataTableManager::m_errorChecking = false;
-std::map<std::string, DataTable *> DataTableManager::m_tables;
+DataTableManager::TableMap DataTableManager::m_tables;
 bool DataTableManager::m_installed = false;
 std::multimap<std::string, DataTableReloadCallback> DataTableManager::m_reloadCallbacks;
 
@@ -47,7 +49,7 @@ void DataTableManager::remove()
 	m_cachedTable = 0;
 	m_cachedTableName.clear();
 
-	std::map<std::string, DataTable *>::iterator i;
+	TableMap::iterator i;
 	for (i=m_tables.begin(); i != m_tables.end(); ++i)
 	{
 		DataTable * toDelete = i->second;
@@ -77,7 +79,8 @@ DataTable* DataTableManager::open(const std::string& table)
 		return 0;
 	}
 
-	Iff iff(table.c_str(), false);
+	IffView iff;
+	IGNORE_RETURN(iff.open(table.c_str()));
 	retVal = new DataTable;
 	retVal->load(iff);
 
@@ -93,7 +96,7 @@ DataTable* DataTableManager::open(const std::string& table)
 void DataTableManager::close(const std::string& table)
 {
 //	FATAL(!m_installed, ("DataTableManager::close: not installed."));
-	std::map<std::string, DataTable *>::iterator i = m_tables.find(table);
+	TableMap::iterator i = m_tables.find(table);
 	if (i == m_tables.end())
 	{
 		DEBUG_WARNING(true, ("Could not find loaded table for close [%s]", table.c_str()));
@@ -120,7 +123,7 @@ DataTable * DataTableManager::getTable(const std::string& table, bool openIfNotF
 	if (m_cachedTableName == table)
 		return m_cachedTable;
 
-	std::map<std::string, DataTable *>::iterator i = m_tables.find(table);
+	TableMap::iterator i = m_tables.find(table);
 	if (i == m_tables.end())
 	{
 		if (openIfNotFound)
@@ -189,9 +192,57 @@ void DataTableManager::addReloadCallback(const std::string& table, DataTableRelo
 
 bool DataTableManager::isOpen(const std::string& table)
 {
-	std::map<std::string, DataTable *>::const_iterator const i = m_tables.find(table);
+	TableMap::const_iterator const i = m_tables.find(table);
 	return i != m_tables.end();
 }
 
-// ======================================================================
+// ----------------------------------------------------------------------
+
+void DataTableManager::getOpenTableNames(std::vector<std::string> & tableNames)
+{
+	tableNames.reserve(tableNames.size() + m_tables.size());
+
+	for (TableMap::const_iterator i = m_tables.begin(); i != m_tables.end(); ++i)
+		tableNames.push_back(i->first);
+}
+
+// ----------------------------------------------------------------------
+/**
+ * Time loading a table in place through an IffView, as open() does, and
+ * through an Iff that copies the file first.  The tables loaded here are
+ * not kept.
+ *
+ * @return false if the table could not be found
+ */
+
+bool DataTableManager::benchmarkLoad(char const * const table, int const numberOfLoads, float & viewTime, float & iffTime)
+{
+	if (!TreeFile::exists(table))
+		return false;
 
+	PerformanceTimer timer;
+	timer.start();
+	for (int i = 0; i < numberOfLoads; ++i)
+	{
+		IffView iff;
+		IGNORE_RETURN(iff.open(table));
+		DataTable dataTable;
+		dataTable.load(iff);
+	}
+	timer.stop();
+	viewTime = timer.getElapsedTime();
+
+	timer.start();
+	for (int i = 0; i < numberOfLoads; ++i)
+	{
+		Iff iff(table);
+		DataTable dataTable;
+		dataTable.load(iff);
+	}
+	timer.stop();
+	iffTime = timer.getElapsedTime();
+
+	return true;
+}
+
+// ======================================================================
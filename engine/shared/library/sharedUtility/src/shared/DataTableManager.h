@@ -11,6 +11,11 @@
 
 // ======================================================================
 
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 class DataTable;
 
 // ======================================================================
@@ -28,6 +33,8 @@ public:
 	static DataTable *        reloadIfOpen(const std::string& table);
 	static void               addReloadCallback(const std::string& table, DataTableReloadCallback callbackFunction);
 	static bool               isOpen(const std::string& table);
+	static void               getOpenTableNames(std::vector<std::string> & tableNames);
+	static bool               benchmarkLoad(char const * table, int numberOfLoads, float & viewTime, float & iffTime);
 
 private:
 	static void remove();
@@ -40,7 +47,9 @@ private:
 	static DataTable*                         m_cachedTable;
 	static std::string                        m_cachedTableName;
 	static bool                               m_errorChecking;
-	static std::map<std::string, DataTable *> m_tables;
+	typedef std::unordered_map<std::string, DataTable *> TableMap;
+
+	static TableMap                           m_tables;
 	static bool                               m_installed;
 	static std::multimap<std::string, DataTableReloadCallback> m_reloadCallbacks;
 };
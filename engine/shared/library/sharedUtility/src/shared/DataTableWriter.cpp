@@ -14,6 +14,7 @@
 #include "sharedFile/Iff.h"
 #include "sharedFoundation/ConstCharCrcString.h"
 #include "sharedUtility/DataTable.h"
+#include "sharedUtility/DataTableCell.h"
 #include "sharedXml/XmlTreeDocument.h"
 #include "sharedXml/XmlTreeDocumentList.h"
 #include "sharedXml/XmlTreeNode.h"
@@ -199,7 +200,10 @@ std::string DataTableWriterNamespace::getTableNameFromTabFile( const char* fileN
 
 // ----------------------------------------------------------------------
 
-DataTableWriter::DataTableWriter()
+DataTableWriter::DataTableWriter() :
+	m_tables(),
+	m_path(),
+	m_serverFormat(false)
 {
 }
 
@@ -650,13 +654,19 @@ void DataTableWriter::_saveTableToIff(Iff & iff, NamedDataTable * ndt) const
 
 	_checkIntegrity(ndt);
 	iff.insertForm(DataTable::getDataTableIffId());
-	iff.insertForm(TAG_0001);
+
+	// the client only reads 0001, so 0002 is written only when asked for
+	Tag const version = m_serverFormat ? TAG_0002 : TAG_0001;
+	iff.insertForm(version);
 
 	_saveColumns(ndt, iff);
 	_saveTypes(ndt, iff);
-	_saveRows(ndt, iff);
+	if (m_serverFormat)
+		_saveCells(ndt, iff);
+	else
+		_saveRows(ndt, iff);
 
-	iff.exitForm(TAG_0001);
+	iff.exitForm(version);
 	iff.exitForm();
 }
 
@@ -910,6 +920,120 @@ void DataTableWriter::_saveRows(NamedDataTable * ndt, Iff& iff) const
 
 // ----------------------------------------------------------------------
 
+/**
+ * Writes the cells a column at a time, with the strings interned into one
+ * pool and a prebuilt row index for every unique column.
+ */
+void DataTableWriter::_saveCells(NamedDataTable * ndt, Iff& iff) const
+{
+	int const numRows = ndt->getNumRows();
+
+	std::vector<char> strings(1, '\0');
+	std::vector<int32> stringOffsets(1, 0);
+	std::vector<int32> stringCrcs(1, 0);
+	std::map<std::string, int32> stringNumbers;
+
+	std::vector<int32> cells;
+	std::vector<int> indexedColumns;
+	std::vector<DataTable::RowIndex> indexes;
+	cells.reserve(static_cast<size_t>(ndt->getNumColumns() * numRows));
+
+	int savedColumn = 0;
+	for (int column = 0; column < ndt->getNumColumns(); ++column)
+	{
+		DataTableColumnType const & columnType = ndt->getDataTypeForColumn(column);
+		if (columnType.getType() == DataTableColumnType::DT_Comment)
+			continue;
+
+		std::vector<int32> keys(static_cast<size_t>(numRows));
+		size_t const firstCell = cells.size();
+		for (int row = 0; row < numRows; ++row)
+		{
+			const DataTableCell * cell = (*ndt->m_rows[static_cast<size_t>(row)])[static_cast<size_t>(column)];
+			NOT_NULL(cell);
+
+			int32 value = 0;
+			switch (columnType.getBasicType())
+			{
+			case DataTableColumnType::DT_Int:
+				value = cell->getIntValue();
+				keys[static_cast<size_t>(row)] = value;
+				break;
+			case DataTableColumnType::DT_Float:
+				{
+				float const tmp = cell->getFloatValue();
+				memcpy(&value, &tmp, sizeof(value));
+				keys[static_cast<size_t>(row)] = DataTable::getFloatIndexKey(tmp);
+				}
+				break;
+			case DataTableColumnType::DT_String:
+				{
+				char const * const tmp = cell->getStringValue();
+				if (*tmp)
+				{
+					std::pair<std::map<std::string, int32>::iterator, bool> const result = stringNumbers.insert(std::make_pair(std::string(tmp), static_cast<int32>(stringOffsets.size())));
+					if (result.second)
+					{
+						stringOffsets.push_back(static_cast<int32>(strings.size()));
+						stringCrcs.push_back(DataTable::calculateStringCrc(tmp));
+						strings.insert(strings.end(), tmp, tmp + strlen(tmp) + 1);
+					}
+					value = result.first->second;
+				}
+				keys[static_cast<size_t>(row)] = stringCrcs[static_cast<size_t>(value)];
+				}
+				break;
+			default:
+				FATAL(true, ("bad case"));
+				break;
+			}
+			cells.push_back(value);
+		}
+
+		if (columnType.areUniqueCellsRequired() && numRows > 0)
+		{
+			indexedColumns.push_back(savedColumn);
+			indexes.push_back(DataTable::RowIndex());
+			DataTable::buildRowIndex(indexes.back(), &cells[firstCell], &keys[0], numRows);
+		}
+
+		++savedColumn;
+	}
+
+	iff.insertChunk(TAG(S,T,R,S));
+	int const numStrings = static_cast<int>(stringOffsets.size());
+	int const stringBytes = static_cast<int>(strings.size());
+	iff.insertChunkData(&numStrings, sizeof(int));
+	iff.insertChunkData(&stringBytes, sizeof(int));
+	iff.insertChunkData(&stringOffsets[0], numStrings * static_cast<int>(sizeof(int32)));
+	iff.insertChunkData(&stringCrcs[0], numStrings * static_cast<int>(sizeof(int32)));
+	iff.insertChunkData(&strings[0], stringBytes);
+	iff.exitChunk(TAG(S,T,R,S));
+
+	iff.insertChunk(TAG(C,E,L,L));
+	iff.insertChunkData(&numRows, sizeof(int));
+	if (!cells.empty())
+		iff.insertChunkData(&cells[0], static_cast<int>(cells.size() * sizeof(int32)));
+	iff.exitChunk(TAG(C,E,L,L));
+
+	if (!indexes.empty())
+	{
+		iff.insertChunk(TAG(I,N,D,X));
+		int const numIndexes = static_cast<int>(indexes.size());
+		iff.insertChunkData(&numIndexes, sizeof(int));
+		for (size_t i = 0; i < indexes.size(); ++i)
+		{
+			int const numBuckets = static_cast<int>(indexes[i].size());
+			iff.insertChunkData(&indexedColumns[i], sizeof(int));
+			iff.insertChunkData(&numBuckets, sizeof(int));
+			iff.insertChunkData(&indexes[i][0], numBuckets * static_cast<int>(sizeof(int32)));
+		}
+		iff.exitChunk(TAG(I,N,D,X));
+	}
+}
+
+// ----------------------------------------------------------------------
+
 bool DataTableWriter::_checkIntegrity(const NamedDataTable * ndt) const
 {
 	FATAL(ndt->m_columns.empty(), ("empty columns"));
@@ -980,6 +1104,17 @@ void DataTableWriter::setOutputPath(const char * path)
 	m_path = path;
 }
 
+// ----------------------------------------------------------------------
+/**
+ * Selects the version 0002 layout (string pool, column-ordered cells and
+ * prebuilt indexes).  The client can not read it, so it must only be used
+ * for tables that are never shipped to the client.
+ */
+void DataTableWriter::setServerFormat(bool serverFormat)
+{
+	m_serverFormat = serverFormat;
+}
+
 // ----------------------------------------------------------------------
 
 void DataTableWriter::getTableNames(std::vector<std::string> & v) const
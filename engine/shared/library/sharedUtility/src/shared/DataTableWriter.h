@@ -27,6 +27,7 @@ public:
 	~DataTableWriter();
 
 	void setOutputPath (const char * path);
+	void setServerFormat (bool serverFormat);
 	void loadFromSpreadsheet (const char * filename);
 
 	bool save (const char * outputFileName, bool optional = false) const;
@@ -62,6 +63,7 @@ private:
 	void _saveColumns(NamedDataTable * ndt, Iff& iff) const;
 	void _saveTypes(NamedDataTable * ndt, Iff& iff) const;
 	void _saveRows(NamedDataTable * ndt, Iff& iff) const;
+	void _saveCells(NamedDataTable * ndt, Iff& iff) const;
 
 	bool _writeTable(NamedDataTable * ndt, const char * outputFile, bool optional) const;
   	void _saveTableToIff(Iff & iff, NamedDataTable * ndt) const;
@@ -70,6 +72,7 @@ private:
 	
 	NamedDataTableList m_tables;
 	std::string m_path;
+	bool m_serverFormat;
 };
 
 //----------------------------------------------------------------------
@@ -15,6 +15,12 @@
 #include "sharedFoundation/DynamicVariableList.h"
 #include "sharedMath/Vector.h"
 
+//========================================================================
+// class TemplateParamResolution
+
+std::atomic<int> TemplateParamResolution::ms_generation(0);
+std::atomic<int> TemplateParamResolution::ms_randomDrawCount(0);
+
 //========================================================================
 // class IntegerParam
 
@@ -24,8 +30,35 @@
 IntegerParam::IntegerParam(void) : TemplateBase<int, int>(),
 	m_dataDeltaType(' ')
 {
+	for (int i = 0; i < 3; ++i)
+		m_resolved[i] = TemplateParamResolution::packResolved(TemplateParamResolution::getGeneration() - 1, 0);
 }	// IntegerParam::IntegerParam
 
+/**
+ * Copy constructor. Resolved values are not copied, the copy resolves its own.
+ */
+IntegerParam::IntegerParam(const IntegerParam & rhs) : TemplateBase<int, int>(rhs),
+	m_dataDeltaType(rhs.m_dataDeltaType)
+{
+	for (int i = 0; i < 3; ++i)
+		m_resolved[i] = TemplateParamResolution::packResolved(TemplateParamResolution::getGeneration() - 1, 0);
+}	// IntegerParam::IntegerParam(const IntegerParam &)
+
+/**
+ * Assignment operator. Drops this param's resolved values.
+ */
+IntegerParam & IntegerParam::operator =(const IntegerParam & rhs)
+{
+	if (&rhs != this)
+	{
+		TemplateBase<int, int>::operator =(rhs);
+		m_dataDeltaType = rhs.m_dataDeltaType;
+		for (int i = 0; i < 3; ++i)
+			m_resolved[i] = TemplateParamResolution::packResolved(TemplateParamResolution::getGeneration() - 1, 0);
+	}
+	return *this;
+}	// IntegerParam::operator =
+
 /**
  * Class destructor.
  */
@@ -193,8 +226,35 @@ int32 intData;
 FloatParam::FloatParam(void) : TemplateBase<float, float>(),
 	m_dataDeltaType(' ')
 {
+	for (int i = 0; i < 3; ++i)
+		m_resolved[i] = TemplateParamResolution::packResolved(TemplateParamResolution::getGeneration() - 1, 0);
 }	// FloatParam::FloatParam
 
+/**
+ * Copy constructor. Resolved values are not copied, the copy resolves its own.
+ */
+FloatParam::FloatParam(const FloatParam & rhs) : TemplateBase<float, float>(rhs),
+	m_dataDeltaType(rhs.m_dataDeltaType)
+{
+	for (int i = 0; i < 3; ++i)
+		m_resolved[i] = TemplateParamResolution::packResolved(TemplateParamResolution::getGeneration() - 1, 0);
+}	// FloatParam::FloatParam(const FloatParam &)
+
+/**
+ * Assignment operator. Drops this param's resolved values.
+ */
+FloatParam & FloatParam::operator =(const FloatParam & rhs)
+{
+	if (&rhs != this)
+	{
+		TemplateBase<float, float>::operator =(rhs);
+		m_dataDeltaType = rhs.m_dataDeltaType;
+		for (int i = 0; i < 3; ++i)
+			m_resolved[i] = TemplateParamResolution::packResolved(TemplateParamResolution::getGeneration() - 1, 0);
+	}
+	return *this;
+}	// FloatParam::operator =
+
 /**
  * Class destructor.
  */
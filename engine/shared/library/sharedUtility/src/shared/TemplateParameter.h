@@ -16,11 +16,91 @@
 #include "sharedRandom/Random.h"
 #include "StringId.h"
 
+#include <atomic>
+#include <cstring>
 #include <string>
 #include <vector>
 
 class Vector;
 
+//========================================================================
+// class TemplateParamResolution
+//
+// Generated template getters resolve int and float parameters by walking
+// the base template chain and applying deltas. The resolved value is cached
+// on the derived template's parameter, provided no random draw (weighted
+// list, range or die roll) was made while resolving it.
+//
+// Loading a template never changes a value already cached: a template's base
+// chain is loaded with it and stays referenced while it lives. Only reloading
+// a template in place does, so ObjectTemplateList::reload drops every cached
+// value. Templates may be loaded and read from more than one thread, hence
+// the atomics; each cached value is stored together with its generation in
+// one 64 bit atomic, so a reader never pairs a value with the wrong one.
+
+class TemplateParamResolution
+{
+public:
+	static int  getGeneration(void);
+	static void invalidate(void);
+
+	static int  getRandomDrawCount(void);
+	static void noteRandomDraw(void);
+
+	static uint64 packResolved(int generation, uint32 valueBits);
+	static bool   unpackResolved(uint64 resolved, uint32 & valueBits);
+
+private:
+	static std::atomic<int> ms_generation;
+	static std::atomic<int> ms_randomDrawCount;
+};
+
+inline int TemplateParamResolution::getGeneration(void)
+{
+	return ms_generation;
+}
+
+/**
+ * Drops every cached value. The draw count is bumped first so that a value
+ * being resolved while this runs is either not stored, or stored under the
+ * old generation.
+ */
+inline void TemplateParamResolution::invalidate(void)
+{
+	++ms_randomDrawCount;
+	++ms_generation;
+}
+
+inline int TemplateParamResolution::getRandomDrawCount(void)
+{
+	return ms_randomDrawCount;
+}
+
+inline void TemplateParamResolution::noteRandomDraw(void)
+{
+	++ms_randomDrawCount;
+}
+
+/**
+ * Packs a resolved value with the generation it was resolved under, so both
+ * can be published to other threads with a single atomic store.
+ */
+inline uint64 TemplateParamResolution::packResolved(int generation, uint32 valueBits)
+{
+	return (static_cast<uint64>(static_cast<uint32>(generation)) << 32) | valueBits;
+}
+
+/**
+ * @return true if the packed value was resolved under the current generation
+ */
+inline bool TemplateParamResolution::unpackResolved(uint64 resolved, uint32 & valueBits)
+{
+	if (static_cast<uint32>(resolved >> 32) != static_cast<uint32>(getGeneration()))
+		return false;
+	valueBits = static_cast<uint32>(resolved);
+	return true;
+}
+
 //========================================================================
 template <class DataType, class ReturnType>
 class TemplateBase
@@ -253,6 +333,7 @@ inline ReturnType TemplateBase<DataType, ReturnType>::getValue(void) const
 		return getSingle();
 	case WEIGHTED_LIST:
 	{
+		TemplateParamResolution::noteRandomDraw();
 		int weight = Random::random(1, 100);
 		typename WeightedList::const_iterator end = m_data.weightedList->end();
 		for (typename WeightedList::const_iterator iter = m_data.weightedList->begin();
@@ -270,8 +351,10 @@ inline ReturnType TemplateBase<DataType, ReturnType>::getValue(void) const
 	}
 	break;
 	case RANGE:
+		TemplateParamResolution::noteRandomDraw();
 		return getRange();
 	case DIE_ROLL:
+		TemplateParamResolution::noteRandomDraw();
 		return getDieRoll();
 	case NONE:
 	default:
@@ -446,8 +529,11 @@ class IntegerParam : public TemplateBase<int, int>
 {
 public:
 	IntegerParam(void);
+	IntegerParam(const IntegerParam & rhs);
 	virtual ~IntegerParam();
 
+	IntegerParam & operator =(const IntegerParam & rhs);
+
 	virtual void loadFromIff(Iff &file);
 	virtual void saveToIff(Iff &file) const;
 
@@ -465,6 +551,9 @@ public:
 	const DieRoll * getDieRollStruct(void) const;
 	const Range * getRangeStruct(void) const;
 
+	bool getResolvedValue(int slot, int & value) const;
+	int storeResolvedValue(int slot, int randomDrawCount, int value) const;
+
 protected:
 	virtual TemplateBase<int, int> * createNewParam(void);
 	virtual int                      getRange(void) const;
@@ -473,6 +562,10 @@ protected:
 private:
 	char m_dataDeltaType;		// if '+' or '-', this param is a delta on a
 								// derived template param
+
+	// values resolved through the base template chain by the generated
+	// getters, indexed by get/getMin/getMax, packed with their generation
+	mutable std::atomic<uint64> m_resolved[3];
 };
 
 inline char IntegerParam::getDeltaType(void) const
@@ -483,6 +576,42 @@ inline char IntegerParam::getDeltaType(void) const
 inline void IntegerParam::setDeltaType(char type)
 {
 	m_dataDeltaType = type;
+	TemplateParamResolution::invalidate();
+}
+
+/**
+ * Gets the value a generated getter last resolved for this param.
+ *
+ * @param slot		0 for get, 1 for getMin, 2 for getMax
+ * @param value		receives the resolved value
+ *
+ * @return true if a value is cached and no template has changed since
+ */
+inline bool IntegerParam::getResolvedValue(int slot, int & value) const
+{
+	uint32 valueBits = 0;
+	if (!TemplateParamResolution::unpackResolved(m_resolved[slot], valueBits))
+		return false;
+	value = static_cast<int>(valueBits);
+	return true;
+}
+
+/**
+ * Caches the value a generated getter resolved for this param. The value is
+ * not cached if a random draw was made since randomDrawCount was read.
+ *
+ * @param slot				0 for get, 1 for getMin, 2 for getMax
+ * @param randomDrawCount	the random draw count before the value was resolved
+ * @param value				the resolved value
+ *
+ * @return value
+ */
+inline int IntegerParam::storeResolvedValue(int slot, int randomDrawCount, int value) const
+{
+	const int generation = TemplateParamResolution::getGeneration();
+	if (randomDrawCount == TemplateParamResolution::getRandomDrawCount())
+		m_resolved[slot] = TemplateParamResolution::packResolved(generation, static_cast<uint32>(value));
+	return value;
 }
 
 inline TemplateBase<int, int> *IntegerParam::createNewParam(void)
@@ -560,8 +689,11 @@ class FloatParam : public TemplateBase<float, float>
 {
 public:
 	FloatParam(void);
+	FloatParam(const FloatParam & rhs);
 	virtual ~FloatParam();
 
+	FloatParam & operator =(const FloatParam & rhs);
+
 	virtual void loadFromIff(Iff &file);
 	virtual void saveToIff(Iff &file) const;
 
@@ -577,6 +709,9 @@ public:
 
 	const Range * getRangeStruct(void) const;
 
+	bool getResolvedValue(int slot, float & value) const;
+	float storeResolvedValue(int slot, int randomDrawCount, float value) const;
+
 protected:
 	virtual TemplateBase<float, float> * createNewParam(void);
 	virtual float                        getRange(void) const;
@@ -584,6 +719,10 @@ protected:
 private:
 	char m_dataDeltaType;		// if '+' or '-', this param is a delta on a
 								// derived template param
+
+	// values resolved through the base template chain by the generated
+	// getters, indexed by get/getMin/getMax, packed with their generation
+	mutable std::atomic<uint64> m_resolved[3];
 };
 
 inline char FloatParam::getDeltaType(void) const
@@ -594,6 +733,46 @@ inline char FloatParam::getDeltaType(void) const
 inline void FloatParam::setDeltaType(char type)
 {
 	m_dataDeltaType = type;
+	TemplateParamResolution::invalidate();
+}
+
+/**
+ * Gets the value a generated getter last resolved for this param.
+ *
+ * @param slot		0 for get, 1 for getMin, 2 for getMax
+ * @param value		receives the resolved value
+ *
+ * @return true if a value is cached and no template has changed since
+ */
+inline bool FloatParam::getResolvedValue(int slot, float & value) const
+{
+	uint32 valueBits = 0;
+	if (!TemplateParamResolution::unpackResolved(m_resolved[slot], valueBits))
+		return false;
+	memcpy(&value, &valueBits, sizeof(value));
+	return true;
+}
+
+/**
+ * Caches the value a generated getter resolved for this param. The value is
+ * not cached if a random draw was made since randomDrawCount was read.
+ *
+ * @param slot				0 for get, 1 for getMin, 2 for getMax
+ * @param randomDrawCount	the random draw count before the value was resolved
+ * @param value				the resolved value
+ *
+ * @return value
+ */
+inline float FloatParam::storeResolvedValue(int slot, int randomDrawCount, float value) const
+{
+	const int generation = TemplateParamResolution::getGeneration();
+	if (randomDrawCount == TemplateParamResolution::getRandomDrawCount())
+	{
+		uint32 valueBits = 0;
+		memcpy(&valueBits, &value, sizeof(valueBits));
+		m_resolved[slot] = TemplateParamResolution::packResolved(generation, valueBits);
+	}
+	return value;
 }
 
 inline TemplateBase<float, float> *FloatParam::createNewParam(void)
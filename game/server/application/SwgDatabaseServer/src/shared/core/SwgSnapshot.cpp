@@ -156,6 +156,28 @@ bool SwgSnapshot::saveToDB(DB::Session *session) {
 
 // ----------------------------------------------------------------------
 
+/**
+ * Whether a delta for this field can replace an earlier one without
+ * decoding it.  The per-package tables are generated with the decoders.
+ */
+
+bool SwgSnapshot::isLatestValueField(unsigned char packageId, Tag typeId, uint16 index) const {
+    switch (packageId) {
+        case DeltasMessage::DELTAS_SERVER:
+            return isLatestValueServerData(typeId, index);
+        case DeltasMessage::DELTAS_SHARED:
+            return isLatestValueSharedData(typeId, index);
+        case DeltasMessage::DELTAS_CLIENT_SERVER:
+            return isLatestValueClientData(typeId, index);
+        case DeltasMessage::DELTAS_FIRST_PARENT_CLIENT_SERVER:
+            return isLatestValueParentClientData(typeId, index);
+        default:
+            return false;
+    }
+}
+
+// ----------------------------------------------------------------------
+
 /**
  * Called when a message is received to update an object's transform and container.
  *
@@ -1172,6 +1194,10 @@ void SwgSnapshot::handleBountyHunterTargetMessage(const BountyHunterTargetMessag
 
 void
 SwgSnapshot::getMoneyFromOfflineObject(uint32 replyServer, NetworkId const &sourceObject, int amount, NetworkId const &replyTo, std::string const &successCallback, std::string const &failCallback, std::vector <int8> const &packedDictionary) {
+    // Decode any coalesced balance deltas first, otherwise this reads stale balances
+    // and the pending values would later overwrite the result.
+    flushPendingDeltas(sourceObject);
+
     // Object might be "offline" but still buffered.  Try to handle it in memory first:
     if (!m_objectTableBuffer.getMoneyFromOfflineObject(replyServer, sourceObject, amount, replyTo, successCallback, failCallback, packedDictionary)) {
         // Object is offline.  Handle it in the DB
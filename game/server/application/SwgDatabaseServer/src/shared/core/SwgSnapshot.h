@@ -218,6 +218,12 @@ protected:
 	virtual void decodeSharedData(NetworkId const & objectId, Tag typeId, uint16 index, Archive::ReadIterator &bs, bool isBaseline);
 	virtual void decodeClientData(NetworkId const & objectId, Tag typeId, uint16 index, Archive::ReadIterator &bs, bool isBaseline);
 	virtual void decodeParentClientData(NetworkId const & objectId, Tag typeId, uint16 index, Archive::ReadIterator &bs, bool isBaseline);
+
+	virtual bool isLatestValueField(unsigned char packageId, Tag typeId, uint16 index) const;
+	static bool isLatestValueServerData(Tag typeId, uint16 index);
+	static bool isLatestValueSharedData(Tag typeId, uint16 index);
+	static bool isLatestValueClientData(Tag typeId, uint16 index);
+	static bool isLatestValueParentClientData(Tag typeId, uint16 index);
 	
 	virtual bool encodeParentClientData(NetworkId const & objectId, Tag typeId, std::vector<BatchBaselinesMessageData> &baselines) const;
 	virtual bool encodeClientData(NetworkId const & objectId, Tag typeId, std::vector<BatchBaselinesMessageData> &baselines) const;